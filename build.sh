@@ -2,9 +2,15 @@
 rm -f unicensd
 mkdir -p out
 cd out
-cmake ..
+cmake "$@" ..
 make
 mv unicensd ..
 mv xml2struct ..
 mv unicensc ..
+mv ucsxml-bench ..
+mv unicens-status ..
+mv unicens-logdecode ..
+mv unicens-lldtrace ..
+mv unicens-inicsim ..
+mv unicens-vsim ..
 
@@ -35,9 +35,13 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include "CdevHandler.h"
 
 static void *ReceiveThread(void *tag);
+static int OpenCdev(CdevData_t *d);
+static void CloseCdev(CdevData_t *d);
 
 bool Cdev_Init(CdevData_t *d, const char *fileName, bool read, bool write)
 {
@@ -73,15 +77,19 @@ bool Cdev_Write(CdevData_t *d, const uint8_t *pData, uint32_t len)
     if (NULL == d || NULL == pData || 0 == len) return false;
     if (O_RDONLY == d->fileFlags) return false;
     if (-1 == d->fileHandle)
-        d->fileHandle = open(d->fileName, d->fileFlags);
+        d->fileHandle = OpenCdev(d);
     if (-1 == d->fileHandle)
         return false;
     while(total < len)
     {
-        ssize_t written = write(d->fileHandle, &pData[total], (len - total));
+        ssize_t written;
+        if (d->isSocket)
+            written = send(d->fileHandle, &pData[total], (len - total), MSG_NOSIGNAL);
+        else
+            written = write(d->fileHandle, &pData[total], (len - total));
         if (0 >= written)
         {
-            d->fileHandle = -1;
+            CloseCdev(d);
             return false;
         }
         total += written;
@@ -196,7 +204,7 @@ static void *ReceiveThread(void *tag)
     {
         ssize_t rx;
         if (-1 == d->fileHandle)
-            d->fileHandle = open(d->fileName, d->fileFlags);
+            d->fileHandle = OpenCdev(d);
         if (-1 == d->fileHandle)
         {
             sleep(1);
@@ -206,7 +214,7 @@ static void *ReceiveThread(void *tag)
         rx = read(d->fileHandle, d->rxBuffer, sizeof(d->rxBuffer));
         if (0 >= rx)
         {
-            d->fileHandle = -1;
+            CloseCdev(d);
             continue;
         }
         d->rxLen = rx;
@@ -215,4 +223,38 @@ static void *ReceiveThread(void *tag)
     }
     d->rxThreadRuns = false;
     return tag;
-}
\ No newline at end of file
+}
+
+/* A Unix socket (e.g. of unicens-inicsim) is connected instead of opened, it must be of
+ * type SOCK_SEQPACKET, so that every read returns exactly one port message like a CDEV */
+static int OpenCdev(CdevData_t *d)
+{
+    struct stat st;
+    struct sockaddr_un addr;
+    int fd;
+    d->isSocket = (0 == stat(d->fileName, &st) && S_ISSOCK(st.st_mode));
+    if (!d->isSocket)
+        return open(d->fileName, d->fileFlags);
+    if (sizeof(addr.sun_path) <= strlen(d->fileName))
+        return -1;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, d->fileName);
+    fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (-1 == fd)
+        return -1;
+    if (0 != connect(fd, (struct sockaddr *)&addr, sizeof(addr)))
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void CloseCdev(CdevData_t *d)
+{
+    if (-1 != d->fileHandle)
+        close(d->fileHandle);
+    d->fileHandle = -1;
+    Cdev_CB_OnReopen();
+}
@@ -51,6 +51,7 @@ typedef struct
     bool rxThreadRuns;
     int fileHandle;
     int fileFlags;
+    bool isSocket;
     char fileName[MAX_FILENAME_LEN];
     uint8_t rxBuffer[RX_BUFFER];
     uint32_t rxLen;
@@ -62,7 +63,8 @@ typedef struct
  * \brief Initialize this component.
  * \note Do not call any function of this component, before calling this function.
  * \param d - Pointer to external allocated memory holding the structure needed by this component.
- * \param fileName - Full path to the CDEV (e.g. "/dev/inic-usb-ctx").
+ * \param fileName - Full path to the CDEV (e.g. "/dev/inic-usb-ctx"). A Unix socket of type SOCK_SEQPACKET
+ *                   (e.g. of unicens-inicsim) is connected instead.
  * \param read - true, if CDEV supports read access.
  * \param write - true, if CDEV supports write access.
  * \note Microchips MOST Linux driver forms for RX and TX different CDEVs.
@@ -129,6 +131,13 @@ const char *GetErrnoString();
  */
 extern void Cdev_CB_OnDataAvailable(void);
 
+/**
+ * \brief Callback when ever the CDEV was closed after an error. It is opened again with the next access.
+ * \note This function must be implemented by the integrator.
+ * \note Do not call any functions of this component inside this callback.
+ */
+extern void Cdev_CB_OnReopen(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -28,14 +28,130 @@
 /* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
 /*------------------------------------------------------------------------------------------------*/
 #include <stdio.h>
+#include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 #include "Console.h"
 
 #ifdef ANDROID
 #define SERVICE_NAME "unicens"
 #include <android/log.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <stddef.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include "ConsoleBinary.h"
+#endif
+
+#ifndef ANDROID
+/* Every logging thread owns a ring, must be a power of two */
+#define RING_SIZE       (0x10000)
+/* Longest single message and longest block formed by Start, Continue and Exit */
+#define LINE_LEN        (4096)
+/* Amount of messages written with a single writev */
+#define BATCH_SIZE      (64)
+#define REC_ALIGN       (8)
+#define REC_PADDING     (0x1)
+#define REC_ERROR       (0x2)
+/* Record holds one or more BinEvent_t instead of text */
+#define REC_BINARY      (0x4)
+/* Format strings known by the binary file, must be a power of two */
+#define DICT_SIZE       (4096)
+#define BIN_BUF_SIZE    (0x10000)
+
+/*! \cond PRIVATE */
+typedef struct
+{
+    /**Global order of the messages, the writer merges the rings by it.*/
+    uint32_t seq;
+    uint16_t len;
+    uint16_t flags;
+} Record_t;
+
+/* Binary event as stored in the ring, the writer replaces the format pointer by its ID */
+typedef struct
+{
+    const char *format;
+    uint64_t timeUs;
+    uint16_t argsLen;
+    uint8_t prio;
+    uint8_t flags;
+    uint32_t reserved;
+} BinEvent_t;
+
+typedef struct
+{
+    const char *format;
+    uint32_t id;
+} DictEntry_t;
+
+typedef struct Ring
+{
+    /**All rings ever created, rings are reused but never freed.*/
+    struct Ring *next;
+    /**Set when the owning thread terminated, another thread may take over.*/
+    uint32_t isFree;
+    /**Free running byte counters, head is written by the owner only, tail by the writer only.*/
+    uint32_t head;
+    uint32_t tail;
+    /**Messages discarded, because the ring was full.*/
+    uint32_t dropped;
+    /**Writer only: read position and head seen by the current batch.*/
+    uint32_t cursor;
+    uint32_t batchHead;
+    /**Owner only: prio of the block started by ConsolePrintfStart and the block itself.*/
+    ConsolePrio_t contPrio;
+    bool blockBinary;
+    uint32_t blockLen;
+    char block[LINE_LEN];
+    char line[LINE_LEN];
+    uint8_t buffer[RING_SIZE];
+} Ring_t;
+/*! \endcond */
+
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t ringKey;
+static bool asyncRuns = false;
+static Ring_t *rings = NULL;
+static uint32_t nextSeq = 0;
+static uint32_t wakeupPending = 0;
+static sem_t wakeupSem;
+static pthread_mutex_t drainMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t writerThread;
+/* Set once by ConsoleSetBinaryFile, the remaining binary state is owned by the writer */
+static bool binaryMode = false;
+static int binFd = -1;
+static uint32_t binLen = 0;
+static uint8_t binBuf[BIN_BUF_SIZE];
+static uint32_t nextFormatId = 0;
+static DictEntry_t dict[DICT_SIZE];
+
+static void StartWriter(void);
+static Ring_t *GetRing(void);
+static void OnThreadExit(void *ptr);
+static void Enqueue(Ring_t *r, uint16_t flags, const char *pData, uint32_t len);
+static void AppendBlock(Ring_t *r, bool isLast, const char *statement, va_list args);
+static void CommitBlock(Ring_t *r, bool isFinished);
+static uint64_t GetTimeUs(clockid_t clock);
+static uint32_t EncodeEvent(char *pBuf, uint32_t size, bool allowCut, ConsolePrio_t prio, uint8_t flags, const char *statement, va_list args);
+static bool EncodeArgs(uint8_t *pBuf, uint32_t size, uint32_t *pLen, const char *statement, va_list args);
+static bool PutArg(uint8_t *pBuf, uint32_t size, uint32_t *pLen, uint8_t type, const void *pData, uint16_t dataLen);
+static void *WriterThread(void *arg);
+static bool Drain(void);
+static bool NextRecord(Ring_t *r, Record_t **ppRec);
+static void WriteAll(int fd, struct iovec *pIov, int iovCnt);
+static void ReportDropped(void);
+static void WriteBinary(const Record_t *rec);
+static uint32_t GetFormatId(const char *format);
+static void PutBinary(const void *pData, uint32_t len);
+static void FlushBinary(void);
 #endif
 
 /*! \cond PRIVATE */
@@ -43,7 +159,8 @@ typedef struct
 {
     /**Minimum priority to be printed. If lower, message will be discarded.*/
     ConsolePrio_t minPrio;
-    /**If is in a critical segmented print, this variable will hold the prio for Start, Continue, Exit.*/
+    /**If is in a critical segmented print, this variable will hold the prio for Start, Continue, Exit.
+     * Only used, if the asynchronous writer is not running.*/
     ConsolePrio_t contPrio;
 } LocalData_t;
 /*! \endcond */
@@ -55,6 +172,11 @@ void ConsoleSetPrio( ConsolePrio_t prio )
     data.minPrio = prio;
 }
 
+bool ConsoleIsEnabled( ConsolePrio_t prio )
+{
+    return ( prio >= data.minPrio );
+}
+
 void ConsolePrintf( ConsolePrio_t prio, const char *statement, ... )
 {
     va_list args;
@@ -62,17 +184,62 @@ void ConsolePrintf( ConsolePrio_t prio, const char *statement, ... )
         return;
 
     va_start( args, statement );
+    ConsoleVPrintf( prio, statement, args );
+    va_end( args );
+}
+
+void ConsoleVPrintf( ConsolePrio_t prio, const char *statement, va_list args )
+{
+#ifndef ANDROID
+    Ring_t *r;
+#endif
+    if( prio < data.minPrio || NULL == statement )
+        return;
+
 #ifdef ANDROID
     __android_log_vprint( PRIO_ERROR == prio ? ANDROID_LOG_ERROR : ANDROID_LOG_INFO, SERVICE_NAME, statement, args );
 #else
-    vfprintf( (PRIO_ERROR == prio ? stderr : stdout), statement, args );
+    r = GetRing();
+    if( NULL != r )
+    {
+        if( ConsoleIsBinary() && PRIO_ERROR != prio )
+        {
+            uint32_t len = EncodeEvent( r->line, LINE_LEN, true, prio, 0, statement, args );
+            if( 0 != len )
+                Enqueue( r, REC_BINARY, r->line, len );
+        }
+        else
+        {
+            int len = vsnprintf( r->line, LINE_LEN, statement, args );
+            if( 0 < len )
+                Enqueue( r, ( PRIO_ERROR == prio ) ? REC_ERROR : 0, r->line,
+                    ( LINE_LEN <= len ) ? LINE_LEN - 1 : (uint32_t)len );
+        }
+    }
+    else
+        vfprintf( (PRIO_ERROR == prio ? stderr : stdout), statement, args );
 #endif
-    va_end( args );
 }
 
 void ConsolePrintfStart( ConsolePrio_t prio, const char *statement, ... )
 {
     va_list args;
+#ifndef ANDROID
+    Ring_t *r = GetRing();
+    if( NULL != r )
+    {
+        /* A block without ConsolePrintfExit is finished by the next one */
+        CommitBlock( r, true );
+        r->contPrio = prio;
+        r->blockBinary = ( ConsoleIsBinary() && PRIO_ERROR != prio );
+        if( r->contPrio < data.minPrio || NULL == statement )
+            return;
+        va_start( args, statement );
+        AppendBlock( r, false, statement, args );
+        va_end( args );
+        return;
+    }
+#endif
     data.contPrio = prio;
     if( data.contPrio < data.minPrio || NULL == statement )
         return;
@@ -89,6 +256,18 @@ void ConsolePrintfStart( ConsolePrio_t prio, const char *statement, ... )
 void ConsolePrintfContinue( const char *statement, ... )
 {
     va_list args;
+#ifndef ANDROID
+    Ring_t *r = GetRing();
+    if( NULL != r )
+    {
+        if( r->contPrio < data.minPrio || NULL == statement )
+            return;
+        va_start( args, statement );
+        AppendBlock( r, false, statement, args );
+        va_end( args );
+        return;
+    }
+#endif
     if( data.contPrio < data.minPrio || NULL == statement )
         return;
 
@@ -104,6 +283,20 @@ void ConsolePrintfContinue( const char *statement, ... )
 void ConsolePrintfExit( const char *statement, ... )
 {
     va_list args;
+#ifndef ANDROID
+    Ring_t *r = GetRing();
+    if( NULL != r )
+    {
+        if( r->contPrio >= data.minPrio && NULL != statement )
+        {
+            va_start( args, statement );
+            AppendBlock( r, true, statement, args );
+            va_end( args );
+        }
+        CommitBlock( r, true );
+        return;
+    }
+#endif
     if( data.contPrio < data.minPrio || NULL == statement )
         return;
 
@@ -115,3 +308,620 @@ void ConsolePrintfExit( const char *statement, ... )
 #endif
     va_end( args );
 }
+
+bool ConsoleSetBinaryFile( const char *fileName )
+{
+#ifdef ANDROID
+    fileName = fileName;
+    return false;
+#else
+    ConsoleBinHeader_t header;
+    struct iovec iov;
+    if( NULL == fileName || ConsoleIsBinary() )
+        return false;
+    /* Binary events are written by the background thread only */
+    pthread_once( &once, StartWriter );
+    if( !asyncRuns )
+        return false;
+    binFd = open( fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+    if( 0 > binFd )
+        return false;
+    memset( &header, 0, sizeof(header) );
+    memcpy( header.magic, CONSOLE_BIN_MAGIC, sizeof(CONSOLE_BIN_MAGIC) );
+    header.byteOrder = CONSOLE_BIN_BYTE_ORDER;
+    header.version = CONSOLE_BIN_VERSION;
+    header.realTimeUs = GetTimeUs( CLOCK_REALTIME );
+    header.monotonicUs = GetTimeUs( CLOCK_MONOTONIC );
+    iov.iov_base = &header;
+    iov.iov_len = sizeof(header);
+    WriteAll( binFd, &iov, 1 );
+    __atomic_store_n( &binaryMode, true, __ATOMIC_RELEASE );
+    return true;
+#endif
+}
+
+bool ConsoleIsBinary( void )
+{
+#ifdef ANDROID
+    return false;
+#else
+    return __atomic_load_n( &binaryMode, __ATOMIC_ACQUIRE );
+#endif
+}
+
+void ConsoleFlush( void )
+{
+#ifndef ANDROID
+    if( !asyncRuns )
+        return;
+    pthread_mutex_lock( &drainMutex );
+    while( Drain() );
+    pthread_mutex_unlock( &drainMutex );
+#endif
+}
+
+#ifndef ANDROID
+/*----------------------------------------------------------*/
+/*                  PRIVATE FUNCTIONS                       */
+/*----------------------------------------------------------*/
+
+static void StartWriter(void)
+{
+    if( 0 != pthread_key_create( &ringKey, OnThreadExit ) )
+        return;
+    if( 0 != sem_init( &wakeupSem, 0, 0 ) )
+        return;
+    if( 0 != pthread_create( &writerThread, NULL, WriterThread, NULL ) )
+        return;
+    pthread_detach( writerThread );
+    atexit( ConsoleFlush );
+    asyncRuns = true;
+}
+
+static Ring_t *GetRing(void)
+{
+    Ring_t *r;
+    pthread_once( &once, StartWriter );
+    if( !asyncRuns )
+        return NULL;
+    r = (Ring_t *)pthread_getspecific( ringKey );
+    if( NULL != r )
+        return r;
+    /* Take over the ring of a terminated thread, its remaining messages are still written */
+    for( r = __atomic_load_n( &rings, __ATOMIC_ACQUIRE ); NULL != r; r = r->next )
+    {
+        uint32_t isFree = 1;
+        if( __atomic_compare_exchange_n( &r->isFree, &isFree, 0, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) )
+            break;
+    }
+    if( NULL == r )
+    {
+        r = (Ring_t *)calloc( 1, sizeof(Ring_t) );
+        if( NULL == r )
+            return NULL;
+        r->next = __atomic_load_n( &rings, __ATOMIC_RELAXED );
+        while( !__atomic_compare_exchange_n( &rings, &r->next, r, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED ) );
+    }
+    r->blockLen = 0;
+    pthread_setspecific( ringKey, r );
+    return r;
+}
+
+static void OnThreadExit(void *ptr)
+{
+    Ring_t *r = (Ring_t *)ptr;
+    CommitBlock( r, true );
+    __atomic_store_n( &r->isFree, 1, __ATOMIC_RELEASE );
+}
+
+static void Enqueue(Ring_t *r, uint16_t flags, const char *pData, uint32_t len)
+{
+    Record_t *rec;
+    uint32_t head = r->head;
+    uint32_t tail = __atomic_load_n( &r->tail, __ATOMIC_ACQUIRE );
+    uint32_t need = ( sizeof(Record_t) + len + REC_ALIGN - 1 ) & ~( REC_ALIGN - 1 );
+    uint32_t offset = head & ( RING_SIZE - 1 );
+    /* Records never wrap, the rest of the ring is skipped by a padding record instead */
+    uint32_t padding = ( RING_SIZE - offset < need ) ? RING_SIZE - offset : 0;
+    if( RING_SIZE - ( head - tail ) < need + padding )
+    {
+        __atomic_fetch_add( &r->dropped, 1, __ATOMIC_RELAXED );
+        return;
+    }
+    if( 0 != padding )
+    {
+        rec = (Record_t *)&r->buffer[offset];
+        rec->flags = REC_PADDING;
+        head += padding;
+        offset = 0;
+    }
+    rec = (Record_t *)&r->buffer[offset];
+    rec->seq = __atomic_fetch_add( &nextSeq, 1, __ATOMIC_RELAXED );
+    rec->len = len;
+    rec->flags = flags;
+    memcpy( &rec[1], pData, len );
+    __atomic_store_n( &r->head, head + need, __ATOMIC_RELEASE );
+    /* Only the first message after the writer woke up needs to post */
+    if( 0 == __atomic_exchange_n( &wakeupPending, 1, __ATOMIC_ACQ_REL ) )
+        sem_post( &wakeupSem );
+}
+
+static void AppendBlock(Ring_t *r, bool isLast, const char *statement, va_list args)
+{
+    int len;
+    va_list retry;
+    va_copy( retry, args );
+    if( r->blockBinary )
+    {
+        /* Every part is kept as an event of its own, the decoder joins them */
+        uint8_t flags = isLast ? 0 : CONSOLE_BIN_FLAG_PART;
+        len = EncodeEvent( &r->block[r->blockLen], LINE_LEN - r->blockLen, ( 0 == r->blockLen ), r->contPrio, flags, statement, args );
+        if( 0 == len && 0 != r->blockLen )
+        {
+            /* Does not fit anymore, pass what is there and start over */
+            CommitBlock( r, false );
+            len = EncodeEvent( r->block, LINE_LEN, true, r->contPrio, flags, statement, retry );
+        }
+        va_end( retry );
+        r->blockLen += len;
+        return;
+    }
+    len = vsnprintf( &r->block[r->blockLen], LINE_LEN - r->blockLen, statement, args );
+    if( LINE_LEN <= r->blockLen + len && 0 != r->blockLen )
+    {
+        /* Does not fit anymore, pass what is there and start over */
+        CommitBlock( r, false );
+        len = vsnprintf( r->block, LINE_LEN, statement, retry );
+    }
+    va_end( retry );
+    if( 0 > len )
+        return;
+    r->blockLen += ( LINE_LEN <= r->blockLen + len ) ? LINE_LEN - 1 - r->blockLen : (uint32_t)len;
+}
+
+static void CommitBlock(Ring_t *r, bool isFinished)
+{
+    uint16_t flags;
+    if( 0 == r->blockLen )
+        return;
+    if( r->blockBinary )
+    {
+        flags = REC_BINARY;
+        if( isFinished )
+        {
+            /* Block was not closed by ConsolePrintfExit, the last part ends the message anyway */
+            uint32_t offset = 0, last = 0;
+            BinEvent_t evt;
+            while( offset < r->blockLen )
+            {
+                last = offset;
+                memcpy( &evt, &r->block[offset], sizeof(evt) );
+                offset += sizeof(evt) + evt.argsLen;
+            }
+            r->block[last + offsetof( BinEvent_t, flags )] &= ~CONSOLE_BIN_FLAG_PART;
+        }
+    }
+    else
+        flags = ( PRIO_ERROR == r->contPrio ) ? REC_ERROR : 0;
+    Enqueue( r, flags, r->block, r->blockLen );
+    r->blockLen = 0;
+}
+
+static uint64_t GetTimeUs(clockid_t clock)
+{
+    struct timespec now;
+    clock_gettime( clock, &now );
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
+/* Stores the event and its raw arguments instead of the formatted text, returns the length or 0 if it does not fit */
+static uint32_t EncodeEvent(char *pBuf, uint32_t size, bool allowCut, ConsolePrio_t prio, uint8_t flags, const char *statement, va_list args)
+{
+    BinEvent_t evt;
+    uint32_t argsLen = 0;
+    if( sizeof(evt) > size )
+        return 0;
+    if( !EncodeArgs( (uint8_t *)&pBuf[sizeof(evt)], size - sizeof(evt), &argsLen, statement, args ) && !allowCut )
+        return 0;
+    memset( &evt, 0, sizeof(evt) );
+    evt.format = statement;
+    evt.timeUs = GetTimeUs( CLOCK_MONOTONIC );
+    evt.argsLen = (uint16_t)argsLen;
+    evt.prio = (uint8_t)prio;
+    evt.flags = flags;
+    memcpy( pBuf, &evt, sizeof(evt) );
+    return sizeof(evt) + argsLen;
+}
+
+/* Walks the conversions of the format string to fetch the arguments, returns false if they were cut, because of the size */
+static bool EncodeArgs(uint8_t *pBuf, uint32_t size, uint32_t *pLen, const char *statement, va_list args)
+{
+    enum { MOD_NONE, MOD_HH, MOD_H, MOD_L, MOD_LL, MOD_Z, MOD_J, MOD_T, MOD_LONG_DOUBLE } mod;
+    const char *p;
+    int64_t iv;
+    double dv;
+    uint64_t pv;
+    const char *sv;
+    size_t sLen;
+    int precision;
+    for( p = statement; '\0' != *p; p++ )
+    {
+        if( '%' != *p )
+            continue;
+        ++p;
+        if( '%' == *p )
+            continue;
+        while( '\0' != *p && NULL != strchr( "-+ #0'", *p ) )
+            ++p;
+        if( '*' == *p )
+        {
+            iv = va_arg( args, int );
+            if( !PutArg( pBuf, size, pLen, ConsoleBinArg_Int, &iv, sizeof(iv) ) )
+                return false;
+            ++p;
+        }
+        while( '0' <= *p && '9' >= *p )
+            ++p;
+        precision = -1;
+        if( '.' == *p )
+        {
+            ++p;
+            if( '*' == *p )
+            {
+                iv = va_arg( args, int );
+                if( !PutArg( pBuf, size, pLen, ConsoleBinArg_Int, &iv, sizeof(iv) ) )
+                    return false;
+                precision = (int)iv;
+                ++p;
+            }
+            else
+                precision = 0;
+            while( '0' <= *p && '9' >= *p )
+                precision = precision * 10 + ( *p++ - '0' );
+        }
+        switch( *p )
+        {
+        case 'h':
+            mod = ( 'h' == p[1] ) ? MOD_HH : MOD_H;
+            break;
+        case 'l':
+            mod = ( 'l' == p[1] ) ? MOD_LL : MOD_L;
+            break;
+        case 'q':
+            mod = MOD_LL;
+            break;
+        case 'z':
+            mod = MOD_Z;
+            break;
+        case 'j':
+            mod = MOD_J;
+            break;
+        case 't':
+            mod = MOD_T;
+            break;
+        case 'L':
+            mod = MOD_LONG_DOUBLE;
+            break;
+        default:
+            mod = MOD_NONE;
+            break;
+        }
+        if( MOD_NONE != mod )
+            p += ( MOD_HH == mod || ( MOD_LL == mod && 'q' != *p ) ) ? 2 : 1;
+        switch( *p )
+        {
+        case 'd':
+        case 'i':
+            switch( mod )
+            {
+            case MOD_HH: iv = (signed char)va_arg( args, int ); break;
+            case MOD_H: iv = (short)va_arg( args, int ); break;
+            case MOD_L: iv = va_arg( args, long ); break;
+            case MOD_LL: iv = va_arg( args, long long ); break;
+            case MOD_Z: iv = va_arg( args, ssize_t ); break;
+            case MOD_J: iv = va_arg( args, intmax_t ); break;
+            case MOD_T: iv = va_arg( args, ptrdiff_t ); break;
+            default: iv = va_arg( args, int ); break;
+            }
+            if( !PutArg( pBuf, size, pLen, ConsoleBinArg_Int, &iv, sizeof(iv) ) )
+                return false;
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            switch( mod )
+            {
+            case MOD_HH: iv = (unsigned char)va_arg( args, unsigned int ); break;
+            case MOD_H: iv = (unsigned short)va_arg( args, unsigned int ); break;
+            case MOD_L: iv = (int64_t)va_arg( args, unsigned long ); break;
+            case MOD_LL: iv = (int64_t)va_arg( args, unsigned long long ); break;
+            case MOD_Z: iv = (int64_t)va_arg( args, size_t ); break;
+            case MOD_J: iv = (int64_t)va_arg( args, uintmax_t ); break;
+            case MOD_T: iv = va_arg( args, ptrdiff_t ); break;
+            default: iv = va_arg( args, unsigned int ); break;
+            }
+            if( !PutArg( pBuf, size, pLen, ConsoleBinArg_Int, &iv, sizeof(iv) ) )
+                return false;
+            break;
+        case 'c':
+            iv = (unsigned char)va_arg( args, int );
+            if( !PutArg( pBuf, size, pLen, ConsoleBinArg_Int, &iv, sizeof(iv) ) )
+                return false;
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            dv = ( MOD_LONG_DOUBLE == mod ) ? (double)va_arg( args, long double ) : va_arg( args, double );
+            if( !PutArg( pBuf, size, pLen, ConsoleBinArg_Double, &dv, sizeof(dv) ) )
+                return false;
+            break;
+        case 's':
+            sv = va_arg( args, const char * );
+            if( NULL == sv )
+                sv = "(null)";
+            /* Only the characters to be printed are stored, the string may not be terminated then */
+            sLen = strnlen( sv, ( 0 <= precision && 0xFFFF > precision ) ? (size_t)precision : 0xFFFF );
+            if( *pLen + 1 + sizeof(uint16_t) + sLen > size )
+            {
+                /* Long strings are cut to the space left */
+                if( *pLen + 1 + sizeof(uint16_t) < size )
+                    PutArg( pBuf, size, pLen, ConsoleBinArg_String, sv, (uint16_t)( size - *pLen - 1 - sizeof(uint16_t) ) );
+                return false;
+            }
+            PutArg( pBuf, size, pLen, ConsoleBinArg_String, sv, (uint16_t)sLen );
+            break;
+        case 'p':
+            pv = (uint64_t)(uintptr_t)va_arg( args, void * );
+            if( !PutArg( pBuf, size, pLen, ConsoleBinArg_Pointer, &pv, sizeof(pv) ) )
+                return false;
+            break;
+        case 'n':
+            va_arg( args, void * );
+            break;
+        case 'm':
+            break;
+        default:
+            /* Unknown conversion, the types of the remaining arguments can not be told */
+            return true;
+        }
+    }
+    return true;
+}
+
+static bool PutArg(uint8_t *pBuf, uint32_t size, uint32_t *pLen, uint8_t type, const void *pData, uint16_t dataLen)
+{
+    uint32_t need = 1 + dataLen;
+    if( ConsoleBinArg_String == type )
+        need += sizeof(uint16_t);
+    if( *pLen + need > size )
+        return false;
+    pBuf[( *pLen )++] = type;
+    if( ConsoleBinArg_String == type )
+    {
+        memcpy( &pBuf[*pLen], &dataLen, sizeof(uint16_t) );
+        *pLen += sizeof(uint16_t);
+    }
+    memcpy( &pBuf[*pLen], pData, dataLen );
+    *pLen += dataLen;
+    return true;
+}
+
+static void *WriterThread(void *arg)
+{
+    arg = arg;
+    while( true )
+    {
+        while( 0 != sem_wait( &wakeupSem ) );
+        __atomic_store_n( &wakeupPending, 0, __ATOMIC_RELEASE );
+        pthread_mutex_lock( &drainMutex );
+        while( Drain() );
+        pthread_mutex_unlock( &drainMutex );
+    }
+    return NULL;
+}
+
+/* Writes a batch of messages of all rings in the order they were logged, returns true if there may be more */
+static bool Drain(void)
+{
+    Ring_t *r, *oldestRing = NULL, *first = __atomic_load_n( &rings, __ATOMIC_ACQUIRE );
+    struct iovec iov[BATCH_SIZE];
+    int iovCnt = 0, recCnt = 0;
+    bool iovError = false;
+    bool more = false;
+    for( r = first; NULL != r; r = r->next )
+    {
+        r->cursor = r->tail;
+        r->batchHead = __atomic_load_n( &r->head, __ATOMIC_ACQUIRE );
+    }
+    while( recCnt < BATCH_SIZE )
+    {
+        Record_t *rec, *oldest = NULL;
+        for( r = first; NULL != r; r = r->next )
+        {
+            if( NextRecord( r, &rec )
+                && ( NULL == oldest || (int32_t)( rec->seq - oldest->seq ) < 0 ) )
+            {
+                oldest = rec;
+                oldestRing = r;
+            }
+        }
+        if( NULL == oldest )
+            break;
+        if( 0 != ( oldest->flags & REC_BINARY ) )
+        {
+            /* Goes to the binary file, so it does not take part in the writev */
+            WriteBinary( oldest );
+            ++recCnt;
+            oldestRing->cursor += ( sizeof(Record_t) + oldest->len + REC_ALIGN - 1 ) & ~( REC_ALIGN - 1 );
+            continue;
+        }
+        /* A single writev can only serve stdout or stderr */
+        if( 0 != iovCnt && iovError != ( 0 != ( oldest->flags & REC_ERROR ) ) )
+        {
+            more = true;
+            break;
+        }
+        iovError = ( 0 != ( oldest->flags & REC_ERROR ) );
+        iov[iovCnt].iov_base = &oldest[1];
+        iov[iovCnt].iov_len = oldest->len;
+        ++iovCnt;
+        ++recCnt;
+        oldestRing->cursor += ( sizeof(Record_t) + oldest->len + REC_ALIGN - 1 ) & ~( REC_ALIGN - 1 );
+    }
+    if( BATCH_SIZE == recCnt )
+        more = true;
+    if( 0 != iovCnt )
+        WriteAll( iovError ? STDERR_FILENO : STDOUT_FILENO, iov, iovCnt );
+    if( !more )
+        FlushBinary();
+    for( r = first; NULL != r; r = r->next )
+        __atomic_store_n( &r->tail, r->cursor, __ATOMIC_RELEASE );
+    if( !more )
+        ReportDropped();
+    return more;
+}
+
+/* Skips padding and gets the record at the cursor without consuming it */
+static bool NextRecord(Ring_t *r, Record_t **ppRec)
+{
+    while( r->cursor != r->batchHead )
+    {
+        uint32_t offset = r->cursor & ( RING_SIZE - 1 );
+        Record_t *rec = (Record_t *)&r->buffer[offset];
+        if( 0 == ( rec->flags & REC_PADDING ) )
+        {
+            *ppRec = rec;
+            return true;
+        }
+        r->cursor += RING_SIZE - offset;
+    }
+    return false;
+}
+
+static void WriteAll(int fd, struct iovec *pIov, int iovCnt)
+{
+    while( 0 < iovCnt )
+    {
+        ssize_t written = writev( fd, pIov, iovCnt );
+        if( 0 > written )
+            return;
+        while( 0 < iovCnt && (size_t)written >= pIov->iov_len )
+        {
+            written -= pIov->iov_len;
+            ++pIov;
+            --iovCnt;
+        }
+        if( 0 < iovCnt )
+        {
+            pIov->iov_base = (char *)pIov->iov_base + written;
+            pIov->iov_len -= written;
+        }
+    }
+}
+
+static void ReportDropped(void)
+{
+    Ring_t *r;
+    char msg[80];
+    struct iovec iov;
+    uint32_t dropped = 0;
+    int len;
+    for( r = __atomic_load_n( &rings, __ATOMIC_ACQUIRE ); NULL != r; r = r->next )
+        dropped += __atomic_exchange_n( &r->dropped, 0, __ATOMIC_RELAXED );
+    if( 0 == dropped )
+        return;
+    len = snprintf( msg, sizeof(msg), RED "Console overloaded, %u messages dropped" RESETCOLOR "\r\n", dropped );
+    if( 0 >= len )
+        return;
+    iov.iov_base = msg;
+    iov.iov_len = ( sizeof(msg) <= (size_t)len ) ? sizeof(msg) - 1 : (size_t)len;
+    WriteAll( STDERR_FILENO, &iov, 1 );
+}
+
+/* Replaces the format pointers of the events by their IDs and adds them to the binary file */
+static void WriteBinary(const Record_t *rec)
+{
+    const uint8_t *pData = (const uint8_t *)&rec[1];
+    uint32_t offset = 0;
+    while( offset + sizeof(BinEvent_t) <= rec->len )
+    {
+        BinEvent_t evt;
+        ConsoleBinEvent_t out;
+        memcpy( &evt, &pData[offset], sizeof(evt) );
+        offset += sizeof(evt);
+        if( offset + evt.argsLen > rec->len )
+            break;
+        memset( &out, 0, sizeof(out) );
+        out.type = ConsoleBin_Event;
+        out.prio = evt.prio;
+        out.flags = evt.flags;
+        out.id = GetFormatId( evt.format );
+        out.timeUs = evt.timeUs;
+        out.argsLen = evt.argsLen;
+        PutBinary( &out, sizeof(out) );
+        PutBinary( &pData[offset], evt.argsLen );
+        offset += evt.argsLen;
+    }
+}
+
+/* Looks up the ID of the format string, the first use of a format string adds its definition to the file */
+static uint32_t GetFormatId(const char *format)
+{
+    ConsoleBinDef_t def;
+    size_t len = strlen( format );
+    uint32_t i, n = (uint32_t)( ( (uintptr_t)format >> 3 ) * 2654435761u ) & ( DICT_SIZE - 1 );
+    for( i = 0; i < DICT_SIZE; i++, n = ( n + 1 ) & ( DICT_SIZE - 1 ) )
+    {
+        if( format == dict[n].format )
+            return dict[n].id;
+        if( NULL == dict[n].format )
+            break;
+    }
+    /* If the dictionary is full, the format string is defined again with every use */
+    memset( &def, 0, sizeof(def) );
+    def.type = ConsoleBin_Definition;
+    def.len = ( len > 0xFFFF ) ? 0xFFFF : (uint16_t)len;
+    def.id = nextFormatId++;
+    if( i < DICT_SIZE )
+    {
+        dict[n].format = format;
+        dict[n].id = def.id;
+    }
+    PutBinary( &def, sizeof(def) );
+    PutBinary( format, def.len );
+    return def.id;
+}
+
+static void PutBinary(const void *pData, uint32_t len)
+{
+    if( BIN_BUF_SIZE - binLen < len )
+        FlushBinary();
+    if( BIN_BUF_SIZE < len )
+    {
+        struct iovec iov;
+        iov.iov_base = (void *)pData;
+        iov.iov_len = len;
+        WriteAll( binFd, &iov, 1 );
+        return;
+    }
+    memcpy( &binBuf[binLen], pData, len );
+    binLen += len;
+}
+
+static void FlushBinary(void)
+{
+    struct iovec iov;
+    if( 0 == binLen )
+        return;
+    iov.iov_base = binBuf;
+    iov.iov_len = binLen;
+    WriteAll( binFd, &iov, 1 );
+    binLen = 0;
+}
+#endif
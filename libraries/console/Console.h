@@ -54,6 +54,7 @@
 #endif
 
 #include <stdbool.h>
+#include <stdarg.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -76,23 +77,40 @@ extern "C"
     /*----------------------------------------------------------*/
     void ConsoleSetPrio( ConsolePrio_t prio );
 
+    /*----------------------------------------------------------*/
+    /*! \brief Checks if a message with the given priority would be displayed.
+     *  \note Use it to skip preparing messages, which would be discarded anyway.
+     *  \param prio - The priority of the message
+     *  \return true, if the message would be displayed. false, it would be discarded.
+     */
+    /*----------------------------------------------------------*/
+    bool ConsoleIsEnabled( ConsolePrio_t prio );
+
     /*----------------------------------------------------------*/
     /*! \brief Uses the board specific PRINT mechanism and provides thread and process safety.
+     *  \note Never blocks, if the writer can not keep up, the message is dropped and the amount of dropped messages is reported.
      *
      */
     /*----------------------------------------------------------*/
     void ConsolePrintf( ConsolePrio_t prio, const char *statement, ... ) __attribute__ ((format (gnu_printf, 2, 3)));
 
+    /*----------------------------------------------------------*/
+    /*! \brief Same as ConsolePrintf, but takes the arguments as va_list.
+     *  \note Use it to pass on arguments of variadic callbacks without formatting them into a buffer first.
+     */
+    /*----------------------------------------------------------*/
+    void ConsoleVPrintf( ConsolePrio_t prio, const char *statement, va_list args ) __attribute__ ((format (gnu_printf, 2, 0)));
+
 
     /*----------------------------------------------------------*/
-    /*! \brief Starts to print and stay blocked after exit of this function
-     *
+    /*! \brief Starts a message formed by several calls. The parts are collected per thread
+     *         and written in one piece, when ConsolePrintfExit is called.
      */
     /*----------------------------------------------------------*/
     void ConsolePrintfStart( ConsolePrio_t prio, const char *statement, ... ) __attribute__ ((format (gnu_printf, 2, 3)));
 
     /*----------------------------------------------------------*/
-    /*! \brief Continue to print and stay blocked after exit of this function
+    /*! \brief Adds a part to the message started by ConsolePrintfStart
      *  \note ConsolePrintfStart must be called before and when finished ConsolePrintfExit must be called.
      *  \note This function may be called multiple times.
      */
@@ -100,12 +118,39 @@ extern "C"
     void ConsolePrintfContinue( const char *statement, ... ) __attribute__ ((format (gnu_printf, 1, 2)));
 
     /*----------------------------------------------------------*/
-    /*! \brief Continue to print and unblock after finishing.
+    /*! \brief Adds the last part and passes the whole message to the writer.
      *  \note ConsolePrintfStart must be called before. ConsolePrintfContinue may have been called before multiple times.
      */
     /*----------------------------------------------------------*/
     void ConsolePrintfExit( const char *statement, ... ) __attribute__ ((format (gnu_printf, 1, 2)));
 
+    /*----------------------------------------------------------*/
+    /*! \brief Writes all pending messages before returning.
+     *  \note Messages are written by a background thread, so that logging never blocks the caller.
+     *         This function is registered with atexit, call it before terminating in any other way.
+     */
+    /*----------------------------------------------------------*/
+    void ConsoleFlush( void );
+
+    /*----------------------------------------------------------*/
+    /*! \brief Writes all following messages into a binary file instead of the console.
+     *         The messages are not formatted, the file holds the format string once
+     *         and per message a timestamp and the raw arguments. Use unicens-logdecode to read it.
+     *  \note Errors are still formatted and written to the console only.
+     *  \note In binary mode, the statements must be string literals, as they are identified by their address.
+     *  \param fileName - Path of the file to create, an existing file is overwritten.
+     *  \return true, if the binary mode is active. false, the file could not be created or the platform does not support it.
+     */
+    /*----------------------------------------------------------*/
+    bool ConsoleSetBinaryFile( const char *fileName );
+
+    /*----------------------------------------------------------*/
+    /*! \brief Checks if the messages are written into a binary file.
+     *  \return true, if ConsoleSetBinaryFile was called successfully. false, otherwise.
+     */
+    /*----------------------------------------------------------*/
+    bool ConsoleIsBinary( void );
+
 #ifdef __cplusplus
 }
 #endif
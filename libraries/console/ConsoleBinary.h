@@ -0,0 +1,113 @@
+/*------------------------------------------------------------------------------------------------*/
+/* Console Binary Log Format                                                                      */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------*/
+/*! \file
+ *  \brief This file describes the file written by ConsoleSetBinaryFile.
+ *         The text is not formatted by the daemon, instead every message holds
+ *         the ID of its format string, a timestamp and the raw arguments.
+ */
+/*----------------------------------------------------------*/
+#ifndef _CONSOLEBINARY_H_
+#define _CONSOLEBINARY_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CONSOLE_BIN_MAGIC       ("UCSBLOG")
+#define CONSOLE_BIN_BYTE_ORDER  (0x01020304)
+#define CONSOLE_BIN_VERSION     (1)
+
+    /** Record types following the file header */
+    typedef enum
+    {
+        /** ConsoleBinDef_t followed by the format string, not zero terminated */
+        ConsoleBin_Definition = 1,
+        /** ConsoleBinEvent_t followed by argsLen bytes of arguments */
+        ConsoleBin_Event = 2
+    } ConsoleBinType_t;
+
+    /** Argument types, each argument starts with one of them */
+    typedef enum
+    {
+        /** int64_t, all integer conversions including '*' width and precision */
+        ConsoleBinArg_Int = 1,
+        /** double, all floating point conversions */
+        ConsoleBinArg_Double = 2,
+        /** uint16_t length followed by the characters, not zero terminated */
+        ConsoleBinArg_String = 3,
+        /** uint64_t */
+        ConsoleBinArg_Pointer = 4
+    } ConsoleBinArg_t;
+
+    /** Event is a part of a message formed by ConsolePrintfStart, Continue and Exit, the next event continues it */
+#define CONSOLE_BIN_FLAG_PART   (0x1)
+
+    typedef struct
+    {
+        char magic[8];
+        /** Written in the byte order of the daemon, the decoder rejects files of a different one */
+        uint32_t byteOrder;
+        uint32_t version;
+        /** CLOCK_REALTIME and CLOCK_MONOTONIC in microseconds, when the file was created */
+        uint64_t realTimeUs;
+        uint64_t monotonicUs;
+    } ConsoleBinHeader_t;
+
+    typedef struct
+    {
+        uint8_t type;
+        uint8_t reserved;
+        uint16_t len;
+        uint32_t id;
+    } ConsoleBinDef_t;
+
+    typedef struct
+    {
+        uint8_t type;
+        uint8_t prio;
+        uint8_t flags;
+        uint8_t reserved;
+        uint32_t id;
+        /** CLOCK_MONOTONIC in microseconds */
+        uint64_t timeUs;
+        uint16_t argsLen;
+        uint16_t reserved2[3];
+    } ConsoleBinEvent_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_CONSOLEBINARY_H_*/
@@ -0,0 +1,870 @@
+/*------------------------------------------------------------------------------------------------*/
+/* INIC Simulator                                                                                 */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "InicSim.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PORT MESSAGE PROTOCOL                            */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/* Follows the port message service (PMS) of UNICENS, keep in sync with ucs_pmp.h */
+#define PM_PML_POS              (0)
+#define PM_PMHL_POS             (2)
+#define PM_FPH_POS              (3)
+#define PM_SID_POS              (4)
+#define PM_EXT_TYPE_POS         (5)
+#define PM_HEADER_SIZE          (6)
+
+#define FPH_DIR_RX              (0x01)
+#define FPH_TYPE_POS            (1)
+#define FPH_TYPE_MASK           (0x06)
+#define FPH_FIFO_POS            (3)
+#define FPH_FIFO_MASK           (0x18)
+#define FPH_VERSION_MASK        (0xE0)
+
+#define FIFO_ICM                (0)
+#define FIFO_RCM                (1)
+#define FIFO_MCM                (2)
+#define FIFO_ALL                (3)
+#define FIFO_CNT                (3)
+
+#define MSG_TYPE_CMD            (0)
+#define MSG_TYPE_STATUS         (1)
+#define MSG_TYPE_DATA           (2)
+
+/* EXT_TYPE of command and status messages holds the type in the upper 3 bits and the code in the lower 5 bits */
+#define EXT_TYPE_TYPE_POS       (5)
+#define EXT_TYPE_CODE_MASK      (0x1F)
+
+#define CMD_TYPE_REQ_STATUS     (0x00)
+#define CMD_TYPE_MSG_ACTION     (0x01)
+#define CMD_TYPE_SYNC           (0x04)
+#define CMD_CODE_SYNC           (0x01)
+#define CMD_CODE_UNSYNC         (0x0C)
+
+#define STATUS_TYPE_FAILURE     (0x00)
+#define STATUS_TYPE_FLOW        (0x01)
+#define STATUS_TYPE_SYNCED      (0x04)
+#define STATUS_TYPE_UNSYNCED    (0x06)
+#define STATUS_CODE_SUCCESS     (0x00)
+#define UNSYNC_REASON_COMMAND   (0x03)
+
+/* EXT_TYPE of data messages gives the content type, which defines the message header */
+#define CONTENT_TGT             (0x80)
+#define CONTENT_TGT_SRC         (0x81)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     FUNCTION BLOCKS                                  */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define FB_INIC                 (0x00)
+#define FB_EXC                  (0x0A)
+
+#define OP_SET                  (0x0)
+#define OP_START                (0x0)
+#define OP_GET                  (0x1)
+#define OP_SETGET               (0x2)
+#define OP_STARTRESULT          (0x2)
+#define OP_STARTRESULTACK       (0x6)
+#define OP_STARTACK             (0x8)
+#define OP_ERRORACK             (0x9)
+#define OP_STATUS               (0xC)
+#define OP_RESULT               (0xC)
+#define OP_RESULTACK            (0xD)
+#define OP_ERROR                (0xF)
+
+#define ERR_FBLOCK_NOT_AVAIL    (0x01)
+
+#define INIC_NOTIFICATION       (0x001)
+#define INIC_DEVICE_STATUS      (0x220)
+#define INIC_DEVICE_VERSION     (0x221)
+#define INIC_DEVICE_POWER_OFF   (0x222)
+#define INIC_DEVICE_ATTACH      (0x223)
+#define INIC_DEVICE_SYNC        (0x224)
+#define INIC_NW_STATUS          (0x520)
+#define INIC_NW_CFG             (0x521)
+#define INIC_NW_STARTUP         (0x524)
+#define INIC_NW_SHUTDOWN        (0x525)
+#define INIC_NW_FORCE_NO_AVAIL  (0x52B)
+#define INIC_MOST_PORT_STATUS   (0x602)
+#define INIC_I2C_PORT_READ      (0x6C3)
+#define INIC_I2C_PORT_WRITE     (0x6C4)
+#define INIC_GPIO_PIN_MODE      (0x703)
+#define INIC_GPIO_PIN_STATE     (0x704)
+#define INIC_RESOURCE_DESTROY   (0x800)
+#define INIC_RESOURCE_INVALID   (0x801)
+#define INIC_RESOURCE_MONITOR   (0x802)
+
+#define EXC_HELLO               (0x200)
+#define EXC_WELCOME             (0x201)
+#define EXC_SIGNATURE           (0x202)
+#define EXC_DEVICE_INIT         (0x203)
+
+#define SIGNATURE_VERSION       (1)
+#define SIGNATURE_SIZE          (26)
+
+#define ADDR_LOCAL_INIC         (0x0001)
+#define ADDR_GROUP_FIRST        (0x0300)
+#define ADDR_BROADCAST_BLOCKING (0x03C8)
+#define ADDR_BROADCAST          (0x03FF)
+#define ADDR_POSITION_FIRST     (0x0400)
+#define ADDR_POSITION_LAST      (0x04FF)
+
+#define AVAIL_NOT_AVAILABLE     (0x00)
+#define AVAIL_AVAILABLE         (0x01)
+#define AVAIL_INFO_REGULAR      (0x00)
+#define AVAIL_INFO_STABLE       (0x11)
+#define AVAIL_CAUSE_COMMAND     (0x01)
+
+#define QUEUE_SIZE              (512)
+/* Resource handles handed out by the create functions of each node start here */
+#define FIRST_RESOURCE_HANDLE   (0x1000)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVATE TYPEDEFS                                 */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+typedef struct
+{
+    uint8_t fifo;
+    uint8_t content;
+    uint16_t targetAddr;
+    uint16_t sourceAddr;
+    uint8_t fblock;
+    uint8_t instance;
+    uint16_t function;
+    uint8_t opType;
+    const uint8_t *pPayload;
+    uint16_t payloadLen;
+} Message_t;
+
+typedef struct
+{
+    InicSimNode_t sig;
+    uint8_t position;
+    bool attached;
+    bool welcomed;
+    uint16_t nextHandle;
+    uint16_t gpioState;
+} Node_t;
+
+typedef struct
+{
+    uint32_t dueMs;
+    uint32_t len;
+    uint8_t data[INICSIM_MAX_MSG_SIZE];
+} Pending_t;
+
+typedef struct
+{
+    InicSimConfig_t cfg;
+    Node_t nodes[INICSIM_MAX_NODES];
+    bool synced[FIFO_CNT];
+    uint8_t dataSid[FIFO_CNT];
+    uint8_t fphVersion;
+    uint8_t content;
+    uint16_t ehcAddress;
+    bool startupRequested;
+    bool ringBreak;
+    uint32_t availableMs;
+    uint32_t random;
+    uint16_t packetBw;
+    uint32_t nowMs;
+    Pending_t queue[QUEUE_SIZE];
+    uint32_t queueCnt;
+    InicSimStats_t stats;
+} LocalVar_t;
+
+static LocalVar_t m;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void OnCommand(uint8_t fifo, uint8_t sid, uint8_t extType, const uint8_t *pData, uint32_t len);
+static void OnData(uint8_t fifo, uint8_t extType, const uint8_t *pData, uint32_t len);
+static void OnInic(const Message_t *req, Node_t *node);
+static void OnExc(const Message_t *req, Node_t *node);
+static void OnUnknown(const Message_t *req, Node_t *node);
+static void ReplyGeneric(const Message_t *req, Node_t *node);
+static void Reply(const Message_t *req, Node_t *node, uint32_t delayMs, uint8_t opType, const uint8_t *pPayload, uint16_t len);
+static void ReplyAck(const Message_t *req, Node_t *node, uint32_t delayMs, uint8_t opType, const uint8_t *pPayload, uint16_t len);
+static void SendNetworkStatus(uint32_t delayMs, uint16_t events);
+static void QueueFrame(uint32_t delayMs, uint8_t fifo, uint8_t type, uint8_t sid, uint8_t extType, const uint8_t *pData, uint32_t len);
+static bool IsAvailable(void);
+static uint32_t GetJitter(void);
+static void ForgetWelcome(void);
+static bool IsCreateFunction(uint16_t function);
+static uint8_t EncodeSignature(const Node_t *node, uint8_t *pBuf);
+static void PrintMessage(bool isRx, const uint8_t *pData, uint32_t len);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+void InicSim_Init(const InicSimConfig_t *pCfg)
+{
+    if (NULL == pCfg)
+        return;
+    m.cfg = *pCfg;
+    if (INICSIM_MAX_NODES < m.cfg.nodeCnt)
+        m.cfg.nodeCnt = INICSIM_MAX_NODES;
+    InicSim_Reset();
+}
+
+void InicSim_Reset(void)
+{
+    uint8_t i;
+    memset(m.nodes, 0, sizeof(m.nodes));
+    for (i = 0; i < m.cfg.nodeCnt; i++)
+    {
+        m.nodes[i].sig = m.cfg.nodes[i];
+        m.nodes[i].position = i;
+        m.nodes[i].nextHandle = FIRST_RESOURCE_HANDLE;
+    }
+    memset(m.synced, 0, sizeof(m.synced));
+    memset(m.dataSid, 0, sizeof(m.dataSid));
+    memset(&m.stats, 0, sizeof(m.stats));
+    m.fphVersion = 0;
+    m.content = CONTENT_TGT_SRC;
+    m.ehcAddress = 0;
+    m.startupRequested = false;
+    m.ringBreak = false;
+    m.availableMs = 0;
+    m.random = (0 != m.cfg.seed) ? m.cfg.seed : 1;
+    m.packetBw = 0;
+    m.queueCnt = 0;
+}
+
+void InicSim_OnTx(uint32_t nowMs, const uint8_t *pData, uint32_t len)
+{
+    uint8_t fph, fifo, type;
+    if (NULL == pData)
+        return;
+    m.nowMs = nowMs;
+    ++m.stats.rxMessages;
+    if (m.cfg.verbose)
+        PrintMessage(false, pData, len);
+    if (PM_HEADER_SIZE > len || (uint32_t)((pData[PM_PML_POS] << 8) | pData[PM_PML_POS + 1]) + 2 != len
+        || 3 > pData[PM_PMHL_POS] || len < 3U + pData[PM_PMHL_POS])
+    {
+        ++m.stats.unknownMessages;
+        return;
+    }
+    fph = pData[PM_FPH_POS];
+    fifo = (fph & FPH_FIFO_MASK) >> FPH_FIFO_POS;
+    type = (fph & FPH_TYPE_MASK) >> FPH_TYPE_POS;
+    m.fphVersion = fph & FPH_VERSION_MASK;
+    switch (type)
+    {
+        case MSG_TYPE_CMD:
+            OnCommand(fifo, pData[PM_SID_POS], pData[PM_EXT_TYPE_POS], &pData[3 + pData[PM_PMHL_POS]],
+                len - 3 - pData[PM_PMHL_POS]);
+            break;
+        case MSG_TYPE_STATUS:
+            /* Acknowledges of the messages sent by this simulator, nothing to do */
+            break;
+        case MSG_TYPE_DATA:
+            if (FIFO_CNT <= fifo)
+            {
+                ++m.stats.unknownMessages;
+                break;
+            }
+            /* Every message is accepted right away */
+            QueueFrame(0, fifo, MSG_TYPE_STATUS, pData[PM_SID_POS],
+                (STATUS_TYPE_FLOW << EXT_TYPE_TYPE_POS) | STATUS_CODE_SUCCESS, NULL, 0);
+            OnData(fifo, pData[PM_EXT_TYPE_POS], &pData[3 + pData[PM_PMHL_POS]], len - 3 - pData[PM_PMHL_POS]);
+            break;
+        default:
+            ++m.stats.unknownMessages;
+            break;
+    }
+}
+
+bool InicSim_GetRx(uint32_t nowMs, uint8_t *pData, uint32_t *pLen)
+{
+    Pending_t *p = &m.queue[0];
+    uint8_t fifo;
+    if (NULL == pData || NULL == pLen || 0 == m.queueCnt || (int32_t)(nowMs - p->dueMs) < 0)
+        return false;
+    m.nowMs = nowMs;
+    memcpy(pData, p->data, p->len);
+    *pLen = p->len;
+    /* Data messages are numbered in the order they are sent, not in the order they were queued */
+    fifo = (pData[PM_FPH_POS] & FPH_FIFO_MASK) >> FPH_FIFO_POS;
+    if (MSG_TYPE_DATA == ((pData[PM_FPH_POS] & FPH_TYPE_MASK) >> FPH_TYPE_POS) && FIFO_CNT > fifo)
+        pData[PM_SID_POS] = m.dataSid[fifo]++;
+    --m.queueCnt;
+    memmove(&m.queue[0], &m.queue[1], m.queueCnt * sizeof(Pending_t));
+    ++m.stats.txMessages;
+    if (m.cfg.verbose)
+        PrintMessage(true, pData, *pLen);
+    return true;
+}
+
+int32_t InicSim_GetTimeout(uint32_t nowMs)
+{
+    int32_t diff;
+    if (0 == m.queueCnt)
+        return -1;
+    diff = (int32_t)(m.queue[0].dueMs - nowMs);
+    return (0 > diff) ? 0 : diff;
+}
+
+void InicSim_SetRingBreak(uint32_t nowMs, bool isBroken)
+{
+    if (isBroken == m.ringBreak)
+        return;
+    m.nowMs = nowMs;
+    m.ringBreak = isBroken;
+    if (isBroken && m.startupRequested)
+    {
+        m.startupRequested = false;
+        ForgetWelcome();
+        SendNetworkStatus(0, 0x0001);
+    }
+}
+
+void InicSim_GetStats(InicSimStats_t *pStats)
+{
+    if (NULL != pStats)
+        *pStats = m.stats;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void OnCommand(uint8_t fifo, uint8_t sid, uint8_t extType, const uint8_t *pData, uint32_t len)
+{
+    uint8_t cmdType = extType >> EXT_TYPE_TYPE_POS;
+    uint8_t code = extType & EXT_TYPE_CODE_MASK;
+    uint8_t i;
+    if (CMD_TYPE_SYNC == cmdType && CMD_CODE_SYNC == code)
+    {
+        for (i = 0; i < FIFO_CNT; i++)
+        {
+            if (FIFO_ALL == fifo || i == fifo)
+            {
+                m.synced[i] = true;
+                m.dataSid[i] = 0;
+            }
+        }
+        /* The synchronization parameters are confirmed as they are */
+        QueueFrame(0, fifo, MSG_TYPE_STATUS, sid, (STATUS_TYPE_SYNCED << EXT_TYPE_TYPE_POS) | STATUS_CODE_SUCCESS, pData, len);
+    }
+    else if (CMD_TYPE_SYNC == cmdType)
+    {
+        for (i = 0; i < FIFO_CNT; i++)
+        {
+            if (FIFO_ALL == fifo || i == fifo)
+                m.synced[i] = false;
+        }
+        QueueFrame(0, fifo, MSG_TYPE_STATUS, sid, (STATUS_TYPE_UNSYNCED << EXT_TYPE_TYPE_POS) | UNSYNC_REASON_COMMAND, NULL, 0);
+    }
+    else
+    {
+        /* Status requests and message actions, nothing is ever pending */
+        QueueFrame(0, fifo, MSG_TYPE_STATUS, sid, (STATUS_TYPE_FLOW << EXT_TYPE_TYPE_POS) | STATUS_CODE_SUCCESS, NULL, 0);
+    }
+}
+
+static void OnData(uint8_t fifo, uint8_t extType, const uint8_t *pData, uint32_t len)
+{
+    Message_t req;
+    uint32_t hdrLen = (CONTENT_TGT_SRC == extType) ? 10 : 8;
+    uint8_t i;
+    if ((CONTENT_TGT != extType && CONTENT_TGT_SRC != extType) || len < hdrLen)
+    {
+        ++m.stats.unknownMessages;
+        return;
+    }
+    memset(&req, 0, sizeof(req));
+    req.fifo = fifo;
+    req.content = extType;
+    req.targetAddr = (pData[0] << 8) | pData[1];
+    if (CONTENT_TGT_SRC == extType)
+    {
+        req.sourceAddr = (pData[2] << 8) | pData[3];
+        pData += 2;
+    }
+    req.fblock = pData[2];
+    req.instance = pData[3];
+    req.function = (pData[4] << 4) | (pData[5] >> 4);
+    req.opType = pData[5] & 0xF;
+    req.payloadLen = ((pData[6] & 0xF) << 8) | pData[7];
+    req.pPayload = &pData[8];
+    if (req.payloadLen > len - hdrLen)
+        req.payloadLen = len - hdrLen;
+    /* Notifications are sent the same way as the last request */
+    m.content = req.content;
+    m.ehcAddress = req.sourceAddr;
+    if (FIFO_MCM == fifo)
+    {
+        /* Application messages, the virtual nodes do not run any application */
+        return;
+    }
+    for (i = 0; i < m.cfg.nodeCnt; i++)
+    {
+        Node_t *node = &m.nodes[i];
+        uint16_t tgt = req.targetAddr;
+        bool match;
+        if (FIFO_ICM == fifo || ADDR_LOCAL_INIC == tgt)
+            match = (0 == i);
+        else if (ADDR_BROADCAST_BLOCKING == tgt || ADDR_BROADCAST == tgt)
+            match = true;
+        else if (ADDR_GROUP_FIRST <= tgt && ADDR_BROADCAST > tgt)
+            match = (tgt == node->sig.groupAddress);
+        else if (ADDR_POSITION_FIRST <= tgt && ADDR_POSITION_LAST >= tgt)
+            match = (tgt - ADDR_POSITION_FIRST == node->position);
+        else
+            match = (tgt == node->sig.nodeAddress);
+        /* Remote nodes are only reachable over a running network */
+        if (!match || (0 != i && !IsAvailable()))
+            continue;
+        if (FB_INIC == req.fblock)
+            OnInic(&req, node);
+        else if (FB_EXC == req.fblock)
+            OnExc(&req, node);
+        else
+            OnUnknown(&req, node);
+    }
+}
+
+static void OnInic(const Message_t *req, Node_t *node)
+{
+    uint8_t buf[INICSIM_MAX_MSG_SIZE];
+    const uint8_t *p = req->pPayload;
+    uint16_t len = req->payloadLen;
+    uint32_t latency = m.cfg.latencyMs;
+    if (IsCreateFunction(req->function) && OP_STARTRESULTACK == req->opType)
+    {
+        buf[0] = node->nextHandle >> 8;
+        buf[1] = node->nextHandle & 0xFF;
+        ++node->nextHandle;
+        ++m.stats.resources;
+        ReplyAck(req, node, latency, OP_RESULTACK, buf, 2);
+        return;
+    }
+    switch (req->function)
+    {
+        case INIC_DEVICE_STATUS:
+            if (OP_GET != req->opType)
+                break;
+            memset(buf, 0, 5);
+            buf[0] = node->attached ? 0x01 : 0x00;
+            Reply(req, node, latency, OP_STATUS, buf, 5);
+            return;
+        case INIC_DEVICE_VERSION:
+            if (OP_GET != req->opType)
+                break;
+            buf[0] = 0x00;
+            buf[1] = 0x08;
+            buf[2] = 0x11;
+            buf[3] = node->sig.chipId;
+            buf[4] = node->sig.fwMajor;
+            buf[5] = node->sig.fwMinor;
+            buf[6] = node->sig.fwRelease;
+            buf[7] = node->sig.fwBuild >> 24;
+            buf[8] = node->sig.fwBuild >> 16;
+            buf[9] = node->sig.fwBuild >> 8;
+            buf[10] = node->sig.fwBuild & 0xFF;
+            buf[11] = 0x01;
+            buf[12] = node->sig.diagnosisId >> 8;
+            buf[13] = node->sig.diagnosisId & 0xFF;
+            buf[14] = node->sig.csMajor;
+            buf[15] = node->sig.csMinor;
+            buf[16] = node->sig.csRelease;
+            Reply(req, node, latency, OP_STATUS, buf, 17);
+            return;
+        case INIC_DEVICE_ATTACH:
+            node->attached = true;
+            break;
+        case INIC_NW_STATUS:
+            if (OP_GET != req->opType)
+                break;
+            SendNetworkStatus(latency, 0x0000);
+            return;
+        case INIC_NW_CFG:
+            if (OP_GET != req->opType && OP_SETGET != req->opType)
+                break;
+            buf[0] = node->sig.nodeAddress >> 8;
+            buf[1] = node->sig.nodeAddress & 0xFF;
+            buf[2] = node->sig.groupAddress >> 8;
+            buf[3] = node->sig.groupAddress & 0xFF;
+            buf[4] = 0x0A;
+            Reply(req, node, latency, OP_STATUS, buf, 5);
+            return;
+        case INIC_NW_STARTUP:
+            if (OP_STARTRESULTACK != req->opType)
+                break;
+            if (6 <= len)
+                m.packetBw = (p[4] << 8) | p[5];
+            ReplyAck(req, node, latency, OP_RESULTACK, NULL, 0);
+            /* On a broken ring, the startup is accepted but the network never gets available */
+            if (!m.startupRequested && !m.ringBreak)
+            {
+                m.startupRequested = true;
+                m.availableMs = m.nowMs + m.cfg.startupMs;
+                ++m.stats.networkStartups;
+                m.stats.availableMs = m.availableMs;
+                SendNetworkStatus(m.cfg.startupMs, 0x0001);
+            }
+            return;
+        case INIC_NW_SHUTDOWN:
+        case INIC_NW_FORCE_NO_AVAIL:
+            if (OP_STARTRESULTACK != req->opType)
+                break;
+            ReplyAck(req, node, latency, OP_RESULTACK, NULL, 0);
+            if (m.startupRequested)
+            {
+                m.startupRequested = false;
+                ForgetWelcome();
+                SendNetworkStatus(latency, 0x0001);
+            }
+            return;
+        case INIC_MOST_PORT_STATUS:
+            if (OP_GET != req->opType)
+                break;
+            buf[0] = 0x0D;
+            buf[1] = 0x00;
+            buf[2] = IsAvailable() ? AVAIL_AVAILABLE : AVAIL_NOT_AVAILABLE;
+            buf[3] = IsAvailable() ? AVAIL_INFO_STABLE : AVAIL_INFO_REGULAR;
+            buf[4] = 0x00;
+            buf[5] = 0x00;
+            Reply(req, node, latency, OP_STATUS, buf, 6);
+            return;
+        case INIC_I2C_PORT_READ:
+        {
+            /* Port handle (2), slave address (1), length (1), timeout (2) */
+            uint8_t readLen;
+            if (OP_STARTRESULTACK != req->opType || 8 > len)
+                break;
+            readLen = p[5];
+            /* Sender handle, message header and port handle, slave address and length are added */
+            if (INICSIM_MAX_MSG_SIZE - PM_HEADER_SIZE - 10 - 2 - 4 < readLen)
+                readLen = INICSIM_MAX_MSG_SIZE - PM_HEADER_SIZE - 10 - 2 - 4;
+            memcpy(buf, &p[2], 3);
+            buf[3] = readLen;
+            memset(&buf[4], 0, readLen);
+            ReplyAck(req, node, m.cfg.i2cLatencyMs, OP_RESULTACK, buf, 4 + readLen);
+            return;
+        }
+        case INIC_I2C_PORT_WRITE:
+            /* Port handle (2), mode (1), block count (1), slave address (1), timeout (2), length (1), data */
+            if (OP_STARTRESULTACK != req->opType || 10 > len)
+                break;
+            buf[0] = p[2];
+            buf[1] = p[3];
+            buf[2] = p[6];
+            buf[3] = p[9];
+            ReplyAck(req, node, m.cfg.i2cLatencyMs, OP_RESULTACK, buf, 4);
+            return;
+        case INIC_GPIO_PIN_MODE:
+            if (OP_GET != req->opType && OP_SETGET != req->opType)
+                break;
+            Reply(req, node, m.cfg.gpioLatencyMs, OP_STATUS, p, len);
+            return;
+        case INIC_GPIO_PIN_STATE:
+            /* GPIO port handle (2), mask (2), data (2) */
+            if (OP_GET != req->opType && OP_SETGET != req->opType)
+                break;
+            if (OP_SETGET == req->opType && 6 <= len)
+            {
+                uint16_t mask = (p[2] << 8) | p[3];
+                uint16_t data = (p[4] << 8) | p[5];
+                node->gpioState = (node->gpioState & ~mask) | (data & mask);
+            }
+            buf[0] = (2 <= len) ? p[0] : 0;
+            buf[1] = (2 <= len) ? p[1] : 0;
+            buf[2] = node->gpioState >> 8;
+            buf[3] = node->gpioState & 0xFF;
+            buf[4] = 0x00;
+            buf[5] = 0x00;
+            Reply(req, node, m.cfg.gpioLatencyMs, OP_STATUS, buf, 6);
+            return;
+        case INIC_RESOURCE_INVALID:
+            if (OP_GET != req->opType)
+                break;
+            Reply(req, node, latency, OP_STATUS, NULL, 0);
+            return;
+        case INIC_RESOURCE_MONITOR:
+            if (OP_GET != req->opType && OP_SETGET != req->opType)
+                break;
+            buf[0] = 0x00;
+            Reply(req, node, latency, OP_STATUS, buf, 1);
+            return;
+        default:
+            break;
+    }
+    ReplyGeneric(req, node);
+}
+
+static void OnExc(const Message_t *req, Node_t *node)
+{
+    uint8_t buf[INICSIM_MAX_MSG_SIZE];
+    uint8_t len;
+    /* The nodes answer one after the other, like on a real ring */
+    uint32_t latency = m.cfg.latencyMs + node->position;
+    switch (req->function)
+    {
+        case EXC_HELLO:
+        case EXC_SIGNATURE:
+            if (OP_GET != req->opType)
+                break;
+            buf[0] = SIGNATURE_VERSION;
+            len = 1 + EncodeSignature(node, &buf[1]);
+            Reply(req, node, latency, OP_STATUS, buf, len);
+            return;
+        case EXC_WELCOME:
+            /* Admin node address (2), signature version (1), signature */
+            if (OP_STARTRESULT != req->opType || 2 > req->payloadLen)
+                break;
+            node->sig.nodeAddress = (req->pPayload[0] << 8) | req->pPayload[1];
+            if (!node->welcomed)
+                ++m.stats.discoveredNodes;
+            node->welcomed = true;
+            buf[0] = 0x00;
+            buf[1] = SIGNATURE_VERSION;
+            len = 2 + EncodeSignature(node, &buf[2]);
+            Reply(req, node, latency, OP_RESULT, buf, len);
+            return;
+        case EXC_DEVICE_INIT:
+            node->welcomed = false;
+            node->sig.nodeAddress = m.cfg.nodes[node->position].nodeAddress;
+            return;
+        default:
+            break;
+    }
+    ReplyGeneric(req, node);
+}
+
+static void OnUnknown(const Message_t *req, Node_t *node)
+{
+    uint8_t buf[2];
+    ++m.stats.unknownMessages;
+    buf[0] = ERR_FBLOCK_NOT_AVAIL;
+    buf[1] = req->fblock;
+    if (OP_STARTRESULTACK == req->opType || OP_STARTACK == req->opType)
+        ReplyAck(req, node, m.cfg.latencyMs, OP_ERRORACK, buf, 2);
+    else if (OP_SET != req->opType)
+        Reply(req, node, m.cfg.latencyMs, OP_ERROR, buf, 2);
+}
+
+/* Functions not simulated in detail succeed without returning anything */
+static void ReplyGeneric(const Message_t *req, Node_t *node)
+{
+    switch (req->opType)
+    {
+        case OP_GET:
+            Reply(req, node, m.cfg.latencyMs, OP_STATUS, NULL, 0);
+            break;
+        case OP_SETGET:
+            Reply(req, node, m.cfg.latencyMs, OP_STATUS, req->pPayload, req->payloadLen);
+            break;
+        case OP_STARTRESULTACK:
+        case OP_STARTACK:
+            ReplyAck(req, node, m.cfg.latencyMs, OP_RESULTACK, NULL, 0);
+            break;
+        default:
+            /* Set and Start do not get an answer */
+            break;
+    }
+}
+
+static void Reply(const Message_t *req, Node_t *node, uint32_t delayMs, uint8_t opType, const uint8_t *pPayload, uint16_t len)
+{
+    uint8_t buf[INICSIM_MAX_MSG_SIZE];
+    uint8_t pos = 0;
+    uint16_t source;
+    uint32_t hdrLen = (CONTENT_TGT_SRC == req->content) ? 10 : 8;
+    if (INICSIM_MAX_MSG_SIZE - PM_HEADER_SIZE - hdrLen < len)
+        len = INICSIM_MAX_MSG_SIZE - PM_HEADER_SIZE - hdrLen;
+    /* Answers to broadcasts come from the node address, others from the address the request was sent to */
+    source = req->targetAddr;
+    if (ADDR_GROUP_FIRST <= source && ADDR_BROADCAST >= source)
+        source = node->sig.nodeAddress;
+    if (CONTENT_TGT_SRC == req->content)
+    {
+        buf[pos++] = req->sourceAddr >> 8;
+        buf[pos++] = req->sourceAddr & 0xFF;
+    }
+    buf[pos++] = source >> 8;
+    buf[pos++] = source & 0xFF;
+    buf[pos++] = req->fblock;
+    buf[pos++] = req->instance;
+    buf[pos++] = req->function >> 4;
+    buf[pos++] = ((req->function & 0xF) << 4) | (opType & 0xF);
+    buf[pos++] = (len >> 8) & 0xF;
+    buf[pos++] = len & 0xFF;
+    if (0 != len)
+        memcpy(&buf[pos], pPayload, len);
+    QueueFrame(delayMs + GetJitter(), req->fifo, MSG_TYPE_DATA, 0, req->content, buf, pos + len);
+}
+
+/* The answers of the acknowledged operation types start with the sender handle of the request */
+static void ReplyAck(const Message_t *req, Node_t *node, uint32_t delayMs, uint8_t opType, const uint8_t *pPayload, uint16_t len)
+{
+    uint8_t buf[INICSIM_MAX_MSG_SIZE];
+    if (INICSIM_MAX_MSG_SIZE - 2 < len)
+        len = INICSIM_MAX_MSG_SIZE - 2;
+    buf[0] = (2 <= req->payloadLen) ? req->pPayload[0] : 0;
+    buf[1] = (2 <= req->payloadLen) ? req->pPayload[1] : 0;
+    if (0 != len)
+        memcpy(&buf[2], pPayload, len);
+    Reply(req, node, delayMs, opType, buf, 2 + len);
+}
+
+static void SendNetworkStatus(uint32_t delayMs, uint16_t events)
+{
+    Message_t req;
+    uint8_t buf[11];
+    /* Reported as it will be, when the message is due */
+    bool available = m.startupRequested && (int32_t)(m.nowMs + delayMs - m.availableMs) >= 0;
+    memset(&req, 0, sizeof(req));
+    req.fifo = FIFO_ICM;
+    req.content = m.content;
+    req.sourceAddr = m.ehcAddress;
+    req.targetAddr = ADDR_LOCAL_INIC;
+    req.fblock = FB_INIC;
+    req.function = INIC_NW_STATUS;
+    buf[0] = events >> 8;
+    buf[1] = events & 0xFF;
+    buf[2] = available ? AVAIL_AVAILABLE : AVAIL_NOT_AVAILABLE;
+    buf[3] = available ? AVAIL_INFO_STABLE : AVAIL_INFO_REGULAR;
+    buf[4] = AVAIL_CAUSE_COMMAND;
+    buf[5] = m.nodes[0].sig.nodeAddress >> 8;
+    buf[6] = m.nodes[0].sig.nodeAddress & 0xFF;
+    buf[7] = 0x00;
+    buf[8] = available ? m.cfg.nodeCnt : 0;
+    buf[9] = m.packetBw >> 8;
+    buf[10] = m.packetBw & 0xFF;
+    Reply(&req, &m.nodes[0], delayMs, OP_STATUS, buf, sizeof(buf));
+}
+
+/* Inserts the message after all messages due earlier or at the same time, so the order is kept */
+static void QueueFrame(uint32_t delayMs, uint8_t fifo, uint8_t type, uint8_t sid, uint8_t extType, const uint8_t *pData, uint32_t len)
+{
+    Pending_t *p;
+    uint32_t i, due = m.nowMs + delayMs;
+    if (QUEUE_SIZE <= m.queueCnt)
+    {
+        fprintf(stderr, "Error: Too many pending messages, message dropped\n");
+        return;
+    }
+    if (INICSIM_MAX_MSG_SIZE - PM_HEADER_SIZE < len)
+        len = INICSIM_MAX_MSG_SIZE - PM_HEADER_SIZE;
+    for (i = m.queueCnt; 0 < i && (int32_t)(m.queue[i - 1].dueMs - due) > 0; i--);
+    memmove(&m.queue[i + 1], &m.queue[i], (m.queueCnt - i) * sizeof(Pending_t));
+    ++m.queueCnt;
+    p = &m.queue[i];
+    p->dueMs = due;
+    p->len = PM_HEADER_SIZE + len;
+    p->data[PM_PML_POS] = (p->len - 2) >> 8;
+    p->data[PM_PML_POS + 1] = (p->len - 2) & 0xFF;
+    p->data[PM_PMHL_POS] = 3;
+    p->data[PM_FPH_POS] = m.fphVersion | ((fifo << FPH_FIFO_POS) & FPH_FIFO_MASK)
+        | ((type << FPH_TYPE_POS) & FPH_TYPE_MASK) | FPH_DIR_RX;
+    p->data[PM_SID_POS] = sid;
+    p->data[PM_EXT_TYPE_POS] = extType;
+    if (0 != len)
+        memcpy(&p->data[PM_HEADER_SIZE], pData, len);
+}
+
+static bool IsAvailable(void)
+{
+    return m.startupRequested && (int32_t)(m.nowMs - m.availableMs) >= 0;
+}
+
+/* xorshift32, so the delays only depend on the seed and not on the C library */
+static uint32_t GetJitter(void)
+{
+    if (0 == m.cfg.jitterMs)
+        return 0;
+    m.random ^= m.random << 13;
+    m.random ^= m.random >> 17;
+    m.random ^= m.random << 5;
+    return m.random % (m.cfg.jitterMs + 1);
+}
+
+static void ForgetWelcome(void)
+{
+    uint8_t i;
+    for (i = 1; i < m.cfg.nodeCnt; i++)
+        m.nodes[i].welcomed = false;
+}
+
+/* The create functions of ports, sockets and connections all end with 1 */
+static bool IsCreateFunction(uint16_t function)
+{
+    if (0x1 != (function & 0xF))
+        return false;
+    return (0x611 <= function && 0x701 >= function) || (0x851 <= function && 0x911 >= function);
+}
+
+static uint8_t EncodeSignature(const Node_t *node, uint8_t *pBuf)
+{
+    const InicSimNode_t *s = &node->sig;
+    uint16_t posAddr = ADDR_POSITION_FIRST + node->position;
+    pBuf[0] = s->nodeAddress >> 8;
+    pBuf[1] = s->nodeAddress & 0xFF;
+    pBuf[2] = s->groupAddress >> 8;
+    pBuf[3] = s->groupAddress & 0xFF;
+    memcpy(&pBuf[4], s->mac, 6);
+    pBuf[10] = posAddr >> 8;
+    pBuf[11] = posAddr & 0xFF;
+    pBuf[12] = s->diagnosisId >> 8;
+    pBuf[13] = s->diagnosisId & 0xFF;
+    pBuf[14] = s->numPorts;
+    pBuf[15] = s->chipId;
+    pBuf[16] = s->fwMajor;
+    pBuf[17] = s->fwMinor;
+    pBuf[18] = s->fwRelease;
+    pBuf[19] = s->fwBuild >> 24;
+    pBuf[20] = s->fwBuild >> 16;
+    pBuf[21] = s->fwBuild >> 8;
+    pBuf[22] = s->fwBuild & 0xFF;
+    pBuf[23] = s->csMajor;
+    pBuf[24] = s->csMinor;
+    pBuf[25] = s->csRelease;
+    return SIGNATURE_SIZE;
+}
+
+static void PrintMessage(bool isRx, const uint8_t *pData, uint32_t len)
+{
+    uint32_t i;
+    printf("%08u: %s:", m.nowMs, isRx ? "RX" : "TX");
+    for (i = 0; i < len; i++)
+        printf(" %02X", pData[i]);
+    printf("\n");
+}
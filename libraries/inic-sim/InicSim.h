@@ -0,0 +1,151 @@
+/*------------------------------------------------------------------------------------------------*/
+/* INIC Simulator                                                                                 */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#ifndef INICSIM_H_
+#define INICSIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define INICSIM_MAX_NODES       (64)
+/* Same as the receive buffer of the CDEV handler, longer messages would be cut */
+#define INICSIM_MAX_MSG_SIZE    (64)
+
+/** Signature reported by a virtual node on node discovery */
+typedef struct
+{
+    uint16_t nodeAddress;
+    uint16_t groupAddress;
+    uint8_t mac[6];
+    uint16_t diagnosisId;
+    uint8_t numPorts;
+    uint8_t chipId;
+    uint8_t fwMajor;
+    uint8_t fwMinor;
+    uint8_t fwRelease;
+    uint32_t fwBuild;
+    uint8_t csMajor;
+    uint8_t csMinor;
+    uint8_t csRelease;
+} InicSimNode_t;
+
+/** Behavior of the simulated network */
+typedef struct
+{
+    /** The first node is the local INIC, the others are found by node discovery in this order */
+    InicSimNode_t nodes[INICSIM_MAX_NODES];
+    uint8_t nodeCnt;
+    /** Time until an INIC answers a request */
+    uint32_t latencyMs;
+    /** Time from starting the network until it is available */
+    uint32_t startupMs;
+    /** Time until an I2C read or write is finished */
+    uint32_t i2cLatencyMs;
+    /** Time until a GPIO pin mode or state request is answered */
+    uint32_t gpioLatencyMs;
+    /** Every answer is delayed by up to this time in addition, 0 to disable */
+    uint32_t jitterMs;
+    /** Start value of the random generator used for the jitter, the same seed gives the same delays */
+    uint32_t seed;
+    /** Prints every message received and sent */
+    bool verbose;
+} InicSimConfig_t;
+
+/** Counters since the last reset */
+typedef struct
+{
+    uint32_t rxMessages;
+    uint32_t txMessages;
+    uint32_t unknownMessages;
+    uint32_t resources;
+    uint32_t discoveredNodes;
+    uint32_t networkStartups;
+    /** Time the network was available the last time, 0 if it never was */
+    uint32_t availableMs;
+} InicSimStats_t;
+
+/**
+ * \brief Sets the configuration and puts the simulated network into the state after power on
+ * \param pCfg - Behavior of the simulated network, it is copied
+ */
+void InicSim_Init(const InicSimConfig_t *pCfg);
+
+/**
+ * \brief Puts the simulated network into the state after power on, e.g. when unicensd was restarted
+ */
+void InicSim_Reset(void);
+
+/**
+ * \brief Processes a port message sent by unicensd
+ * \param nowMs - Current time in milliseconds
+ * \param pData - The port message
+ * \param len - Length of the port message
+ */
+void InicSim_OnTx(uint32_t nowMs, const uint8_t *pData, uint32_t len);
+
+/**
+ * \brief Gets the next port message to send to unicensd, if it is due
+ * \param nowMs - Current time in milliseconds
+ * \param pData - Buffer of INICSIM_MAX_MSG_SIZE bytes, receiving the port message
+ * \param pLen - Receives the length of the port message
+ * \return true, if a message was copied. false, if there is no message due
+ */
+bool InicSim_GetRx(uint32_t nowMs, uint8_t *pData, uint32_t *pLen);
+
+/**
+ * \brief Gets the time until the next port message is due
+ * \param nowMs - Current time in milliseconds
+ * \return Time in milliseconds, 0 if a message is due, -1 if there is no message pending
+ */
+int32_t InicSim_GetTimeout(uint32_t nowMs);
+
+/**
+ * \brief Breaks or closes the ring, while broken the network can not be started
+ * \note Breaking the ring of an available network lets it become unavailable immediately and all remote nodes
+ *       forget their welcome, like after a real cable loss
+ * \param nowMs - Current time in milliseconds
+ * \param isBroken - true to break the ring, false to close it again
+ */
+void InicSim_SetRingBreak(uint32_t nowMs, bool isBroken);
+
+/**
+ * \brief Gets the counters since the last reset
+ * \param pStats - Receives the counters
+ */
+void InicSim_GetStats(InicSimStats_t *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INICSIM_H_ */
@@ -0,0 +1,522 @@
+/*------------------------------------------------------------------------------------------------*/
+/* LLD Trace Replay                                                                               */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include "LldTrace.h"
+#include "LldReplay.h"
+
+/* How much longer than recorded UNICENS may take to send a message, until it is given up */
+#define STALL_TIMEOUT_US    (1000000)
+/* UNICENS may send messages in a different order than recorded, a sent message is looked up
+ * in this many pending messages of the recording */
+#define MATCH_WINDOW        (16)
+
+typedef enum
+{
+    RecState_Pending,
+    RecState_Done,
+    RecState_Missing
+} RecState_t;
+
+typedef struct
+{
+    uint64_t tsUs;
+    uint64_t doneUs;
+    uint8_t *pData;
+    uint32_t len;
+    bool isTx;
+    RecState_t state;
+} Record_t;
+
+typedef struct
+{
+    bool isOpen;
+    bool stop;
+    bool finished;
+    bool rxPending;
+    double speed;
+    uint8_t *pFile;
+    Record_t *pRec;
+    uint32_t recCnt;
+    /**Next received message to pass on, all received messages before were taken by UNICENS.*/
+    uint32_t rxPos;
+    /**First message UNICENS has not sent yet, all sent messages before were found or given up.*/
+    uint32_t txPos;
+    /**Sent message following the last received one in the recording, recCnt if there is none.*/
+    uint32_t responsePos;
+    uint64_t responseStartUs;
+    uint64_t deliveredUs;
+    uint64_t startUs;
+    uint64_t progressUs;
+    struct rusage startUsage;
+    LldReplayStats_t stats;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_t replayThread;
+} LocalVar_t;
+
+static LocalVar_t m = { 0 };
+
+static bool LoadFile(const char *fileName);
+static uint32_t ReadU32(const uint8_t *pData, bool swapped);
+static void *ReplayThread(void *arg);
+static void GiveUpTx(uint64_t now);
+static void AdvanceRx(void);
+static void AdvanceTx(void);
+static uint64_t GetGapUs(uint32_t pos);
+static void WaitUntil(uint64_t us);
+static void UpdateTimes(void);
+static void AddLatency(LldReplayLatency_t *pLatency, uint64_t us);
+static uint64_t GetUs(void);
+static uint64_t GetTimevalUs(const struct timeval *pTime);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+bool LldReplay_Open(const char *fileName, double speed)
+{
+    pthread_condattr_t attr;
+    if (NULL == fileName || m.isOpen || 0.0 > speed)
+        return false;
+    memset(&m.stats, 0, sizeof(m.stats));
+    if (!LoadFile(fileName))
+        return false;
+    m.stop = false;
+    m.finished = false;
+    m.rxPending = false;
+    m.speed = speed;
+    m.rxPos = 0;
+    m.txPos = 0;
+    m.responsePos = m.recCnt;
+    AdvanceRx();
+    AdvanceTx();
+    pthread_mutex_init(&m.mutex, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&m.cond, &attr);
+    pthread_condattr_destroy(&attr);
+    getrusage(RUSAGE_SELF, &m.startUsage);
+    m.startUs = GetUs();
+    m.progressUs = m.startUs;
+    if (0 != pthread_create(&m.replayThread, NULL, ReplayThread, NULL))
+    {
+        pthread_cond_destroy(&m.cond);
+        pthread_mutex_destroy(&m.mutex);
+        free(m.pRec);
+        free(m.pFile);
+        return false;
+    }
+    m.isOpen = true;
+    return true;
+}
+
+bool LldReplay_GetRx(uint8_t **pData, uint32_t *len)
+{
+    bool success = false;
+    if (!m.isOpen || NULL == pData || NULL == len)
+        return false;
+    pthread_mutex_lock(&m.mutex);
+    if (m.rxPending)
+    {
+        *pData = m.pRec[m.rxPos].pData;
+        *len = m.pRec[m.rxPos].len;
+        success = true;
+    }
+    pthread_mutex_unlock(&m.mutex);
+    return success;
+}
+
+bool LldReplay_PopRx(void)
+{
+    uint64_t now;
+    if (!m.isOpen)
+        return false;
+    pthread_mutex_lock(&m.mutex);
+    if (!m.rxPending)
+    {
+        pthread_mutex_unlock(&m.mutex);
+        return false;
+    }
+    now = GetUs();
+    AddLatency(&m.stats.delivery, now - m.deliveredUs);
+    m.pRec[m.rxPos].state = RecState_Done;
+    m.pRec[m.rxPos].doneUs = now;
+    ++m.stats.rxMessages;
+    m.rxPending = false;
+    m.responsePos = m.recCnt;
+    if (m.rxPos + 1 < m.recCnt && m.pRec[m.rxPos + 1].isTx && RecState_Pending == m.pRec[m.rxPos + 1].state)
+    {
+        m.responsePos = m.rxPos + 1;
+        m.responseStartUs = now;
+    }
+    ++m.rxPos;
+    AdvanceRx();
+    m.progressUs = now;
+    pthread_cond_signal(&m.cond);
+    pthread_mutex_unlock(&m.mutex);
+    return true;
+}
+
+bool LldReplay_Write(const uint8_t *pData, uint32_t len)
+{
+    uint32_t i, checked = 0;
+    uint32_t found;
+    uint64_t now;
+    if (!m.isOpen || NULL == pData)
+        return false;
+    pthread_mutex_lock(&m.mutex);
+    found = m.recCnt;
+    for (i = m.txPos; i < m.recCnt && checked < MATCH_WINDOW; i++)
+    {
+        Record_t *pRec = &m.pRec[i];
+        if (!pRec->isTx || RecState_Pending != pRec->state)
+            continue;
+        ++checked;
+        if (len == pRec->len && 0 == memcmp(pData, pRec->pData, len))
+        {
+            found = i;
+            break;
+        }
+    }
+    if (found < m.recCnt)
+    {
+        now = GetUs();
+        m.pRec[found].state = RecState_Done;
+        m.pRec[found].doneUs = now;
+        ++m.stats.txMatched;
+        if (found == m.responsePos)
+        {
+            AddLatency(&m.stats.response, now - m.responseStartUs);
+            m.responsePos = m.recCnt;
+        }
+        AdvanceTx();
+        m.progressUs = now;
+        pthread_cond_signal(&m.cond);
+    }
+    else
+    {
+        ++m.stats.txUnexpected;
+    }
+    pthread_mutex_unlock(&m.mutex);
+    return true;
+}
+
+bool LldReplay_GetStats(LldReplayStats_t *pStats)
+{
+    if (!m.isOpen || NULL == pStats)
+        return false;
+    pthread_mutex_lock(&m.mutex);
+    if (!m.finished)
+        UpdateTimes();
+    *pStats = m.stats;
+    pthread_mutex_unlock(&m.mutex);
+    return true;
+}
+
+uint64_t LldReplay_GetElapsedUs(void)
+{
+    if (!m.isOpen)
+        return 0;
+    return GetUs() - m.startUs;
+}
+
+uint32_t LldReplay_GetPercentile(const LldReplayLatency_t *pLatency, uint32_t percent)
+{
+    uint64_t target, sum = 0;
+    uint32_t i;
+    if (NULL == pLatency || 0 == pLatency->count)
+        return 0;
+    if (100 < percent)
+        percent = 100;
+    target = ((uint64_t)pLatency->count * percent + 99) / 100;
+    for (i = 0; i < LLD_REPLAY_HISTOGRAM_SIZE; i++)
+    {
+        sum += pLatency->histogram[i];
+        if (sum >= target && 0 != sum)
+        {
+            uint64_t bound = (2ULL << i) - 1;
+            return (bound < pLatency->maxUs) ? (uint32_t)bound : pLatency->maxUs;
+        }
+    }
+    return pLatency->maxUs;
+}
+
+void LldReplay_Close(void)
+{
+    if (!m.isOpen)
+        return;
+    pthread_mutex_lock(&m.mutex);
+    m.stop = true;
+    pthread_cond_signal(&m.cond);
+    pthread_mutex_unlock(&m.mutex);
+    pthread_join(m.replayThread, NULL);
+    pthread_cond_destroy(&m.cond);
+    pthread_mutex_destroy(&m.mutex);
+    free(m.pRec);
+    free(m.pFile);
+    m.pRec = NULL;
+    m.pFile = NULL;
+    m.isOpen = false;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static uint32_t ReadU32(const uint8_t *pData, bool swapped)
+{
+    uint32_t val;
+    memcpy(&val, pData, sizeof(val));
+    return swapped ? __builtin_bswap32(val) : val;
+}
+
+static bool LoadFile(const char *fileName)
+{
+    FILE *fp;
+    long fileSize;
+    uint32_t pos, maxCnt;
+    bool swapped;
+    fp = fopen(fileName, "rb");
+    if (NULL == fp)
+        return false;
+    if (0 != fseek(fp, 0, SEEK_END) || 0 > (fileSize = ftell(fp)) || 0 != fseek(fp, 0, SEEK_SET)
+        || (long)sizeof(LldTraceFileHeader_t) > fileSize)
+    {
+        fclose(fp);
+        return false;
+    }
+    m.pFile = malloc(fileSize);
+    if (NULL == m.pFile || 1 != fread(m.pFile, fileSize, 1, fp))
+    {
+        fclose(fp);
+        free(m.pFile);
+        m.pFile = NULL;
+        return false;
+    }
+    fclose(fp);
+    if (LLD_TRACE_PCAP_MAGIC == ReadU32(m.pFile, false))
+        swapped = false;
+    else if (LLD_TRACE_PCAP_MAGIC == ReadU32(m.pFile, true))
+        swapped = true;
+    else
+    {
+        free(m.pFile);
+        m.pFile = NULL;
+        return false;
+    }
+    /* Every record has at least a header and the direction byte */
+    maxCnt = fileSize / (sizeof(LldTraceRecord_t) + 1) + 1;
+    m.pRec = calloc(maxCnt, sizeof(Record_t));
+    if (NULL == m.pRec)
+    {
+        free(m.pFile);
+        m.pFile = NULL;
+        return false;
+    }
+    m.recCnt = 0;
+    pos = sizeof(LldTraceFileHeader_t);
+    while (pos + sizeof(LldTraceRecord_t) <= (uint32_t)fileSize)
+    {
+        const uint8_t *pHdr = &m.pFile[pos];
+        uint32_t inclLen = ReadU32(pHdr + offsetof(LldTraceRecord_t, inclLen), swapped);
+        uint32_t origLen = ReadU32(pHdr + offsetof(LldTraceRecord_t, origLen), swapped);
+        uint8_t *pData = &m.pFile[pos + sizeof(LldTraceRecord_t)];
+        pos += sizeof(LldTraceRecord_t);
+        if (inclLen > fileSize - pos)
+            break; /* Incomplete, the daemon was killed while writing */
+        pos += inclLen;
+        if (0 == inclLen)
+            continue;
+        if (LldTraceDir_Dropped == pData[0])
+        {
+            if (1 + sizeof(uint32_t) <= inclLen)
+                m.stats.skipped += ReadU32(pData + 1, swapped);
+            continue;
+        }
+        if ((LldTraceDir_Tx != pData[0] && LldTraceDir_Rx != pData[0]) || inclLen < origLen || 1 == inclLen)
+        {
+            ++m.stats.skipped;
+            continue;
+        }
+        m.pRec[m.recCnt].tsUs = (uint64_t)ReadU32(pHdr + offsetof(LldTraceRecord_t, tsSec), swapped) * 1000000
+            + ReadU32(pHdr + offsetof(LldTraceRecord_t, tsUsec), swapped);
+        m.pRec[m.recCnt].pData = pData + 1;
+        m.pRec[m.recCnt].len = inclLen - 1;
+        m.pRec[m.recCnt].isTx = (LldTraceDir_Tx == pData[0]);
+        m.pRec[m.recCnt].state = RecState_Pending;
+        ++m.recCnt;
+    }
+    if (0 != m.recCnt)
+        m.stats.recordedUs = m.pRec[m.recCnt - 1].tsUs - m.pRec[0].tsUs;
+    return true;
+}
+
+static void *ReplayThread(void *arg)
+{
+    arg = arg;
+    pthread_mutex_lock(&m.mutex);
+    while (!m.stop)
+    {
+        uint64_t now = GetUs();
+        uint64_t readyUs;
+        if (m.rxPending)
+        {
+            /* UNICENS did not take the last one yet */
+            pthread_cond_wait(&m.cond, &m.mutex);
+            continue;
+        }
+        if (m.rxPos == m.recCnt && m.txPos == m.recCnt)
+        {
+            m.finished = true;
+            break;
+        }
+        if (m.txPos < m.rxPos)
+        {
+            /* The received message answers a message UNICENS did not send yet */
+            uint64_t deadline = m.progressUs + GetGapUs(m.txPos) + STALL_TIMEOUT_US;
+            if (now < deadline)
+                WaitUntil(deadline);
+            else
+                GiveUpTx(now);
+            continue;
+        }
+        readyUs = (0 == m.rxPos) ? m.startUs : m.pRec[m.rxPos - 1].doneUs;
+        if (0.0 != m.speed)
+            readyUs += (uint64_t)(GetGapUs(m.rxPos) / m.speed);
+        if (now < readyUs)
+        {
+            WaitUntil(readyUs);
+            continue;
+        }
+        m.rxPending = true;
+        m.deliveredUs = now;
+        pthread_mutex_unlock(&m.mutex);
+        LldReplay_CB_OnDataAvailable();
+        pthread_mutex_lock(&m.mutex);
+    }
+    if (m.finished)
+        UpdateTimes();
+    pthread_mutex_unlock(&m.mutex);
+    if (m.finished)
+        LldReplay_CB_OnFinished();
+    return NULL;
+}
+
+static void GiveUpTx(uint64_t now)
+{
+    uint32_t i;
+    for (i = m.txPos; i < m.rxPos; i++)
+    {
+        if (!m.pRec[i].isTx || RecState_Pending != m.pRec[i].state)
+            continue;
+        m.pRec[i].state = RecState_Missing;
+        m.pRec[i].doneUs = now;
+        ++m.stats.txMissing;
+        if (i == m.responsePos)
+            m.responsePos = m.recCnt;
+    }
+    AdvanceTx();
+    m.progressUs = now;
+}
+
+static void AdvanceRx(void)
+{
+    while (m.rxPos < m.recCnt && m.pRec[m.rxPos].isTx)
+        ++m.rxPos;
+}
+
+static void AdvanceTx(void)
+{
+    while (m.txPos < m.recCnt && (!m.pRec[m.txPos].isTx || RecState_Pending != m.pRec[m.txPos].state))
+        ++m.txPos;
+}
+
+/* Time between the given record and the one before in the recording */
+static uint64_t GetGapUs(uint32_t pos)
+{
+    if (0 == pos || pos >= m.recCnt || m.pRec[pos].tsUs < m.pRec[pos - 1].tsUs)
+        return 0;
+    return m.pRec[pos].tsUs - m.pRec[pos - 1].tsUs;
+}
+
+static void WaitUntil(uint64_t us)
+{
+    struct timespec t;
+    t.tv_sec = us / 1000000;
+    t.tv_nsec = (us % 1000000) * 1000;
+    pthread_cond_timedwait(&m.cond, &m.mutex, &t);
+}
+
+static void UpdateTimes(void)
+{
+    struct rusage usage;
+    m.stats.replayUs = GetUs() - m.startUs;
+    if (0 != getrusage(RUSAGE_SELF, &usage))
+        return;
+    m.stats.cpuUserUs = GetTimevalUs(&usage.ru_utime) - GetTimevalUs(&m.startUsage.ru_utime);
+    m.stats.cpuSystemUs = GetTimevalUs(&usage.ru_stime) - GetTimevalUs(&m.startUsage.ru_stime);
+}
+
+static void AddLatency(LldReplayLatency_t *pLatency, uint64_t us)
+{
+    uint32_t bucket = 0;
+    if (0xFFFFFFFF < us)
+        us = 0xFFFFFFFF;
+    if (0 == pLatency->count || us < pLatency->minUs)
+        pLatency->minUs = (uint32_t)us;
+    if (us > pLatency->maxUs)
+        pLatency->maxUs = (uint32_t)us;
+    ++pLatency->count;
+    pLatency->sumUs += us;
+    if (0 != us)
+        bucket = 63 - __builtin_clzll(us);
+    if (LLD_REPLAY_HISTOGRAM_SIZE <= bucket)
+        bucket = LLD_REPLAY_HISTOGRAM_SIZE - 1;
+    ++pLatency->histogram[bucket];
+}
+
+static uint64_t GetUs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static uint64_t GetTimevalUs(const struct timeval *pTime)
+{
+    return (uint64_t)pTime->tv_sec * 1000000 + pTime->tv_usec;
+}
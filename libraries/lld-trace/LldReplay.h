@@ -0,0 +1,165 @@
+/*------------------------------------------------------------------------------------------------*/
+/* LLD Trace Replay                                                                               */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#ifndef LLDREPLAY_H
+#define LLDREPLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Latencies are collected in buckets of powers of two microseconds */
+#define LLD_REPLAY_HISTOGRAM_SIZE (32)
+
+typedef struct
+{
+    uint32_t count;
+    uint64_t sumUs;
+    uint32_t minUs;
+    uint32_t maxUs;
+    /** Bucket n counts the latencies from 2^n to 2^(n+1)-1 microseconds, bucket 0 includes 0 */
+    uint32_t histogram[LLD_REPLAY_HISTOGRAM_SIZE];
+} LldReplayLatency_t;
+
+typedef struct
+{
+    /** Port messages of the recording passed to UNICENS */
+    uint32_t rxMessages;
+    /** Port messages sent by UNICENS, which were found in the recording */
+    uint32_t txMatched;
+    /** Port messages sent by UNICENS, which were not found in the recording */
+    uint32_t txUnexpected;
+    /** Port messages of the recording, which UNICENS did not send in time */
+    uint32_t txMissing;
+    /** Records which could not be replayed, because they were cut or not captured at all */
+    uint32_t skipped;
+    /** Time between the first and the last record of the recording */
+    uint64_t recordedUs;
+    /** Time between starting and finishing the replay */
+    uint64_t replayUs;
+    /** CPU time used by the whole process during the replay */
+    uint64_t cpuUserUs;
+    uint64_t cpuSystemUs;
+    /** From passing a received message to UNICENS, until it was taken from the stand-in CDEV */
+    LldReplayLatency_t delivery;
+    /** From taking a received message, until UNICENS sent the message following it in the recording */
+    LldReplayLatency_t response;
+} LldReplayStats_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            REPLAY API                                */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/**
+ * \brief Loads a capture written by LldTrace and starts replaying it as stand-in for the control CDEVs.
+ * \note A received message is only passed on, when UNICENS has sent all messages preceding it in the
+ *       recording. If UNICENS does not send one of them, it is given up after a timeout.
+ * \param fileName - Path of the capture file.
+ * \param speed - 1.0 replays with the recorded response times of the INIC, 10.0 ten times faster.
+ *                0.0 passes every message on as soon as possible.
+ * \return true, if successful. false, otherwise, do not call any other function in this case.
+ */
+bool LldReplay_Open(const char *fileName, double speed);
+
+/**
+ * \brief Gets the received message to process. The content will stay valid until LldReplay_PopRx is called.
+ * \note Same behavior as Cdev_GetRx, only call it after LldReplay_CB_OnDataAvailable was raised.
+ * \param pData - To this Pointer the pointer of RX payload will be written.
+ * \param len - To this pointer the length in bytes of RX payload will be written.
+ * \return true, if successful. false, otherwise.
+ */
+bool LldReplay_GetRx(uint8_t **pData, uint32_t *len);
+
+/**
+ * \brief Releases the data provided by LldReplay_GetRx.
+ * \return true, if successful. false, otherwise.
+ */
+bool LldReplay_PopRx(void);
+
+/**
+ * \brief Takes a message sent by UNICENS and looks it up in the recording.
+ * \param pData - Pointer to the payload to be sent.
+ * \param len - Length in bytes of the payload.
+ * \return true, if successful. false, otherwise.
+ */
+bool LldReplay_Write(const uint8_t *pData, uint32_t len);
+
+/**
+ * \brief Gets the current statistics, after LldReplay_CB_OnFinished they are final.
+ * \param pStats - Where to copy the statistics to.
+ * \return true, if successful. false, otherwise.
+ */
+bool LldReplay_GetStats(LldReplayStats_t *pStats);
+
+/**
+ * \brief Gets the time since the replay was started.
+ * \return The time in microseconds, 0 if not replaying.
+ */
+uint64_t LldReplay_GetElapsedUs(void);
+
+/**
+ * \brief Estimates a percentile from the histogram of a latency.
+ * \param pLatency - The latency statistic.
+ * \param percent - The percentile to get (e.g. 50 or 99).
+ * \return The upper bound in microseconds of the bucket holding the percentile.
+ */
+uint32_t LldReplay_GetPercentile(const LldReplayLatency_t *pLatency, uint32_t percent);
+
+/**
+ * \brief Stops the replay and frees the recording.
+ */
+void LldReplay_Close(void);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                        CALLBACK SECTION                              */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/**
+ * \brief Callback when ever the replay has a received message to process.
+ * \note This function must be implemented by the integrator, it is called by the replay thread.
+ * \note Do not call any functions of this component inside this callback.
+ */
+extern void LldReplay_CB_OnDataAvailable(void);
+
+/**
+ * \brief Callback when all records of the recording were replayed.
+ * \note This function must be implemented by the integrator, it is called by the replay thread.
+ * \note Do not call any functions of this component inside this callback.
+ */
+extern void LldReplay_CB_OnFinished(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LLDREPLAY_H */
@@ -0,0 +1,329 @@
+/*------------------------------------------------------------------------------------------------*/
+/* LLD Trace Capture                                                                              */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/uio.h>
+#include "LldTrace.h"
+
+/* Holds the messages not yet written, must be a power of two */
+#define RING_SIZE           (0x40000)
+/* The writer looks for new messages this often, so that capturing does not need any system call */
+#define WRITE_INTERVAL_MS   (20)
+#define NAME_LEN            (256)
+
+typedef struct
+{
+    bool isOpen;
+    /**Free running byte counters, head is written by LldTrace_Capture only, tail by the writer only.*/
+    uint32_t head;
+    uint32_t tail;
+    uint32_t dropped;
+    uint32_t wakeupPending;
+    uint32_t stop;
+    sem_t wakeupSem;
+    pthread_t writerThread;
+    int fd;
+    uint32_t fileSize;
+    uint32_t maxFileSize;
+    char fileName[NAME_LEN];
+    char oldFileName[NAME_LEN + 2];
+    uint8_t ring[RING_SIZE];
+} LocalVar_t;
+
+static LocalVar_t m = { 0 };
+
+static bool OpenFile(void);
+static void *WriterThread(void *arg);
+static void WritePending(void);
+static void WriteDropped(uint32_t dropped);
+static void PrepareRecord(uint32_t recLen);
+static uint32_t PutRing(uint32_t pos, const void *pData, uint32_t len);
+static void GetRing(uint32_t pos, void *pData, uint32_t len);
+static void WriteRing(uint32_t pos, uint32_t len);
+static void WriteAll(struct iovec *pIov, int iovCnt);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+bool LldTrace_Open(const char *fileName, uint32_t maxFileSize)
+{
+    static bool exitRegistered = false;
+    if (NULL == fileName || m.isOpen)
+        return false;
+    m.head = 0;
+    m.tail = 0;
+    m.dropped = 0;
+    m.wakeupPending = 0;
+    m.stop = 0;
+    m.maxFileSize = maxFileSize;
+    if (NAME_LEN <= snprintf(m.fileName, sizeof(m.fileName), "%s", fileName))
+        return false;
+    snprintf(m.oldFileName, sizeof(m.oldFileName), "%s.1", fileName);
+    if (!OpenFile())
+        return false;
+    if (0 != sem_init(&m.wakeupSem, 0, 0))
+    {
+        close(m.fd);
+        return false;
+    }
+    if (0 != pthread_create(&m.writerThread, NULL, WriterThread, NULL))
+    {
+        sem_destroy(&m.wakeupSem);
+        close(m.fd);
+        return false;
+    }
+    if (!exitRegistered)
+    {
+        atexit(LldTrace_Close);
+        exitRegistered = true;
+    }
+    m.isOpen = true;
+    return true;
+}
+
+void LldTrace_Capture(LldTraceDir_t dir, const uint8_t *pData, uint32_t len)
+{
+    LldTraceRecord_t rec;
+    struct timespec now;
+    uint8_t dirByte = (uint8_t)dir;
+    uint32_t head, used;
+    if (!m.isOpen || NULL == pData)
+        return;
+    rec.origLen = len + 1;
+    rec.inclLen = (LLD_TRACE_SNAPLEN < rec.origLen) ? LLD_TRACE_SNAPLEN : rec.origLen;
+    head = m.head;
+    used = head - __atomic_load_n(&m.tail, __ATOMIC_ACQUIRE);
+    if (RING_SIZE - used < sizeof(rec) + rec.inclLen)
+    {
+        __atomic_fetch_add(&m.dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    clock_gettime(CLOCK_REALTIME, &now);
+    rec.tsSec = (uint32_t)now.tv_sec;
+    rec.tsUsec = (uint32_t)(now.tv_nsec / 1000);
+    head = PutRing(head, &rec, sizeof(rec));
+    head = PutRing(head, &dirByte, sizeof(dirByte));
+    head = PutRing(head, pData, rec.inclLen - 1);
+    __atomic_store_n(&m.head, head, __ATOMIC_RELEASE);
+    /* Usually the writer finds the messages by itself, it is only woken up early to prevent drops */
+    if (RING_SIZE / 2 < used && 0 == __atomic_exchange_n(&m.wakeupPending, 1, __ATOMIC_ACQ_REL))
+        sem_post(&m.wakeupSem);
+}
+
+void LldTrace_Close(void)
+{
+    if (!m.isOpen)
+        return;
+    m.isOpen = false;
+    __atomic_store_n(&m.stop, 1, __ATOMIC_RELEASE);
+    sem_post(&m.wakeupSem);
+    pthread_join(m.writerThread, NULL);
+    sem_destroy(&m.wakeupSem);
+    close(m.fd);
+}
+
+bool LldTrace_IsOpen(void)
+{
+    return m.isOpen;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                        PRIVATE FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static bool OpenFile(void)
+{
+    LldTraceFileHeader_t header;
+    struct iovec iov;
+    m.fd = open(m.fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (0 > m.fd)
+        return false;
+    memset(&header, 0, sizeof(header));
+    header.magic = LLD_TRACE_PCAP_MAGIC;
+    header.versionMajor = LLD_TRACE_PCAP_MAJOR;
+    header.versionMinor = LLD_TRACE_PCAP_MINOR;
+    header.snapLen = LLD_TRACE_SNAPLEN;
+    header.linkType = LLD_TRACE_LINKTYPE;
+    iov.iov_base = &header;
+    iov.iov_len = sizeof(header);
+    WriteAll(&iov, 1);
+    m.fileSize = sizeof(header);
+    return true;
+}
+
+static void *WriterThread(void *arg)
+{
+    uint32_t stop;
+    arg = arg;
+    do
+    {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += WRITE_INTERVAL_MS * 1000000L;
+        if (1000000000L <= deadline.tv_nsec)
+        {
+            deadline.tv_nsec -= 1000000000L;
+            ++deadline.tv_sec;
+        }
+        while (0 != sem_timedwait(&m.wakeupSem, &deadline) && EINTR == errno);
+        __atomic_store_n(&m.wakeupPending, 0, __ATOMIC_RELEASE);
+        /* Read before writing, so that all messages captured before LldTrace_Close get written */
+        stop = __atomic_load_n(&m.stop, __ATOMIC_ACQUIRE);
+        WritePending();
+    } while (0 == stop);
+    return NULL;
+}
+
+static void WritePending(void)
+{
+    uint32_t tail = m.tail;
+    uint32_t start = tail;
+    uint32_t head = __atomic_load_n(&m.head, __ATOMIC_ACQUIRE);
+    uint32_t dropped = __atomic_exchange_n(&m.dropped, 0, __ATOMIC_RELAXED);
+    while (tail != head)
+    {
+        LldTraceRecord_t rec;
+        uint32_t recLen;
+        GetRing(tail, &rec, sizeof(rec));
+        recLen = sizeof(rec) + rec.inclLen;
+        if (0 != m.maxFileSize && m.fileSize + recLen > m.maxFileSize)
+        {
+            /* Everything before belongs into the current file */
+            WriteRing(start, tail - start);
+            start = tail;
+        }
+        PrepareRecord(recLen);
+        tail += recLen;
+    }
+    WriteRing(start, tail - start);
+    __atomic_store_n(&m.tail, tail, __ATOMIC_RELEASE);
+    if (0 != dropped)
+        WriteDropped(dropped);
+}
+
+static void WriteDropped(uint32_t dropped)
+{
+    LldTraceRecord_t rec;
+    struct timespec now;
+    uint8_t dirByte = LldTraceDir_Dropped;
+    struct iovec iov[3];
+    clock_gettime(CLOCK_REALTIME, &now);
+    rec.tsSec = (uint32_t)now.tv_sec;
+    rec.tsUsec = (uint32_t)(now.tv_nsec / 1000);
+    rec.inclLen = sizeof(dirByte) + sizeof(dropped);
+    rec.origLen = rec.inclLen;
+    PrepareRecord(sizeof(rec) + rec.inclLen);
+    iov[0].iov_base = &rec;
+    iov[0].iov_len = sizeof(rec);
+    iov[1].iov_base = &dirByte;
+    iov[1].iov_len = sizeof(dirByte);
+    iov[2].iov_base = &dropped;
+    iov[2].iov_len = sizeof(dropped);
+    WriteAll(iov, 3);
+}
+
+/* Starts a new file, if the record does not fit anymore. The caller must have written all previous records. */
+static void PrepareRecord(uint32_t recLen)
+{
+    if (0 != m.maxFileSize && m.fileSize + recLen > m.maxFileSize && sizeof(LldTraceFileHeader_t) < m.fileSize)
+    {
+        close(m.fd);
+        rename(m.fileName, m.oldFileName);
+        /* On failure nothing is written anymore, the capture must not disturb the daemon */
+        OpenFile();
+    }
+    m.fileSize += recLen;
+}
+
+static uint32_t PutRing(uint32_t pos, const void *pData, uint32_t len)
+{
+    uint32_t offset = pos & (RING_SIZE - 1);
+    uint32_t first = (RING_SIZE - offset < len) ? RING_SIZE - offset : len;
+    memcpy(&m.ring[offset], pData, first);
+    memcpy(m.ring, (const uint8_t *)pData + first, len - first);
+    return pos + len;
+}
+
+static void GetRing(uint32_t pos, void *pData, uint32_t len)
+{
+    uint32_t offset = pos & (RING_SIZE - 1);
+    uint32_t first = (RING_SIZE - offset < len) ? RING_SIZE - offset : len;
+    memcpy(pData, &m.ring[offset], first);
+    memcpy((uint8_t *)pData + first, m.ring, len - first);
+}
+
+static void WriteRing(uint32_t pos, uint32_t len)
+{
+    struct iovec iov[2];
+    uint32_t offset = pos & (RING_SIZE - 1);
+    uint32_t first = (RING_SIZE - offset < len) ? RING_SIZE - offset : len;
+    if (0 == len)
+        return;
+    iov[0].iov_base = &m.ring[offset];
+    iov[0].iov_len = first;
+    iov[1].iov_base = m.ring;
+    iov[1].iov_len = len - first;
+    WriteAll(iov, (0 == iov[1].iov_len) ? 1 : 2);
+}
+
+static void WriteAll(struct iovec *pIov, int iovCnt)
+{
+    if (0 > m.fd)
+        return;
+    while (0 < iovCnt)
+    {
+        ssize_t written = writev(m.fd, pIov, iovCnt);
+        if (0 > written)
+        {
+            if (EINTR == errno)
+                continue;
+            return;
+        }
+        while (0 < iovCnt && (size_t)written >= pIov->iov_len)
+        {
+            written -= pIov->iov_len;
+            ++pIov;
+            --iovCnt;
+        }
+        if (0 < iovCnt)
+        {
+            pIov->iov_base = (uint8_t *)pIov->iov_base + written;
+            pIov->iov_len -= written;
+        }
+    }
+}
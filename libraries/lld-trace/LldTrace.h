@@ -0,0 +1,127 @@
+/*------------------------------------------------------------------------------------------------*/
+/* LLD Trace Capture                                                                              */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#ifndef LLDTRACE_H
+#define LLDTRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                           FILE LAYOUT                                */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/* The capture is a pcap file in host byte order, it can be opened with any pcap based tool.
+ * Every packet starts with one byte holding the direction, followed by the port message
+ * exactly as exchanged with the INIC. */
+#define LLD_TRACE_PCAP_MAGIC     (0xA1B2C3D4)
+#define LLD_TRACE_PCAP_MAJOR     (2)
+#define LLD_TRACE_PCAP_MINOR     (4)
+/* LINKTYPE_USER0, reserved for private use */
+#define LLD_TRACE_LINKTYPE       (147)
+/* Longer port messages are cut, the original length is kept in the record header */
+#define LLD_TRACE_SNAPLEN        (2048)
+
+typedef enum
+{
+    /** Port message sent to the INIC */
+    LldTraceDir_Tx = 0,
+    /** Port message received from the INIC */
+    LldTraceDir_Rx = 1,
+    /** Not a port message, but the amount of records dropped, because the writer could not keep up (uint32_t) */
+    LldTraceDir_Dropped = 0xFF
+} LldTraceDir_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t versionMajor;
+    uint16_t versionMinor;
+    int32_t thisZone;
+    uint32_t sigFigs;
+    uint32_t snapLen;
+    uint32_t linkType;
+} LldTraceFileHeader_t;
+
+typedef struct
+{
+    /** CLOCK_REALTIME of the capture */
+    uint32_t tsSec;
+    uint32_t tsUsec;
+    /** Bytes following in the file, including the direction byte */
+    uint32_t inclLen;
+    /** Bytes of the whole packet, including the direction byte */
+    uint32_t origLen;
+} LldTraceRecord_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            CAPTURE API                               */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/**
+ * \brief Creates the capture file and starts the thread writing it.
+ * \note LldTrace_Close is registered with atexit.
+ * \param fileName - Path of the capture file, an existing file is overwritten.
+ * \param maxFileSize - If not 0, the file is renamed to fileName.1 when reaching this size and a new one is started.
+ *                      So at most two files of this size are kept.
+ * \return true, if successful. false, otherwise, LldTrace_Capture will discard all messages in this case.
+ */
+bool LldTrace_Open(const char *fileName, uint32_t maxFileSize);
+
+/**
+ * \brief Adds a port message to the capture, never blocks and does not do any file access.
+ * \note Must always be called from the same thread. If the writer can not keep up, the message
+ *       is dropped and a record with the amount of dropped messages is written instead.
+ * \param dir - LldTraceDir_Tx or LldTraceDir_Rx
+ * \param pData - The port message
+ * \param len - Length of the port message
+ */
+void LldTrace_Capture(LldTraceDir_t dir, const uint8_t *pData, uint32_t len);
+
+/**
+ * \brief Writes all pending messages, stops the writer thread and closes the file.
+ */
+void LldTrace_Close(void);
+
+/**
+ * \brief Checks if a capture file was opened.
+ * \return true, if LldTrace_Open was successful and LldTrace_Close was not called yet. false, otherwise.
+ */
+bool LldTrace_IsOpen(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LLDTRACE_H */
@@ -0,0 +1,375 @@
+/*------------------------------------------------------------------------------------------------*/
+/* Metrics Export                                                                                 */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include "Metrics.h"
+
+/* HDR style histogram: every power of two is split into 2^HIST_SUB_BITS linear buckets,
+ * so any value is recorded with at most 6.25% error, from 1 us up to 2^32 us (71 minutes) */
+#define HIST_SUB_BITS       (4)
+#define HIST_SUB_CNT        (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS        ((32 - HIST_SUB_BITS + 1) * HIST_SUB_CNT)
+#define NAME_LEN            (256)
+
+typedef struct
+{
+    uint64_t count;
+    uint64_t sumUs;
+    uint32_t buckets[HIST_BUCKETS];
+} Histogram_t;
+
+typedef struct
+{
+    const char *name;
+    uint64_t enqueued;
+    uint64_t executed;
+    uint64_t failed;
+    Histogram_t duration;
+} Command_t;
+
+typedef struct
+{
+    const char *name;
+    const char *help;
+} CounterInfo_t;
+
+typedef struct
+{
+    /**Read by all instrumented threads, written by Metrics_Open and Metrics_Close only.*/
+    uint32_t isOpen;
+    uint32_t stop;
+    uint32_t intervalMs;
+    sem_t wakeupSem;
+    pthread_t writerThread;
+    char fileName[NAME_LEN];
+    char tmpFileName[NAME_LEN + 4];
+    uint64_t counters[MetricsCounter_Count];
+    uint32_t queueDepthMax;
+    uint32_t networkAvailable;
+    Command_t commands[METRICS_MAX_COMMANDS];
+    Histogram_t service;
+} LocalVar_t;
+
+static LocalVar_t m = { 0 };
+
+static const CounterInfo_t m_counterInfo[MetricsCounter_Count] =
+{
+    { "rx_frames_total", "Port messages received from the INIC" },
+    { "rx_bytes_total", "Bytes of the port messages received from the INIC" },
+    { "tx_frames_total", "Port messages sent to the INIC" },
+    { "tx_bytes_total", "Bytes of the port messages sent to the INIC" },
+    { "cdev_reopens_total", "Control CDEV closed after an error and opened again" },
+    { "route_failures_total", "Routes which could not be built" },
+    { "network_resets_total", "Network got unavailable after it was available" },
+    { "unicens_restarts_total", "UNICENS restarted after a general error" }
+};
+
+static void *WriterThread(void *arg);
+static void WriteFile(void);
+static void WriteCommandCounter(FILE *f, const char *name, const char *help, size_t offset);
+static void WriteSummary(FILE *f, const char *name, const char *label, const Histogram_t *pHist);
+static void Record(Histogram_t *pHist, uint32_t value);
+static uint32_t GetBucket(uint32_t value);
+static uint64_t GetBucketMax(uint32_t bucket);
+static void SetMax(uint32_t *pMax, uint32_t value);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+bool Metrics_Open(const char *fileName, uint32_t intervalMs)
+{
+    static bool exitRegistered = false;
+    if (NULL == fileName || 0 == intervalMs || Metrics_IsOpen())
+        return false;
+    if (NAME_LEN <= snprintf(m.fileName, sizeof(m.fileName), "%s", fileName))
+        return false;
+    snprintf(m.tmpFileName, sizeof(m.tmpFileName), "%s.tmp", fileName);
+    m.intervalMs = intervalMs;
+    m.stop = 0;
+    if (0 != sem_init(&m.wakeupSem, 0, 0))
+        return false;
+    __atomic_store_n(&m.isOpen, 1, __ATOMIC_RELEASE);
+    if (0 != pthread_create(&m.writerThread, NULL, WriterThread, NULL))
+    {
+        __atomic_store_n(&m.isOpen, 0, __ATOMIC_RELEASE);
+        sem_destroy(&m.wakeupSem);
+        return false;
+    }
+    if (!exitRegistered)
+    {
+        atexit(Metrics_Close);
+        exitRegistered = true;
+    }
+    return true;
+}
+
+void Metrics_Close(void)
+{
+    if (!Metrics_IsOpen())
+        return;
+    __atomic_store_n(&m.isOpen, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&m.stop, 1, __ATOMIC_RELEASE);
+    sem_post(&m.wakeupSem);
+    pthread_join(m.writerThread, NULL);
+    sem_destroy(&m.wakeupSem);
+}
+
+bool Metrics_IsOpen(void)
+{
+    return 0 != __atomic_load_n(&m.isOpen, __ATOMIC_ACQUIRE);
+}
+
+uint64_t Metrics_GetUs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+void Metrics_Add(MetricsCounter_t counter, uint32_t value)
+{
+    if (!Metrics_IsOpen() || MetricsCounter_Count <= counter)
+        return;
+    __atomic_fetch_add(&m.counters[counter], value, __ATOMIC_RELAXED);
+}
+
+void Metrics_SetCommandName(uint8_t command, const char *name)
+{
+    if (METRICS_MAX_COMMANDS <= command)
+        return;
+    __atomic_store_n(&m.commands[command].name, name, __ATOMIC_RELEASE);
+}
+
+void Metrics_CommandEnqueued(uint8_t command, uint32_t queueDepth)
+{
+    if (!Metrics_IsOpen() || METRICS_MAX_COMMANDS <= command)
+        return;
+    __atomic_fetch_add(&m.commands[command].enqueued, 1, __ATOMIC_RELAXED);
+    SetMax(&m.queueDepthMax, queueDepth);
+}
+
+void Metrics_CommandExecuted(uint8_t command)
+{
+    if (!Metrics_IsOpen() || METRICS_MAX_COMMANDS <= command)
+        return;
+    __atomic_fetch_add(&m.commands[command].executed, 1, __ATOMIC_RELAXED);
+}
+
+void Metrics_CommandFinished(uint8_t command, bool success, uint32_t durationUs)
+{
+    if (!Metrics_IsOpen() || METRICS_MAX_COMMANDS <= command)
+        return;
+    if (!success)
+        __atomic_fetch_add(&m.commands[command].failed, 1, __ATOMIC_RELAXED);
+    if (0 != durationUs)
+        Record(&m.commands[command].duration, durationUs);
+}
+
+void Metrics_ServiceDuration(uint32_t durationUs)
+{
+    if (!Metrics_IsOpen())
+        return;
+    Record(&m.service, durationUs);
+}
+
+void Metrics_SetNetworkAvailable(bool isAvailable)
+{
+    uint32_t wasAvailable;
+    if (!Metrics_IsOpen())
+        return;
+    wasAvailable = __atomic_exchange_n(&m.networkAvailable, isAvailable ? 1 : 0, __ATOMIC_RELAXED);
+    if (wasAvailable && !isAvailable)
+        __atomic_fetch_add(&m.counters[MetricsCounter_NetworkResets], 1, __ATOMIC_RELAXED);
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                        PRIVATE FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void *WriterThread(void *arg)
+{
+    uint32_t stop;
+    arg = arg;
+    do
+    {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += m.intervalMs / 1000;
+        deadline.tv_nsec += (m.intervalMs % 1000) * 1000000L;
+        if (1000000000L <= deadline.tv_nsec)
+        {
+            deadline.tv_nsec -= 1000000000L;
+            ++deadline.tv_sec;
+        }
+        while (0 != sem_timedwait(&m.wakeupSem, &deadline) && EINTR == errno);
+        stop = __atomic_load_n(&m.stop, __ATOMIC_ACQUIRE);
+        WriteFile();
+    } while (0 == stop);
+    return NULL;
+}
+
+/* The counters are read one by one without locking, so they may be a few updates apart from each other */
+static void WriteFile(void)
+{
+    FILE *f;
+    uint8_t i;
+    f = fopen(m.tmpFileName, "w");
+    if (NULL == f)
+        return;
+    for (i = 0; i < MetricsCounter_Count; i++)
+    {
+        fprintf(f, "# HELP " METRICS_PREFIX "%s %s\n", m_counterInfo[i].name, m_counterInfo[i].help);
+        fprintf(f, "# TYPE " METRICS_PREFIX "%s counter\n", m_counterInfo[i].name);
+        fprintf(f, METRICS_PREFIX "%s %llu\n", m_counterInfo[i].name,
+            (unsigned long long)__atomic_load_n(&m.counters[i], __ATOMIC_RELAXED));
+    }
+    fprintf(f, "# HELP " METRICS_PREFIX "network_available 1, if the network is available\n");
+    fprintf(f, "# TYPE " METRICS_PREFIX "network_available gauge\n");
+    fprintf(f, METRICS_PREFIX "network_available %u\n", __atomic_load_n(&m.networkAvailable, __ATOMIC_RELAXED));
+    fprintf(f, "# HELP " METRICS_PREFIX "command_queue_depth_max Most commands waiting in the command queue at once\n");
+    fprintf(f, "# TYPE " METRICS_PREFIX "command_queue_depth_max gauge\n");
+    fprintf(f, METRICS_PREFIX "command_queue_depth_max %u\n", __atomic_load_n(&m.queueDepthMax, __ATOMIC_RELAXED));
+    WriteCommandCounter(f, "commands_enqueued_total", "Commands added to the command queue", offsetof(Command_t, enqueued));
+    WriteCommandCounter(f, "commands_executed_total", "Commands passed to UNICENS", offsetof(Command_t, executed));
+    WriteCommandCounter(f, "commands_failed_total", "Commands which failed", offsetof(Command_t, failed));
+    fprintf(f, "# HELP " METRICS_PREFIX "command_duration_seconds Time from passing a command to UNICENS until its result\n");
+    fprintf(f, "# TYPE " METRICS_PREFIX "command_duration_seconds summary\n");
+    for (i = 0; i < METRICS_MAX_COMMANDS; i++)
+    {
+        const char *name = __atomic_load_n(&m.commands[i].name, __ATOMIC_ACQUIRE);
+        if (NULL != name)
+            WriteSummary(f, "command_duration_seconds", name, &m.commands[i].duration);
+    }
+    fprintf(f, "# HELP " METRICS_PREFIX "service_duration_seconds Duration of one run of the UNICENS service routine\n");
+    fprintf(f, "# TYPE " METRICS_PREFIX "service_duration_seconds summary\n");
+    WriteSummary(f, "service_duration_seconds", NULL, &m.service);
+    if (0 != fclose(f))
+        return;
+    rename(m.tmpFileName, m.fileName);
+}
+
+static void WriteCommandCounter(FILE *f, const char *name, const char *help, size_t offset)
+{
+    uint8_t i;
+    fprintf(f, "# HELP " METRICS_PREFIX "%s %s\n", name, help);
+    fprintf(f, "# TYPE " METRICS_PREFIX "%s counter\n", name);
+    for (i = 0; i < METRICS_MAX_COMMANDS; i++)
+    {
+        const char *cmdName = __atomic_load_n(&m.commands[i].name, __ATOMIC_ACQUIRE);
+        uint64_t *pValue = (uint64_t *)((uint8_t *)&m.commands[i] + offset);
+        if (NULL != cmdName)
+            fprintf(f, METRICS_PREFIX "%s{command=\"%s\"} %llu\n", name, cmdName,
+                (unsigned long long)__atomic_load_n(pValue, __ATOMIC_RELAXED));
+    }
+}
+
+/* Quantiles are computed from a snapshot of the buckets, every quantile is reported as the highest value of its bucket */
+static void WriteSummary(FILE *f, const char *name, const char *label, const Histogram_t *pHist)
+{
+    static const double quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+    static uint32_t buckets[HIST_BUCKETS];
+    char labels[96];
+    uint64_t total = 0;
+    uint32_t i, q;
+    for (i = 0; i < HIST_BUCKETS; i++)
+    {
+        buckets[i] = __atomic_load_n(&pHist->buckets[i], __ATOMIC_RELAXED);
+        total += buckets[i];
+    }
+    if (NULL != label)
+        snprintf(labels, sizeof(labels), "command=\"%s\",", label);
+    else
+        labels[0] = '\0';
+    for (q = 0, i = 0; q < sizeof(quantiles) / sizeof(quantiles[0]); q++)
+    {
+        uint64_t rank = (uint64_t)(quantiles[q] * total + 0.5);
+        uint64_t seen = 0;
+        double value = 0.0;
+        if (0 != total)
+        {
+            if (0 == rank)
+                rank = 1;
+            for (i = 0; i < HIST_BUCKETS; i++)
+            {
+                seen += buckets[i];
+                if (seen >= rank)
+                    break;
+            }
+            value = GetBucketMax(i) / 1000000.0;
+        }
+        fprintf(f, METRICS_PREFIX "%s{%squantile=\"%g\"} %.6f\n", name, labels, quantiles[q], value);
+    }
+    if (NULL != label)
+        snprintf(labels, sizeof(labels), "{command=\"%s\"}", label);
+    fprintf(f, METRICS_PREFIX "%s_sum%s %.6f\n", name, labels,
+        __atomic_load_n(&pHist->sumUs, __ATOMIC_RELAXED) / 1000000.0);
+    fprintf(f, METRICS_PREFIX "%s_count%s %llu\n", name, labels,
+        (unsigned long long)__atomic_load_n(&pHist->count, __ATOMIC_RELAXED));
+}
+
+static void Record(Histogram_t *pHist, uint32_t value)
+{
+    __atomic_fetch_add(&pHist->buckets[GetBucket(value)], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&pHist->sumUs, value, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&pHist->count, 1, __ATOMIC_RELAXED);
+}
+
+static uint32_t GetBucket(uint32_t value)
+{
+    uint32_t shift;
+    if (HIST_SUB_CNT > value)
+        return value;
+    /* Position of the highest bit minus the bits kept below it */
+    shift = (31 - __builtin_clz(value)) - HIST_SUB_BITS;
+    return (shift + 1) * HIST_SUB_CNT + ((value >> shift) & (HIST_SUB_CNT - 1));
+}
+
+static uint64_t GetBucketMax(uint32_t bucket)
+{
+    uint32_t shift;
+    if (HIST_SUB_CNT > bucket)
+        return bucket;
+    shift = bucket / HIST_SUB_CNT - 1;
+    return ((uint64_t)(HIST_SUB_CNT + bucket % HIST_SUB_CNT + 1) << shift) - 1;
+}
+
+static void SetMax(uint32_t *pMax, uint32_t value)
+{
+    uint32_t old = __atomic_load_n(pMax, __ATOMIC_RELAXED);
+    while (old < value && !__atomic_compare_exchange_n(pMax, &old, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
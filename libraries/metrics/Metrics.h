@@ -0,0 +1,161 @@
+/*------------------------------------------------------------------------------------------------*/
+/* Metrics Export                                                                                 */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                              METRICS                                 */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/* The metrics are written in the Prometheus text format, all names start with this prefix */
+#define METRICS_PREFIX          "unicensd_"
+/* Commands are identified by their number, e.g. UnicensCmd_t */
+#define METRICS_MAX_COMMANDS    (32)
+/* Interval in milliseconds the file is rewritten with, if none is given */
+#define METRICS_DEFAULT_INTERVAL (1000)
+
+typedef enum
+{
+    /** Port messages received from the INIC */
+    MetricsCounter_RxFrames = 0,
+    /** Bytes of the port messages received from the INIC */
+    MetricsCounter_RxBytes,
+    /** Port messages sent to the INIC */
+    MetricsCounter_TxFrames,
+    /** Bytes of the port messages sent to the INIC */
+    MetricsCounter_TxBytes,
+    /** Control CDEV closed after an error, it is opened again */
+    MetricsCounter_CdevReopens,
+    /** Routes which could not be built */
+    MetricsCounter_RouteFailures,
+    /** Network got unavailable after it was available */
+    MetricsCounter_NetworkResets,
+    /** UNICENS was restarted after a general error */
+    MetricsCounter_UnicensRestarts,
+    MetricsCounter_Count
+} MetricsCounter_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            EXPORT API                                */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/**
+ * \brief Starts the thread writing the metrics into a file in the Prometheus text format
+ * \note The file is written to a temporary file and renamed, so readers (e.g. the textfile collector
+ *       of the node exporter) never see a partial file. Metrics_Close is registered with atexit.
+ * \param fileName - Path of the metrics file, an existing file is overwritten
+ * \param intervalMs - The file is written this often
+ * \return true, if successful. false, otherwise, all metrics are discarded in this case
+ */
+bool Metrics_Open(const char *fileName, uint32_t intervalMs);
+
+/**
+ * \brief Writes the metrics a last time and stops the writer thread
+ */
+void Metrics_Close(void);
+
+/**
+ * \brief Checks if the metrics are collected
+ * \return true, if Metrics_Open was successful and Metrics_Close was not called yet. false, otherwise.
+ */
+bool Metrics_IsOpen(void);
+
+/**
+ * \brief Gets a monotonic timestamp to measure durations with
+ * \return Microseconds since an arbitrary point in time
+ */
+uint64_t Metrics_GetUs(void);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         INSTRUMENTATION API                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/* All functions may be called from any thread, they never block and do not do any system call.
+ * They only update atomic counters and return immediately, if the metrics are not collected. */
+
+/**
+ * \brief Adds to a counter
+ * \param counter - The counter to increase
+ * \param value - Amount to add
+ */
+void Metrics_Add(MetricsCounter_t counter, uint32_t value);
+
+/**
+ * \brief Sets the name a command is exported with, commands without a name are not exported
+ * \param command - Number of the command, less than METRICS_MAX_COMMANDS
+ * \param name - Name of the command, the string must stay valid
+ */
+void Metrics_SetCommandName(uint8_t command, const char *name);
+
+/**
+ * \brief Counts a command added to the command queue
+ * \param command - Number of the command
+ * \param queueDepth - Amount of commands in the queue, including this one
+ */
+void Metrics_CommandEnqueued(uint8_t command, uint32_t queueDepth);
+
+/**
+ * \brief Counts a command taken from the queue and passed to UNICENS
+ * \param command - Number of the command
+ */
+void Metrics_CommandExecuted(uint8_t command);
+
+/**
+ * \brief Counts a command which has finished
+ * \param command - Number of the command
+ * \param success - false, if the command failed
+ * \param durationUs - Time since the command was passed to UNICENS, 0 if unknown, it is not recorded then
+ */
+void Metrics_CommandFinished(uint8_t command, bool success, uint32_t durationUs);
+
+/**
+ * \brief Records the duration of one run of the service routine
+ * \param durationUs - Duration in microseconds
+ */
+void Metrics_ServiceDuration(uint32_t durationUs);
+
+/**
+ * \brief Sets the network availability, a change from available to unavailable counts as network reset
+ * \param isAvailable - true, if the network is available. false, otherwise.
+ */
+void Metrics_SetNetworkAvailable(bool isAvailable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* METRICS_H */
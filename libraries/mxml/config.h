@@ -68,7 +68,7 @@
  * Do we have threading support?
  */
 
-/*#define HAVE_PTHREAD_H 1*/
+#define HAVE_PTHREAD_H 1
 
 
 /*
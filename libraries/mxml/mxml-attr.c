@@ -19,7 +19,7 @@
  */
 
 #include "config.h"
-#include "mxml.h"
+#include "mxml-private.h"
 
 
 /*
@@ -74,7 +74,6 @@ mxmlElementDeleteAttr(mxml_node_t *node,/* I - Element */
       * Delete this attribute...
       */
 
-      free(attr->name);
       free(attr->value);
 
       i --;
@@ -130,7 +129,7 @@ mxmlElementGetAttr(mxml_node_t *node,	/* I - Element node */
     printf("    %s=\"%s\"\n", attr->name, attr->value);
 #endif /* DEBUG */
 
-    if (!strcmp(attr->name, name))
+    if (attr->name == name || !strcmp(attr->name, name))
     {
 #ifdef DEBUG
       printf("    Returning \"%s\"!\n", attr->value);
@@ -253,6 +252,13 @@ mxml_set_attr(mxml_node_t *node,	/* I - Element node */
   mxml_attr_t	*attr;			/* New attribute */
 
 
+ /*
+  * Attribute names are interned, so they can be compared by pointer...
+  */
+
+  if ((name = mxmlIntern(name)) == NULL)
+    return (-1);
+
  /*
   * Look for the attribute...
   */
@@ -260,7 +266,7 @@ mxml_set_attr(mxml_node_t *node,	/* I - Element node */
   for (i = node->value.element.num_attrs, attr = node->value.element.attrs;
        i > 0;
        i --, attr ++)
-    if (!strcmp(attr->name, name))
+    if (attr->name == name)
     {
      /*
       * Free the old value as needed...
@@ -294,13 +300,7 @@ mxml_set_attr(mxml_node_t *node,	/* I - Element node */
   node->value.element.attrs = attr;
   attr += node->value.element.num_attrs;
 
-  if ((attr->name = strdup(name)) == NULL)
-  {
-    mxml_error("Unable to allocate memory for attribute '%s' in element %s!",
-               name, node->value.element.name);
-    return (-1);
-  }
-
+  attr->name  = (char *)name;
   attr->value = value;
 
   node->value.element.num_attrs ++;
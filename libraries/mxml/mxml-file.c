@@ -49,7 +49,7 @@ typedef int (*_mxml_putc_cb_t)(int, void *);
 
 typedef struct _mxml_fdbuf_s		/**** File descriptor buffer ****/
 {
-  int		fd;			/* File descriptor */
+  int		fd;			/* File descriptor, -1 for memory buffer */
   unsigned char	*current,		/* Current position in buffer */
 		*end,			/* End of buffer */
 		buffer[8192];		/* Character buffer */
@@ -62,6 +62,8 @@ typedef struct _mxml_fdbuf_s		/**** File descriptor buffer ****/
 
 static int		mxml_add_char(int ch, char **ptr, char **buffer,
 			              int *bufsize);
+static void		mxml_buffer_init(_mxml_fdbuf_t *buf, const char *s,
+			                 size_t len);
 static int		mxml_fd_getc(void *p, int *encoding);
 static int		mxml_fd_putc(int ch, void *p);
 static int		mxml_fd_read(_mxml_fdbuf_t *buf);
@@ -98,6 +100,33 @@ static int		mxml_write_ws(mxml_node_t *node, void *p,
 				      int col, _mxml_putc_cb_t putc_cb);
 
 
+/*
+ * 'mxmlLoadBuffer()' - Load a memory buffer into an XML node tree.
+ *
+ * The buffer does not need to be nul-terminated, exactly len bytes are
+ * read. This allows parsing directly from a read-only file mapping.
+ * Otherwise it behaves like mxmlLoadString().
+ */
+
+mxml_node_t *				/* O - First node or NULL if the buffer has errors. */
+mxmlLoadBuffer(mxml_node_t    *top,	/* I - Top node */
+               const char     *s,	/* I - Buffer to load */
+               size_t         len,	/* I - Length of buffer in bytes */
+               mxml_load_cb_t cb)	/* I - Callback function or MXML_NO_CALLBACK */
+{
+  _mxml_fdbuf_t	buf;			/* Memory buffer */
+
+
+  mxml_buffer_init(&buf, s, len);
+
+ /*
+  * Read the XML data...
+  */
+
+  return (mxml_load_data(top, &buf, cb, mxml_fd_getc, MXML_NO_CALLBACK, NULL));
+}
+
+
 /*
  * 'mxmlLoadFd()' - Load a file descriptor into an XML node tree.
  *
@@ -400,6 +429,36 @@ mxmlSaveString(mxml_node_t    *node,	/* I - Node to write */
 }
 
 
+/*
+ * 'mxmlSAXLoadBuffer()' - Load a memory buffer into an XML node tree
+ *                         using a SAX callback.
+ *
+ * The buffer does not need to be nul-terminated, exactly len bytes are
+ * read. Otherwise it behaves like mxmlSAXLoadString().
+ */
+
+mxml_node_t *				/* O - First node or NULL if the buffer has errors. */
+mxmlSAXLoadBuffer(
+    mxml_node_t    *top,		/* I - Top node */
+    const char     *s,			/* I - Buffer to load */
+    size_t         len,			/* I - Length of buffer in bytes */
+    mxml_load_cb_t cb,			/* I - Callback function or MXML_NO_CALLBACK */
+    mxml_sax_cb_t  sax_cb,		/* I - SAX callback or MXML_NO_CALLBACK */
+    void           *sax_data)		/* I - SAX user data */
+{
+  _mxml_fdbuf_t	buf;			/* Memory buffer */
+
+
+  mxml_buffer_init(&buf, s, len);
+
+ /*
+  * Read the XML data...
+  */
+
+  return (mxml_load_data(top, &buf, cb, mxml_fd_getc, sax_cb, sax_data));
+}
+
+
 /*
  * 'mxmlSAXLoadFd()' - Load a file descriptor into an XML node tree
  *                     using a SAX callback.
@@ -663,6 +722,23 @@ mxml_add_char(int  ch,			/* I  - Character to add */
 }
 
 
+/*
+ * 'mxml_buffer_init()' - Prepare a buffer to read from memory.
+ *
+ * The memory is read in place by mxml_fd_getc(), the fd buffer is not used.
+ */
+
+static void
+mxml_buffer_init(_mxml_fdbuf_t *buf,	/* I - Buffer to initialize */
+                 const char    *s,	/* I - Memory to read */
+                 size_t        len)	/* I - Length of memory */
+{
+  buf->fd      = -1;
+  buf->current = (unsigned char *)s;
+  buf->end     = (unsigned char *)s + len;
+}
+
+
 /*
  * 'mxml_fd_getc()' - Read a character from a file descriptor.
  */
@@ -1014,6 +1090,13 @@ mxml_fd_read(_mxml_fdbuf_t *buf)		/* I - File descriptor buffer */
   if (!buf)
     return (-1);
 
+ /*
+  * A memory buffer has no more data once it is consumed...
+  */
+
+  if (buf->fd < 0)
+    return (-1);
+
  /*
   * Read from the file descriptor...
   */
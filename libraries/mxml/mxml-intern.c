@@ -0,0 +1,247 @@
+/*
+ * "$Id$"
+ *
+ * Name interning for Mini-XML, a small XML-like file parsing library.
+ *
+ * Copyright 2003-2014 by Michael R Sweet.
+ *
+ * These coded instructions, statements, and computer programs are the
+ * property of Michael R Sweet and are protected by Federal copyright
+ * law.  Distribution and use rights are outlined in the file "COPYING"
+ * which should have been included with this file.  If this file is
+ * missing or damaged, see the license at:
+ *
+ *     http://www.msweet.org/projects.php/Mini-XML
+ */
+
+/*
+ * Include necessary headers...
+ */
+
+#include "mxml-private.h"
+#ifdef HAVE_PTHREAD_H
+#  include <pthread.h>
+#endif /* HAVE_PTHREAD_H */
+
+
+/*
+ * Element and attribute names are stored once in a process-wide open
+ * addressing hash table, so equal names share the same pointer.  Lookups
+ * do not lock: slots are only written once and a grown table is published
+ * as a whole, while the replaced tables stay valid for concurrent readers.
+ * Interned names are never freed.
+ */
+
+#define _MXML_INTERN_SIZE	256	/* Initial number of slots */
+
+typedef struct _mxml_itable_s		/**** Intern table ****/
+{
+  struct _mxml_itable_s	*prev;		/* Replaced table */
+  size_t		size;		/* Number of slots, power of 2 */
+  size_t		count;		/* Number of used slots */
+  const char		*slots[1];	/* Interned names */
+} _mxml_itable_t;
+
+#ifdef HAVE_PTHREAD_H
+#  define _MXML_LOAD(p)		__atomic_load_n(p, __ATOMIC_ACQUIRE)
+#  define _MXML_STORE(p,v)	__atomic_store_n(p, v, __ATOMIC_RELEASE)
+static pthread_mutex_t	mxml_intern_lock = PTHREAD_MUTEX_INITIALIZER;
+#else
+#  define _MXML_LOAD(p)		(*(p))
+#  define _MXML_STORE(p,v)	(*(p) = (v))
+#endif /* HAVE_PTHREAD_H */
+
+static _mxml_itable_t	*mxml_intern_table = NULL;
+
+
+/*
+ * Local functions...
+ */
+
+static const char	*mxml_intern_find(_mxml_itable_t *t, const char *s,
+			                  unsigned hash);
+static _mxml_itable_t	*mxml_intern_grow(_mxml_itable_t *t);
+static unsigned		mxml_intern_hash(const char *s);
+
+
+/*
+ * 'mxmlIntern()' - Get the shared copy of a name.
+ *
+ * Equal strings always give the same pointer, so interned names can be
+ * compared by pointer.  The returned string must not be freed.
+ *
+ * @since Mini-XML 2.10.1@
+ */
+
+const char *				/* O - Shared copy or NULL on error */
+mxmlIntern(const char *s)		/* I - String to intern */
+{
+  unsigned		hash;		/* Hash of string */
+  size_t		i;		/* Current slot */
+  _mxml_itable_t	*t;		/* Current table */
+  const char		*found;		/* Interned string */
+  char			*copy;		/* New string */
+
+
+  if (!s)
+    return (NULL);
+
+  hash = mxml_intern_hash(s);
+
+  if ((found = mxml_intern_find(_MXML_LOAD(&mxml_intern_table), s,
+                                hash)) != NULL)
+    return (found);
+
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock(&mxml_intern_lock);
+#endif /* HAVE_PTHREAD_H */
+
+  t = mxml_intern_table;
+
+  if ((found = mxml_intern_find(t, s, hash)) == NULL)
+  {
+    if (!t || (t->count + 1) * 2 > t->size)
+      t = mxml_intern_grow(t);
+
+    if (t && (copy = strdup(s)) != NULL)
+    {
+      for (i = hash & (t->size - 1); t->slots[i]; i = (i + 1) & (t->size - 1));
+
+      _MXML_STORE(&t->slots[i], copy);
+      t->count ++;
+      found = copy;
+    }
+    else
+      mxml_error("Unable to allocate memory for name '%s'!", s);
+  }
+
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock(&mxml_intern_lock);
+#endif /* HAVE_PTHREAD_H */
+
+  return (found);
+}
+
+
+/*
+ * '_mxml_strdup_name()' - Get a copy of an element or attribute name.
+ *
+ * Names of comments, CDATA and declarations hold the content as well, so
+ * they are copied instead of interned.
+ */
+
+char *					/* O - Name or NULL on error */
+_mxml_strdup_name(const char *name)	/* I - Name */
+{
+  if (_MXML_INTERNED(name))
+    return ((char *)mxmlIntern(name));
+  else
+    return (strdup(name));
+}
+
+
+/*
+ * '_mxml_free_name()' - Free a name from _mxml_strdup_name.
+ */
+
+void
+_mxml_free_name(char *name)		/* I - Name */
+{
+  if (name && !_MXML_INTERNED(name))
+    free(name);
+}
+
+
+/*
+ * 'mxml_intern_find()' - Find an interned string, without locking.
+ */
+
+static const char *			/* O - Interned string or NULL */
+mxml_intern_find(_mxml_itable_t *t,	/* I - Table */
+                 const char     *s,	/* I - String */
+		 unsigned       hash)	/* I - Hash of string */
+{
+  size_t	i;			/* Current slot */
+  const char	*cur;			/* Current string */
+
+
+  if (!t)
+    return (NULL);
+
+  for (i = hash & (t->size - 1);
+       (cur = _MXML_LOAD(&t->slots[i])) != NULL;
+       i = (i + 1) & (t->size - 1))
+    if (cur == s || !strcmp(cur, s))
+      return (cur);
+
+  return (NULL);
+}
+
+
+/*
+ * 'mxml_intern_grow()' - Replace the table by one of double size.
+ *
+ * Must be called with the lock held.
+ */
+
+static _mxml_itable_t *			/* O - New table or NULL on error */
+mxml_intern_grow(_mxml_itable_t *t)	/* I - Current table or NULL */
+{
+  size_t		i, j;		/* Looping vars */
+  size_t		size;		/* New size */
+  _mxml_itable_t	*nt;		/* New table */
+
+
+  size = t ? 2 * t->size : _MXML_INTERN_SIZE;
+
+  if ((nt = calloc(1, sizeof(_mxml_itable_t) +
+                      (size - 1) * sizeof(const char *))) == NULL)
+    return (NULL);
+
+  nt->prev = t;
+  nt->size = size;
+
+  if (t)
+  {
+    for (i = 0; i < t->size; i ++)
+      if (t->slots[i])
+      {
+        for (j = mxml_intern_hash(t->slots[i]) & (size - 1);
+	     nt->slots[j];
+	     j = (j + 1) & (size - 1));
+
+	nt->slots[j] = t->slots[i];
+      }
+
+    nt->count = t->count;
+  }
+
+  _MXML_STORE(&mxml_intern_table, nt);
+
+  return (nt);
+}
+
+
+/*
+ * 'mxml_intern_hash()' - FNV-1a hash of a string.
+ */
+
+static unsigned				/* O - Hash */
+mxml_intern_hash(const char *s)		/* I - String */
+{
+  unsigned	hash = 2166136261U;	/* Hash */
+
+
+  while (*s)
+  {
+    hash ^= (unsigned char)*s++;
+    hash *= 16777619U;
+  }
+
+  return (hash);
+}
+
+
+/*
+ * End of "$Id$".
+ */
@@ -19,7 +19,7 @@
  */
 
 #include "config.h"
-#include "mxml.h"
+#include "mxml-private.h"
 
 
 /*
@@ -221,22 +221,13 @@ mxmlDelete(mxml_node_t *node)		/* I - Node to delete */
 
     if ((next = current->next) == NULL)
     {
-      mxml_node_t *temp = current->parent;
-					/* Pointer to parent node */
-
-      if (temp == node)
-      {
-       /*
-        * Got back to the top node...
-        */
+     /*
+      * Go back to the parent node, it has no children anymore and will be
+      * freed before continuing with its siblings...
+      */
 
+      if ((next = current->parent) == node)
         next = NULL;
-      }
-      else if ((next = temp->next) == NULL)
-      {
-	if ((next = temp->parent) == node)
-	  next = NULL;
-      }
     }
 
     mxml_free(current);
@@ -390,7 +381,7 @@ mxmlNewElement(mxml_node_t *parent,	/* I - Parent node or MXML_NO_PARENT */
   */
 
   if ((node = mxml_new(parent, MXML_ELEMENT)) != NULL)
-    node->value.element.name = strdup(name);
+    node->value.element.name = _mxml_strdup_name(name);
 
   return (node);
 }
@@ -737,14 +728,12 @@ mxml_free(mxml_node_t *node)		/* I - Node */
   {
     case MXML_ELEMENT :
         if (node->value.element.name)
-	  free(node->value.element.name);
+	  _mxml_free_name(node->value.element.name);
 
 	if (node->value.element.num_attrs)
 	{
 	  for (i = 0; i < node->value.element.num_attrs; i ++)
 	  {
-	    if (node->value.element.attrs[i].name)
-	      free(node->value.element.attrs[i].name);
 	    if (node->value.element.attrs[i].value)
 	      free(node->value.element.attrs[i].value);
 	  }
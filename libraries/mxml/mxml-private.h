@@ -37,12 +37,21 @@ typedef struct _mxml_global_s
 } _mxml_global_t;
 
 
+/*
+ * Element names of comments, CDATA and declarations are not interned...
+ */
+
+#  define _MXML_INTERNED(name)	((name)[0] != '!' && (name)[0] != '?')
+
+
 /*
  * Functions...
  */
 
 extern _mxml_global_t	*_mxml_global(void);
 extern int		_mxml_entity_cb(const char *name);
+extern char		*_mxml_strdup_name(const char *name);
+extern void		_mxml_free_name(char *name);
 
 
 /*
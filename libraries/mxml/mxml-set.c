@@ -19,7 +19,7 @@
  */
 
 #include "config.h"
-#include "mxml.h"
+#include "mxml-private.h"
 
 
 /*
@@ -53,7 +53,7 @@ mxmlSetCDATA(mxml_node_t *node,		/* I - Node to set */
   */
 
   if (node->value.element.name)
-    free(node->value.element.name);
+    _mxml_free_name(node->value.element.name);
 
   node->value.element.name = _mxml_strdupf("![CDATA[%s]]", data);
 
@@ -122,9 +122,9 @@ mxmlSetElement(mxml_node_t *node,	/* I - Node to set */
   */
 
   if (node->value.element.name)
-    free(node->value.element.name);
+    _mxml_free_name(node->value.element.name);
 
-  node->value.element.name = strdup(name);
+  node->value.element.name = _mxml_strdup_name(name);
 
   return (0);
 }
@@ -238,6 +238,10 @@ extern int		mxmlIndexGetCount(mxml_index_t *ind);
 extern mxml_index_t	*mxmlIndexNew(mxml_node_t *node, const char *element,
 			              const char *attr);
 extern mxml_node_t	*mxmlIndexReset(mxml_index_t *ind);
+extern const char	*mxmlIntern(const char *s);
+extern mxml_node_t	*mxmlLoadBuffer(mxml_node_t *top, const char *s,
+			                size_t len,
+			                mxml_type_t (*cb)(mxml_node_t *));
 extern mxml_node_t	*mxmlLoadFd(mxml_node_t *top, int fd,
 			            mxml_type_t (*cb)(mxml_node_t *));
 extern mxml_node_t	*mxmlLoadFile(mxml_node_t *top, FILE *fp,
@@ -271,6 +275,10 @@ extern int		mxmlSaveFile(mxml_node_t *node, FILE *fp,
 			             mxml_save_cb_t cb);
 extern int		mxmlSaveString(mxml_node_t *node, char *buffer,
 			               int bufsize, mxml_save_cb_t cb);
+extern mxml_node_t	*mxmlSAXLoadBuffer(mxml_node_t *top, const char *s,
+			                   size_t len,
+			                   mxml_type_t (*cb)(mxml_node_t *),
+			                   mxml_sax_cb_t sax, void *sax_data);
 extern mxml_node_t	*mxmlSAXLoadFd(mxml_node_t *top, int fd,
 			               mxml_type_t (*cb)(mxml_node_t *),
 			               mxml_sax_cb_t sax, void *sax_data);
@@ -0,0 +1,238 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Status Shared Memory Component                                                         */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "StatusShm.h"
+
+/* A reader gives up, if the writer is in the middle of an update this often */
+#define READ_RETRIES (100000)
+
+static bool IsValidSegment(const StatusShmSegment_t *seg);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            WRITER SECTION                            */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+bool StatusShm_Create(StatusShmWriter_t *w, const char *name)
+{
+    int fd;
+    void *pMem;
+    StatusShmSegment_t *seg;
+    if (NULL == w || NULL == name)
+        return false;
+    memset(w, 0, sizeof(StatusShmWriter_t));
+    fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (-1 == fd)
+        return false;
+    if (0 != ftruncate(fd, sizeof(StatusShmSegment_t)))
+    {
+        close(fd);
+        return false;
+    }
+    pMem = mmap(NULL, sizeof(StatusShmSegment_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == pMem)
+        return false;
+    seg = (StatusShmSegment_t *)pMem;
+    /* Continue the sequence of a previous instance, so its readers notice the restart */
+    w->seg = seg;
+    w->sequence = __atomic_load_n(&seg->sequence, __ATOMIC_RELAXED) & ~1u;
+    StatusShm_BeginWrite(w);
+    memset(&seg->data, 0, sizeof(StatusShmData_t));
+    seg->data.daemonRunning = 1;
+    seg->version = STATUS_SHM_VERSION;
+    seg->segmentSize = sizeof(StatusShmSegment_t);
+    seg->writerPid = (uint32_t)getpid();
+    seg->magic = STATUS_SHM_MAGIC;
+    StatusShm_EndWrite(w);
+    return true;
+}
+
+StatusShmData_t *StatusShm_BeginWrite(StatusShmWriter_t *w)
+{
+    if (NULL == w || NULL == w->seg)
+        return NULL;
+    __atomic_store_n(&w->seg->sequence, w->sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return &w->seg->data;
+}
+
+void StatusShm_EndWrite(StatusShmWriter_t *w)
+{
+    if (NULL == w || NULL == w->seg)
+        return;
+    w->sequence += 2;
+    __atomic_store_n(&w->seg->sequence, w->sequence, __ATOMIC_RELEASE);
+}
+
+void StatusShm_Destroy(StatusShmWriter_t *w)
+{
+    StatusShmData_t *pData = StatusShm_BeginWrite(w);
+    if (NULL == pData)
+        return;
+    pData->daemonRunning = 0;
+    pData->networkAvailable = 0;
+    StatusShm_EndWrite(w);
+    munmap(w->seg, sizeof(StatusShmSegment_t));
+    w->seg = NULL;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            READER SECTION                            */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+bool StatusShm_Open(StatusShmReader_t *r, const char *name)
+{
+    int fd;
+    void *pMem;
+    struct stat st;
+    if (NULL == r || NULL == name)
+        return false;
+    memset(r, 0, sizeof(StatusShmReader_t));
+    fd = shm_open(name, O_RDONLY, 0);
+    if (-1 == fd)
+        return false;
+    if (0 != fstat(fd, &st) || st.st_size < (off_t)sizeof(StatusShmSegment_t))
+    {
+        close(fd);
+        return false;
+    }
+    pMem = mmap(NULL, sizeof(StatusShmSegment_t), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == pMem)
+        return false;
+    if (!IsValidSegment((const StatusShmSegment_t *)pMem))
+    {
+        munmap(pMem, sizeof(StatusShmSegment_t));
+        return false;
+    }
+    r->seg = (const StatusShmSegment_t *)pMem;
+    return true;
+}
+
+bool StatusShm_Read(StatusShmReader_t *r, StatusShmData_t *pData, uint32_t *pSequence)
+{
+    uint32_t i, seqBefore, seqAfter;
+    if (NULL == r || NULL == r->seg || NULL == pData)
+        return false;
+    for (i = 0; i < READ_RETRIES; i++)
+    {
+        seqBefore = __atomic_load_n(&r->seg->sequence, __ATOMIC_ACQUIRE);
+        if (0 != (seqBefore & 1))
+            continue;
+        /* The writer of a newer daemon version may have taken over the segment */
+        if (!IsValidSegment(r->seg))
+            return false;
+        memcpy(pData, &r->seg->data, sizeof(StatusShmData_t));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        seqAfter = __atomic_load_n(&r->seg->sequence, __ATOMIC_RELAXED);
+        if (seqBefore != seqAfter)
+            continue;
+        if (STATUS_SHM_MAX_NODES < pData->nodesSize)
+            pData->nodesSize = STATUS_SHM_MAX_NODES;
+        if (STATUS_SHM_MAX_ROUTES < pData->routesSize)
+            pData->routesSize = STATUS_SHM_MAX_ROUTES;
+        if (STATUS_SHM_MAX_RESOURCES < pData->resourcesSize)
+            pData->resourcesSize = STATUS_SHM_MAX_RESOURCES;
+        if (NULL != pSequence)
+            *pSequence = seqBefore;
+        return true;
+    }
+    return false;
+}
+
+uint32_t StatusShm_GetSequence(StatusShmReader_t *r)
+{
+    if (NULL == r || NULL == r->seg)
+        return 0;
+    return __atomic_load_n(&r->seg->sequence, __ATOMIC_ACQUIRE);
+}
+
+uint32_t StatusShm_GetWriterPid(StatusShmReader_t *r)
+{
+    if (NULL == r || NULL == r->seg)
+        return 0;
+    return r->seg->writerPid;
+}
+
+void StatusShm_Close(StatusShmReader_t *r)
+{
+    if (NULL == r || NULL == r->seg)
+        return;
+    munmap((void *)r->seg, sizeof(StatusShmSegment_t));
+    r->seg = NULL;
+}
+
+const char *StatusShm_GetResTypeName(uint8_t type)
+{
+    switch (type)
+    {
+    case StatusResType_NetworkSocket:
+        return "NetworkSocket";
+    case StatusResType_MlbPort:
+        return "MlbPort";
+    case StatusResType_MlbSocket:
+        return "MlbSocket";
+    case StatusResType_UsbPort:
+        return "UsbPort";
+    case StatusResType_UsbSocket:
+        return "UsbSocket";
+    case StatusResType_StreamPort:
+        return "StreamPort";
+    case StatusResType_StreamSocket:
+        return "StreamSocket";
+    case StatusResType_SyncConnection:
+        return "SyncConnection";
+    case StatusResType_Combiner:
+        return "Combiner";
+    case StatusResType_Splitter:
+        return "Splitter";
+    case StatusResType_AvpConnection:
+        return "AvpConnection";
+    case StatusResType_RmckPort:
+        return "RmckPort";
+    default:
+        return "Unknown";
+    }
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PRIVATE FUNCTIONS                            */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static bool IsValidSegment(const StatusShmSegment_t *seg)
+{
+    return (STATUS_SHM_MAGIC == seg->magic && STATUS_SHM_VERSION == seg->version
+        && sizeof(StatusShmSegment_t) == seg->segmentSize);
+}
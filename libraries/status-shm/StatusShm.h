@@ -0,0 +1,263 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Status Shared Memory Component                                                         */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#ifndef STATUSSHM_H
+#define STATUSSHM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         SEGMENT LAYOUT                               */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define STATUS_SHM_NAME          ("/unicensd-status")
+#define STATUS_SHM_MAGIC         (0x55435353)
+/* Increment with every change of the structures below */
+#define STATUS_SHM_VERSION       (1)
+#define STATUS_SHM_MAX_NODES     (64)
+#define STATUS_SHM_MAX_ROUTES    (256)
+#define STATUS_SHM_MAX_RESOURCES (512)
+
+typedef enum
+{
+    StatusNode_NotAvailable = 0,
+    StatusNode_Ignored = 1,
+    StatusNode_Available = 2
+} StatusShmNodeState_t;
+
+typedef enum
+{
+    StatusRes_Unused = 0,
+    StatusRes_Built = 1,
+    StatusRes_Failed = 2
+} StatusShmResState_t;
+
+typedef enum
+{
+    StatusResType_Unknown = 0,
+    StatusResType_NetworkSocket,
+    StatusResType_MlbPort,
+    StatusResType_MlbSocket,
+    StatusResType_UsbPort,
+    StatusResType_UsbSocket,
+    StatusResType_StreamPort,
+    StatusResType_StreamSocket,
+    StatusResType_SyncConnection,
+    StatusResType_Combiner,
+    StatusResType_Splitter,
+    StatusResType_AvpConnection,
+    StatusResType_RmckPort
+} StatusShmResType_t;
+
+/** Signature as reported by the node, valid if signatureValid is set */
+typedef struct
+{
+    uint32_t fwBuild;
+    uint16_t nodeAddress;
+    uint16_t groupAddress;
+    uint16_t nodePosAddr;
+    uint16_t diagnosisId;
+    uint8_t mac[6];
+    uint8_t numPorts;
+    uint8_t chipId;
+    uint8_t fwMajor;
+    uint8_t fwMinor;
+    uint8_t fwRelease;
+    uint8_t csMajor;
+    uint8_t csMinor;
+    uint8_t csRelease;
+} StatusShmSignature_t;
+
+typedef struct
+{
+    uint16_t nodeAddress;
+    uint8_t state;              /* StatusShmNodeState_t */
+    uint8_t signatureValid;
+    StatusShmSignature_t signature;
+} StatusShmNode_t;
+
+typedef struct
+{
+    uint16_t routeId;
+    uint16_t connectionLabel;   /* Only valid while isBuilt is set */
+    uint16_t sourceNode;
+    uint16_t sinkNode;
+    uint8_t shallActive;        /* Requested state */
+    uint8_t isBuilt;            /* State reported by UNICENS */
+    uint8_t reserved[2];
+} StatusShmRoute_t;
+
+typedef struct
+{
+    uint16_t routeId;           /* First route using this resource */
+    uint16_t nodeAddress;
+    uint8_t type;               /* StatusShmResType_t */
+    uint8_t state;              /* StatusShmResState_t */
+    uint8_t isSource;           /* Part of the source or of the sink endpoint */
+    uint8_t jobIndex;           /* Position in the job list of the endpoint */
+} StatusShmResource_t;
+
+/** Everything protected by the sequence counter, readers get a copy of it */
+typedef struct
+{
+    uint8_t daemonRunning;
+    uint8_t networkAvailable;
+    uint8_t nodeCount;          /* Amount of nodes found in the ring */
+    uint8_t reserved;
+    uint16_t nodesSize;
+    uint16_t routesSize;
+    uint16_t resourcesSize;
+    uint16_t reserved2;
+    StatusShmNode_t nodes[STATUS_SHM_MAX_NODES];
+    StatusShmRoute_t routes[STATUS_SHM_MAX_ROUTES];
+    StatusShmResource_t resources[STATUS_SHM_MAX_RESOURCES];
+} StatusShmData_t;
+
+/** Shared memory segment, written by the daemon only */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t segmentSize;
+    uint32_t writerPid;
+    /* Odd while the writer updates data, incremented by two with every update */
+    uint32_t sequence;
+    uint32_t reserved2;
+    StatusShmData_t data;
+} StatusShmSegment_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            WRITER SECTION                            */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/** Internal structure of the writer.
+ * \note Do not access any of this variables.
+ *  */
+typedef struct
+{
+    StatusShmSegment_t *seg;
+    uint32_t sequence;
+} StatusShmWriter_t;
+
+/**
+ * \brief Creates the segment or takes over the segment of a previous daemon instance.
+ * \note Readers which still map the old segment continue to work.
+ * \param w - Pointer to external allocated memory holding the structure needed by the writer.
+ * \param name - Name of the POSIX shared memory object, use STATUS_SHM_NAME by default.
+ * \return true, if successful. false, otherwise, do not call any other writer function in this case.
+ */
+bool StatusShm_Create(StatusShmWriter_t *w, const char *name);
+
+/**
+ * \brief Starts an update. Readers retry until StatusShm_EndWrite was called.
+ * \note Keep the update short, there must be only one writer.
+ * \param w - Pointer given along with StatusShm_Create.
+ * \return Pointer to the data to be modified, NULL if the segment is not created.
+ */
+StatusShmData_t *StatusShm_BeginWrite(StatusShmWriter_t *w);
+
+/**
+ * \brief Publishes the update started by StatusShm_BeginWrite.
+ * \param w - Pointer given along with StatusShm_Create.
+ */
+void StatusShm_EndWrite(StatusShmWriter_t *w);
+
+/**
+ * \brief Marks the daemon as not running and unmaps the segment. The segment itself stays existent.
+ * \param w - Pointer given along with StatusShm_Create.
+ */
+void StatusShm_Destroy(StatusShmWriter_t *w);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            READER SECTION                            */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/** Internal structure of the reader.
+ * \note Do not access any of this variables.
+ *  */
+typedef struct
+{
+    const StatusShmSegment_t *seg;
+} StatusShmReader_t;
+
+/**
+ * \brief Maps the segment read-only.
+ * \param r - Pointer to external allocated memory holding the structure needed by the reader.
+ * \param name - Name of the POSIX shared memory object, use STATUS_SHM_NAME by default.
+ * \return true, if successful. false, if the segment does not exist or has a different version.
+ */
+bool StatusShm_Open(StatusShmReader_t *r, const char *name);
+
+/**
+ * \brief Takes a consistent copy of the published data. Does neither block the writer nor enter the kernel.
+ * \param r - Pointer given along with StatusShm_Open.
+ * \param pData - Pointer to external allocated memory, the copy will be written to.
+ * \param pSequence - If not NULL, the sequence number of the copy will be written to.
+ *                    An unchanged sequence number means unchanged data.
+ * \return true, if successful. false, if the writer did not finish an update in time.
+ */
+bool StatusShm_Read(StatusShmReader_t *r, StatusShmData_t *pData, uint32_t *pSequence);
+
+/**
+ * \brief Gets the sequence number of the published data without copying it.
+ * \param r - Pointer given along with StatusShm_Open.
+ * \return Sequence number, odd while the writer updates the data.
+ */
+uint32_t StatusShm_GetSequence(StatusShmReader_t *r);
+
+/**
+ * \brief Gets the process ID of the daemon, which wrote the segment last.
+ * \param r - Pointer given along with StatusShm_Open.
+ */
+uint32_t StatusShm_GetWriterPid(StatusShmReader_t *r);
+
+/**
+ * \brief Unmaps the segment.
+ * \param r - Pointer given along with StatusShm_Open.
+ */
+void StatusShm_Close(StatusShmReader_t *r);
+
+/**
+ * \brief Gets a short human readable name of the given resource type.
+ * \param type - One of StatusShmResType_t.
+ * \return Zero terminated string.
+ */
+const char *StatusShm_GetResTypeName(uint8_t type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STATUSSHM_H */
@@ -28,14 +28,20 @@
 /* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
 /*------------------------------------------------------------------------------------------------*/
 #include <assert.h>
+#include <stdarg.h>
+#include <stdio.h>
 #include <string.h>
+#include <pthread.h>
 #include <assert.h>
 #include "mxml.h"
 #include "UcsXml_Private.h"
 #include "UcsXml.h"
 
 #ifdef XML_FILE_SUPPORTED
-#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 /************************************************************************/
@@ -43,11 +49,12 @@
 /************************************************************************/
 
 #define COMPILETIME_CHECK(cond)  (void)sizeof(int[2 * !!(cond) - 1])
-#define RETURN_ASSERT(result, reason) { UcsXml_CB_OnError("Assertion in file=%s, line=%d reason='%s'", 3, __FILE__, __LINE__, reason); assert(false); return result; }
+#define RETURN_ASSERT(result, reason) { UcsXml_ReportError("Assertion in file=%s, line=%d reason='%s'", 3, __FILE__, __LINE__, reason); assert(false); return result; }
 #define MISC_HB(value)      ((uint8_t)((uint16_t)(value) >> 8))
 #define MISC_LB(value)      ((uint8_t)((uint16_t)(value) & (uint16_t)0xFF))
 #define ROUTE_AUTO_ID_START (0x8000)
 #define ROUTE_INVALID_ID    (0xFFFF)
+#define ERROR_MSG_MAX_LEN   (300)
 
 struct UcsXmlRoute
 {
@@ -70,16 +77,31 @@ struct UcsXmlScript
     struct UcsXmlScript *next;
 };
 
+struct UcsXmlScriptDef
+{
+    char *scriptName;
+    Ucs_Ns_Script_t *actions;
+    uint32_t actionCnt;
+    struct UcsXmlScriptDef *next;
+};
+
 struct UcsXmlDriverInfoList
 {
     DriverInformation_t *driverInfo;
     struct UcsXmlDriverInfoList *next;
 };
 
-struct UcsXmlJobList
+struct UcsXmlJob
 {
     Ucs_Xrm_ResObject_t *job;
-    struct UcsXmlJobList *next;
+    struct UcsXmlJob *next;
+};
+
+struct UcsXmlJobList
+{
+    struct UcsXmlJob *head;
+    struct UcsXmlJob *tail;
+    uint16_t count;
 };
 
 typedef enum
@@ -122,7 +144,7 @@ typedef struct
     uint16_t labelFallback;
     Ucs_Xrm_ResObject_t *inSocket;
     Ucs_Xrm_ResObject_t *outSocket;
-    struct UcsXmlJobList *jobList;
+    struct UcsXmlJobList jobList;
     Ucs_Xrm_Combiner_t *combiner;
     Ucs_Xrm_Splitter_t *splitter;
     mxml_node_t *pendingCombinerSockets;
@@ -139,10 +161,16 @@ typedef struct {
     uint16_t autoRouteId;
     struct UcsXmlObjectList objList;
     struct UcsXmlRoute *pRtLst;
+    struct UcsXmlRoute *pRtTail;
     struct UcsXmlScript *pScrLst;
+    struct UcsXmlScript *pScrTail;
     NodeData_t nodeData;
     ConnectionData_t conData;
     struct UcsXmlDriverInfoList *drvInfLst;
+    struct UcsXmlDriverInfoList *drvInfTail;
+    uint16_t drvInfCnt;
+    void *binary;           /* Mapping of a binary configuration, NULL if parsed from XML */
+    size_t binarySize;
 } PrivateData_t;
 
 typedef struct {
@@ -151,6 +179,22 @@ typedef struct {
     ScriptData_t scriptData;
 } PrivateDataScript_t;
 
+/* State of the streaming (SAX) parser. Only the top level element which is
+ * currently open is held in memory. Nodes are stored temporarily and moved
+ * into one array when the whole document was read. */
+typedef struct {
+    UcsXmlVal_t *ucs;
+    PrivateData_t *priv;
+    mxml_node_t *root;
+    bool finished;
+    ParseResult_t result;
+    Ucs_Rm_Node_t **nodes;
+    uint16_t nodeCnt;
+    uint16_t nodeCapacity;
+    struct UcsXmlScriptDef *pScrDefLst;
+    struct UcsXmlScriptDef *pScrDefTail;
+} SaxData_t;
+
 /************************************************************************/
 /* Constants                                                            */
 /************************************************************************/
@@ -159,6 +203,7 @@ typedef struct {
 static const char* UNICENS =                "Unicens";
 static const char* PACKET_BW =              "AsyncBandwidth";
 static const char* PROXY_BW =               "ProxyBandwidth";
+static const char* NETWORK =                "Network";
 static const char* NAME =                   "Name";
 static const char* ROUTE =                  "Route";
 static const char* ROUTE_ID =               "RouteId";
@@ -195,6 +240,7 @@ static const char* ALL_CONNECTIONS[] = { SYNC_CONNECTION, AVP_CONNECTION,
 #define STREAM_SOCKET                       "StreamSocket"
 #define SPLITTER                            "Splitter"
 #define COMBINER                            "Combiner"
+static const char* NW_SOCKET =              NETWORK_SOCKET;
 static const char* ALL_SOCKETS[] = { NETWORK_SOCKET, USB_SOCKET, MLB_SOCKET,
                         STREAM_SOCKET, SPLITTER, COMBINER, NULL };
 
@@ -263,30 +309,65 @@ static const char* L_DRIVER_ALSARES_16BIT = "16bit";
 static const char* L_DRIVER_ALSARES_24BIT = "24bit";
 static const char* L_DRIVER_ALSARES_32BIT = "32bit";
 
+static const char* SCENE =                  "Scene";
+static const char* ROUTE_STATE =            "RouteState";
+
 #define L_DRIVER_ALSA                       "Alsa"
 #define L_DRIVER_CDEV                       "Cdev"
 #define L_DRIVER_V4L2                       "V4l2"
 static const char * ALL_DRIVERS[] = { L_DRIVER_ALSA, L_DRIVER_CDEV, L_DRIVER_V4L2, NULL };
 
+static const char* NETWORK_INICNET_50 =     "INICnet-50";
+static const char* NETWORK_INICNET_150 =    "INICnet-150";
+static const char* NETWORK_MOST150 =        "MOST150";
+
 static const char* VALUE_TRUE =             "true";
 static const char* VALUE_FALSE =            "false";
 static const char* VALUE_1 =                "1";
 static const char* VALUE_0 =                "0";
 
+/*Element and attribute names are interned by mxml. All keys are resolved once
+ *to their interned copy by InternKeys, so names can be compared by pointer.*/
+static const char** ALL_KEYS[] = {
+    &UNICENS, &PACKET_BW, &PROXY_BW, &NETWORK, &NAME, &ROUTE, &ROUTE_ID, &LABEL_NORMAL, &LABEL_FALLBACK,
+    &ROUTE_IS_ACTIVE, &ENDPOINT_ADDRESS, &CHANNEL_ADDRESS, &BANDWIDTH, &BYTES_PER_FRAME, &OFFSET,
+    &NODE, &REMOTE_ATTACH_DISABLE, &CLOCK_CONFIG, &ADDRESS, &FRAMES_PER_TRANSACTION, &MUTE_MODE,
+    &MUTE_MODE_NO_MUTING, &MUTE_MODE_MUTE_SIGNAL, &AVP_PACKET_SIZE, &DIVISOR, &NW_SOCKET,
+    &PHYSICAL_LAYER, &DEVICE_INTERFACES, &STRM_IN_COUNT, &STRM_OUT_COUNT, &STRM_PIN, &STRM_ALIGN,
+    &SCRIPT, &FBLOCK_ID, &FUNCTION_ID, &OP_TYPE_REQUEST, &OP_TYPE_RESPONSE, &PAYLOAD_REQ_HEX,
+    &PAUSE_MS, &DEBOUNCE_TIME, &PIN_CONFIG, &PIN_MASK, &PIN_DATA, &I2C_SPEED, &I2C_SPEED_SLOW,
+    &I2C_SPEED_FAST, &I2C_WRITE_MODE, &I2C_WRITE_MODE_DEFAULT, &I2C_WRITE_MODE_REPEAT,
+    &I2C_WRITE_MODE_BURST, &I2C_WRITE_BLOCK_COUNT, &I2C_SLAVE_ADDRESS, &I2C_PAYLOAD_LENGTH,
+    &I2C_PAYLOAD, &I2C_TIMEOUT, &L_DRIVER_ATTR, &L_DRIVER_TAG, &L_DRIVER_NAME, &L_BUFFERSIZE,
+    &L_BUFFFERCOUNT, &L_ALSA_CH_COUNT, &L_ALSA_CH_RES, &L_DRIVER_ALSARES_8BIT,
+    &L_DRIVER_ALSARES_16BIT, &L_DRIVER_ALSARES_24BIT, &L_DRIVER_ALSARES_32BIT, &SCENE,
+    &ROUTE_STATE, &VALUE_TRUE, &VALUE_FALSE, &VALUE_1, &VALUE_0, NULL };
+static const char** ALL_KEY_ARRAYS[] = { ALL_CONNECTIONS, ALL_SOCKETS, ALL_PORTS,
+    ALL_SCRIPTS, ALL_SCRIPTS_NO_PAUSE, ALL_DRIVERS, NULL };
+static pthread_once_t keysInterned = PTHREAD_ONCE_INIT;
+
+/* Context of the reentrant function currently running in this thread, NULL for the plain API */
+static __thread const UcsXmlCtx_t *currentCtx = NULL;
+
 /************************************************************************/
 /* Private Function Prototypes                                          */
 /************************************************************************/
 
 #ifdef XML_FILE_SUPPORTED
-static char *ReadFile(const char *fileName);
+static UcsXmlVal_t *LoadBinary(const char *fileName, const char *content, size_t len);
 #endif
+static UcsXmlVal_t *ParseSax(const char *xml, size_t len);
+static void InternKeys(void);
+static void OnSaxEvent(mxml_node_t *node, mxml_sax_event_t event, void *data);
+static void FreeSaxData(SaxData_t *sax);
 static void FreeVal(UcsXmlVal_t *ucs);
 static void FreeValScript(UcsXmlScript_t *script);
 static bool GetElement(mxml_node_t *element, const char *name, bool goDeep, mxml_node_t **out, bool mandatory);
+static bool GetChildElement(mxml_node_t *element, const char *name, mxml_node_t **out, bool mandatory);
 static bool GetElementArray(mxml_node_t *element, const char *array[], const char **foundName, mxml_node_t **out, bool skipFirstElement);
-static bool GetCount(mxml_node_t *element, const char *name, uint32_t *out, bool mandatory);
-static bool GetCountArray(mxml_node_t *element, const char *array[], uint32_t *out, bool mandatory);
 static bool GetString(mxml_node_t *element, const char *key, const char **out, bool mandatory);
+static bool GetStringCopy(mxml_node_t *element, const char *key, const char **out, struct UcsXmlObjectList *objList, bool mandatory);
+static const char *CopyString(const char *txt, struct UcsXmlObjectList *objList);
 static bool CheckInteger(const char *val, bool forceHex);
 static bool GetUInt16(mxml_node_t *element, const char *key, uint16_t *out, bool mandatory);
 static bool GetUInt8(mxml_node_t *element, const char *key, uint8_t *out, bool mandatory);
@@ -294,17 +375,23 @@ static bool GetSocketType(const char *txt, MSocketType_t *out);
 static bool GetPayload(mxml_node_t *element, const char *name, uint8_t **pPayload, uint8_t *len, uint8_t offset,
             struct UcsXmlObjectList *obj, bool mandatory);
 static Ucs_Xrm_ResourceType_t GetResourceType(Ucs_Xrm_ResObject_t *element);
-static bool AddJob(struct UcsXmlJobList **joblist, Ucs_Xrm_ResObject_t *job, struct UcsXmlObjectList *objList);
+static bool AddJob(struct UcsXmlJobList *joblist, Ucs_Xrm_ResObject_t *job, struct UcsXmlObjectList *objList);
 static Ucs_Xrm_ResObject_t **GetJobList(struct UcsXmlJobList *joblist, struct UcsXmlObjectList *objList);
-static struct UcsXmlJobList *DeepCopyJobList(struct UcsXmlJobList *jobsIn, struct UcsXmlObjectList *objList);
-static void AddRoute(struct UcsXmlRoute **pRtLst, struct UcsXmlRoute *route);
-static void AddScript(struct UcsXmlScript **pScrLst, struct UcsXmlScript *script);
-static ParseResult_t ParseAll(mxml_node_t *tree, UcsXmlVal_t *ucs, PrivateData_t *priv);
+static bool DeepCopyJobList(struct UcsXmlJobList *jobsIn, struct UcsXmlJobList *jobsOut, struct UcsXmlObjectList *objList);
+static void AddRoute(PrivateData_t *priv, struct UcsXmlRoute *route);
+static void AddScript(PrivateData_t *priv, struct UcsXmlScript *script);
+static ParseResult_t ParseRoot(mxml_node_t *root, UcsXmlVal_t *ucs);
+static ParseResult_t ParseNodeTree(mxml_node_t *sub, SaxData_t *sax);
+static ParseResult_t ParseFinish(SaxData_t *sax);
+static Ucs_Rm_Node_t *RemapNode(SaxData_t *sax, Ucs_Rm_Node_t *tempNode);
 static ParseResult_t ParseNode(mxml_node_t * node, PrivateData_t *priv);
 static ParseResult_t ParseConnection(mxml_node_t * node, const char *conType, PrivateData_t *priv);
-static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t socketType, struct UcsXmlJobList **jobList, PrivateData_t *priv);
-static ParseResult_t ParseAllScripts(mxml_node_t *tree, struct UcsXmlScript *scrlist, struct UcsXmlObjectList *objList, bool checkReference);
+static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t socketType, struct UcsXmlJobList *jobList, PrivateData_t *priv);
+static ParseResult_t ParseScriptDefinition(mxml_node_t *scr, SaxData_t *sax);
+static ParseResult_t BindAllScripts(struct UcsXmlScriptDef *defs, struct UcsXmlScript *scrlist);
+static ParseResult_t BindScript(const char *name, Ucs_Ns_Script_t *script, uint32_t actCnt, struct UcsXmlScript *scrlist);
 static ParseResult_t ParseScript(mxml_node_t *scr, struct UcsXmlScript *scrlist, struct UcsXmlObjectList *objList);
+static ParseResult_t ParseScriptActions(mxml_node_t *scr, struct UcsXmlObjectList *objList, Ucs_Ns_Script_t **pScript, uint32_t *pActCnt);
 static bool FillScriptInitialValues(Ucs_Ns_Script_t *scr, struct UcsXmlObjectList *objList, ScriptData_t *scriptData);
 static ParseResult_t ParseScriptMsgSend(mxml_node_t *act, Ucs_Ns_Script_t *scr, struct UcsXmlObjectList *objList, ScriptData_t *scriptData);
 static ParseResult_t ParseScriptGpioPortCreate(mxml_node_t *act, Ucs_Ns_Script_t *scr, struct UcsXmlObjectList *objList, ScriptData_t *scriptData);
@@ -315,11 +402,14 @@ static ParseResult_t ParseScriptPortWrite(mxml_node_t *act, Ucs_Ns_Script_t *scr
 static ParseResult_t ParseScriptPortRead(mxml_node_t *act, Ucs_Ns_Script_t *scr, struct UcsXmlObjectList *objList, ScriptData_t *scriptData);
 static ParseResult_t ParseScriptPause(mxml_node_t *act, ScriptData_t *scriptData);
 static ParseResult_t ParseRoutes(UcsXmlVal_t *ucs, PrivateData_t *priv);
-static bool AddDriverInfo(struct UcsXmlDriverInfoList **drvList, DriverInformation_t *drvInfo, struct UcsXmlObjectList *objList);
+static bool AddDriverInfo(PrivateData_t *priv, DriverInformation_t *drvInfo);
 static ParseResult_t ParseDriver(mxml_node_t *soc, UcsXmlVal_t *ucs, PrivateData_t *priv);
 static ParseResult_t StoreDriverInfo(PrivateData_t *priv, const char *driverLink);
-static uint16_t GetDrvInfCount(struct UcsXmlDriverInfoList *drvInfLst);
 static void FillDriverArray(struct UcsXmlDriverInfoList *drvInfLst, DriverInformation_t **ppDriveInfo);
+static ParseResult_t ParseScenes(mxml_node_t *root, UcsXmlVal_t *ucs, PrivateData_t *priv);
+static ParseResult_t ParseRouteState(mxml_node_t *state, const char *sceneName, UcsXmlVal_t *ucs, PrivateData_t *priv, int8_t *states);
+static bool IsRouteNamed(PrivateData_t *priv, const Ucs_Rm_Route_t *route, const char *name);
+static ParseResult_t StoreSceneRoutes(UcsXmlVal_t *ucs, PrivateData_t *priv, const int8_t *states, int8_t state, uint16_t **ppIds, uint16_t *pSize);
 
 /************************************************************************/
 /* Public Functions                                                     */
@@ -327,47 +417,25 @@ static void FillDriverArray(struct UcsXmlDriverInfoList *drvInfLst, DriverInform
 
 UcsXmlVal_t *UcsXml_Parse(const char *xmlString)
 {
-    UcsXmlVal_t *val = NULL;
-    ParseResult_t result = Parse_MemoryError;
-    mxml_node_t *tree;
-    if (!(tree = mxmlLoadString(NULL, xmlString, MXML_NO_CALLBACK)))
-    {
-        UcsXml_CB_OnError("XML is not parsable, double check that is well formed!", 0);
-        goto ERROR;
-    }
-    if (!GetElement(tree, UNICENS, true, &tree, true)) goto ERROR;
-    /*Do not use MCalloc for the root element*/
-    val = calloc(1, sizeof(UcsXmlVal_t));
-    if (!val) goto ERROR;
-    val->pInternal = calloc(1, sizeof(PrivateData_t));
-    if (!val->pInternal) goto ERROR;
-    result = ParseAll(tree, val, val->pInternal);
-    if (Parse_Success == result)
-        return val;
-ERROR:
-    if (Parse_MemoryError == result)
-        UcsXml_CB_OnError("XML memory error, aborting..", 0);
-    else
-        UcsXml_CB_OnError("XML parsing error, aborting..", 0);
-    if (tree)
-        mxmlDelete(tree);
-    if (val)
-        FreeVal(val);
-    return NULL;
+    if (NULL == xmlString) return NULL;
+    return ParseSax(xmlString, strlen(xmlString));
 }
 
 #ifdef XML_FILE_SUPPORTED
 UcsXmlVal_t *UcsXml_ParseFile(const char *fileName)
 {
     UcsXmlVal_t *val;
-    char *content = ReadFile(fileName);
+    size_t len;
+    const char *content = UcsXml_MapFile(fileName, &len);
     if (NULL == content)
     {
-        UcsXml_CB_OnError("UcsXml_ParseFile:Could not read file:'%s'", 1, fileName);
+        UcsXml_ReportError("UcsXml_ParseFile:Could not read file:'%s'", 1, fileName);
         return NULL;
     }
-    val = UcsXml_Parse(content);
-    free(content);
+    if (UcsXml_IsBinary(content, len))
+        return LoadBinary(fileName, content, len);
+    val = ParseSax(content, len);
+    UcsXml_UnmapFile(content, len);
     return val;
 }
 #endif
@@ -377,18 +445,184 @@ void UcsXml_FreeVal(UcsXmlVal_t *val)
     FreeVal(val);
 }
 
+#ifdef XML_FILE_SUPPORTED
+bool UcsXml_WriteBinary(const UcsXmlVal_t *val, const char *fileName)
+{
+    if (NULL == val || NULL == fileName) return false;
+    return UcsXml_WriteBinaryFile(val, fileName);
+}
+#endif
+
 UcsXmlScript_t *UcsXml_ParseScript(const char *xmlString)
+{
+    if (NULL == xmlString) return NULL;
+    return UcsXml_ParseScriptBuffer(xmlString, strlen(xmlString));
+}
+
+#ifdef XML_FILE_SUPPORTED
+UcsXmlScript_t *UcsXml_ParseScriptFile(const char *fileName)
+{
+    UcsXmlScript_t *script;
+    size_t len;
+    const char *content = UcsXml_MapFile(fileName, &len);
+    if (NULL == content)
+    {
+        UcsXml_ReportError("UcsXml_ParseScriptFile:Could not read file:'%s'", 1, fileName);
+        return NULL;
+    }
+    script = UcsXml_ParseScriptBuffer(content, len);
+    UcsXml_UnmapFile(content, len);
+    return script;
+}
+#endif
+
+void UcsXml_FreeScript(UcsXmlScript_t *script)
+{
+    FreeValScript(script);
+}
+
+UcsXmlVal_t *UcsXml_ParseCtx(const UcsXmlCtx_t *ctx, const char *xmlString)
+{
+    UcsXmlVal_t *val;
+    const UcsXmlCtx_t *prevCtx = currentCtx;
+    currentCtx = ctx;
+    val = UcsXml_Parse(xmlString);
+    currentCtx = prevCtx;
+    return val;
+}
+
+#ifdef XML_FILE_SUPPORTED
+UcsXmlVal_t *UcsXml_ParseFileCtx(const UcsXmlCtx_t *ctx, const char *fileName)
+{
+    UcsXmlVal_t *val;
+    const UcsXmlCtx_t *prevCtx = currentCtx;
+    currentCtx = ctx;
+    val = UcsXml_ParseFile(fileName);
+    currentCtx = prevCtx;
+    return val;
+}
+
+bool UcsXml_WriteBinaryCtx(const UcsXmlCtx_t *ctx, const UcsXmlVal_t *val, const char *fileName)
+{
+    bool success;
+    const UcsXmlCtx_t *prevCtx = currentCtx;
+    currentCtx = ctx;
+    success = UcsXml_WriteBinary(val, fileName);
+    currentCtx = prevCtx;
+    return success;
+}
+#endif
+
+UcsXmlScript_t *UcsXml_ParseScriptCtx(const UcsXmlCtx_t *ctx, const char *xmlString)
+{
+    UcsXmlScript_t *script;
+    const UcsXmlCtx_t *prevCtx = currentCtx;
+    currentCtx = ctx;
+    script = UcsXml_ParseScript(xmlString);
+    currentCtx = prevCtx;
+    return script;
+}
+
+#ifdef XML_FILE_SUPPORTED
+UcsXmlScript_t *UcsXml_ParseScriptFileCtx(const UcsXmlCtx_t *ctx, const char *fileName)
+{
+    UcsXmlScript_t *script;
+    const UcsXmlCtx_t *prevCtx = currentCtx;
+    currentCtx = ctx;
+    script = UcsXml_ParseScriptFile(fileName);
+    currentCtx = prevCtx;
+    return script;
+}
+#endif
+
+/************************************************************************/
+/* Module Internal Functions                                            */
+/************************************************************************/
+
+void UcsXml_ReportError(const char format[], uint16_t vargsCnt, ...)
+{
+    char msg[ERROR_MSG_MAX_LEN];
+    va_list argptr;
+    va_start(argptr, vargsCnt);
+    vsnprintf(msg, sizeof(msg), format, argptr);
+    va_end(argptr);
+    if (NULL != currentCtx && NULL != currentCtx->onError)
+        currentCtx->onError(currentCtx->userPtr, msg);
+    else
+        UcsXml_CB_OnError("%s", 1, msg);
+}
+
+/************************************************************************/
+/* Private Function Implementations                                     */
+/************************************************************************/
+
+#ifdef XML_FILE_SUPPORTED
+const char *UcsXml_MapFile(const char *fileName, size_t *pLen)
+{
+    void *content;
+    struct stat st;
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return NULL;
+    if (0 != fstat(fd, &st) || !S_ISREG(st.st_mode) || 0 == st.st_size)
+    {
+        close(fd);
+        return NULL;
+    }
+    /*The mapping stays valid after closing the descriptor*/
+    content = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == content) return NULL;
+    posix_madvise(content, st.st_size, POSIX_MADV_SEQUENTIAL);
+    *pLen = st.st_size;
+    return content;
+}
+
+void UcsXml_UnmapFile(const char *content, size_t len)
+{
+    munmap((void *)content, len);
+}
+
+static UcsXmlVal_t *LoadBinary(const char *fileName, const char *content, size_t len)
+{
+    UcsXmlVal_t *val = NULL;
+    PrivateData_t *priv = NULL;
+    const UcsXmlVal_t *root = NULL;
+    /*The mapping is private, relocating the pointers never touches the file*/
+    if (0 == mprotect((void *)content, len, PROT_READ | PROT_WRITE))
+        root = UcsXml_RelocateBinary((void *)content, len);
+    if (root)
+        val = calloc(1, sizeof(UcsXmlVal_t));
+    if (val)
+        priv = calloc(1, sizeof(PrivateData_t));
+    if (NULL == priv)
+    {
+        UcsXml_ReportError("UcsXml_ParseFile:Could not load binary file:'%s'", 1, fileName);
+        free(val);
+        UcsXml_UnmapFile(content, len);
+        return NULL;
+    }
+    memcpy(val, root, sizeof(UcsXmlVal_t));
+    val->pInternal = priv;
+    priv->binary = (void *)content;
+    priv->binarySize = len;
+    return val;
+}
+#endif
+
+UcsXmlScript_t *UcsXml_ParseScriptBuffer(const char *xml, size_t len)
 {
     ParseResult_t result = Parse_MemoryError;
     UcsXmlScript_t *script = NULL;
-    mxml_node_t *tree = NULL;
+    mxml_node_t *top = NULL;
+    mxml_node_t *tree;
     PrivateDataScript_t *priv = NULL;
     struct UcsXmlScript scriptLst = { 0 };
     Ucs_Rm_Node_t node = { 0 };
+    pthread_once(&keysInterned, InternKeys);
     scriptLst.node = &node;
     scriptLst.singleShot = true;
-    if (!(tree = mxmlLoadString(NULL, xmlString, MXML_NO_CALLBACK))) goto ERROR;
-    if (!GetElement(tree, UNICENS, true, &tree, true)) goto ERROR;
+    if (!(top = mxmlLoadBuffer(NULL, xml, len, MXML_NO_CALLBACK))) goto ERROR;
+    if (!GetElement(top, UNICENS, true, &tree, true)) goto ERROR;
     if (!GetElement(tree, SCRIPT, true, &tree, true)) goto ERROR;
     /*Do not use MCalloc for the root element*/
     script = calloc(1, sizeof(UcsXmlScript_t));
@@ -399,68 +633,152 @@ UcsXmlScript_t *UcsXml_ParseScript(const char *xmlString)
     if (Parse_Success != result) goto ERROR;
     script->pScriptList = (Ucs_Ns_Script_t *)node.init_script_list_ptr;
     script->scriptListLength = node.init_script_list_size;
+    /*All values are copied, the XML tree is not needed anymore*/
+    mxmlDelete(top);
     return script;
 ERROR:
     if (Parse_MemoryError == result)
-        UcsXml_CB_OnError("XML memory error, aborting..", 0);
+        UcsXml_ReportError("XML memory error, aborting..", 0);
     else
-        UcsXml_CB_OnError("XML parsing error, aborting..", 0);
-    if (tree)
-        mxmlDelete(tree);
+        UcsXml_ReportError("XML parsing error, aborting..", 0);
+    if (top)
+        mxmlDelete(top);
     if (script)
         FreeValScript(script);
-    if (priv)
+    else if (priv)
         free(priv);
     return NULL;
 }
 
-#ifdef XML_FILE_SUPPORTED
-UcsXmlScript_t *UcsXml_ParseScriptFile(const char *fileName)
+static UcsXmlVal_t *ParseSax(const char *xml, size_t len)
 {
-    UcsXmlScript_t *script;
-    char *content = ReadFile(fileName);
-    if (NULL == content)
+    UcsXmlVal_t *val = NULL;
+    mxml_node_t *top = NULL;
+    SaxData_t sax;
+    pthread_once(&keysInterned, InternKeys);
+    memset(&sax, 0, sizeof(SaxData_t));
+    sax.result = Parse_MemoryError;
+    /*Do not use MCalloc for the root element*/
+    val = calloc(1, sizeof(UcsXmlVal_t));
+    if (!val) goto ERROR;
+    val->pInternal = calloc(1, sizeof(PrivateData_t));
+    if (!val->pInternal) goto ERROR;
+    sax.ucs = val;
+    sax.priv = val->pInternal;
+    sax.priv->autoRouteId = ROUTE_AUTO_ID_START;
+    sax.result = Parse_Success;
+    top = mxmlSAXLoadBuffer(NULL, xml, len, MXML_NO_CALLBACK, OnSaxEvent, &sax);
+    if (NULL == top)
+    {
+        UcsXml_ReportError("XML is not parsable, double check that is well formed!", 0);
+        sax.result = Parse_XmlError;
+        goto ERROR;
+    }
+    /*All values are copied, the remaining XML tree is not needed anymore*/
+    mxmlDelete(top);
+    if (Parse_Success != sax.result) goto ERROR;
+    if (!sax.finished)
     {
-        UcsXml_CB_OnError("UcsXml_ParseScriptFile:Could not read file:'%s'", 1, fileName);
-        return NULL;
+        UcsXml_ReportError("Can not find tag <%s>", 1, UNICENS);
+        sax.result = Parse_XmlError;
+        goto ERROR;
     }
-    script = UcsXml_ParseScript(content);
-    free(content);
-    return script;
+    FreeSaxData(&sax);
+    return val;
+ERROR:
+    if (Parse_MemoryError == sax.result)
+        UcsXml_ReportError("XML memory error, aborting..", 0);
+    else
+        UcsXml_ReportError("XML parsing error, aborting..", 0);
+    FreeSaxData(&sax);
+    if (val)
+        FreeVal(val);
+    return NULL;
 }
-#endif
 
-void UcsXml_FreeScript(UcsXmlScript_t *script)
+static void InternKeys(void)
 {
-    FreeValScript(script);
+    uint32_t i, j;
+    const char *interned;
+    for (i = 0; NULL != ALL_KEYS[i]; i++)
+    {
+        interned = mxmlIntern(*ALL_KEYS[i]);
+        if (interned) *ALL_KEYS[i] = interned;
+    }
+    for (i = 0; NULL != ALL_KEY_ARRAYS[i]; i++)
+    {
+        for (j = 0; NULL != ALL_KEY_ARRAYS[i][j]; j++)
+        {
+            interned = mxmlIntern(ALL_KEY_ARRAYS[i][j]);
+            if (interned) ALL_KEY_ARRAYS[i][j] = interned;
+        }
+    }
 }
 
-/************************************************************************/
-/* Private Function Implementations                                     */
-/************************************************************************/
+static void OnSaxEvent(mxml_node_t *node, mxml_sax_event_t event, void *data)
+{
+    SaxData_t *sax = (SaxData_t *)data;
+    const char *name;
+    assert(NULL != sax);
+    if (Parse_Success != sax->result || sax->finished)
+        return; /*Ignore the rest, mxml will free all unretained nodes*/
+    if (MXML_SAX_ELEMENT_OPEN == event)
+    {
+        /*Keep every element until its top level element got parsed.
+         *Text, comments and directives are released immediately by mxml.*/
+        mxmlRetain(node);
+        if (NULL == sax->root && UNICENS == node->value.element.name)
+        {
+            sax->root = node;
+            sax->result = ParseRoot(node, sax->ucs);
+        }
+        return;
+    }
+    if (MXML_SAX_ELEMENT_CLOSE != event || NULL == sax->root)
+        return;
+    if (node == sax->root)
+    {
+        sax->result = ParseFinish(sax);
+        sax->finished = true;
+        return;
+    }
+    if (node->parent != sax->root)
+        return;
+    /*A top level element is complete*/
+    name = node->value.element.name;
+    if (NODE == name)
+    {
+        sax->result = ParseNodeTree(node, sax);
+        mxmlRelease(node);
+    }
+    else if (SCRIPT == name)
+    {
+        sax->result = ParseScriptDefinition(node, sax);
+        mxmlRelease(node);
+    }
+    else if (L_DRIVER_TAG != name && SCENE != name)
+    {
+        mxmlRelease(node);
+    }
+    /*Drivers and scenes are kept until the end, they may refer to connections of following nodes*/
+}
 
-#ifdef XML_FILE_SUPPORTED
-static char *ReadFile(const char *fileName)
-{
-    char *buffer;
-    int stringSize, readSize;
-    FILE *fh = fopen(fileName, "r");
-    if (!fh) return NULL;
-    fseek(fh, 0, SEEK_END);
-    stringSize = ftell(fh);
-    rewind(fh);
-    buffer = (char *)malloc(stringSize + 1);
-    readSize = fread(buffer, sizeof(char), stringSize, fh);
-    buffer[stringSize] = '\0'; /*In any case, terminate it.*/
-    if (stringSize != readSize)
-    {
-        free(buffer);
-        buffer = NULL;
-    }
-    fclose(fh);
-    return buffer;
+static void FreeSaxData(SaxData_t *sax)
+{
+    uint16_t i;
+    struct UcsXmlScriptDef *def = sax->pScrDefLst;
+    for (i = 0; i < sax->nodeCnt; i++)
+        free(sax->nodes[i]);
+    free(sax->nodes);
+    while (def)
+    {
+        struct UcsXmlScriptDef *next = def->next;
+        free(def->scriptName);
+        free(def);
+        def = next;
+    }
+    memset(sax, 0, sizeof(SaxData_t));
 }
-#endif
 
 static void FreeVal(UcsXmlVal_t *ucs)
 {
@@ -468,7 +786,12 @@ static void FreeVal(UcsXmlVal_t *ucs)
     if (NULL == ucs || NULL == ucs->pInternal)
         return;
     priv = ucs->pInternal;
-    FreeObjList(&priv->objList);
+#ifdef XML_FILE_SUPPORTED
+    if (priv->binary)
+        UcsXml_UnmapFile(priv->binary, priv->binarySize);
+    else
+#endif
+        FreeObjList(&priv->objList);
     free(ucs->pInternal);
     free(ucs);
 }
@@ -497,14 +820,33 @@ static bool GetElement(mxml_node_t *element, const char *name, bool goDeep, mxml
     {
         if (MXML_ELEMENT != n->type)
             continue;
-        if (0 == strcmp(name, n->value.opaque))
+        if (name == n->value.opaque)
+        {
+            *out = n;
+            return true;
+        }
+    }
+    if (mandatory)
+        UcsXml_ReportError("Can not find tag <%s>", 1, name);
+    return false;
+}
+
+static bool GetChildElement(mxml_node_t *element, const char *name, mxml_node_t **out, bool mandatory)
+{
+    mxml_node_t *n;
+    if (NULL == element || NULL == name || NULL == out) return false;
+    for (n = element->child; NULL != n; n = n->next)
+    {
+        if (MXML_ELEMENT != n->type)
+            continue;
+        if (name == n->value.opaque)
         {
             *out = n;
             return true;
         }
     }
     if (mandatory)
-        UcsXml_CB_OnError("Can not find tag <%s>", 1, name);
+        UcsXml_ReportError("Can not find tag <%s>", 1, name);
     return false;
 }
 
@@ -524,7 +866,7 @@ static bool GetElementArray(mxml_node_t *element, const char *array[], const cha
         }
         for (i = 0; NULL != array[i]; i++)
         {
-            if (0 == strcmp(array[i], n->value.opaque))
+            if (array[i] == n->value.opaque)
             {
                 *foundName = array[i];
                 *out = n;
@@ -536,50 +878,6 @@ static bool GetElementArray(mxml_node_t *element, const char *array[], const cha
     return false;
 }
 
-static bool GetCount(mxml_node_t *element, const char *name, uint32_t *out, bool mandatory)
-{
-    uint32_t cnt = 0;
-    mxml_node_t *n;
-    if (NULL == element || NULL == name) return false;
-    if(!GetElement(element, name, true, &n, false))
-        return false;
-    while(NULL != n)
-    {
-        ++cnt;
-        if(!GetElement(n, name, false, &n, false))
-            break;
-    }
-    if (mandatory && 0 == cnt)
-    {
-        UcsXml_CB_OnError("element count of <%s> is zero", 1, name);
-        return false;
-    }
-    *out = cnt;
-    return true;
-}
-
-static bool GetCountArray(mxml_node_t *element, const char *array[], uint32_t *out, bool mandatory)
-{
-    const char *tmp;
-    uint32_t cnt = 0;
-    mxml_node_t *n;
-    if (NULL == element || NULL == array) return false;
-    n = element;
-    while(NULL != n)
-    {
-        if(!GetElementArray(n, array, &tmp, &n, true))
-            break;
-        ++cnt;
-    }
-    if (mandatory && 0 == cnt)
-    {
-        UcsXml_CB_OnError("element count is zero, searched with string array", 0);
-        return false;
-    }
-    *out = cnt;
-    return true;
-}
-
 static bool GetString(mxml_node_t *element, const char *key, const char **out, bool mandatory)
 {
     int32_t i;
@@ -587,18 +885,37 @@ static bool GetString(mxml_node_t *element, const char *key, const char **out, b
     for (i = 0; i < element->value.element.num_attrs; i++)
     {
         mxml_attr_t *attr = &element->value.element.attrs[i];
-        if (0 == strcmp(key, attr->name))
+        if (key == attr->name)
         {
             *out = attr->value;
             return true;
         }
     }
     if (mandatory)
-        UcsXml_CB_OnError("Can not find attribute='%s' from element <%s>",
+        UcsXml_ReportError("Can not find attribute='%s' from element <%s>",
             2, key, element->value.element.name);
     return false;
 }
 
+static bool GetStringCopy(mxml_node_t *element, const char *key, const char **out, struct UcsXmlObjectList *objList, bool mandatory)
+{
+    const char *txt;
+    if (!GetString(element, key, &txt, mandatory)) return false;
+    *out = CopyString(txt, objList);
+    if (NULL == *out) RETURN_ASSERT(false, "calloc returned NULL");
+    return true;
+}
+
+static const char *CopyString(const char *txt, struct UcsXmlObjectList *objList)
+{
+    char *copy;
+    if (NULL == txt) return NULL;
+    copy = MCalloc(objList, strlen(txt) + 1, 1);
+    if (NULL != copy)
+        strcpy(copy, txt);
+    return copy;
+}
+
 static bool CheckInteger(const char *value, bool forceHex)
 {
     bool hex = forceHex;
@@ -633,13 +950,13 @@ static bool GetUInt16(mxml_node_t *element, const char *key, uint16_t *out, bool
     if (!GetString(element, key, &txt, mandatory)) return false;
     if (!CheckInteger(txt, false))
     {
-        UcsXml_CB_OnError("key='%s' contained invalid integer='%s'", 2, key, txt);
+        UcsXml_ReportError("key='%s' contained invalid integer='%s'", 2, key, txt);
         return false;
     }
     value = strtol( txt, NULL, 0 );
     if (value > 0xFFFF)
     {
-        UcsXml_CB_OnError("key='%s' is out of range='%d'", 2, key, value);
+        UcsXml_ReportError("key='%s' is out of range='%d'", 2, key, value);
         return false;
     }
     *out = value;
@@ -653,13 +970,13 @@ static bool GetUInt8(mxml_node_t *element, const char *key, uint8_t *out, bool m
     if (!GetString(element, key, &txt, mandatory)) return false;
     if (!CheckInteger(txt, false))
     {
-        UcsXml_CB_OnError("key='%s' contained invalid integer='%s'", 2, key, txt);
+        UcsXml_ReportError("key='%s' contained invalid integer='%s'", 2, key, txt);
         return false;
     }
     value = strtol( txt, NULL, 0 );
     if (value > 0xFF)
     {
-        UcsXml_CB_OnError("key='%s' is out of range='%d'", 2, key, value);
+        UcsXml_ReportError("key='%s' is out of range='%d'", 2, key, value);
         return false;
     }
     *out = value;
@@ -680,7 +997,7 @@ static bool GetDataType(const char *txt, MDataType_t *out)
     } else if (0 == strcmp(IPC_CONNECTION, txt)) {
         *out = IPC_PACKET;
     } else {
-        UcsXml_CB_OnError("Unknown data type : '%s'", 1, txt);
+        UcsXml_ReportError("Unknown data type : '%s'", 1, txt);
         return false;
     }
     return true;
@@ -701,7 +1018,7 @@ static bool GetSocketType(const char *txt, MSocketType_t *out)
     } else if (0 == strcmp(txt, COMBINER)) {
         *out = MSocket_COMBINER;
     } else {
-        UcsXml_CB_OnError("Unknown port : '%s'", 1, txt);
+        UcsXml_ReportError("Unknown port : '%s'", 1, txt);
         return false;
     }
     return true;
@@ -743,19 +1060,20 @@ static bool GetPayload(mxml_node_t *element, const char *name, uint8_t **pPayloa
     {
         if( len >= tempLen )
         {
-            UcsXml_CB_OnError("Script payload values must be stuffed to two characters", 0);
+            UcsXml_ReportError("Script payload values must be stuffed to two characters", 0);
             free(txtCopy);
             return false;
         }
         if (!CheckInteger(token, true))
         {
-            UcsXml_CB_OnError("Script payload contains non valid hex number='%s'", 1, token);
+            UcsXml_ReportError("Script payload contains non valid hex number='%s'", 1, token);
             free(txtCopy);
             return false;
         }
         p[offset + len++] = strtol( token, NULL, 16 );
         token = strtok_r( NULL, " ,.-", &tkPtr );
     }
+    free(txtCopy);
     *outLen = len;
     return true;
 }
@@ -767,29 +1085,25 @@ static Ucs_Xrm_ResourceType_t GetResourceType(Ucs_Xrm_ResObject_t *element)
     return typ;
 }
 
-static bool AddJob(struct UcsXmlJobList **joblist, Ucs_Xrm_ResObject_t *job, struct UcsXmlObjectList *objList)
+static bool AddJob(struct UcsXmlJobList *joblist, Ucs_Xrm_ResObject_t *job, struct UcsXmlObjectList *objList)
 {
-    struct UcsXmlJobList *tail;
+    struct UcsXmlJob *entry;
     if (NULL == joblist || NULL == job)
         return false;
     assert(UCS_XRM_RC_TYPE_QOS_CON >= *((Ucs_Xrm_ResourceType_t *)job));
-    if (NULL == joblist[0])
-    {
-        joblist[0] = MCalloc(objList, 1, sizeof(struct UcsXmlJobList));
-        if (NULL == joblist[0]) return false;;
-        joblist[0]->job = job;
-        return true;
-    }
-    tail = joblist[0];
-    while(tail) {
-        assert(tail->job != job);
-        if (!tail->next)
-            break;
-        tail = tail->next;
-    }
-    tail->next = MCalloc(objList, 1, sizeof(struct UcsXmlJobList));
-    if (NULL == tail->next) return false;
-    tail->next->job = job;
+#ifndef NDEBUG
+    for (entry = joblist->head; NULL != entry; entry = entry->next)
+        assert(entry->job != job);
+#endif
+    entry = MCalloc(objList, 1, sizeof(struct UcsXmlJob));
+    if (NULL == entry) return false;
+    entry->job = job;
+    if (NULL == joblist->tail)
+        joblist->head = entry;
+    else
+        joblist->tail->next = entry;
+    joblist->tail = entry;
+    ++joblist->count;
     return true;
 }
 
@@ -797,189 +1111,220 @@ static Ucs_Xrm_ResObject_t **GetJobList(struct UcsXmlJobList *joblist, struct Uc
 {
     Ucs_Xrm_ResObject_t **outJob;
     uint32_t count = 0;
-    struct UcsXmlJobList *tail;
-    if (NULL == joblist)
-        return false;
-    /*First: Get amount of stored jobs by enumerate all*/
-    tail = joblist;
-    while(tail)
-    {
-        ++count;
-        tail = tail->next;
-    }
-    if (0 == count)
-        return false;
-    /*Second: Allocate count+1 elements (NULL terminated) and copy pointers*/
-    outJob = MCalloc(objList, (count + 1), sizeof(Ucs_Xrm_ResObject_t *));
+    struct UcsXmlJob *entry;
+    if (NULL == joblist || 0 == joblist->count)
+        return NULL;
+    /*Allocate count+1 elements (NULL terminated) and copy pointers*/
+    outJob = MCalloc(objList, (joblist->count + 1), sizeof(Ucs_Xrm_ResObject_t *));
     if (NULL == outJob) RETURN_ASSERT(NULL, "calloc returned NULL");
-    tail = joblist;
-    count = 0;
-    while(tail)
-    {
-        outJob[count++] = tail->job;
-        tail = tail->next;
-    }
+    for (entry = joblist->head; NULL != entry; entry = entry->next)
+        outJob[count++] = entry->job;
+    assert(count == joblist->count);
     return outJob;
 }
 
-static struct UcsXmlJobList *DeepCopyJobList(struct UcsXmlJobList *jobsIn, struct UcsXmlObjectList *objList)
+static bool DeepCopyJobList(struct UcsXmlJobList *jobsIn, struct UcsXmlJobList *jobsOut, struct UcsXmlObjectList *objList)
 {
-    struct UcsXmlJobList *jobsOut, *tail;
-    if (NULL == jobsIn || NULL == objList)
-        return NULL;
-    jobsOut = tail = MCalloc(objList, 1, sizeof(struct UcsXmlJobList));
-    if (NULL == jobsOut) RETURN_ASSERT(NULL, "calloc returned NULL");
-    while(jobsIn)
-    {
-        tail->job = jobsIn->job;
-        if (jobsIn->next)
-        {
-            tail->next = MCalloc(objList, 1, sizeof(struct UcsXmlJobList));
-            if (NULL == tail->next) RETURN_ASSERT(NULL, "calloc returned NULL");
-            tail = tail->next;
-        }
-        jobsIn = jobsIn->next;
+    struct UcsXmlJob *entry;
+    if (NULL == jobsIn || NULL == jobsOut || NULL == objList)
+        return false;
+    memset(jobsOut, 0, sizeof(struct UcsXmlJobList));
+    for (entry = jobsIn->head; NULL != entry; entry = entry->next)
+    {
+        struct UcsXmlJob *copy = MCalloc(objList, 1, sizeof(struct UcsXmlJob));
+        if (NULL == copy) RETURN_ASSERT(false, "calloc returned NULL");
+        copy->job = entry->job;
+        if (NULL == jobsOut->tail)
+            jobsOut->head = copy;
+        else
+            jobsOut->tail->next = copy;
+        jobsOut->tail = copy;
+        ++jobsOut->count;
     }
-    return jobsOut;
+    return true;
 }
 
-static void AddRoute(struct UcsXmlRoute **pRtLst, struct UcsXmlRoute *route)
+static void AddRoute(PrivateData_t *priv, struct UcsXmlRoute *route)
 {
-    struct UcsXmlRoute *tail;
-    if (NULL == pRtLst || NULL == route)
+    if (NULL == priv || NULL == route)
     {
         assert(false);
         return;
     }
-    if (NULL == pRtLst[0])
-    {
-        pRtLst[0] = route;
-        return;
-    }
-    tail = pRtLst[0];
-    while(tail->next) tail = tail->next;
-    tail->next = route;
+    if (NULL == priv->pRtTail)
+        priv->pRtLst = route;
+    else
+        priv->pRtTail->next = route;
+    priv->pRtTail = route;
 }
 
-static void AddScript(struct UcsXmlScript **pScrLst, struct UcsXmlScript *script)
+static void AddScript(PrivateData_t *priv, struct UcsXmlScript *script)
 {
-    struct UcsXmlScript *tail;
-    if (NULL == pScrLst || NULL == script)
+    if (NULL == priv || NULL == script)
     {
         assert(false);
         return;
     }
-    if (NULL == pScrLst[0])
-    {
-        pScrLst[0] = script;
-        return;
-    }
-    tail = pScrLst[0];
-    while(tail->next) tail = tail->next;
-    tail->next = script;
+    if (NULL == priv->pScrTail)
+        priv->pScrLst = script;
+    else
+        priv->pScrTail->next = script;
+    priv->pScrTail = script;
 }
 
-static ParseResult_t ParseAll(mxml_node_t *tree, UcsXmlVal_t *ucs, PrivateData_t *priv)
+static ParseResult_t ParseRoot(mxml_node_t *root, UcsXmlVal_t *ucs)
 {
-    uint32_t nodeCount;
-    mxml_node_t *sub;
-    ParseResult_t result;
-    priv->autoRouteId = ROUTE_AUTO_ID_START;
-    if (!GetCount(tree, NODE, &nodeCount, true))
-        RETURN_ASSERT(Parse_XmlError, "No node defined");
-
-    ucs->pNod = MCalloc(&priv->objList, nodeCount, sizeof(Ucs_Rm_Node_t));
-    if (NULL == ucs->pNod) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
-
-    if (!GetUInt16(tree, PACKET_BW, &ucs->packetBw, true))
+    const char *txt;
+    assert(NULL != root && NULL != ucs);
+    if (!GetUInt16(root, PACKET_BW, &ucs->packetBw, true))
         RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
 
-    GetUInt16(tree, PROXY_BW, &ucs->proxyBw, false);
-
-    /*Iterate all nodes*/
-    if (!GetElement(tree, NODE, true, &sub, true))
-        RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
-    while(sub)
+    GetUInt16(root, PROXY_BW, &ucs->proxyBw, false);
+    if (GetString(root, NETWORK, &txt, false))
     {
-        const char *conType;
-        mxml_node_t *con;
-        memset(&priv->nodeData, 0, sizeof(NodeData_t));
-        priv->nodeData.nod = &ucs->pNod[ucs->nodSize];
-        if (Parse_Success != (result = ParseNode(sub, priv)))
-            return result;
-        /*/Iterate all connections. Node without any connection is also valid.*/
-        if (GetElementArray(sub->child, ALL_CONNECTIONS, &conType, &con, false))
+        if (0 == strcmp(txt, NETWORK_INICNET_50))
+            ucs->networkBw = UCSXML_NETWORK_BW_50;
+        else if (0 == strcmp(txt, NETWORK_INICNET_150) || 0 == strcmp(txt, NETWORK_MOST150))
+            ucs->networkBw = UCSXML_NETWORK_BW_150;
+        else
+        {
+            UcsXml_ReportError("Unknown network type:'%s'", 1, txt);
+            return Parse_XmlError;
+        }
+    }
+    return Parse_Success;
+}
+
+static ParseResult_t ParseNodeTree(mxml_node_t *sub, SaxData_t *sax)
+{
+    const char *conType;
+    mxml_node_t *con;
+    ParseResult_t result;
+    PrivateData_t *priv = sax->priv;
+    if (sax->nodeCnt == sax->nodeCapacity)
+    {
+        uint16_t newCapacity = sax->nodeCapacity ? (2 * sax->nodeCapacity) : 8;
+        Ucs_Rm_Node_t **grown = realloc(sax->nodes, newCapacity * sizeof(Ucs_Rm_Node_t *));
+        if (NULL == grown) RETURN_ASSERT(Parse_MemoryError, "realloc returned NULL");
+        sax->nodes = grown;
+        sax->nodeCapacity = newCapacity;
+    }
+    memset(&priv->nodeData, 0, sizeof(NodeData_t));
+    /*The final node array is created in ParseFinish, when the amount of nodes is known*/
+    priv->nodeData.nod = calloc(1, sizeof(Ucs_Rm_Node_t));
+    if (NULL == priv->nodeData.nod) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
+    sax->nodes[sax->nodeCnt++] = priv->nodeData.nod;
+    if (Parse_Success != (result = ParseNode(sub, priv)))
+        return result;
+    /*/Iterate all connections. Node without any connection is also valid.*/
+    if (GetElementArray(sub->child, ALL_CONNECTIONS, &conType, &con, false))
+    {
+        while(con)
         {
-            while(con)
+            const char *driverLink;
+            const char *socTypeStr;
+            MSocketType_t socType;
+            mxml_node_t *soc;
+            memset(&priv->conData, 0, sizeof(ConnectionData_t));
+            if(priv->nodeData.rmckPort) {
+                AddJob(&priv->conData.jobList, priv->nodeData.rmckPort, &priv->objList);
+            }
+            if (Parse_Success != (result = ParseConnection(con, conType, priv)))
+                return result;
+            /*Iterate all sockets*/
+            if(!GetElementArray(con->child, ALL_SOCKETS, &socTypeStr, &soc, false)) RETURN_ASSERT(Parse_XmlError, "No Sockets defined");
+            while(soc)
             {
-                const char *driverLink;
-                const char *socTypeStr;
-                MSocketType_t socType;
-                mxml_node_t *soc;
-                memset(&priv->conData, 0, sizeof(ConnectionData_t));
-                if(priv->nodeData.rmckPort) {
-                    AddJob(&priv->conData.jobList, priv->nodeData.rmckPort, &priv->objList);
-                }
-                if (Parse_Success != (result = ParseConnection(con, conType, priv)))
+                if (!GetSocketType(socTypeStr, &socType)) RETURN_ASSERT(Parse_XmlError, "Could not get socket type");
+                if (Parse_Success != (result = ParseSocket(soc, (0 == priv->conData.sockCnt), socType, &priv->conData.jobList, priv)))
                     return result;
-                /*Iterate all sockets*/
-                if(!GetElementArray(con->child, ALL_SOCKETS, &socTypeStr, &soc, false)) RETURN_ASSERT(Parse_XmlError, "No Sockets defined");
-                while(soc)
-                {
-                    if (!GetSocketType(socTypeStr, &socType)) RETURN_ASSERT(Parse_XmlError, "Could not get socket type");
-                    if (Parse_Success != (result = ParseSocket(soc, (0 == priv->conData.sockCnt), socType, &priv->conData.jobList, priv)))
-                        return result;
-                    ++priv->conData.sockCnt;
-                    if(!GetElementArray(soc, ALL_SOCKETS, &socTypeStr, &soc, true))
-                        break;
-                }
-                if (GetString(con, L_DRIVER_ATTR, &driverLink, false)) {
-                    result = StoreDriverInfo(priv, driverLink);
-                    if (Parse_Success != result) return result;
-                }
-                if(!GetElementArray(con, ALL_CONNECTIONS, &conType, &con, true))
+                ++priv->conData.sockCnt;
+                if(!GetElementArray(soc, ALL_SOCKETS, &socTypeStr, &soc, true))
                     break;
             }
+            if (GetString(con, L_DRIVER_ATTR, &driverLink, false)) {
+                result = StoreDriverInfo(priv, driverLink);
+                if (Parse_Success != result) return result;
+            }
+            if(!GetElementArray(con, ALL_CONNECTIONS, &conType, &con, true))
+                break;
         }
-        ++ucs->nodSize;
-        if (!GetElement(sub, NODE, false, &sub, false))
-            break;
     }
+    return Parse_Success;
+}
+
+static ParseResult_t ParseFinish(SaxData_t *sax)
+{
+    uint16_t i;
+    mxml_node_t *sub;
+    ParseResult_t result;
+    struct UcsXmlRoute *route;
+    struct UcsXmlScript *scr;
+    UcsXmlVal_t *ucs = sax->ucs;
+    PrivateData_t *priv = sax->priv;
+    if (0 == sax->nodeCnt)
+        RETURN_ASSERT(Parse_XmlError, "No node defined");
+
+    /*Move all nodes into one array and update the references to them*/
+    ucs->pNod = MCalloc(&priv->objList, sax->nodeCnt, sizeof(Ucs_Rm_Node_t));
+    if (NULL == ucs->pNod) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
+    for (i = 0; i < sax->nodeCnt; i++)
+        memcpy(&ucs->pNod[i], sax->nodes[i], sizeof(Ucs_Rm_Node_t));
+    ucs->nodSize = sax->nodeCnt;
+    for (route = priv->pRtLst; NULL != route; route = route->next)
+        route->ep->node_obj_ptr = RemapNode(sax, route->ep->node_obj_ptr);
+    for (scr = priv->pScrLst; NULL != scr; scr = scr->next)
+        scr->node = RemapNode(sax, scr->node);
+    priv->nodeData.nod = NULL;
 
     /*Fill route structures*/
     result = ParseRoutes(ucs, priv);
     if (Parse_MemoryError == result) RETURN_ASSERT(Parse_MemoryError, "Aborting further parsing, because nodes failed")
     else if (Parse_XmlError == result) RETURN_ASSERT(Parse_XmlError, "Aborting further parsing, because nodes failed");
 
-
-    /* Parse all scripts*/
-    result = ParseAllScripts(tree, priv->pScrLst, &priv->objList, true);
+    /* Assign all scripts*/
+    result = BindAllScripts(sax->pScrDefLst, priv->pScrLst);
     if (Parse_MemoryError == result) RETURN_ASSERT(Parse_MemoryError, "Aborting further parsing, because scripts failed")
     else if (Parse_XmlError == result) RETURN_ASSERT(Parse_XmlError, "Aborting further parsing, because scripts failed");
 
-    /*Iterate all drivers. No driver at all is allowed*/
-    if(GetElement(tree, L_DRIVER_TAG, true, &sub, false))
+    /*Iterate all drivers, they are the only top level elements left. No driver at all is allowed*/
+    for (sub = sax->root->child; NULL != sub; sub = sub->next)
     {
-        while(sub)
-        {
-            result = ParseDriver(sub, ucs, priv);
-            if (Parse_MemoryError == result) RETURN_ASSERT(Parse_MemoryError, "Aborting further parsing, because drivers failed")
-            else if (Parse_XmlError == result) RETURN_ASSERT(Parse_XmlError, "Aborting further parsing, because drivers failed");
-            if(!GetElement(sub, L_DRIVER_TAG, false, &sub, false))
-                break;
-        }
+        if (MXML_ELEMENT != sub->type || L_DRIVER_TAG != sub->value.element.name)
+            continue;
+        result = ParseDriver(sub, ucs, priv);
+        if (Parse_MemoryError == result) RETURN_ASSERT(Parse_MemoryError, "Aborting further parsing, because drivers failed")
+        else if (Parse_XmlError == result) RETURN_ASSERT(Parse_XmlError, "Aborting further parsing, because drivers failed");
     }
 
     /*Fill driver informations*/
-    ucs->driverSize = GetDrvInfCount(priv->drvInfLst);
+    ucs->driverSize = priv->drvInfCnt;
     if (0 != ucs->driverSize)
     {
         ucs->ppDriver = MCalloc(&priv->objList, ucs->driverSize, sizeof(DriverInformation_t *));
+        if (NULL == ucs->ppDriver) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
         FillDriverArray(priv->drvInfLst, ucs->ppDriver);
     }
+
+    /*Scenes refer to the final route identifiers, so they are resolved last*/
+    result = ParseScenes(sax->root, ucs, priv);
+    if (Parse_MemoryError == result) RETURN_ASSERT(Parse_MemoryError, "Aborting further parsing, because scenes failed")
+    else if (Parse_XmlError == result) RETURN_ASSERT(Parse_XmlError, "Aborting further parsing, because scenes failed");
     return Parse_Success;
 }
 
+static Ucs_Rm_Node_t *RemapNode(SaxData_t *sax, Ucs_Rm_Node_t *tempNode)
+{
+    uint16_t i;
+    for (i = 0; i < sax->nodeCnt; i++)
+    {
+        if (sax->nodes[i] == tempNode)
+            return &sax->ucs->pNod[i];
+    }
+    assert(false);
+    return NULL;
+}
+
 static ParseResult_t ParseNode(mxml_node_t *node, PrivateData_t *priv)
 {
     const char *txt;
@@ -1005,7 +1350,7 @@ static ParseResult_t ParseNode(mxml_node_t *node, PrivateData_t *priv)
         if (NULL == scr) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
         scr->node = priv->nodeData.nod;
         strncpy(scr->scriptName, txt, sizeof(scr->scriptName));
-        AddScript(&priv->pScrLst, scr);
+        AddScript(priv, scr);
     }
     /*Iterate all ports*/
     if(GetElementArray(node->child, ALL_PORTS, &txt, &port, false))
@@ -1049,7 +1394,7 @@ static ParseResult_t ParseNode(mxml_node_t *node, PrivateData_t *priv)
             }
             else
             {
-                UcsXml_CB_OnError("Unknown Port:'%s'", 1, txt);
+                UcsXml_ReportError("Unknown Port:'%s'", 1, txt);
                 RETURN_ASSERT(Parse_XmlError, "Internal error");
             }
             if(!GetElementArray(port, ALL_PORTS, &txt, &port, true))
@@ -1077,7 +1422,7 @@ static ParseResult_t ParseConnection(mxml_node_t * node, const char *conType, Pr
                 priv->conData.muteMode = UCS_SYNC_MUTE_MODE_MUTE_SIGNAL;
             else
             {
-                UcsXml_CB_OnError("ParseConnection: MuteMode='%s' not implemented", 1, txt);
+                UcsXml_ReportError("ParseConnection: MuteMode='%s' not implemented", 1, txt);
                 RETURN_ASSERT(Parse_XmlError, "Wrong enum");
             }
         }
@@ -1105,7 +1450,7 @@ static ParseResult_t ParseConnection(mxml_node_t * node, const char *conType, Pr
                 priv->conData.isocPacketSize = UCS_ISOC_PCKT_SIZE_206;
                 break;
             default:
-                UcsXml_CB_OnError("ParseConnection: %s='%d' not implemented", 2, AVP_PACKET_SIZE, size);
+                UcsXml_ReportError("ParseConnection: %s='%d' not implemented", 2, AVP_PACKET_SIZE, size);
                 RETURN_ASSERT(Parse_XmlError, "Wrong enum");
             }
         }
@@ -1117,14 +1462,14 @@ static ParseResult_t ParseConnection(mxml_node_t * node, const char *conType, Pr
         break;
     }
     default:
-        UcsXml_CB_OnError("ParseConnection: Datatype='%s' not implemented", 1, conType);
+        UcsXml_ReportError("ParseConnection: Datatype='%s' not implemented", 1, conType);
         RETURN_ASSERT(Parse_XmlError, "Wrong enum");
         break;
     }
     return Parse_Success;
 }
 
-static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t socketType, struct UcsXmlJobList **jobList, PrivateData_t *priv)
+static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t socketType, struct UcsXmlJobList *jobList, PrivateData_t *priv)
 {
     Ucs_Xrm_ResObject_t **targetSock;
     assert(NULL != soc && NULL != priv);
@@ -1256,7 +1601,7 @@ static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t
              * It will split a big network socket into a smaller socket on a peripherial port of INIC (Stream/USB/MLB) */
             if (!GetSplitter(&priv->conData.splitter, &p)) RETURN_ASSERT(Parse_XmlError, "Can not get Splitter");
             priv->conData.inSocket = priv->conData.splitter;
-            if (!GetElement(soc->child, NETWORK_SOCKET, false, &networkSoc, true))
+            if (!GetChildElement(soc, NW_SOCKET, &networkSoc, true))
                 RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
             /* Currently only supporting one NetworkSocket */
             if(networkSoc) {
@@ -1268,13 +1613,14 @@ static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t
             if (!(p.inSoc = priv->conData.inSocket)) RETURN_ASSERT(Parse_XmlError, "Wrong usage of Splitter");
             if (!GetSplitter((Ucs_Xrm_Splitter_t **)&priv->conData.inSocket, &p)) RETURN_ASSERT(Parse_XmlError, "Can not get Splitter");
             if (!AddJob(jobList, priv->conData.inSocket, &priv->objList)) RETURN_ASSERT(Parse_XmlError, "Failed to add job");
-            if (!GetElement(soc->child, NETWORK_SOCKET, false, &networkSoc, true))
+            if (!GetChildElement(soc, NW_SOCKET, &networkSoc, true))
                 RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
             while(networkSoc)
             {
-                struct UcsXmlJobList *jobListCopy = DeepCopyJobList(*jobList, &priv->objList);
+                struct UcsXmlJobList jobListCopy;
+                if (!DeepCopyJobList(jobList, &jobListCopy, &priv->objList)) RETURN_ASSERT(Parse_MemoryError, "Failed to copy job list");
                 if (!ParseSocket(networkSoc, false, MSocket_NETWORK, &jobListCopy, priv)) RETURN_ASSERT(Parse_XmlError, "Failed to parse Network Socket");
-                if (!GetElement(networkSoc, NETWORK_SOCKET, false, &networkSoc, false))
+                if (!GetElement(networkSoc, NW_SOCKET, false, &networkSoc, false))
                     return Parse_Success; /* Do not break here, otherwise an additional invalid route will be created */
             }
         }
@@ -1285,14 +1631,14 @@ static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t
         struct CombinerParameters p;
         if (!isSource)
         {
-            UcsXml_CB_OnError("Combiner can not be used as output socket", 0);
+            UcsXml_ReportError("Combiner can not be used as output socket", 0);
             RETURN_ASSERT(Parse_XmlError, "Wrong usage of Combiner");
         }
         p.list = &priv->objList;
         if (!GetUInt16(soc, BYTES_PER_FRAME, &p.bytesPerFrame, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
         if (!GetCombiner(&priv->conData.combiner, &p)) RETURN_ASSERT(Parse_XmlError, "Can not get Combiner");
         priv->conData.syncOffsetNeeded = true;
-        if (!GetElement(soc->child, NETWORK_SOCKET, false, &priv->conData.pendingCombinerSockets, true))
+        if (!GetChildElement(soc, NW_SOCKET, &priv->conData.pendingCombinerSockets, true))
             RETURN_ASSERT(Parse_XmlError, "No Network Socket inside Combiner");
         break;
     }
@@ -1311,9 +1657,10 @@ static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t
         priv->conData.outSocket = priv->conData.combiner;
         while(tmp)
         {
-            struct UcsXmlJobList *jobListCopy = DeepCopyJobList(*jobList, &priv->objList);
+            struct UcsXmlJobList jobListCopy;
+            if (!DeepCopyJobList(jobList, &jobListCopy, &priv->objList)) RETURN_ASSERT(Parse_MemoryError, "Failed to copy job list");
             if (!ParseSocket(tmp, true, MSocket_NETWORK, &jobListCopy, priv)) RETURN_ASSERT(Parse_XmlError, "Failed to parse Network Socket in Combiner");
-            if (!GetElement(tmp, NETWORK_SOCKET, false, &tmp, false))
+            if (!GetElement(tmp, NW_SOCKET, false, &tmp, false))
                 return Parse_Success; /* Do not break here, otherwise an additional invalid route will be created */
         }
     }
@@ -1352,7 +1699,7 @@ static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t
             break;
         }
         default:
-            UcsXml_CB_OnError("Could not connect sockets, data type not implemented: %d", 1, priv->conData.dataType);
+            UcsXml_ReportError("Could not connect sockets, data type not implemented: %d", 1, priv->conData.dataType);
             RETURN_ASSERT(Parse_XmlError, "Wrong enum");
             break;
         }
@@ -1364,11 +1711,11 @@ static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t
         networkIsOutput = (UCS_XRM_RC_TYPE_NW_SOCKET == *((Ucs_Xrm_ResourceType_t *)priv->conData.outSocket));
         if (!networkIsInput && !networkIsOutput)
         {
-            UcsXml_CB_OnError("At least one Network socket required per connection", 0);
+            UcsXml_ReportError("At least one Network socket required per connection", 0);
             RETURN_ASSERT(Parse_XmlError, "Wrong usage of connection");
         }
         ep->endpoint_type = networkIsOutput ? UCS_RM_EP_SOURCE : UCS_RM_EP_SINK;
-        ep->jobs_list_ptr = GetJobList(*jobList, &priv->objList);
+        ep->jobs_list_ptr = GetJobList(jobList, &priv->objList);
         if(NULL == ep->jobs_list_ptr) RETURN_ASSERT(Parse_MemoryError, "Got empty job list");
         ep->node_obj_ptr = priv->nodeData.nod;
         route = MCalloc(&priv->objList, 1, sizeof(struct UcsXmlRoute));
@@ -1390,119 +1737,178 @@ static ParseResult_t ParseSocket(mxml_node_t *soc, bool isSource, MSocketType_t
         if (0 != priv->conData.labelFallback) {
             route->labelFallback = priv->conData.labelFallback;
         }
-        AddRoute(&priv->pRtLst, route);
+        AddRoute(priv, route);
     }
     return Parse_Success;
 }
 
-static ParseResult_t ParseAllScripts(mxml_node_t *tree, struct UcsXmlScript *scrlist, struct UcsXmlObjectList *objList, bool checkReference)
+static ParseResult_t ParseScriptDefinition(mxml_node_t *scr, SaxData_t *sax)
 {
-    mxml_node_t *sub;
-    ParseResult_t result = Parse_Success; /* It's okay to have no scripts */
-    /*Iterate all scripts. No scripts at all is allowed*/
-    if(GetElement(tree, SCRIPT, true, &sub, false))
+    const char *txt;
+    ParseResult_t result;
+    struct UcsXmlScriptDef *def = calloc(1, sizeof(struct UcsXmlScriptDef));
+    if (NULL == def) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
+    if (NULL == sax->pScrDefTail)
+        sax->pScrDefLst = def;
+    else
+        sax->pScrDefTail->next = def;
+    sax->pScrDefTail = def;
+    /*Actions are parsed now, the nodes using this script may follow later on*/
+    result = ParseScriptActions(scr, &sax->priv->objList, &def->actions, &def->actionCnt);
+    if (Parse_Success != result) return result;
+    if (!GetString(scr, NAME, &txt, true))
+        RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
+    def->scriptName = malloc(strlen(txt) + 1);
+    if (NULL == def->scriptName) RETURN_ASSERT(Parse_MemoryError, "malloc returned NULL");
+    strcpy(def->scriptName, txt);
+    return Parse_Success;
+}
+
+static ParseResult_t BindAllScripts(struct UcsXmlScriptDef *defs, struct UcsXmlScript *scrlist)
+{
+    bool found = true;
+    ParseResult_t result = Parse_Success;
+    if (NULL == defs)
+        return Parse_Success; /* It's okay to have no scripts */
+    while(defs)
+    {
+        result = BindScript(defs->scriptName, defs->actions, defs->actionCnt, scrlist);
+        if (Parse_MemoryError == result) RETURN_ASSERT(Parse_MemoryError, "Aborting further parsing, because scripts failed")
+        else if (Parse_XmlError == result) RETURN_ASSERT(Parse_XmlError, "Aborting further parsing, because scripts failed");
+        defs = defs->next;
+    }
+    /* Check if all scripts where referenced */
+    while(NULL != scrlist)
     {
-        bool found = true;
-        while(sub)
+        if (!scrlist->inUse)
         {
-            result = ParseScript(sub, scrlist, objList);
-            if (Parse_MemoryError == result) RETURN_ASSERT(Parse_MemoryError, "Aborting further parsing, because scripts failed")
-            else if (Parse_XmlError == result) RETURN_ASSERT(Parse_XmlError, "Aborting further parsing, because scripts failed");
-            if(!GetElement(sub, SCRIPT, false, &sub, false))
-                break;
+            UcsXml_ReportError("Script not defined:'%s', used by node=0x%X", 1, scrlist->scriptName, scrlist->node->signature_ptr->node_address);
+            found = false;
         }
-        /* Check if all scripts where referenced */
-        while(checkReference && NULL != scrlist)
+        scrlist = scrlist->next;
+    }
+    if (!found)
+        RETURN_ASSERT(Parse_XmlError, "Script not found");
+    return result;
+}
+
+static ParseResult_t BindScript(const char *name, Ucs_Ns_Script_t *script, uint32_t actCnt, struct UcsXmlScript *scrlist)
+{
+    bool found = false;
+    while(NULL != scrlist)
+    {
+        if (scrlist->singleShot || 0 == strcmp(name, scrlist->scriptName))
         {
-            if (!scrlist->inUse)
-            {
-                UcsXml_CB_OnError("Script not defined:'%s', used by node=0x%X", 1, scrlist->scriptName, scrlist->node->signature_ptr->node_address);
-                found = false;
-            }
-            scrlist = scrlist->next;
+            Ucs_Rm_Node_t *node = scrlist->node;
+            if (NULL == node)
+                return Parse_MemoryError;
+            node->init_script_list_ptr = script;
+            node->init_script_list_size = actCnt;
+            scrlist->inUse = true;
+            found = true;
         }
-        if (!found)
-            RETURN_ASSERT(Parse_XmlError, "Script not found");
+        scrlist = scrlist->next;
     }
-    return result;
+    if(!found)
+    {
+        UcsXml_ReportError("Script defined:'%s', which was never referenced", 1, name);
+        RETURN_ASSERT(Parse_XmlError, "Unused script");
+    }
+    return Parse_Success;
 }
 
 static ParseResult_t ParseScript(mxml_node_t *scr, struct UcsXmlScript *scrlist, struct UcsXmlObjectList *objList)
 {
-    bool found = false;
-    mxml_node_t *act;
     uint32_t actCnt;
     const char *txt;
     Ucs_Ns_Script_t *script;
-    ScriptData_t scriptData = { 0 };
+    ParseResult_t result;
     assert(NULL != scr && NULL != scrlist && NULL != objList);
-    if (!GetCountArray(scr->child, ALL_SCRIPTS_NO_PAUSE, &actCnt, true)) RETURN_ASSERT(Parse_XmlError, "Script without any action");
-    if (NULL == (script = MCalloc(objList, actCnt, sizeof(Ucs_Ns_Script_t))))
-        RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
-    actCnt = 0;
-    /*Iterate all actions*/
+    result = ParseScriptActions(scr, objList, &script, &actCnt);
+    if (Parse_Success != result) return result;
+    if (!GetString(scr, NAME, &txt, true))
+        RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
+    return BindScript(txt, script, actCnt, scrlist);
+}
+
+static ParseResult_t ParseScriptActions(mxml_node_t *scr, struct UcsXmlObjectList *objList, Ucs_Ns_Script_t **pScript, uint32_t *pActCnt)
+{
+#define SCRIPT_ACTIONS_INITIAL_CAPACITY 8
+    mxml_node_t *act;
+    uint32_t actCnt = 0;
+    uint32_t actCapacity = 0;
+    const char *txt;
+    Ucs_Ns_Script_t *actions = NULL;
+    Ucs_Ns_Script_t *script;
+    ScriptData_t scriptData = { 0 };
+    assert(NULL != scr && NULL != objList && NULL != pScript && NULL != pActCnt);
+    /*Iterate all actions, growing the temporary action array on demand*/
     if (!GetElementArray(scr->child, ALL_SCRIPTS, &txt, &act, false)) RETURN_ASSERT(Parse_XmlError, "Script without any action");
     while(act)
     {
-        if (0 == strcmp(txt, SCRIPT_MSG_SEND)) {
-            ParseResult_t result = ParseScriptMsgSend(act, &script[actCnt], objList, &scriptData);
-            if (Parse_Success != result) return result;
-            ++actCnt;
+        ParseResult_t result;
+        bool isPause = (0 == strcmp(txt, SCRIPT_PAUSE));
+        if (!isPause && actCnt == actCapacity)
+        {
+            uint32_t newCapacity = actCapacity ? (2 * actCapacity) : SCRIPT_ACTIONS_INITIAL_CAPACITY;
+            Ucs_Ns_Script_t *grown = realloc(actions, newCapacity * sizeof(Ucs_Ns_Script_t));
+            if (NULL == grown)
+            {
+                free(actions);
+                RETURN_ASSERT(Parse_MemoryError, "realloc returned NULL");
+            }
+            memset(&grown[actCapacity], 0, (newCapacity - actCapacity) * sizeof(Ucs_Ns_Script_t));
+            actions = grown;
+            actCapacity = newCapacity;
+        }
+        if (isPause) {
+            result = ParseScriptPause(act, &scriptData);
+        } else if (0 == strcmp(txt, SCRIPT_MSG_SEND)) {
+            result = ParseScriptMsgSend(act, &actions[actCnt], objList, &scriptData);
         } else if (0 == strcmp(txt, SCRIPT_GPIO_PORT_CREATE)) {
-            ParseResult_t result = ParseScriptGpioPortCreate(act, &script[actCnt], objList, &scriptData);
-            if (Parse_Success != result) return result;
-            ++actCnt;
+            result = ParseScriptGpioPortCreate(act, &actions[actCnt], objList, &scriptData);
         } else if (0 == strcmp(txt, SCRIPT_GPIO_PORT_PIN_MODE)) {
-            ParseResult_t result = ParseScriptGpioPinMode(act, &script[actCnt], objList, &scriptData);
-            if (Parse_Success != result) return result;
-            ++actCnt;
+            result = ParseScriptGpioPinMode(act, &actions[actCnt], objList, &scriptData);
         } else if (0 == strcmp(txt, SCRIPT_GPIO_PIN_STATE)) {
-            ParseResult_t result = ParseScriptGpioPinState(act, &script[actCnt], objList, &scriptData);
-            if (Parse_Success != result) return result;
-            ++actCnt;
+            result = ParseScriptGpioPinState(act, &actions[actCnt], objList, &scriptData);
         } else if (0 == strcmp(txt, SCRIPT_I2C_PORT_CREATE)) {
-            ParseResult_t result = ParseScriptPortCreate(act, &script[actCnt], objList, &scriptData);
-            if (Parse_Success != result) return result;
-            ++actCnt;
+            result = ParseScriptPortCreate(act, &actions[actCnt], objList, &scriptData);
         } else if (0 == strcmp(txt, SCRIPT_I2C_PORT_WRITE)) {
-            ParseResult_t result = ParseScriptPortWrite(act, &script[actCnt], objList, &scriptData);
-            if (Parse_Success != result) return result;
-            ++actCnt;
+            result = ParseScriptPortWrite(act, &actions[actCnt], objList, &scriptData);
         } else if (0 == strcmp(txt, SCRIPT_I2C_PORT_READ)) {
-            ParseResult_t result = ParseScriptPortRead(act, &script[actCnt], objList, &scriptData);
-            if (Parse_Success != result) return result;
-            ++actCnt;
-        } else if (0 == strcmp(txt, SCRIPT_PAUSE)) {
-            ParseResult_t result = ParseScriptPause(act, &scriptData);
-            if (Parse_Success != result) return result;
+            result = ParseScriptPortRead(act, &actions[actCnt], objList, &scriptData);
         } else {
-            UcsXml_CB_OnError("Unknown script action:'%s'", 1, txt);
+            free(actions);
+            UcsXml_ReportError("Unknown script action:'%s'", 1, txt);
             RETURN_ASSERT(Parse_XmlError, "Wrong enum");
         }
+        if (Parse_Success != result)
+        {
+            free(actions);
+            return result;
+        }
+        if (!isPause)
+            ++actCnt;
         if (!GetElementArray(act, ALL_SCRIPTS, &txt, &act, true))
             break;
     }
-    if (!GetString(scr, NAME, &txt, true))
-        RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
-    while(NULL != scrlist)
+    if (0 == actCnt)
     {
-        if (scrlist->singleShot || 0 == strcmp(txt, scrlist->scriptName))
-        {
-            Ucs_Rm_Node_t *node = scrlist->node;
-            if (NULL == node)
-                return Parse_MemoryError;
-            node->init_script_list_ptr = script;
-            node->init_script_list_size = actCnt;
-            scrlist->inUse = true;
-            found = true;
-        }
-        scrlist = scrlist->next;
+        free(actions);
+        UcsXml_ReportError("element count is zero, searched with string array", 0);
+        RETURN_ASSERT(Parse_XmlError, "Script without any action");
     }
-    if(!found)
+    /*Move the actions into an exactly sized array owned by the object list*/
+    script = MCalloc(objList, actCnt, sizeof(Ucs_Ns_Script_t));
+    if (NULL == script)
     {
-        UcsXml_CB_OnError("Script defined:'%s', which was never referenced", 1, txt);
-        RETURN_ASSERT(Parse_XmlError, "Unused script");
+        free(actions);
+        RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
     }
+    memcpy(script, actions, actCnt * sizeof(Ucs_Ns_Script_t));
+    free(actions);
+    *pScript = script;
+    *pActCnt = actCnt;
     return Parse_Success;
 }
 
@@ -1644,7 +2050,7 @@ static ParseResult_t ParseScriptPortCreate(mxml_node_t *act, Ucs_Ns_Script_t *sc
         speed = 1;
     else
     {
-        UcsXml_CB_OnError("Invalid I2C speed:'%s'", 1, txt);
+        UcsXml_ReportError("Invalid I2C speed:'%s'", 1, txt);
         RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
     }
     req = (Ucs_Ns_ConfigMsg_t *)scr->send_cmd;
@@ -1683,7 +2089,7 @@ static ParseResult_t ParseScriptPortWrite(mxml_node_t *act, Ucs_Ns_Script_t *scr
             mode = 2;
         else
         {
-            UcsXml_CB_OnError("Invalid I2C mode:'%s'", 1, txt);
+            UcsXml_ReportError("Invalid I2C mode:'%s'", 1, txt);
             RETURN_ASSERT(Parse_XmlError, "Wrong enum");
         }
     } else {
@@ -1942,23 +2348,20 @@ static ParseResult_t ParseRoutes(UcsXmlVal_t *ucs, PrivateData_t *priv)
     return Parse_Success;
 }
 
-static bool AddDriverInfo(struct UcsXmlDriverInfoList **drvList, DriverInformation_t *drvInfo, struct UcsXmlObjectList *objList)
+static bool AddDriverInfo(PrivateData_t *priv, DriverInformation_t *drvInfo)
 {
-    struct UcsXmlDriverInfoList *tail;
-    if (NULL == drvList || NULL == drvInfo)
+    struct UcsXmlDriverInfoList *entry;
+    if (NULL == priv || NULL == drvInfo)
         return false;
-    if (NULL == drvList[0])
-    {
-        drvList[0] = MCalloc(objList, 1, sizeof(struct UcsXmlDriverInfoList));
-        if (NULL == drvList[0]) return false;;
-        drvList[0]->driverInfo = drvInfo;
-        return true;
-    }
-    tail = drvList[0];
-    while(tail->next) tail = tail->next;
-    tail->next = MCalloc(objList, 1, sizeof(struct UcsXmlDriverInfoList));
-    if (NULL == tail->next) return false;
-    tail->next->driverInfo = drvInfo;
+    entry = MCalloc(&priv->objList, 1, sizeof(struct UcsXmlDriverInfoList));
+    if (NULL == entry) return false;
+    entry->driverInfo = drvInfo;
+    if (NULL == priv->drvInfTail)
+        priv->drvInfLst = entry;
+    else
+        priv->drvInfTail->next = entry;
+    priv->drvInfTail = entry;
+    ++priv->drvInfCnt;
     return true;
 }
 
@@ -1999,20 +2402,23 @@ static ParseResult_t ParseDriver(mxml_node_t *drv, UcsXmlVal_t *ucs, PrivateData
                     memcpy(copyInfo, head->driverInfo, sizeof(DriverInformation_t));
                     copyList->driverInfo = copyInfo;
                     head->next = copyList;
+                    if (priv->drvInfTail == head)
+                        priv->drvInfTail = copyList;
+                    ++priv->drvInfCnt;
                     head = copyList;
                     drvInf = head->driverInfo;
                 }
                 if(0 == strcmp(driverType, L_DRIVER_CDEV))
                 {
                     drvInf->driverType = Driver_LinuxCdev;
-                    if (!GetString(driver, L_DRIVER_NAME, &drvInf->drv.LinuxCdev.aimName, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
+                    if (!GetStringCopy(driver, L_DRIVER_NAME, &drvInf->drv.LinuxCdev.aimName, &priv->objList, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                     if (!GetUInt16(driver, L_BUFFERSIZE, &drvInf->drv.LinuxCdev.bufferSize, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                     if (!GetUInt16(driver, L_BUFFFERCOUNT, &drvInf->drv.LinuxCdev.numBuffers, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                 } 
                 else if(0 == strcmp(driverType, L_DRIVER_V4L2))
                 {
                     drvInf->driverType = Driver_LinuxV4l2;
-                    if (!GetString(driver, L_DRIVER_NAME, &drvInf->drv.LinuxV4l2.aimName, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
+                    if (!GetStringCopy(driver, L_DRIVER_NAME, &drvInf->drv.LinuxV4l2.aimName, &priv->objList, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                     if (!GetUInt16(driver, L_BUFFERSIZE, &drvInf->drv.LinuxV4l2.bufferSize, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                     if (!GetUInt16(driver, L_BUFFFERCOUNT, &drvInf->drv.LinuxV4l2.numBuffers, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                 }
@@ -2020,7 +2426,7 @@ static ParseResult_t ParseDriver(mxml_node_t *drv, UcsXmlVal_t *ucs, PrivateData
                 {
                     const char *resolution;
                     drvInf->driverType = Driver_LinuxAlsa;
-                    if (!GetString(driver, L_DRIVER_NAME, &drvInf->drv.LinuxAlsa.aimName, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
+                    if (!GetStringCopy(driver, L_DRIVER_NAME, &drvInf->drv.LinuxAlsa.aimName, &priv->objList, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                     if (!GetUInt16(driver, L_BUFFERSIZE, &drvInf->drv.LinuxAlsa.bufferSize, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                     if (!GetUInt16(driver, L_BUFFFERCOUNT, &drvInf->drv.LinuxAlsa.numBuffers, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
                     if (!GetUInt8(driver, L_ALSA_CH_COUNT, &drvInf->drv.LinuxAlsa.amountOfChannels, true)) RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
@@ -2034,13 +2440,13 @@ static ParseResult_t ParseDriver(mxml_node_t *drv, UcsXmlVal_t *ucs, PrivateData
                     } else if (0 == strcmp(L_DRIVER_ALSARES_32BIT, resolution)) {
                         drvInf->drv.LinuxAlsa.resolutionInBit = 32;
                     } else {
-                        UcsXml_CB_OnError("Invalid ALSA resolution '%s'", 1, resolution);
+                        UcsXml_ReportError("Invalid ALSA resolution '%s'", 1, resolution);
                         RETURN_ASSERT(Parse_XmlError, "Wrong enum");
                     }
                 }
                 else
                 {
-                    UcsXml_CB_OnError("Invalid Driver Type", 0);
+                    UcsXml_ReportError("Invalid Driver Type", 0);
                     RETURN_ASSERT(Parse_XmlError, "Wrong enum");
                 }
                 if(!GetElementArray(driver, ALL_DRIVERS, &driverType, &driver, true))
@@ -2052,7 +2458,7 @@ static ParseResult_t ParseDriver(mxml_node_t *drv, UcsXmlVal_t *ucs, PrivateData
     while(NULL != head);
     if (!found)
     {
-        UcsXml_CB_OnError("Did not find driver info for '%s'", 1, driverLink);
+        UcsXml_ReportError("Did not find driver info for '%s'", 1, driverLink);
         RETURN_ASSERT(Parse_XmlError, "No driver info");
     }
     return Parse_Success;
@@ -2074,9 +2480,10 @@ static ParseResult_t StoreDriverInfo(PrivateData_t *priv, const char *driverLink
     channelName = MCalloc(&priv->objList, MAX_CHANNEL_NAME_LENGTH, sizeof(char));
     if (NULL == channelName) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
     
-    drvInf->linkName = driverLink;
+    drvInf->linkName = CopyString(driverLink, &priv->objList);
+    if (NULL == drvInf->linkName) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
     drvInf->phy = DriverPhyUnknown;
-    AddDriverInfo(&priv->drvInfLst, drvInf, &priv->objList);
+    if (!AddDriverInfo(priv, drvInf)) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
 
     switch(con->dataType)
     {
@@ -2088,12 +2495,12 @@ static ParseResult_t StoreDriverInfo(PrivateData_t *priv, const char *driverLink
     case IPC_PACKET:
     case INVALID:
     default:
-        UcsXml_CB_OnError("StoreDriverInfo: Unsupported Data Type=0x%X", 1, con->dataType);
+        UcsXml_ReportError("StoreDriverInfo: Unsupported Data Type=0x%X", 1, con->dataType);
         RETURN_ASSERT(Parse_XmlError, "Wrong enum");
     }
     if (NULL == con->inSocket)
     {
-        UcsXml_CB_OnError("Driver Configuration:In Socket was not set on node=0x%X, route=%s", 
+        UcsXml_ReportError("Driver Configuration:In Socket was not set on node=0x%X, route=%s", 
                 2, priv->nodeData.nod->signature_ptr->node_address, driverLink);
         RETURN_ASSERT(Parse_XmlError, "Not enough info to fill driver structure");
     }
@@ -2150,7 +2557,7 @@ static ParseResult_t StoreDriverInfo(PrivateData_t *priv, const char *driverLink
     }
     case UCS_XRM_RC_TYPE_COMBINER: /* Combiner not supported as input */
     default:
-        UcsXml_CB_OnError("StoreDriverInfo: Unsupported Resource as inSocket=0x%X", 1, GetResourceType(con->inSocket));
+        UcsXml_ReportError("StoreDriverInfo: Unsupported Resource as inSocket=0x%X", 1, GetResourceType(con->inSocket));
         RETURN_ASSERT(Parse_XmlError, "Wrong enum");
         break;
     }
@@ -2162,13 +2569,13 @@ static ParseResult_t StoreDriverInfo(PrivateData_t *priv, const char *driverLink
             case UCS_ISOC_PCKT_SIZE_196: subBufferSize = 196; break;
             case UCS_ISOC_PCKT_SIZE_206: subBufferSize = 206; break;
             default:
-                UcsXml_CB_OnError("StoreDriverInfo: Non supported isoc packet size=%d", 1, con->isocPacketSize);
+                UcsXml_ReportError("StoreDriverInfo: Non supported isoc packet size=%d", 1, con->isocPacketSize);
                 RETURN_ASSERT(Parse_XmlError, "Wrong enum");
         }
     }
     if (NULL == con->outSocket)
     {
-        UcsXml_CB_OnError("Driver Configuration:Out Socket was not set on node=0x%X, route=%s", 
+        UcsXml_ReportError("Driver Configuration:Out Socket was not set on node=0x%X, route=%s", 
                 2, priv->nodeData.nod->signature_ptr->node_address, driverLink);
         RETURN_ASSERT(Parse_XmlError, "Not enough info to fill driver structure");
     }
@@ -2222,7 +2629,7 @@ static ParseResult_t StoreDriverInfo(PrivateData_t *priv, const char *driverLink
     }
     case UCS_XRM_RC_TYPE_SPLITTER: /* Splitter not supported as output */
     default:
-        UcsXml_CB_OnError("StoreDriverInfo: Unsupported Resource as outSocket=0x%X", 1, GetResourceType(con->outSocket));
+        UcsXml_ReportError("StoreDriverInfo: Unsupported Resource as outSocket=0x%X", 1, GetResourceType(con->outSocket));
         RETURN_ASSERT(Parse_XmlError, "Wrong enum");
         break;
     }
@@ -2256,29 +2663,151 @@ static ParseResult_t StoreDriverInfo(PrivateData_t *priv, const char *driverLink
     return Parse_Success;
 }
 
-static uint16_t GetDrvInfCount(struct UcsXmlDriverInfoList *drvInfLst)
+static void FillDriverArray(struct UcsXmlDriverInfoList *drvInfLst, DriverInformation_t **ppDriverInfo)
 {
-    uint16_t cnt = 0;
+    uint16_t i = 0;
     struct UcsXmlDriverInfoList *head = drvInfLst;
-    if (NULL == drvInfLst)
-        return 0;
     do
     {
-        ++cnt;
+        ppDriverInfo[i++] = head->driverInfo;
         head = head->next;
     }
     while(NULL != head);
-    return cnt;
 }
 
-static void FillDriverArray(struct UcsXmlDriverInfoList *drvInfLst, DriverInformation_t **ppDriverInfo)
+static ParseResult_t ParseScenes(mxml_node_t *root, UcsXmlVal_t *ucs, PrivateData_t *priv)
 {
-    uint16_t i = 0;
-    struct UcsXmlDriverInfoList *head = drvInfLst;
-    do
+    mxml_node_t *sub;
+    int8_t *states;
+    uint16_t sceneCnt = 0;
+    ParseResult_t result = Parse_Success;
+    for (sub = root->child; NULL != sub; sub = sub->next)
+    {
+        if (MXML_ELEMENT == sub->type && SCENE == sub->value.element.name)
+            ++sceneCnt;
+    }
+    if (0 == sceneCnt)
+        return Parse_Success; /*Scenes are optional*/
+    ucs->pScenes = MCalloc(&priv->objList, sceneCnt, sizeof(UcsXmlScene_t));
+    if (NULL == ucs->pScenes) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
+    /*One state per route: -1 untouched, 0 inactive, 1 active*/
+    states = malloc(ucs->routesSize + 1);
+    if (NULL == states) RETURN_ASSERT(Parse_MemoryError, "malloc returned NULL");
+    for (sub = root->child; NULL != sub && Parse_Success == result; sub = sub->next)
     {
-        ppDriverInfo[i++] = head->driverInfo;
-        head = head->next;
+        uint16_t i;
+        mxml_node_t *state;
+        UcsXmlScene_t *scene;
+        if (MXML_ELEMENT != sub->type || SCENE != sub->value.element.name)
+            continue;
+        scene = &ucs->pScenes[ucs->sceneSize];
+        if (!GetStringCopy(sub, NAME, &scene->name, &priv->objList, true))
+        {
+            result = Parse_XmlError;
+            break;
+        }
+        for (i = 0; i < ucs->sceneSize; i++)
+        {
+            if (0 == strcmp(ucs->pScenes[i].name, scene->name))
+            {
+                UcsXml_ReportError("Scene='%s' is defined twice", 1, scene->name);
+                result = Parse_XmlError;
+                break;
+            }
+        }
+        ++ucs->sceneSize;
+        memset(states, -1, ucs->routesSize + 1);
+        for (state = sub->child; NULL != state && Parse_Success == result; state = state->next)
+        {
+            if (MXML_ELEMENT == state->type && ROUTE_STATE == state->value.element.name)
+                result = ParseRouteState(state, scene->name, ucs, priv, states);
+        }
+        if (Parse_Success == result)
+            result = StoreSceneRoutes(ucs, priv, states, 0, &scene->pInactiveRoutes, &scene->inactiveSize);
+        if (Parse_Success == result)
+            result = StoreSceneRoutes(ucs, priv, states, 1, &scene->pActiveRoutes, &scene->activeSize);
     }
-    while(NULL != head);
+    free(states);
+    return result;
+}
+
+static ParseResult_t ParseRouteState(mxml_node_t *state, const char *sceneName, UcsXmlVal_t *ucs, PrivateData_t *priv, int8_t *states)
+{
+    uint16_t i;
+    uint16_t routeId;
+    const char *txt;
+    const char *routeName = NULL;
+    int8_t isActive;
+    bool found = false;
+    if (!GetString(state, ROUTE_IS_ACTIVE, &txt, true))
+        RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute");
+    if (0 == strcmp(txt, VALUE_TRUE) || 0 == strcmp(txt, VALUE_1))
+        isActive = 1;
+    else if (0 == strcmp(txt, VALUE_FALSE) || 0 == strcmp(txt, VALUE_0))
+        isActive = 0;
+    else RETURN_ASSERT(Parse_XmlError, "Wrong enum");
+    if (!GetUInt16(state, ROUTE_ID, &routeId, false))
+    {
+        routeId = ROUTE_INVALID_ID;
+        if (!GetString(state, ROUTE, &routeName, false))
+            RETURN_ASSERT(Parse_XmlError, "Missing mandatory attribute, neither route name nor route id provided");
+    }
+    for (i = 0; i < ucs->routesSize; i++)
+    {
+        Ucs_Rm_Route_t *route = &ucs->pRoutes[i];
+        if (NULL != routeName ? !IsRouteNamed(priv, route, routeName) : routeId != route->route_id)
+            continue;
+        if (-1 != states[i] && isActive != states[i])
+        {
+            UcsXml_ReportError("Scene='%s' sets route id=0x%X active and inactive", 2, sceneName, route->route_id);
+            return Parse_XmlError;
+        }
+        states[i] = isActive;
+        found = true;
+    }
+    if (!found)
+    {
+        if (NULL != routeName)
+            UcsXml_ReportError("Scene='%s' refers to unknown route='%s'", 2, sceneName, routeName);
+        else
+            UcsXml_ReportError("Scene='%s' refers to unknown route id=0x%X", 2, sceneName, routeId);
+        return Parse_XmlError;
+    }
+    return Parse_Success;
+}
+
+static bool IsRouteNamed(PrivateData_t *priv, const Ucs_Rm_Route_t *route, const char *name)
+{
+    struct UcsXmlRoute *rt;
+    for (rt = priv->pRtLst; NULL != rt; rt = rt->next)
+    {
+        if (rt->ep != route->source_endpoint_ptr && rt->ep != route->sink_endpoint_ptr)
+            continue;
+        if (0 == strncmp(rt->routeName, name, sizeof(rt->routeName)))
+            return true;
+    }
+    return false;
+}
+
+static ParseResult_t StoreSceneRoutes(UcsXmlVal_t *ucs, PrivateData_t *priv, const int8_t *states, int8_t state, uint16_t **ppIds, uint16_t *pSize)
+{
+    uint16_t i, j;
+    uint16_t cnt = 0;
+    for (i = 0; i < ucs->routesSize; i++)
+        if (state == states[i]) ++cnt;
+    if (0 == cnt)
+        return Parse_Success;
+    *ppIds = MCalloc(&priv->objList, cnt, sizeof(uint16_t));
+    if (NULL == *ppIds) RETURN_ASSERT(Parse_MemoryError, "calloc returned NULL");
+    /*Routes sharing one identifier are switched together, so every identifier is stored once*/
+    for (i = 0; i < ucs->routesSize; i++)
+    {
+        uint16_t routeId = ucs->pRoutes[i].route_id;
+        if (state != states[i])
+            continue;
+        for (j = 0; j < *pSize && routeId != (*ppIds)[j]; j++);
+        if (j == *pSize)
+            (*ppIds)[(*pSize)++] = routeId;
+    }
+    return Parse_Success;
 }
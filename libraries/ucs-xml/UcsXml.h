@@ -49,6 +49,28 @@ extern "C" {
 #include "ucs_api.h"
 #include "UcsXmlDriverConfig.h"
 
+/** Bytes per frame usable on a 50 MBit/s network (INICnet-50) */
+#define UCSXML_NETWORK_BW_50    (116)
+/** Bytes per frame usable on a 150 MBit/s network (INICnet-150, MOST150) */
+#define UCSXML_NETWORK_BW_150   (372)
+
+/** Structure holding a named set of route states (a scene).
+ *  Route identifiers may be shared by several routes, all of them are switched together.
+ *  */
+typedef struct
+{
+    /** Name of the scene, as given in the XML */
+    const char *name;
+    /** Identifiers of the routes to be active in this scene */
+    uint16_t *pActiveRoutes;
+    /** Active route identifier array size */
+    uint16_t activeSize;
+    /** Identifiers of the routes to be inactive in this scene */
+    uint16_t *pInactiveRoutes;
+    /** Inactive route identifier array size */
+    uint16_t inactiveSize;
+} UcsXmlScene_t;
+
 /** Structure holding informations to startup UNICENS (UCS).
  *  Pass all these variables to the UCS manager structure, but not pInternal.
  *  */
@@ -58,6 +80,8 @@ typedef struct
     uint16_t packetBw;
     /** The amount of bytes assigned to the proxy channel*/
     uint16_t proxyBw;
+    /** The amount of bytes per frame offered by the network, 0 if the Network attribute is not given */
+    uint16_t networkBw;
     /** Array of routes */
     Ucs_Rm_Route_t *pRoutes;
     /** Route array size */
@@ -70,6 +94,10 @@ typedef struct
     DriverInformation_t **ppDriver;
     /** Driver array size */
     uint16_t driverSize;
+    /** Array of scenes, routes not listed in a scene keep their state */
+    UcsXmlScene_t *pScenes;
+    /** Scene array size */
+    uint16_t sceneSize;
     /** Internal data, to be ignored */
     void *pInternal;
 } UcsXmlVal_t;
@@ -87,6 +115,79 @@ typedef struct
     void *pInternal;
 } UcsXmlScript_t;
 
+/** Structure holding the streaming bandwidth allocated by a single source node.
+ *  */
+typedef struct
+{
+    /** Node address of the source node */
+    uint16_t nodeAddress;
+    /** Bytes allocated by the routes active at startup */
+    uint16_t activeBw;
+    /** Bytes allocated, if all routes are active */
+    uint16_t maximumBw;
+} UcsXmlNodeBw_t;
+
+/** Structure holding the result of UcsXml_AnalyzeBandwidth. All values are given in bytes per frame.
+ *  */
+typedef struct
+{
+    /** Bytes offered by the network */
+    uint16_t networkBw;
+    /** true, if the configuration does not name the network and 150 MBit/s were assumed */
+    bool networkAssumed;
+    /** Bytes assigned to the async channel */
+    uint16_t packetBw;
+    /** Bytes assigned to the proxy channel */
+    uint16_t proxyBw;
+    /** Bytes left for streaming routes (networkBw - packetBw - proxyBw), may be negative */
+    int32_t streamingBw;
+    /** Bytes allocated by the routes active at startup */
+    uint16_t activeBw;
+    /** Highest allocation of the startup state and all scenes */
+    uint16_t peakBw;
+    /** Scene causing peakBw, NULL if it is the startup state */
+    const UcsXmlScene_t *peakScene;
+    /** Bytes allocated, if all routes are active at the same time */
+    uint16_t maximumBw;
+    /** Bytes left over in the peak state (streamingBw - peakBw), negative if oversubscribed */
+    int32_t headroom;
+    /** Largest async bandwidth still fitting the peak state, a multiple of 4 */
+    uint16_t proposedPacketBw;
+    /** true, if the startup state or any scene does not fit into the streaming bandwidth */
+    bool oversubscribed;
+} UcsXmlBandwidth_t;
+
+/** Structure holding the amount of UNICENS pool objects needed by a configuration.
+ *  */
+typedef struct
+{
+    /** Nodes, each one is a remote device for the resources management */
+    uint16_t nodes;
+    /** Routes */
+    uint16_t routes;
+    /** Distinct endpoints built by the resources management, each one is an XRM job */
+    uint16_t endpoints;
+    /** Resource objects of all endpoints, shared objects are counted once per endpoint */
+    uint16_t resources;
+} UcsXmlPoolUsage_t;
+
+/** Callback for parser errors, raised instead of UcsXml_CB_OnError when a context is used.
+ *  \param userPtr - The user pointer stored in the context
+ *  \param message - Zero terminated, human readable error message
+ *  */
+typedef void (*UcsXml_ErrorCb_t)(void *userPtr, const char *message);
+
+/** Context for the reentrant parser functions (the ones ending with Ctx).
+ *  Every thread may parse with its own context at the same time.
+ *  */
+typedef struct
+{
+    /** Called on parser errors. If NULL, UcsXml_CB_OnError is raised instead */
+    UcsXml_ErrorCb_t onError;
+    /** Passed unchanged to onError */
+    void *userPtr;
+} UcsXmlCtx_t;
+
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                            Public API                                */
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
@@ -110,7 +211,8 @@ UcsXmlVal_t *UcsXml_Parse(const char *xmlString);
  *        generate the data needed to run UNICENS (UCS) library.
  *
  * \note In case of errors the callback UcsXml_CB_OnError will be raised.
- * \param fileName - Path to the UNICENS XML file.
+ * \param fileName - Path to the UNICENS XML file or to a binary configuration,
+ *                   written by UcsXml_WriteBinary.
  * \return Structure holding the needed data for UCS. NULL, if there was an error.
  *         The structure will be created dynamically, to free the data call UcsXml_FreeVal.
  */
@@ -124,6 +226,21 @@ UcsXmlVal_t *UcsXml_ParseFile(const char *fileName);
  */
 void UcsXml_FreeVal(UcsXmlVal_t *val);
 
+#ifdef XML_FILE_SUPPORTED
+/**
+ * \brief Stores the given structure as precompiled binary configuration.
+ *        The binary file can be passed to UcsXml_ParseFile instead of the XML file.
+ *        It is mapped into memory and only its pointers are relocated, there is no parsing.
+ *
+ * \note The binary file is only valid for the UNICENS version and CPU architecture
+ *       it was created with. Otherwise UcsXml_ParseFile rejects it.
+ * \param val - Structure generated by UcsXml_Parse or UcsXml_ParseFile.
+ * \param fileName - Path of the binary file to be written.
+ * \return true, if the file was written. false, otherwise.
+ */
+bool UcsXml_WriteBinary(const UcsXmlVal_t *val, const char *fileName);
+#endif
+
 /**
  * \brief Initializes UNICENS XML parser module, parses the given string and
  *        generate the data needed to run a single UNICENS script on a particular node.
@@ -156,6 +273,161 @@ UcsXmlScript_t *UcsXml_ParseScriptFile(const char *fileName);
  */
 void UcsXml_FreeScript(UcsXmlScript_t *script);
 
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                          Script Cache                                */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/** Cache of parsed scripts, keyed by name and content hash. Opaque to the user. */
+typedef struct UcsXmlScriptCache UcsXmlScriptCache_t;
+
+/**
+ * \brief Creates a cache for parsed scripts. When full, the least recently used
+ *        script, which is not in use, gets evicted.
+ *
+ * \note The cache is not thread safe. Use it from one thread only.
+ * \param capacity - Maximum amount of cached scripts.
+ * \return The cache, NULL if there was no memory. Free it with UcsXml_FreeScriptCache.
+ */
+UcsXmlScriptCache_t *UcsXml_CreateScriptCache(uint16_t capacity);
+
+/**
+ * \brief Frees the cache and all scripts in it.
+ *
+ * \note All scripts returned by the cache must be released before.
+ * \param cache - The cache to be freed.
+ */
+void UcsXml_FreeScriptCache(UcsXmlScriptCache_t *cache);
+
+/**
+ * \brief Returns the parsed script for the given name. The XML string is only parsed,
+ *        if the script is not cached yet or its content changed.
+ *
+ * \note In case of errors the callback UcsXml_CB_OnError will be raised.
+ * \param cache - The cache created by UcsXml_CreateScriptCache.
+ * \param name - Zero terminated name of the script, used as key.
+ * \param xmlString - Zero terminated XML string, containing only one script.
+ * \return The script, NULL if there was an error. The script stays valid until it is
+ *         given back with UcsXml_ReleaseCachedScript, so it may be passed to
+ *         UCSI_ExecuteScript and released once the execution has finished.
+ */
+const UcsXmlScript_t *UcsXml_GetCachedScript(UcsXmlScriptCache_t *cache, const char *name, const char *xmlString);
+
+#ifdef XML_FILE_SUPPORTED
+/**
+ * \brief Returns the parsed script of the given file. The file name is used as key.
+ *        The file is only parsed, if it is not cached yet or its content changed.
+ *
+ * \note In case of errors the callback UcsXml_CB_OnError will be raised.
+ * \param cache - The cache created by UcsXml_CreateScriptCache.
+ * \param fileName - Path to the UNICENS XML file containing only one script.
+ * \return The script, NULL if there was an error. Give it back with UcsXml_ReleaseCachedScript.
+ */
+const UcsXmlScript_t *UcsXml_GetCachedScriptFile(UcsXmlScriptCache_t *cache, const char *fileName);
+#endif
+
+/**
+ * \brief Gives back a script returned by UcsXml_GetCachedScript or UcsXml_GetCachedScriptFile.
+ *        The script stays in the cache for the next call, but may be evicted from now on.
+ *
+ * \param cache - The cache the script was taken from.
+ * \param script - The script to be given back.
+ */
+void UcsXml_ReleaseCachedScript(UcsXmlScriptCache_t *cache, const UcsXmlScript_t *script);
+
+/**
+ * \brief Removes the script with the given name from the cache, so it will be parsed again
+ *        with the next call. Scripts still in use are freed when they are released.
+ *
+ * \param cache - The cache created by UcsXml_CreateScriptCache.
+ * \param name - Name or file name of the script. NULL removes all scripts.
+ */
+void UcsXml_InvalidateCachedScript(UcsXmlScriptCache_t *cache, const char *name);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                          Reentrant API                               */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/**
+ * \brief Same as UcsXml_Parse, but errors are reported to the given context.
+ *        Several threads may call this function at the same time.
+ *
+ * \param ctx - Parser context, may be NULL to use UcsXml_CB_OnError.
+ * \param xmlString - Zero terminated XML string.
+ * \return Structure holding the needed data for UCS. NULL, if there was an error.
+ */
+UcsXmlVal_t *UcsXml_ParseCtx(const UcsXmlCtx_t *ctx, const char *xmlString);
+
+#ifdef XML_FILE_SUPPORTED
+/**
+ * \brief Same as UcsXml_ParseFile, but errors are reported to the given context.
+ *        Several threads may call this function at the same time.
+ *
+ * \param ctx - Parser context, may be NULL to use UcsXml_CB_OnError.
+ * \param fileName - Path to the UNICENS XML file or to a binary configuration.
+ * \return Structure holding the needed data for UCS. NULL, if there was an error.
+ */
+UcsXmlVal_t *UcsXml_ParseFileCtx(const UcsXmlCtx_t *ctx, const char *fileName);
+
+/**
+ * \brief Same as UcsXml_WriteBinary, but errors are reported to the given context.
+ *
+ * \param ctx - Parser context, may be NULL to use UcsXml_CB_OnError.
+ * \param val - Structure generated by UcsXml_Parse or UcsXml_ParseFile.
+ * \param fileName - Path of the binary file to be written.
+ * \return true, if the file was written. false, otherwise.
+ */
+bool UcsXml_WriteBinaryCtx(const UcsXmlCtx_t *ctx, const UcsXmlVal_t *val, const char *fileName);
+#endif
+
+/**
+ * \brief Same as UcsXml_ParseScript, but errors are reported to the given context.
+ *        Several threads may call this function at the same time.
+ *
+ * \param ctx - Parser context, may be NULL to use UcsXml_CB_OnError.
+ * \param xmlString - Zero terminated XML string, containing only one script.
+ * \return Structure holding the needed data for executing the script. NULL, if there was an error.
+ */
+UcsXmlScript_t *UcsXml_ParseScriptCtx(const UcsXmlCtx_t *ctx, const char *xmlString);
+
+#ifdef XML_FILE_SUPPORTED
+/**
+ * \brief Same as UcsXml_ParseScriptFile, but errors are reported to the given context.
+ *        Several threads may call this function at the same time.
+ *
+ * \param ctx - Parser context, may be NULL to use UcsXml_CB_OnError.
+ * \param fileName - Path to the UNICENS XML file containing only one script.
+ * \return Structure holding the needed data for executing the script. NULL, if there was an error.
+ */
+UcsXmlScript_t *UcsXml_ParseScriptFileCtx(const UcsXmlCtx_t *ctx, const char *fileName);
+#endif
+
+/**
+ * \brief Calculates the synchronous bandwidth allocated by the routes of a parsed configuration
+ *        and checks it against the bandwidth left over by the async and proxy channel.
+ *        The startup state, every scene applied to the startup state and all routes active
+ *        at the same time are evaluated. Sources shared by several routes are counted once.
+ * \note The routes are not modified, the function may be called on a running configuration.
+ *
+ * \param val - The configuration returned by UcsXml_Parse or UcsXml_ParseFile.
+ * \param result - Filled with the analysis results.
+ * \param pNodes - Optional array, filled with the allocation per source node. May be NULL.
+ * \param nodesSize - Number of elements in pNodes.
+ * \param pNodesUsed - Optional, receives the number of elements written to pNodes. May be NULL.
+ * \return true, if the analysis was done. false, if the parameters are invalid or pNodes is too small.
+ */
+bool UcsXml_AnalyzeBandwidth(const UcsXmlVal_t *val, UcsXmlBandwidth_t *result,
+    UcsXmlNodeBw_t *pNodes, uint16_t nodesSize, uint16_t *pNodesUsed);
+
+/**
+ * \brief Counts the objects UNICENS needs from its static pools to run the given configuration.
+ *        The result may be used to size UCS_XRM_NUM_JOBS, UCS_XRM_NUM_RESOURCES and UCS_NUM_REMOTE_DEVICES.
+ *
+ * \param val - The configuration returned by UcsXml_Parse or UcsXml_ParseFile.
+ * \param usage - Filled with the amount of objects needed.
+ * \return true, if the usage was calculated. false, if the parameters are invalid or memory ran out.
+ */
+bool UcsXml_GetPoolUsage(const UcsXmlVal_t *val, UcsXmlPoolUsage_t *usage);
+
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                        CALLBACK SECTION                              */
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
@@ -163,6 +435,7 @@ void UcsXml_FreeScript(UcsXmlScript_t *script);
 /**
  * \brief Callback whenever a parser error occurs. The message is human readable.
  * \note This function must be implemented by the integrator.
+ *       It is not raised for calls passing a context with an onError callback.
  *
  * \param format - Zero terminated format string (following printf rules)
  * \param vargsCnt - Amount of parameters stored in "..."
@@ -0,0 +1,285 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS XML Parser                                                                             */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "UcsXml.h"
+
+/************************************************************************/
+/* Private Definitions                                                  */
+/************************************************************************/
+/* On the ring every synchronous channel occupies its bytes on all
+ * segments, so the network usage equals the sum of all active sources.
+ * A source endpoint shared by several routes (fan-out) is counted once.
+ * Scenes keep the routes they do not list in their current state, so
+ * such a route is counted, if the startup state or any other scene
+ * activates it.
+ */
+
+struct Source
+{
+    const Ucs_Rm_EndPoint_t *ep;
+    uint16_t nodeAddress;
+    uint16_t bandwidth;
+};
+
+struct Analysis
+{
+    const UcsXmlVal_t *val;
+    struct Source *pSrc;
+    uint16_t srcSize;
+    /* Source index per route, 0xFFFF for routes without synchronous source */
+    uint16_t *pRouteSrc;
+    bool *pSrcUsed;
+};
+
+#define NO_SOURCE           (0xFFFF)
+#define PACKET_BW_ALIGN     (4)
+
+/************************************************************************/
+/* Private Function Prototypes                                          */
+/************************************************************************/
+
+static bool CollectSources(struct Analysis *an);
+static uint16_t GetSourceBandwidth(const Ucs_Rm_EndPoint_t *ep);
+static uint16_t GetUsage(struct Analysis *an, const UcsXmlScene_t *scene, bool allActive);
+static bool IsRouteActive(const struct Analysis *an, const Ucs_Rm_Route_t *route, const UcsXmlScene_t *scene);
+static bool ContainsId(const uint16_t *pIds, uint16_t size, uint16_t id);
+
+/************************************************************************/
+/* Public Functions                                                     */
+/************************************************************************/
+
+bool UcsXml_AnalyzeBandwidth(const UcsXmlVal_t *val, UcsXmlBandwidth_t *result,
+    UcsXmlNodeBw_t *pNodes, uint16_t nodesSize, uint16_t *pNodesUsed)
+{
+    struct Analysis an;
+    uint16_t i, usage, nodesUsed = 0;
+    int32_t proposed;
+    bool success = true;
+    if (NULL == val || NULL == result || (NULL == pNodes && 0 != nodesSize))
+        return false;
+    memset(result, 0, sizeof(UcsXmlBandwidth_t));
+    memset(&an, 0, sizeof(an));
+    an.val = val;
+    if (!CollectSources(&an))
+    {
+        free(an.pSrc);
+        free(an.pRouteSrc);
+        free(an.pSrcUsed);
+        return false;
+    }
+    result->networkBw = val->networkBw;
+    if (0 == result->networkBw)
+    {
+        result->networkBw = UCSXML_NETWORK_BW_150;
+        result->networkAssumed = true;
+    }
+    result->packetBw = val->packetBw;
+    result->proxyBw = val->proxyBw;
+    result->streamingBw = (int32_t)result->networkBw - val->packetBw - val->proxyBw;
+    result->activeBw = GetUsage(&an, NULL, false);
+    result->peakBw = result->activeBw;
+    result->maximumBw = GetUsage(&an, NULL, true);
+    for (i = 0; i < val->sceneSize; i++)
+    {
+        usage = GetUsage(&an, &val->pScenes[i], false);
+        if (usage > result->peakBw)
+        {
+            result->peakBw = usage;
+            result->peakScene = &val->pScenes[i];
+        }
+    }
+    result->headroom = result->streamingBw - result->peakBw;
+    result->oversubscribed = (result->headroom < 0);
+    proposed = (int32_t)result->networkBw - val->proxyBw - result->peakBw;
+    if (proposed > 0)
+        result->proposedPacketBw = (uint16_t)(proposed - (proposed % PACKET_BW_ALIGN));
+
+    /* Sum up the allocation of every source node */
+    for (i = 0; i < an.srcSize && success; i++)
+    {
+        struct Source *src = &an.pSrc[i];
+        uint16_t activeBw = 0;
+        uint16_t j, n;
+        for (j = 0; j < val->routesSize; j++)
+        {
+            if (i == an.pRouteSrc[j] && val->pRoutes[j].active)
+            {
+                activeBw = src->bandwidth;
+                break;
+            }
+        }
+        if (NULL == pNodes)
+            continue;
+        for (n = 0; n < nodesUsed; n++)
+        {
+            if (pNodes[n].nodeAddress == src->nodeAddress)
+                break;
+        }
+        if (n == nodesUsed)
+        {
+            if (nodesUsed == nodesSize)
+            {
+                success = false;
+                break;
+            }
+            pNodes[n].nodeAddress = src->nodeAddress;
+            pNodes[n].activeBw = 0;
+            pNodes[n].maximumBw = 0;
+            ++nodesUsed;
+        }
+        pNodes[n].activeBw += activeBw;
+        pNodes[n].maximumBw += src->bandwidth;
+    }
+    if (NULL != pNodesUsed)
+        *pNodesUsed = nodesUsed;
+    free(an.pSrc);
+    free(an.pRouteSrc);
+    free(an.pSrcUsed);
+    return success;
+}
+
+/************************************************************************/
+/* Private Functions                                                    */
+/************************************************************************/
+
+static bool CollectSources(struct Analysis *an)
+{
+    uint16_t i, s;
+    const UcsXmlVal_t *val = an->val;
+    if (0 == val->routesSize)
+        return true;
+    an->pSrc = calloc(val->routesSize, sizeof(struct Source));
+    an->pRouteSrc = calloc(val->routesSize, sizeof(uint16_t));
+    an->pSrcUsed = calloc(val->routesSize, sizeof(bool));
+    if (NULL == an->pSrc || NULL == an->pRouteSrc || NULL == an->pSrcUsed)
+        return false;
+    for (i = 0; i < val->routesSize; i++)
+    {
+        const Ucs_Rm_EndPoint_t *ep = val->pRoutes[i].source_endpoint_ptr;
+        an->pRouteSrc[i] = NO_SOURCE;
+        if (NULL == ep || UCS_RM_EP_SOURCE != ep->endpoint_type)
+            continue;
+        for (s = 0; s < an->srcSize; s++)
+        {
+            if (an->pSrc[s].ep == ep)
+                break;
+        }
+        if (s == an->srcSize)
+        {
+            an->pSrc[s].ep = ep;
+            an->pSrc[s].bandwidth = GetSourceBandwidth(ep);
+            if (NULL != ep->node_obj_ptr && NULL != ep->node_obj_ptr->signature_ptr)
+                an->pSrc[s].nodeAddress = ep->node_obj_ptr->signature_ptr->node_address;
+            ++an->srcSize;
+        }
+        an->pRouteSrc[i] = s;
+    }
+    return true;
+}
+
+static uint16_t GetSourceBandwidth(const Ucs_Rm_EndPoint_t *ep)
+{
+    uint16_t j = 0;
+    uint16_t bandwidth = 0;
+    Ucs_Xrm_ResourceType_t *job;
+    if (NULL == ep->jobs_list_ptr)
+        return 0;
+    while((job = ((Ucs_Xrm_ResourceType_t *)ep->jobs_list_ptr[j])))
+    {
+        if (UCS_XRM_RC_TYPE_NW_SOCKET == *job)
+        {
+            Ucs_Xrm_NetworkSocket_t *sock = (Ucs_Xrm_NetworkSocket_t *)job;
+            if (UCS_SOCKET_DIR_OUTPUT == sock->direction)
+                bandwidth += sock->bandwidth;
+        }
+        ++j;
+    }
+    return bandwidth;
+}
+
+static uint16_t GetUsage(struct Analysis *an, const UcsXmlScene_t *scene, bool allActive)
+{
+    uint16_t i, src;
+    uint16_t usage = 0;
+    const UcsXmlVal_t *val = an->val;
+    if (0 == an->srcSize)
+        return 0;
+    memset(an->pSrcUsed, 0, an->srcSize * sizeof(bool));
+    for (i = 0; i < val->routesSize; i++)
+    {
+        src = an->pRouteSrc[i];
+        if (NO_SOURCE == src || an->pSrcUsed[src])
+            continue;
+        if (allActive || IsRouteActive(an, &val->pRoutes[i], scene))
+        {
+            an->pSrcUsed[src] = true;
+            usage += an->pSrc[src].bandwidth;
+        }
+    }
+    return usage;
+}
+
+static bool IsRouteActive(const struct Analysis *an, const Ucs_Rm_Route_t *route, const UcsXmlScene_t *scene)
+{
+    uint16_t i;
+    const UcsXmlScene_t *other;
+    if (NULL != scene)
+    {
+        if (ContainsId(scene->pActiveRoutes, scene->activeSize, route->route_id))
+            return true;
+        if (ContainsId(scene->pInactiveRoutes, scene->inactiveSize, route->route_id))
+            return false;
+    }
+    if (0 != route->active)
+        return true;
+    if (NULL == scene)
+        return false;
+    /* Not listed, so it is still active, if a previous scene activated it */
+    for (i = 0; i < an->val->sceneSize; i++)
+    {
+        other = &an->val->pScenes[i];
+        if (other != scene && ContainsId(other->pActiveRoutes, other->activeSize, route->route_id))
+            return true;
+    }
+    return false;
+}
+
+static bool ContainsId(const uint16_t *pIds, uint16_t size, uint16_t id)
+{
+    uint16_t i;
+    for (i = 0; i < size; i++)
+    {
+        if (pIds[i] == id)
+            return true;
+    }
+    return false;
+}
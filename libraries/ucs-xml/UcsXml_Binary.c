@@ -0,0 +1,693 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS XML Parser                                                                             */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include "UcsXml_Private.h"
+
+/************************************************************************/
+/* Binary Format                                                        */
+/************************************************************************/
+/* A binary configuration is a memory image of all structures referenced
+ * by UcsXmlVal_t. Every pointer inside the image holds the offset of its
+ * target relative to the image start. The relocation table lists the
+ * positions of all those pointers, so loading is just mapping the file and
+ * adding the mapping address to each listed position. */
+
+#define BIN_MAGIC           "UCSXBIN"
+#define BIN_VERSION         (3)
+#define BIN_ALIGNMENT       (8)
+#define BIN_ALIGN(X)        (((X) + BIN_ALIGNMENT - 1) & ~(BIN_ALIGNMENT - 1))
+#define BIN_INITIAL_SIZE    (4096)
+#define FNV_OFFSET_BASIS    (0xcbf29ce484222325ULL)
+#define FNV_PRIME           (0x100000001b3ULL)
+
+typedef struct
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t layout;        /* Fingerprint of the structure sizes, see GetLayout */
+    uint32_t size;          /* Size of the whole file */
+    uint32_t rootOffset;    /* Offset of the UcsXmlVal_t structure */
+    uint32_t relocOffset;
+    uint32_t relocCount;
+    uint64_t hash;          /* FNV-1a of everything behind this header */
+} BinHeader_t;
+
+struct BinObject
+{
+    uintptr_t src;
+    uint32_t size;
+    uint32_t offset;
+};
+
+typedef struct
+{
+    uint8_t *data;
+    uint32_t size;
+    uint32_t capacity;
+    uint32_t *relocs;
+    uint32_t relocCnt;
+    uint32_t relocCapacity;
+    struct BinObject *objs;
+    uint32_t objCnt;
+    uint32_t objCapacity;
+    uint32_t *lookup;       /* Open addressing table of object index + 1, hashed by source address */
+    uint32_t lookupCapacity;
+    bool error;
+} BinWriter_t;
+
+/************************************************************************/
+/* Private Function Prototypes                                          */
+/************************************************************************/
+
+static uint32_t GetLayout(void);
+static bool Reserve(void **buf, uint32_t *capacity, uint32_t needed, uint32_t elemSize);
+static uint32_t LookupSlot(BinWriter_t *w, uintptr_t src);
+static bool GrowLookup(BinWriter_t *w);
+static uint32_t AddObject(BinWriter_t *w, const void *src, uint32_t size, bool *isNew);
+static void AddRelocation(BinWriter_t *w, uint32_t fieldOffset);
+static void ClearPointer(BinWriter_t *w, uint32_t fieldOffset);
+static void StoreString(BinWriter_t *w, uint32_t fieldOffset, const char *str);
+static void StoreResource(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Xrm_ResObject_t *res);
+static void StoreJobList(BinWriter_t *w, uint32_t fieldOffset, Ucs_Xrm_ResObject_t **jobs);
+static void StoreEndpoint(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Rm_EndPoint_t *ep);
+static void StoreConfigMsg(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Ns_ConfigMsg_t *msg);
+static void StoreScripts(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Ns_Script_t *scr, uint8_t cnt);
+static void StoreNodes(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Rm_Node_t *nodes, uint16_t cnt);
+static void StoreRoutes(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Rm_Route_t *routes, uint16_t cnt);
+static void StoreDriver(BinWriter_t *w, uint32_t fieldOffset, const DriverInformation_t *drv);
+static void StoreDrivers(BinWriter_t *w, uint32_t fieldOffset, DriverInformation_t **ppDrv, uint16_t cnt);
+static void StoreScenes(BinWriter_t *w, uint32_t fieldOffset, const UcsXmlScene_t *scenes, uint16_t cnt);
+static void StoreRouteIds(BinWriter_t *w, uint32_t fieldOffset, const uint16_t *ids, uint16_t cnt);
+static int CompareObjects(const void *a, const void *b);
+static void ResolveRelocations(BinWriter_t *w);
+static void FreeWriter(BinWriter_t *w);
+
+/************************************************************************/
+/* Public Functions                                                     */
+/************************************************************************/
+
+bool UcsXml_IsBinary(const void *content, size_t len)
+{
+    if (NULL == content || len < sizeof(BinHeader_t)) return false;
+    return (0 == memcmp(content, BIN_MAGIC, sizeof(BIN_MAGIC)));
+}
+
+const UcsXmlVal_t *UcsXml_RelocateBinary(void *content, size_t len)
+{
+    uint32_t i;
+    uint8_t *base = content;
+    BinHeader_t *hdr = content;
+    const uint32_t *relocs;
+    if (!UcsXml_IsBinary(content, len)) return NULL;
+    if (BIN_VERSION != hdr->version || GetLayout() != hdr->layout)
+    {
+        UcsXml_ReportError("Binary configuration was created by an incompatible version or architecture", 0);
+        return NULL;
+    }
+    if (len != hdr->size
+        || 0 != (hdr->rootOffset % BIN_ALIGNMENT) || hdr->rootOffset < sizeof(BinHeader_t)
+        || len < sizeof(UcsXmlVal_t) || hdr->rootOffset > len - sizeof(UcsXmlVal_t)
+        || 0 != (hdr->relocOffset % sizeof(uint32_t)) || len < hdr->relocOffset
+        || (len - hdr->relocOffset) / sizeof(uint32_t) < hdr->relocCount)
+    {
+        UcsXml_ReportError("Binary configuration is truncated or corrupted", 0);
+        return NULL;
+    }
+    if (UcsXml_GetHash(base + sizeof(BinHeader_t), len - sizeof(BinHeader_t)) != hdr->hash)
+    {
+        UcsXml_ReportError("Binary configuration checksum mismatch", 0);
+        return NULL;
+    }
+    relocs = (const uint32_t *)(base + hdr->relocOffset);
+    for (i = 0; i < hdr->relocCount; i++)
+    {
+        uintptr_t *field;
+        uint32_t pos = relocs[i];
+        if (0 != (pos % sizeof(uintptr_t)) || pos < sizeof(BinHeader_t)
+            || (size_t)pos + sizeof(uintptr_t) > hdr->relocOffset)
+        {
+            UcsXml_ReportError("Binary configuration has invalid relocation", 0);
+            return NULL;
+        }
+        field = (uintptr_t *)(base + pos);
+        if (hdr->relocOffset <= *field)
+        {
+            UcsXml_ReportError("Binary configuration has invalid relocation", 0);
+            return NULL;
+        }
+        *field = (uintptr_t)(base + *field);
+    }
+    return (const UcsXmlVal_t *)(base + hdr->rootOffset);
+}
+
+#ifdef XML_FILE_SUPPORTED
+bool UcsXml_WriteBinaryFile(const UcsXmlVal_t *val, const char *fileName)
+{
+    FILE *fh;
+    BinHeader_t hdr;
+    BinWriter_t w;
+    uint32_t root;
+    bool success = false;
+    memset(&w, 0, sizeof(BinWriter_t));
+    memset(&hdr, 0, sizeof(BinHeader_t));
+    w.size = BIN_ALIGN(sizeof(BinHeader_t));
+    root = AddObject(&w, val, sizeof(UcsXmlVal_t), NULL);
+    if (!w.error)
+    {
+        /*The internal data is replaced by the file mapping on load*/
+        ClearPointer(&w, root + offsetof(UcsXmlVal_t, pInternal));
+        StoreNodes(&w, root + offsetof(UcsXmlVal_t, pNod), val->pNod, val->nodSize);
+        StoreRoutes(&w, root + offsetof(UcsXmlVal_t, pRoutes), val->pRoutes, val->routesSize);
+        StoreDrivers(&w, root + offsetof(UcsXmlVal_t, ppDriver), val->ppDriver, val->driverSize);
+        StoreScenes(&w, root + offsetof(UcsXmlVal_t, pScenes), val->pScenes, val->sceneSize);
+        ResolveRelocations(&w);
+    }
+    hdr.relocOffset = BIN_ALIGN(w.size);
+    hdr.relocCount = w.relocCnt;
+    if (!w.error && Reserve((void **)&w.data, &w.capacity, hdr.relocOffset + w.relocCnt * sizeof(uint32_t), 1))
+    {
+        memcpy(w.data + hdr.relocOffset, w.relocs, w.relocCnt * sizeof(uint32_t));
+        w.size = hdr.relocOffset + w.relocCnt * sizeof(uint32_t);
+        memcpy(hdr.magic, BIN_MAGIC, sizeof(BIN_MAGIC));
+        hdr.version = BIN_VERSION;
+        hdr.layout = GetLayout();
+        hdr.size = w.size;
+        hdr.rootOffset = root;
+        hdr.hash = UcsXml_GetHash(w.data + sizeof(BinHeader_t), w.size - sizeof(BinHeader_t));
+        memcpy(w.data, &hdr, sizeof(BinHeader_t));
+        fh = fopen(fileName, "wb");
+        if (fh)
+        {
+            success = (1 == fwrite(w.data, w.size, 1, fh));
+            success = (0 == fclose(fh)) && success;
+        }
+        if (!success)
+            UcsXml_ReportError("Could not write binary configuration file:'%s'", 1, fileName);
+    }
+    else
+    {
+        UcsXml_ReportError("Could not create binary configuration", 0);
+    }
+    FreeWriter(&w);
+    return success;
+}
+#endif
+
+/************************************************************************/
+/* Private Function Implementations                                     */
+/************************************************************************/
+
+uint64_t UcsXml_GetHash(const uint8_t *data, size_t len)
+{
+    size_t i;
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (i = 0; i < len; i++)
+    {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint32_t GetLayout(void)
+{
+    /*Any change of the UNICENS structures or the architecture invalidates the file*/
+    const uint32_t sizes[] = {
+        sizeof(void *), sizeof(UcsXmlVal_t), sizeof(Ucs_Rm_Node_t), sizeof(Ucs_Signature_t),
+        sizeof(Ucs_Ns_Script_t), sizeof(Ucs_Ns_ConfigMsg_t), sizeof(Ucs_Rm_Route_t),
+        sizeof(Ucs_Rm_EndPoint_t), sizeof(Ucs_Xrm_DefaultCreatedPort_t), sizeof(Ucs_Xrm_NetworkSocket_t),
+        sizeof(Ucs_Xrm_MlbPort_t), sizeof(Ucs_Xrm_MlbSocket_t), sizeof(Ucs_Xrm_UsbPort_t),
+        sizeof(Ucs_Xrm_UsbSocket_t), sizeof(Ucs_Xrm_StrmPort_t), sizeof(Ucs_Xrm_StrmSocket_t),
+        sizeof(Ucs_Xrm_RmckPort_t), sizeof(Ucs_Xrm_SyncCon_t), sizeof(Ucs_Xrm_AvpCon_t),
+        sizeof(Ucs_Xrm_Splitter_t), sizeof(Ucs_Xrm_Combiner_t), sizeof(DriverInformation_t),
+        sizeof(UcsXmlScene_t) };
+    return (uint32_t)UcsXml_GetHash((const uint8_t *)sizes, sizeof(sizes));
+}
+
+static bool Reserve(void **buf, uint32_t *capacity, uint32_t needed, uint32_t elemSize)
+{
+    void *p;
+    uint32_t cap = *capacity;
+    if (needed <= cap) return true;
+    if (0 == cap) cap = (BIN_INITIAL_SIZE + elemSize - 1) / elemSize;
+    while (cap < needed) cap *= 2;
+    p = realloc(*buf, (size_t)cap * elemSize);
+    if (NULL == p) return false;
+    memset((uint8_t *)p + (size_t)*capacity * elemSize, 0, (size_t)(cap - *capacity) * elemSize);
+    *buf = p;
+    *capacity = cap;
+    return true;
+}
+
+static uint32_t LookupSlot(BinWriter_t *w, uintptr_t src)
+{
+    uint32_t mask = w->lookupCapacity - 1;
+    uint32_t slot = (uint32_t)((src >> 3) * 2654435761u) & mask;
+    while (0 != w->lookup[slot] && w->objs[w->lookup[slot] - 1].src != src)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+static bool GrowLookup(BinWriter_t *w)
+{
+    uint32_t i;
+    uint32_t *old = w->lookup;
+    uint32_t oldCapacity = w->lookupCapacity;
+    w->lookupCapacity = oldCapacity ? oldCapacity * 2 : 256;
+    w->lookup = calloc(w->lookupCapacity, sizeof(uint32_t));
+    if (NULL == w->lookup)
+    {
+        free(old);
+        return false;
+    }
+    for (i = 0; i < oldCapacity; i++)
+    {
+        if (0 != old[i])
+            w->lookup[LookupSlot(w, w->objs[old[i] - 1].src)] = old[i];
+    }
+    free(old);
+    return true;
+}
+
+static uint32_t AddObject(BinWriter_t *w, const void *src, uint32_t size, bool *isNew)
+{
+    uint32_t slot, offset;
+    struct BinObject *obj;
+    if (isNew) *isNew = false;
+    if (w->error || NULL == src || 0 == size) return 0;
+    if ((w->objCnt + 1) * 2 > w->lookupCapacity && !GrowLookup(w))
+    {
+        w->error = true;
+        return 0;
+    }
+    slot = LookupSlot(w, (uintptr_t)src);
+    if (0 != w->lookup[slot])
+    {
+        /*Already stored, shared by multiple owners*/
+        obj = &w->objs[w->lookup[slot] - 1];
+        if (obj->size < size) w->error = true;
+        return obj->offset;
+    }
+    offset = BIN_ALIGN(w->size);
+    if (!Reserve((void **)&w->data, &w->capacity, offset + size, 1)
+        || !Reserve((void **)&w->objs, &w->objCapacity, w->objCnt + 1, sizeof(struct BinObject)))
+    {
+        w->error = true;
+        return 0;
+    }
+    memcpy(w->data + offset, src, size);
+    w->size = offset + size;
+    obj = &w->objs[w->objCnt++];
+    obj->src = (uintptr_t)src;
+    obj->size = size;
+    obj->offset = offset;
+    w->lookup[slot] = w->objCnt;
+    if (isNew) *isNew = true;
+    return offset;
+}
+
+static void AddRelocation(BinWriter_t *w, uint32_t fieldOffset)
+{
+    uintptr_t ptr;
+    if (w->error) return;
+    memcpy(&ptr, w->data + fieldOffset, sizeof(uintptr_t));
+    if (0 == ptr) return;
+    if (!Reserve((void **)&w->relocs, &w->relocCapacity, w->relocCnt + 1, sizeof(uint32_t)))
+    {
+        w->error = true;
+        return;
+    }
+    w->relocs[w->relocCnt++] = fieldOffset;
+}
+
+static void ClearPointer(BinWriter_t *w, uint32_t fieldOffset)
+{
+    if (w->error) return;
+    memset(w->data + fieldOffset, 0, sizeof(uintptr_t));
+}
+
+static void StoreString(BinWriter_t *w, uint32_t fieldOffset, const char *str)
+{
+    if (NULL == str) return;
+    AddRelocation(w, fieldOffset);
+    AddObject(w, str, strlen(str) + 1, NULL);
+}
+
+static void StoreResource(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Xrm_ResObject_t *res)
+{
+    bool isNew;
+    uint32_t pos;
+    if (NULL == res) return;
+    AddRelocation(w, fieldOffset);
+    switch (*((const Ucs_Xrm_ResourceType_t *)res))
+    {
+    case UCS_XRM_RC_TYPE_DC_PORT:
+        AddObject(w, res, sizeof(Ucs_Xrm_DefaultCreatedPort_t), NULL);
+        break;
+    case UCS_XRM_RC_TYPE_NW_SOCKET:
+        AddObject(w, res, sizeof(Ucs_Xrm_NetworkSocket_t), NULL);
+        break;
+    case UCS_XRM_RC_TYPE_MLB_PORT:
+        AddObject(w, res, sizeof(Ucs_Xrm_MlbPort_t), NULL);
+        break;
+    case UCS_XRM_RC_TYPE_USB_PORT:
+        AddObject(w, res, sizeof(Ucs_Xrm_UsbPort_t), NULL);
+        break;
+    case UCS_XRM_RC_TYPE_STRM_PORT:
+        AddObject(w, res, sizeof(Ucs_Xrm_StrmPort_t), NULL);
+        break;
+    case UCS_XRM_RC_TYPE_RMCK_PORT:
+        AddObject(w, res, sizeof(Ucs_Xrm_RmckPort_t), NULL);
+        break;
+    case UCS_XRM_RC_TYPE_MLB_SOCKET:
+    {
+        const Ucs_Xrm_MlbSocket_t *soc = res;
+        pos = AddObject(w, res, sizeof(Ucs_Xrm_MlbSocket_t), &isNew);
+        if (isNew)
+            StoreResource(w, pos + offsetof(Ucs_Xrm_MlbSocket_t, mlb_port_obj_ptr), soc->mlb_port_obj_ptr);
+        break;
+    }
+    case UCS_XRM_RC_TYPE_USB_SOCKET:
+    {
+        const Ucs_Xrm_UsbSocket_t *soc = res;
+        pos = AddObject(w, res, sizeof(Ucs_Xrm_UsbSocket_t), &isNew);
+        if (isNew)
+            StoreResource(w, pos + offsetof(Ucs_Xrm_UsbSocket_t, usb_port_obj_ptr), soc->usb_port_obj_ptr);
+        break;
+    }
+    case UCS_XRM_RC_TYPE_STRM_SOCKET:
+    {
+        const Ucs_Xrm_StrmSocket_t *soc = res;
+        pos = AddObject(w, res, sizeof(Ucs_Xrm_StrmSocket_t), &isNew);
+        if (isNew)
+            StoreResource(w, pos + offsetof(Ucs_Xrm_StrmSocket_t, stream_port_obj_ptr), soc->stream_port_obj_ptr);
+        break;
+    }
+    case UCS_XRM_RC_TYPE_SYNC_CON:
+    {
+        const Ucs_Xrm_SyncCon_t *con = res;
+        pos = AddObject(w, res, sizeof(Ucs_Xrm_SyncCon_t), &isNew);
+        if (isNew)
+        {
+            StoreResource(w, pos + offsetof(Ucs_Xrm_SyncCon_t, socket_in_obj_ptr), con->socket_in_obj_ptr);
+            StoreResource(w, pos + offsetof(Ucs_Xrm_SyncCon_t, socket_out_obj_ptr), con->socket_out_obj_ptr);
+        }
+        break;
+    }
+    case UCS_XRM_RC_TYPE_AVP_CON:
+    {
+        const Ucs_Xrm_AvpCon_t *con = res;
+        pos = AddObject(w, res, sizeof(Ucs_Xrm_AvpCon_t), &isNew);
+        if (isNew)
+        {
+            StoreResource(w, pos + offsetof(Ucs_Xrm_AvpCon_t, socket_in_obj_ptr), con->socket_in_obj_ptr);
+            StoreResource(w, pos + offsetof(Ucs_Xrm_AvpCon_t, socket_out_obj_ptr), con->socket_out_obj_ptr);
+        }
+        break;
+    }
+    case UCS_XRM_RC_TYPE_SPLITTER:
+    {
+        const Ucs_Xrm_Splitter_t *splitter = res;
+        pos = AddObject(w, res, sizeof(Ucs_Xrm_Splitter_t), &isNew);
+        if (isNew)
+            StoreResource(w, pos + offsetof(Ucs_Xrm_Splitter_t, socket_in_obj_ptr), splitter->socket_in_obj_ptr);
+        break;
+    }
+    case UCS_XRM_RC_TYPE_COMBINER:
+    {
+        const Ucs_Xrm_Combiner_t *combiner = res;
+        pos = AddObject(w, res, sizeof(Ucs_Xrm_Combiner_t), &isNew);
+        if (isNew)
+            StoreResource(w, pos + offsetof(Ucs_Xrm_Combiner_t, port_socket_obj_ptr), combiner->port_socket_obj_ptr);
+        break;
+    }
+    default:
+        UcsXml_ReportError("Binary configuration does not support resource type %d", 1,
+            *((const Ucs_Xrm_ResourceType_t *)res));
+        w->error = true;
+        break;
+    }
+}
+
+static void StoreJobList(BinWriter_t *w, uint32_t fieldOffset, Ucs_Xrm_ResObject_t **jobs)
+{
+    bool isNew;
+    uint32_t i, cnt, pos;
+    if (NULL == jobs) return;
+    AddRelocation(w, fieldOffset);
+    for (cnt = 0; NULL != jobs[cnt]; cnt++);
+    /*Including the terminating NULL pointer*/
+    pos = AddObject(w, jobs, (cnt + 1) * sizeof(Ucs_Xrm_ResObject_t *), &isNew);
+    if (!isNew) return;
+    for (i = 0; i < cnt; i++)
+        StoreResource(w, pos + i * sizeof(Ucs_Xrm_ResObject_t *), jobs[i]);
+}
+
+static void StoreEndpoint(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Rm_EndPoint_t *ep)
+{
+    bool isNew;
+    uint32_t pos;
+    if (NULL == ep) return;
+    AddRelocation(w, fieldOffset);
+    pos = AddObject(w, ep, sizeof(Ucs_Rm_EndPoint_t), &isNew);
+    if (!isNew) return;
+    StoreJobList(w, pos + offsetof(Ucs_Rm_EndPoint_t, jobs_list_ptr), ep->jobs_list_ptr);
+    /*Points into the node array, which is stored separately*/
+    AddRelocation(w, pos + offsetof(Ucs_Rm_EndPoint_t, node_obj_ptr));
+}
+
+static void StoreConfigMsg(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Ns_ConfigMsg_t *msg)
+{
+    bool isNew;
+    uint32_t pos;
+    if (NULL == msg) return;
+    AddRelocation(w, fieldOffset);
+    pos = AddObject(w, msg, sizeof(Ucs_Ns_ConfigMsg_t), &isNew);
+    if (!isNew) return;
+    if (NULL == msg->data_ptr || 0 == msg->data_size)
+    {
+        ClearPointer(w, pos + offsetof(Ucs_Ns_ConfigMsg_t, data_ptr));
+        return;
+    }
+    AddRelocation(w, pos + offsetof(Ucs_Ns_ConfigMsg_t, data_ptr));
+    AddObject(w, msg->data_ptr, msg->data_size, NULL);
+}
+
+static void StoreScripts(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Ns_Script_t *scr, uint8_t cnt)
+{
+    bool isNew;
+    uint32_t i, pos;
+    if (NULL == scr || 0 == cnt)
+    {
+        ClearPointer(w, fieldOffset);
+        return;
+    }
+    AddRelocation(w, fieldOffset);
+    pos = AddObject(w, scr, cnt * sizeof(Ucs_Ns_Script_t), &isNew);
+    if (!isNew) return;
+    for (i = 0; i < cnt; i++)
+    {
+        uint32_t p = pos + i * sizeof(Ucs_Ns_Script_t);
+        StoreConfigMsg(w, p + offsetof(Ucs_Ns_Script_t, send_cmd), scr[i].send_cmd);
+        StoreConfigMsg(w, p + offsetof(Ucs_Ns_Script_t, exp_result), scr[i].exp_result);
+    }
+}
+
+static void StoreNodes(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Rm_Node_t *nodes, uint16_t cnt)
+{
+    uint32_t i, pos;
+    if (NULL == nodes || 0 == cnt)
+    {
+        ClearPointer(w, fieldOffset);
+        return;
+    }
+    AddRelocation(w, fieldOffset);
+    pos = AddObject(w, nodes, cnt * sizeof(Ucs_Rm_Node_t), NULL);
+    for (i = 0; i < cnt; i++)
+    {
+        uint32_t p = pos + i * sizeof(Ucs_Rm_Node_t);
+        if (NULL != nodes[i].signature_ptr)
+        {
+            AddRelocation(w, p + offsetof(Ucs_Rm_Node_t, signature_ptr));
+            AddObject(w, nodes[i].signature_ptr, sizeof(Ucs_Signature_t), NULL);
+        }
+        StoreScripts(w, p + offsetof(Ucs_Rm_Node_t, init_script_list_ptr),
+            nodes[i].init_script_list_ptr, nodes[i].init_script_list_size);
+    }
+}
+
+static void StoreRoutes(BinWriter_t *w, uint32_t fieldOffset, const Ucs_Rm_Route_t *routes, uint16_t cnt)
+{
+    uint32_t i, pos;
+    if (NULL == routes || 0 == cnt)
+    {
+        ClearPointer(w, fieldOffset);
+        return;
+    }
+    AddRelocation(w, fieldOffset);
+    pos = AddObject(w, routes, cnt * sizeof(Ucs_Rm_Route_t), NULL);
+    for (i = 0; i < cnt; i++)
+    {
+        uint32_t p = pos + i * sizeof(Ucs_Rm_Route_t);
+        StoreEndpoint(w, p + offsetof(Ucs_Rm_Route_t, source_endpoint_ptr), routes[i].source_endpoint_ptr);
+        StoreEndpoint(w, p + offsetof(Ucs_Rm_Route_t, sink_endpoint_ptr), routes[i].sink_endpoint_ptr);
+    }
+}
+
+static void StoreDriver(BinWriter_t *w, uint32_t fieldOffset, const DriverInformation_t *drv)
+{
+    bool isNew;
+    uint32_t pos;
+    if (NULL == drv) return;
+    AddRelocation(w, fieldOffset);
+    pos = AddObject(w, drv, sizeof(DriverInformation_t), &isNew);
+    if (!isNew) return;
+    StoreString(w, pos + offsetof(DriverInformation_t, linkName), drv->linkName);
+    switch (drv->driverType)
+    {
+    case Driver_LinuxCdev:
+        StoreString(w, pos + offsetof(DriverInformation_t, drv.LinuxCdev.channelName), drv->drv.LinuxCdev.channelName);
+        StoreString(w, pos + offsetof(DriverInformation_t, drv.LinuxCdev.aimName), drv->drv.LinuxCdev.aimName);
+        break;
+    case Driver_LinuxAlsa:
+        StoreString(w, pos + offsetof(DriverInformation_t, drv.LinuxAlsa.channelName), drv->drv.LinuxAlsa.channelName);
+        StoreString(w, pos + offsetof(DriverInformation_t, drv.LinuxAlsa.aimName), drv->drv.LinuxAlsa.aimName);
+        break;
+    case Driver_LinuxV4l2:
+        StoreString(w, pos + offsetof(DriverInformation_t, drv.LinuxV4l2.channelName), drv->drv.LinuxV4l2.channelName);
+        StoreString(w, pos + offsetof(DriverInformation_t, drv.LinuxV4l2.aimName), drv->drv.LinuxV4l2.aimName);
+        break;
+    case Driver_LinuxNetwork:
+        StoreString(w, pos + offsetof(DriverInformation_t, drv.LinuxNetwork.channelName), drv->drv.LinuxNetwork.channelName);
+        StoreString(w, pos + offsetof(DriverInformation_t, drv.LinuxNetwork.aimName), drv->drv.LinuxNetwork.aimName);
+        break;
+    default:
+        w->error = true;
+        break;
+    }
+}
+
+static void StoreDrivers(BinWriter_t *w, uint32_t fieldOffset, DriverInformation_t **ppDrv, uint16_t cnt)
+{
+    uint32_t i, pos;
+    if (NULL == ppDrv || 0 == cnt)
+    {
+        ClearPointer(w, fieldOffset);
+        return;
+    }
+    AddRelocation(w, fieldOffset);
+    pos = AddObject(w, ppDrv, cnt * sizeof(DriverInformation_t *), NULL);
+    for (i = 0; i < cnt; i++)
+        StoreDriver(w, pos + i * sizeof(DriverInformation_t *), ppDrv[i]);
+}
+
+static void StoreScenes(BinWriter_t *w, uint32_t fieldOffset, const UcsXmlScene_t *scenes, uint16_t cnt)
+{
+    uint32_t i, pos;
+    if (NULL == scenes || 0 == cnt)
+    {
+        ClearPointer(w, fieldOffset);
+        return;
+    }
+    AddRelocation(w, fieldOffset);
+    pos = AddObject(w, scenes, cnt * sizeof(UcsXmlScene_t), NULL);
+    for (i = 0; i < cnt; i++)
+    {
+        uint32_t p = pos + i * sizeof(UcsXmlScene_t);
+        StoreString(w, p + offsetof(UcsXmlScene_t, name), scenes[i].name);
+        StoreRouteIds(w, p + offsetof(UcsXmlScene_t, pActiveRoutes), scenes[i].pActiveRoutes, scenes[i].activeSize);
+        StoreRouteIds(w, p + offsetof(UcsXmlScene_t, pInactiveRoutes), scenes[i].pInactiveRoutes, scenes[i].inactiveSize);
+    }
+}
+
+static void StoreRouteIds(BinWriter_t *w, uint32_t fieldOffset, const uint16_t *ids, uint16_t cnt)
+{
+    if (NULL == ids || 0 == cnt)
+    {
+        ClearPointer(w, fieldOffset);
+        return;
+    }
+    AddRelocation(w, fieldOffset);
+    AddObject(w, ids, cnt * sizeof(uint16_t), NULL);
+}
+
+static int CompareObjects(const void *a, const void *b)
+{
+    const struct BinObject *oa = a;
+    const struct BinObject *ob = b;
+    if (oa->src < ob->src) return -1;
+    return (oa->src > ob->src) ? 1 : 0;
+}
+
+static void ResolveRelocations(BinWriter_t *w)
+{
+    uint32_t i;
+    if (w->error) return;
+    /*The lookup table is not needed anymore and holds indexes into the unsorted array*/
+    free(w->lookup);
+    w->lookup = NULL;
+    w->lookupCapacity = 0;
+    qsort(w->objs, w->objCnt, sizeof(struct BinObject), CompareObjects);
+    for (i = 0; i < w->relocCnt; i++)
+    {
+        uintptr_t ptr;
+        uint32_t lo = 0, hi = w->objCnt;
+        memcpy(&ptr, w->data + w->relocs[i], sizeof(uintptr_t));
+        /*Find the last object starting at or before the pointer, it may point inside*/
+        while (lo < hi)
+        {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (w->objs[mid].src <= ptr)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (0 == lo || ptr >= w->objs[lo - 1].src + w->objs[lo - 1].size)
+        {
+            UcsXml_ReportError("Binary configuration contains a pointer to an unknown object", 0);
+            w->error = true;
+            return;
+        }
+        ptr = w->objs[lo - 1].offset + (ptr - w->objs[lo - 1].src);
+        memcpy(w->data + w->relocs[i], &ptr, sizeof(uintptr_t));
+    }
+}
+
+static void FreeWriter(BinWriter_t *w)
+{
+    free(w->data);
+    free(w->relocs);
+    free(w->objs);
+    free(w->lookup);
+}
@@ -0,0 +1,101 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS XML Parser                                                                             */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "UcsXml.h"
+
+/************************************************************************/
+/* Private Function Prototypes                                          */
+/************************************************************************/
+
+static bool AddEndpoint(const Ucs_Rm_EndPoint_t **pEps, uint16_t *pSize, const Ucs_Rm_EndPoint_t *ep);
+static uint16_t GetResourceCount(const Ucs_Rm_EndPoint_t *ep);
+
+/************************************************************************/
+/* Public Functions                                                     */
+/************************************************************************/
+
+bool UcsXml_GetPoolUsage(const UcsXmlVal_t *val, UcsXmlPoolUsage_t *usage)
+{
+    const Ucs_Rm_EndPoint_t **pEps;
+    uint16_t i, epSize = 0;
+    if (NULL == val || NULL == usage)
+        return false;
+    memset(usage, 0, sizeof(UcsXmlPoolUsage_t));
+    usage->nodes = val->nodSize;
+    usage->routes = val->routesSize;
+    if (0 == val->routesSize)
+        return true;
+    /* Every route has at most two endpoints, fan-out routes share their source */
+    pEps = calloc(2 * (uint32_t)val->routesSize, sizeof(Ucs_Rm_EndPoint_t *));
+    if (NULL == pEps)
+        return false;
+    for (i = 0; i < val->routesSize; i++)
+    {
+        const Ucs_Rm_Route_t *route = &val->pRoutes[i];
+        if (AddEndpoint(pEps, &epSize, route->source_endpoint_ptr))
+            usage->resources += GetResourceCount(route->source_endpoint_ptr);
+        if (AddEndpoint(pEps, &epSize, route->sink_endpoint_ptr))
+            usage->resources += GetResourceCount(route->sink_endpoint_ptr);
+    }
+    usage->endpoints = epSize;
+    free(pEps);
+    return true;
+}
+
+/************************************************************************/
+/* Private Functions                                                    */
+/************************************************************************/
+
+static bool AddEndpoint(const Ucs_Rm_EndPoint_t **pEps, uint16_t *pSize, const Ucs_Rm_EndPoint_t *ep)
+{
+    uint16_t i;
+    /* Static connections (DC endpoints) are not built by the XRM */
+    if (NULL == ep || (UCS_RM_EP_SOURCE != ep->endpoint_type && UCS_RM_EP_SINK != ep->endpoint_type))
+        return false;
+    for (i = 0; i < *pSize; i++)
+    {
+        if (pEps[i] == ep)
+            return false;
+    }
+    pEps[(*pSize)++] = ep;
+    return true;
+}
+
+static uint16_t GetResourceCount(const Ucs_Rm_EndPoint_t *ep)
+{
+    uint16_t j = 0;
+    if (NULL == ep->jobs_list_ptr)
+        return 0;
+    while(NULL != ep->jobs_list_ptr[j])
+        ++j;
+    return j;
+}
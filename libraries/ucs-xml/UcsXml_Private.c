@@ -64,7 +64,7 @@ static const char* I2S_PIN_SRXB1 =          "SRXB1";
 static const char* MUTE_OFF =               "NoMuting";
 static const char* MUTE_SIGNAL =            "MuteSignal";
 
-#define ASSERT_FALSE(func, par) { UcsXml_CB_OnError("Parameter error in attribute=%s value=%s, file=%s, line=%d", 4, func, par,  __FILE__, __LINE__); return false; }
+#define ASSERT_FALSE(func, par) { UcsXml_ReportError("Parameter error in attribute=%s value=%s, file=%s, line=%d", 4, func, par,  __FILE__, __LINE__); return false; }
 #define CHECK_POINTER(PTR) if (NULL == PTR) { ASSERT_FALSE(PTR, "NULL pointer"); }
 
 static int32_t Str2Int(const char *val)
@@ -75,7 +75,7 @@ static int32_t Str2Int(const char *val)
 void *MCalloc(struct UcsXmlObjectList *list, uint32_t nElem, uint32_t elemSize)
 {
     void *obj;
-    struct UcsXmlObjectList *tail = list;
+    struct UcsXmlObjectList *tail;
     if (NULL == list || 0 == nElem || 0 == elemSize) return NULL;
 
     obj = calloc(nElem, elemSize);
@@ -89,7 +89,7 @@ void *MCalloc(struct UcsXmlObjectList *list, uint32_t nElem, uint32_t elemSize)
         list->obj = obj;
         return obj;
     }
-    while(tail->next) tail = tail->next;
+    tail = list->tail ? list->tail : list;
     tail->next = calloc(1, sizeof(struct UcsXmlObjectList));
     if (NULL == tail->next)
     {
@@ -98,6 +98,7 @@ void *MCalloc(struct UcsXmlObjectList *list, uint32_t nElem, uint32_t elemSize)
         return NULL;
     }
     tail->next->obj = obj;
+    list->tail = tail->next;
     return obj;
 }
 
@@ -581,4 +582,4 @@ bool GetDefaultCreatedRoute(Ucs_Rm_Route_t **dcRoute, struct DCRouteParametes *p
         }
     }
     return true;
-}
\ No newline at end of file
+}
\ No newline at end of file
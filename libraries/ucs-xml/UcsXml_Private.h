@@ -31,6 +31,7 @@
 #define UCSXML_PRIVATE_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "ucs_api.h"
 #include "UcsXml.h"
@@ -53,6 +54,7 @@ struct UcsXmlObjectList
 {
     void *obj;
     struct UcsXmlObjectList *next;
+    struct UcsXmlObjectList *tail; /* Only maintained in the root element */
 };
 
 void *MCalloc(struct UcsXmlObjectList *list, uint32_t nElem, uint32_t elemSize);
@@ -193,4 +195,20 @@ struct DCRouteParametes
 
 bool GetDefaultCreatedRoute(Ucs_Rm_Route_t **dcRoute, struct DCRouteParametes *param);
 
-#endif /* UCSXML_PRIVATE_H_ */
\ No newline at end of file
+/* Reports an error to the context of the current thread or to UcsXml_CB_OnError, see UcsXml.c */
+void UcsXml_ReportError(const char format[], uint16_t vargsCnt, ...);
+UcsXmlScript_t *UcsXml_ParseScriptBuffer(const char *xml, size_t len);
+#ifdef XML_FILE_SUPPORTED
+const char *UcsXml_MapFile(const char *fileName, size_t *pLen);
+void UcsXml_UnmapFile(const char *content, size_t len);
+#endif
+
+/* Binary configuration, see UcsXml_Binary.c */
+bool UcsXml_IsBinary(const void *content, size_t len);
+const UcsXmlVal_t *UcsXml_RelocateBinary(void *content, size_t len);
+uint64_t UcsXml_GetHash(const uint8_t *data, size_t len);
+#ifdef XML_FILE_SUPPORTED
+bool UcsXml_WriteBinaryFile(const UcsXmlVal_t *val, const char *fileName);
+#endif
+
+#endif /* UCSXML_PRIVATE_H_ */
\ No newline at end of file
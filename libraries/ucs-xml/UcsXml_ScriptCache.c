@@ -0,0 +1,293 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS XML Parser                                                                             */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "UcsXml_Private.h"
+
+/************************************************************************/
+/* Private Definitions                                                  */
+/************************************************************************/
+/* Cached scripts are found by name through a chained hash table. All
+ * entries are additionally linked in LRU order, the most recently used
+ * one first. Entries handed out to the user are pinned by a reference
+ * count and are never evicted. Invalidated pinned entries are moved to
+ * a separate list until their last reference is released. */
+
+struct ScriptEntry
+{
+    struct ScriptEntry *prev;       /* LRU list or released list */
+    struct ScriptEntry *next;
+    struct ScriptEntry *chain;      /* Hash bucket */
+    UcsXmlScript_t *script;
+    uint64_t contentHash;
+    uint32_t nameHash;
+    uint16_t refCnt;
+    char name[];
+};
+
+struct ScriptList
+{
+    struct ScriptEntry *head;
+    struct ScriptEntry *tail;
+};
+
+struct UcsXmlScriptCache
+{
+    struct ScriptEntry **buckets;
+    uint32_t bucketsSize;
+    struct ScriptList lru;
+    struct ScriptList invalid;
+    uint16_t capacity;
+    uint16_t count;
+};
+
+/************************************************************************/
+/* Private Function Prototypes                                          */
+/************************************************************************/
+
+static const UcsXmlScript_t *GetScript(UcsXmlScriptCache_t *cache, const char *name, const char *xml, size_t len);
+static struct ScriptEntry *FindEntry(UcsXmlScriptCache_t *cache, const char *name, uint32_t nameHash);
+static void RemoveEntry(UcsXmlScriptCache_t *cache, struct ScriptEntry *entry);
+static void EvictEntries(UcsXmlScriptCache_t *cache);
+static void FreeEntry(struct ScriptEntry *entry);
+static void ListRemove(struct ScriptList *list, struct ScriptEntry *entry);
+static void ListPushFront(struct ScriptList *list, struct ScriptEntry *entry);
+
+/************************************************************************/
+/* Public Functions                                                     */
+/************************************************************************/
+
+UcsXmlScriptCache_t *UcsXml_CreateScriptCache(uint16_t capacity)
+{
+    UcsXmlScriptCache_t *cache;
+    if (0 == capacity) return NULL;
+    cache = calloc(1, sizeof(UcsXmlScriptCache_t));
+    if (NULL == cache) return NULL;
+    cache->bucketsSize = 1;
+    while (cache->bucketsSize < capacity)
+        cache->bucketsSize <<= 1;
+    cache->buckets = calloc(cache->bucketsSize, sizeof(struct ScriptEntry *));
+    if (NULL == cache->buckets)
+    {
+        free(cache);
+        return NULL;
+    }
+    cache->capacity = capacity;
+    return cache;
+}
+
+void UcsXml_FreeScriptCache(UcsXmlScriptCache_t *cache)
+{
+    struct ScriptEntry *entry;
+    if (NULL == cache) return;
+    UcsXml_InvalidateCachedScript(cache, NULL);
+    /* Scripts still in use are freed anyway, the user must not access them anymore */
+    while (NULL != (entry = cache->invalid.head))
+    {
+        ListRemove(&cache->invalid, entry);
+        FreeEntry(entry);
+    }
+    free(cache->buckets);
+    free(cache);
+}
+
+const UcsXmlScript_t *UcsXml_GetCachedScript(UcsXmlScriptCache_t *cache, const char *name, const char *xmlString)
+{
+    if (NULL == cache || NULL == name || NULL == xmlString) return NULL;
+    return GetScript(cache, name, xmlString, strlen(xmlString));
+}
+
+#ifdef XML_FILE_SUPPORTED
+const UcsXmlScript_t *UcsXml_GetCachedScriptFile(UcsXmlScriptCache_t *cache, const char *fileName)
+{
+    const UcsXmlScript_t *script;
+    size_t len;
+    const char *content;
+    if (NULL == cache || NULL == fileName) return NULL;
+    content = UcsXml_MapFile(fileName, &len);
+    if (NULL == content)
+    {
+        UcsXml_ReportError("UcsXml_GetCachedScriptFile:Could not read file:'%s'", 1, fileName);
+        return NULL;
+    }
+    script = GetScript(cache, fileName, content, len);
+    UcsXml_UnmapFile(content, len);
+    return script;
+}
+#endif
+
+void UcsXml_ReleaseCachedScript(UcsXmlScriptCache_t *cache, const UcsXmlScript_t *script)
+{
+    struct ScriptEntry *entry;
+    if (NULL == cache || NULL == script) return;
+    for (entry = cache->lru.head; NULL != entry; entry = entry->next)
+    {
+        if (script == entry->script)
+        {
+            if (entry->refCnt) --entry->refCnt;
+            EvictEntries(cache);
+            return;
+        }
+    }
+    for (entry = cache->invalid.head; NULL != entry; entry = entry->next)
+    {
+        if (script == entry->script)
+        {
+            if (0 == --entry->refCnt)
+            {
+                ListRemove(&cache->invalid, entry);
+                FreeEntry(entry);
+            }
+            return;
+        }
+    }
+}
+
+void UcsXml_InvalidateCachedScript(UcsXmlScriptCache_t *cache, const char *name)
+{
+    struct ScriptEntry *entry;
+    if (NULL == cache) return;
+    if (NULL != name)
+    {
+        entry = FindEntry(cache, name, (uint32_t)UcsXml_GetHash((const uint8_t *)name, strlen(name)));
+        if (entry) RemoveEntry(cache, entry);
+        return;
+    }
+    while (NULL != cache->lru.head)
+        RemoveEntry(cache, cache->lru.head);
+}
+
+/************************************************************************/
+/* Private Function Implementations                                     */
+/************************************************************************/
+
+static const UcsXmlScript_t *GetScript(UcsXmlScriptCache_t *cache, const char *name, const char *xml, size_t len)
+{
+    size_t nameLen = strlen(name);
+    uint32_t nameHash = (uint32_t)UcsXml_GetHash((const uint8_t *)name, nameLen);
+    uint64_t contentHash = UcsXml_GetHash((const uint8_t *)xml, len);
+    struct ScriptEntry *entry = FindEntry(cache, name, nameHash);
+    if (entry && contentHash != entry->contentHash)
+    {
+        /* Content changed since it was cached */
+        RemoveEntry(cache, entry);
+        entry = NULL;
+    }
+    if (NULL == entry)
+    {
+        uint32_t bucket = nameHash & (cache->bucketsSize - 1);
+        entry = calloc(1, sizeof(struct ScriptEntry) + nameLen + 1);
+        if (NULL == entry)
+        {
+            UcsXml_ReportError("Script cache is out of memory", 0);
+            return NULL;
+        }
+        entry->script = UcsXml_ParseScriptBuffer(xml, len);
+        if (NULL == entry->script)
+        {
+            free(entry);
+            return NULL;
+        }
+        memcpy(entry->name, name, nameLen + 1);
+        entry->nameHash = nameHash;
+        entry->contentHash = contentHash;
+        entry->chain = cache->buckets[bucket];
+        cache->buckets[bucket] = entry;
+        ++cache->count;
+    }
+    else
+    {
+        ListRemove(&cache->lru, entry);
+    }
+    ListPushFront(&cache->lru, entry);
+    ++entry->refCnt;
+    EvictEntries(cache);
+    return entry->script;
+}
+
+static struct ScriptEntry *FindEntry(UcsXmlScriptCache_t *cache, const char *name, uint32_t nameHash)
+{
+    struct ScriptEntry *entry = cache->buckets[nameHash & (cache->bucketsSize - 1)];
+    while (entry && (nameHash != entry->nameHash || 0 != strcmp(name, entry->name)))
+        entry = entry->chain;
+    return entry;
+}
+
+static void RemoveEntry(UcsXmlScriptCache_t *cache, struct ScriptEntry *entry)
+{
+    struct ScriptEntry **link = &cache->buckets[entry->nameHash & (cache->bucketsSize - 1)];
+    while (*link != entry)
+        link = &(*link)->chain;
+    *link = entry->chain;
+    ListRemove(&cache->lru, entry);
+    --cache->count;
+    if (entry->refCnt)
+        ListPushFront(&cache->invalid, entry);
+    else
+        FreeEntry(entry);
+}
+
+static void EvictEntries(UcsXmlScriptCache_t *cache)
+{
+    struct ScriptEntry *entry = cache->lru.tail;
+    while (cache->count > cache->capacity && NULL != entry)
+    {
+        struct ScriptEntry *prev = entry->prev;
+        if (0 == entry->refCnt)
+            RemoveEntry(cache, entry);
+        entry = prev;
+    }
+}
+
+static void FreeEntry(struct ScriptEntry *entry)
+{
+    UcsXml_FreeScript(entry->script);
+    free(entry);
+}
+
+static void ListRemove(struct ScriptList *list, struct ScriptEntry *entry)
+{
+    if (entry->prev) entry->prev->next = entry->next;
+    else list->head = entry->next;
+    if (entry->next) entry->next->prev = entry->prev;
+    else list->tail = entry->prev;
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+static void ListPushFront(struct ScriptList *list, struct ScriptEntry *entry)
+{
+    entry->prev = NULL;
+    entry->next = list->head;
+    if (list->head) list->head->prev = entry;
+    else list->tail = entry;
+    list->head = entry;
+}
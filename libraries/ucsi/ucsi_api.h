@@ -218,6 +218,25 @@ void UCSI_ReleaseAmsMessage(UCSI_Data_t *pPriv);
  */
 bool UCSI_SetRouteActive(UCSI_Data_t *pPriv, uint16_t routeId, bool isActive);
 
+/**
+ * \brief Switches to a scene, a set of route states applied as one operation.
+ * \note Call this function only from single context (not from ISR)
+ * \note Only routes differing from their current state are touched. All deactivations are finished
+ *       before the first activation starts, so resources are freed before they get allocated again.
+ *       The result is reported once via UCSI_CB_OnSceneResult.
+ * \note The given arrays are used until UCSI_CB_OnSceneResult was raised, do not free them before.
+ *
+ * \param pPriv - private data section of this instance
+ * \param pActiveRoutes - identifiers of the routes to be active, may be NULL if activeSize is 0
+ * \param activeSize - amount of entries in pActiveRoutes
+ * \param pInactiveRoutes - identifiers of the routes to be inactive, may be NULL if inactiveSize is 0
+ * \param inactiveSize - amount of entries in pInactiveRoutes
+ *
+ * \return true, if the scene switch was enqueued to UNICENS.
+ */
+bool UCSI_SwitchScene(UCSI_Data_t *pPriv, const uint16_t *pActiveRoutes, uint16_t activeSize,
+    const uint16_t *pInactiveRoutes, uint16_t inactiveSize);
+
 /**
  * \brief Performs an remote I2C write command
  * \note Call this function only from single context (not from ISR)
@@ -427,6 +446,16 @@ extern void UCSI_CB_OnAmsMessageReceived(void *pTag);
  */
 extern void UCSI_CB_OnRouteResult(void *pTag, uint16_t routeId, bool isActive, uint16_t connectionLabel);
 
+/**
+ * \brief Callback when a scene switch started by UCSI_SwitchScene has finished.
+ * \note This function must be implemented by the integrator
+ * \param pTag - Pointer given by the integrator by UCSI_Init
+ * \param success - true, if all routes reached their new state. false, if at least one route failed or timed out
+ * \param routeChanges - amount of routes which were activated or deactivated
+ * \param durationMs - time in milliseconds from the start of the first deactivation until the last route finished
+ */
+extern void UCSI_CB_OnSceneResult(void *pTag, bool success, uint16_t routeChanges, uint16_t durationMs);
+
 /**
  * \brief Callback when a INIC GPIO changes its state
  * \note This function must be implemented by the integrator
@@ -42,12 +42,15 @@
 #define ENABLE_AMS_LIB          (true)
 #define DEBUG_XRM
 #define ENABLE_RESOURCE_PRINT
+#define ENABLE_STATUS_SHM
 #define BOARD_PMS_TX_SIZE       (72)
 #define CMD_QUEUE_LEN           (40)
 #define I2C_WRITE_MAX_LEN       (32)
 #define AMS_MSG_MAX_LEN         (45)
 #define MAX_NODES               (32)
 #define PROGRAM_MAX_DATA_LEN    (50)
+#define SCENE_MAX_ROUTES        (64)
+#define SCENE_TIMEOUT_MS        (3000)
 
 #include <string.h>
 #include <stdarg.h>
@@ -102,7 +105,8 @@ typedef enum
     UnicensCmd_PacketFilterMode,
     UnicensCmd_ProgramNode,
     UnicensCmd_ProgramExit,
-    UnicensCmd_SupvSetMode
+    UnicensCmd_SupvSetMode,
+    UnicensCmd_RmSetScene
 } UnicensCmd_t;
 
 /**
@@ -122,6 +126,17 @@ typedef struct
     bool isActive;
 } UnicensCmdRmSetRoute_t;
 
+/**
+ * \brief Internal struct for UNICENS Integration
+ */
+typedef struct
+{
+    const uint16_t *pActive;
+    uint16_t activeSize;
+    const uint16_t *pInactive;
+    uint16_t inactiveSize;
+} UnicensCmdRmSetScene_t;
+
 /**
  * \brief Internal struct for UNICENS Integration
  */
@@ -234,6 +249,7 @@ typedef struct
     {
         UnicensCmdInit_t Init;
         UnicensCmdRmSetRoute_t RmSetRoute;
+        UnicensCmdRmSetScene_t RmSetScene;
         UnicensCmdNsRun_t NsRun;
         UnicensCmdGpioCreatePort_t GpioCreatePort;
         UnicensCmdGpioWritePort_t GpioWritePort;
@@ -272,6 +288,19 @@ typedef struct
     uint8_t triggerNodeCount;
 } UCSI_Programming_t;
 
+typedef struct
+{
+    Ucs_Rm_Route_t *pending[SCENE_MAX_ROUTES];
+    uint16_t pendingCnt;
+    uint16_t scanPos;
+    uint16_t changes;
+    uint16_t startTime;
+    uint16_t progressTime;
+    bool activatePhase;
+    bool issuing;
+    bool failed;
+} UCSI_Scene_t;
+
 /**
  * \brief Internal variables for one instance of UNICENS Integration
  * \note Allocate this structure for each instance (static or malloc)
@@ -286,6 +315,7 @@ typedef struct
     Ucs_InitData_t uniInitData;
     Ucs_Supv_Mode_t supvShallMode;
     UCSI_Programming_t program;
+    UCSI_Scene_t scene;
     RB_t rb;
     void *tag;
     void *uniLldHPtr;
@@ -293,6 +323,7 @@ typedef struct
     Ucs_Inst_t *unicens;
     Ucs_Lld_Api_t *uniLld;
     UnicensCmdEntry_t *currentCmd;
+    uint64_t currentCmdStartUs;
     bool initialized;
     bool printTrigger;
     bool triggerService;
@@ -31,6 +31,8 @@
 #include <stdio.h>
 #include "ucsi_api.h"
 #include "ucsi_print.h"
+#include "ucsi_status.h"
+#include "Metrics.h"
 
 /************************************************************************/
 /* Private Definitions and variables                                    */
@@ -70,6 +72,8 @@ static char m_traceBuffer[TRACE_BUFFER_SZ];
 /************************************************************************/
 static bool EnqueueCommand(UCSI_Data_t *my, UnicensCmdEntry_t *cmd);
 static void OnCommandExecuted(UCSI_Data_t *my, UnicensCmd_t cmd, bool success);
+static void OnCommandEnqueued(UCSI_Data_t *my, UnicensCmd_t cmd);
+static void CommandResult(UCSI_Data_t *my, UnicensCmd_t cmd, bool success, uint16_t nodeAddress);
 static void RB_Init(RB_t *rb, uint16_t amountOfEntries, uint32_t sizeOfEntry, uint8_t *workingBuffer);
 static void *RB_GetReadPtr(RB_t *rb);
 static void RB_PopReadPtr(RB_t *rb);
@@ -116,6 +120,7 @@ static void OnProgramResult(Ucs_Prg_Report_t *result_ptr, void *user_ptr);
 static void OnUcsAmsWrite(Ucs_AmsTx_Msg_t* msg_ptr, Ucs_AmsTx_Result_t result, Ucs_AmsTx_Info_t info, void *user_ptr);
 #endif
 static const char *GetSupervisorModeString(Ucs_Supv_Mode_t mode);
+static const char *GetCommandString(UnicensCmd_t cmd);
 static void OnHdxReport(Ucs_Hdx_Report_t *result, void *user_ptr);
 static void ProgrammingSetFoundNodeCount(UCSI_Data_t *my, uint8_t nodeCount);
 static void ProgrammingStoreSignature(UCSI_Data_t *my, const Ucs_Signature_t *signature);
@@ -125,6 +130,12 @@ static uint16_t BuildIdentString(Ucs_IdentString_t *ident_string, uint8_t data[]
 static uint16_t CalcCCITT16(uint8_t data[], uint16_t length, uint16_t start_value);
 static uint16_t CalcCCITT16Step(uint16_t crc, uint8_t value);
 static void OnNetworkAlive(Ucs_Network_AliveStatus_t *result_ptr, void *user_ptr);
+static void SceneStart(UCSI_Data_t *my);
+static void SceneContinue(UCSI_Data_t *my);
+static bool SceneIsMember(const uint16_t *pIds, uint16_t size, uint16_t routeId);
+static bool SceneOnRouteResult(UCSI_Data_t *my, Ucs_Rm_Route_t *route, Ucs_Rm_RouteInfos_t routeInfos);
+static void SceneCheckTimeout(UCSI_Data_t *my);
+static void SceneFinish(UCSI_Data_t *my);
 
 /************************************************************************/
 /* Public Function Implementations                                      */
@@ -133,10 +144,13 @@ static void OnNetworkAlive(Ucs_Network_AliveStatus_t *result_ptr, void *user_ptr
 void UCSI_Init(UCSI_Data_t *my, void *pTag, bool debugLocalNode)
 {
     Ucs_Return_t result;
+    UnicensCmd_t cmd;
     assert(NULL != my);
     memset(my, 0, sizeof(UCSI_Data_t));
     my->magic = MAGIC;
     my->tag = pTag;
+    for (cmd = UnicensCmd_Init; cmd <= UnicensCmd_RmSetScene; cmd++)
+        Metrics_SetCommandName(cmd, GetCommandString(cmd));
     my->unicens = Ucs_CreateInstance();
     if (NULL == my->unicens)
     {
@@ -241,6 +255,7 @@ bool UCSI_NewConfig(UCSI_Data_t *my,
         if (NULL == e) return false;
         e->cmd = UnicensCmd_Stop;
         RB_PopWritePtr(&my->rb);
+        OnCommandEnqueued(my, UnicensCmd_Stop);
     }
     my->uniInitData.supv.packet_bw = packetBw;
     my->uniInitData.supv.proxy_channel_bw = proxyBw;
@@ -263,8 +278,11 @@ bool UCSI_NewConfig(UCSI_Data_t *my,
     e->cmd =  UnicensCmd_Init;
     e->val.Init.init_ptr = &my->uniInitData;
     RB_PopWritePtr(&my->rb);
+    OnCommandEnqueued(my, UnicensCmd_Init);
     UCSI_CB_OnServiceRequired(my->tag);
     UCSIPrint_Init(pRoutesList, routesListSize, my);
+    if (!UCSIStatus_Init(pRoutesList, routesListSize, pNodesList, nodesListSize))
+        UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Status segment is too small, configuration is published incomplete", 0);
     return true;
 }
 
@@ -319,9 +337,12 @@ void UCSI_Service(UCSI_Data_t *my)
         my->printTrigger = false;
         UCSIPrint_Service(UCSI_CB_OnGetTime(my->tag));
     }
+    SceneCheckTimeout(my);
     if (NULL != my->currentCmd) return;
     my->currentCmd = e = (UnicensCmdEntry_t *)RB_GetReadPtr(&my->rb);
     if (NULL == e) return;
+    my->currentCmdStartUs = Metrics_GetUs();
+    Metrics_CommandExecuted(e->cmd);
     switch (e->cmd) {
         case UnicensCmd_Init:
             if (UCS_RET_SUCCESS == Ucs_Init(my->unicens, e->val.Init.init_ptr, OnUcsInitResult))
@@ -329,7 +350,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_Init failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_Init, false, LOCAL_NODE_ADDR);
+                CommandResult(my, UnicensCmd_Init, false, LOCAL_NODE_ADDR);
             }
             break;
         case UnicensCmd_Stop:
@@ -338,24 +359,30 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_Stop failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_Stop, false, LOCAL_NODE_ADDR);
+                CommandResult(my, UnicensCmd_Stop, false, LOCAL_NODE_ADDR);
             }
             break;
         case UnicensCmd_RmSetRoute:
             if (UCS_RET_SUCCESS == Ucs_Rm_SetRouteActive(my->unicens, e->val.RmSetRoute.routePtr, e->val.RmSetRoute.isActive))
             {
                 my->pendingRoutePtr = e->val.RmSetRoute.routePtr;
+                UCSIStatus_SetRouteShall(e->val.RmSetRoute.routePtr->route_id, e->val.RmSetRoute.isActive);
                 popEntry = false;
             } else  {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_Rm_SetRouteActive failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_RmSetRoute, false, e->val.RmSetRoute.routePtr->sink_endpoint_ptr->node_obj_ptr->signature_ptr->node_address);
+                CommandResult(my, UnicensCmd_RmSetRoute, false, e->val.RmSetRoute.routePtr->sink_endpoint_ptr->node_obj_ptr->signature_ptr->node_address);
             }
             break;
+        case UnicensCmd_RmSetScene:
+            /*Finished by SceneFinish, even if no route needs to be changed*/
+            SceneStart(my);
+            popEntry = false;
+            break;
         case UnicensCmd_NsRun:
             if (UCS_RET_SUCCESS != Ucs_Ns_Run(my->unicens, e->val.NsRun.nodeAddress, e->val.NsRun.scriptPtr, e->val.NsRun.scriptSize, OnUcsNsRun))
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_Ns_Run failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_NsRun, false, e->val.NsRun.nodeAddress);
+                CommandResult(my, UnicensCmd_NsRun, false, e->val.NsRun.nodeAddress);
             }
             break;
         case UnicensCmd_GpioCreatePort:
@@ -364,7 +391,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_Gpio_CreatePort failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_GpioCreatePort, false, e->val.GpioCreatePort.destination);
+                CommandResult(my, UnicensCmd_GpioCreatePort, false, e->val.GpioCreatePort.destination);
             }
             break;
         case UnicensCmd_GpioWritePort:
@@ -373,7 +400,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_Gpio_WritePort failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_GpioWritePort, false, e->val.GpioWritePort.destination);
+                CommandResult(my, UnicensCmd_GpioWritePort, false, e->val.GpioWritePort.destination);
             }
             break;
         case UnicensCmd_GpioPortMode:
@@ -382,7 +409,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "UnicensCmd_GpioPortMode failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_GpioPortMode, false, e->val.GpioPortMode.destination);
+                CommandResult(my, UnicensCmd_GpioPortMode, false, e->val.GpioPortMode.destination);
             }
             break;
         case UnicensCmd_I2CWrite:
@@ -393,7 +420,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_I2c_WritePort failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_I2CWrite, false, e->val.I2CWrite.destination);
+                CommandResult(my, UnicensCmd_I2CWrite, false, e->val.I2CWrite.destination);
                 if (e->val.I2CWrite.result_fptr) {
                     e->val.I2CWrite.result_fptr(false, e->val.I2CWrite.i2cMode, e->val.I2CWrite.destination, e->val.I2CWrite.slaveAddr, e->val.I2CWrite.request_ptr);
                 }
@@ -406,7 +433,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_I2c_ReadPort failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_I2CRead, false, e->val.I2CRead.destination);
+                CommandResult(my, UnicensCmd_I2CRead, false, e->val.I2CRead.destination);
             }
             break;
 #if ENABLE_AMS_LIB
@@ -421,7 +448,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_AmsTx_SendMsg failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_SendAmsMessage, false, msg->destination_address);
+                CommandResult(my, UnicensCmd_SendAmsMessage, false, msg->destination_address);
                 Ucs_AmsTx_FreeUnusedMsg(my->unicens, msg);
             }
             break;
@@ -433,7 +460,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Ucs_Network_SetPacketFilterMode failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_PacketFilterMode, false, e->val.PacketFilterMode.destination_address);
+                CommandResult(my, UnicensCmd_PacketFilterMode, false, e->val.PacketFilterMode.destination_address);
             }
             break;
         case UnicensCmd_ProgramNode:
@@ -442,7 +469,7 @@ void UCSI_Service(UCSI_Data_t *my)
             else
             {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "UnicensCmd_ProgramNode failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_ProgramNode, false, e->val.ProgramNode.nodePosAddr);
+                CommandResult(my, UnicensCmd_ProgramNode, false, e->val.ProgramNode.nodePosAddr);
             }
             break;
         case UnicensCmd_ProgramExit:
@@ -457,7 +484,7 @@ void UCSI_Service(UCSI_Data_t *my)
                 popEntry = false;
             } else {
                 UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "UnicensCmd_SupvSetMode failed", 0);
-                UCSI_CB_OnCommandResult(my->tag, UnicensCmd_SupvSetMode, false, UNKNOWN_NODE_ADDR);
+                CommandResult(my, UnicensCmd_SupvSetMode, false, UNKNOWN_NODE_ADDR);
             }
             break;
         default:
@@ -476,6 +503,7 @@ void UCSI_Timeout(UCSI_Data_t *my)
     assert(MAGIC == my->magic);
     if (NULL == my->unicens) return;
     Ucs_ReportTimeout(my->unicens);
+    SceneCheckTimeout(my);
     if (my->printTrigger)
     {
         my->printTrigger = false;
@@ -633,6 +661,22 @@ bool UCSI_EnablePromiscuousMode(UCSI_Data_t *my, uint16_t targetAddress, bool en
     return EnqueueCommand(my, &entry);
 }
 
+bool UCSI_SwitchScene(UCSI_Data_t *my, const uint16_t *pActiveRoutes, uint16_t activeSize,
+    const uint16_t *pInactiveRoutes, uint16_t inactiveSize)
+{
+    UnicensCmdEntry_t entry;
+    assert(MAGIC == my->magic);
+    if (NULL == my || NULL == my->uniInitData.supv.routes_list_ptr) return false;
+    if ((NULL == pActiveRoutes && 0 != activeSize) || (NULL == pInactiveRoutes && 0 != inactiveSize))
+        return false;
+    entry.cmd = UnicensCmd_RmSetScene;
+    entry.val.RmSetScene.pActive = pActiveRoutes;
+    entry.val.RmSetScene.activeSize = activeSize;
+    entry.val.RmSetScene.pInactive = pInactiveRoutes;
+    entry.val.RmSetScene.inactiveSize = inactiveSize;
+    return EnqueueCommand(my, &entry);
+}
+
 /************************************************************************/
 /* Private Functions                                                    */
 /************************************************************************/
@@ -653,6 +697,7 @@ static bool EnqueueCommand(UCSI_Data_t *my, UnicensCmdEntry_t *cmd)
     }
     memcpy(e, cmd, sizeof(UnicensCmdEntry_t));
     RB_PopWritePtr(&my->rb);
+    OnCommandEnqueued(my, cmd->cmd);
     UCSI_CB_OnServiceRequired(my->tag);
     UCSIPrint_UnicensActivity();
     return true;
@@ -684,39 +729,54 @@ static void OnCommandExecuted(UCSI_Data_t *my, UnicensCmd_t cmd, bool success)
     UCSIPrint_UnicensActivity();
     switch (e->cmd) {
         case UnicensCmd_Init:
-                UCSI_CB_OnCommandResult(my->tag, cmd, success, LOCAL_NODE_ADDR);
+                CommandResult(my, cmd, success, LOCAL_NODE_ADDR);
             break;
         case UnicensCmd_Stop:
-                UCSI_CB_OnCommandResult(my->tag, cmd, success, LOCAL_NODE_ADDR);
+                CommandResult(my, cmd, success, LOCAL_NODE_ADDR);
             break;
         case UnicensCmd_GpioCreatePort:
-                UCSI_CB_OnCommandResult(my->tag, cmd, success, e->val.GpioCreatePort.destination);
+                CommandResult(my, cmd, success, e->val.GpioCreatePort.destination);
             break;
         case UnicensCmd_GpioWritePort:
-                UCSI_CB_OnCommandResult(my->tag, cmd, success, e->val.GpioWritePort.destination);
+                CommandResult(my, cmd, success, e->val.GpioWritePort.destination);
             break;
         case UnicensCmd_I2CWrite:
-                UCSI_CB_OnCommandResult(my->tag, cmd, success, e->val.I2CWrite.destination);
+                CommandResult(my, cmd, success, e->val.I2CWrite.destination);
             break;
         case UnicensCmd_I2CRead:
-                UCSI_CB_OnCommandResult(my->tag, cmd, success, e->val.I2CRead.destination);
+                CommandResult(my, cmd, success, e->val.I2CRead.destination);
             break;
 #if ENABLE_AMS_LIB
         case UnicensCmd_SendAmsMessage:
-                UCSI_CB_OnCommandResult(my->tag, cmd, success, e->val.SendAms.msg->destination_address);
+                CommandResult(my, cmd, success, e->val.SendAms.msg->destination_address);
             break;
 #endif
         case UnicensCmd_PacketFilterMode:
-                UCSI_CB_OnCommandResult(my->tag, cmd, success, e->val.PacketFilterMode.destination_address);
+                CommandResult(my, cmd, success, e->val.PacketFilterMode.destination_address);
             break;
         default:
-            UCSI_CB_OnCommandResult(my->tag, cmd, success, UNKNOWN_NODE_ADDR);
+            CommandResult(my, cmd, success, UNKNOWN_NODE_ADDR);
             break;
     }
     my->currentCmd = NULL;
     RB_PopReadPtr(&my->rb);
 }
 
+static void OnCommandEnqueued(UCSI_Data_t *my, UnicensCmd_t cmd)
+{
+    Metrics_CommandEnqueued(cmd, my->rb.txPos - my->rb.rxPos);
+}
+
+static void CommandResult(UCSI_Data_t *my, UnicensCmd_t cmd, bool success, uint16_t nodeAddress)
+{
+    uint32_t durationUs = 0;
+    /* Only the command in progress has a known start, scripts report after they have left the queue */
+    if (NULL != my->currentCmd && cmd == my->currentCmd->cmd)
+        durationUs = (uint32_t)(Metrics_GetUs() - my->currentCmdStartUs);
+    Metrics_CommandFinished(cmd, success, durationUs);
+    UCSI_CB_OnCommandResult(my->tag, cmd, success, nodeAddress);
+}
+
 static void RB_Init(RB_t *rb, uint16_t amountOfEntries, uint32_t sizeOfEntry, uint8_t *workingBuffer)
 {
     assert(NULL != rb);
@@ -793,6 +853,7 @@ static void OnUnicensError( Ucs_Error_t error_code, void *user_ptr )
     error_code = error_code;
     assert(MAGIC == my->magic);
     UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "UNICENS general error, code=0x%X, restarting", 1, error_code);
+    Metrics_Add(MetricsCounter_UnicensRestarts, 1);
     e.cmd = UnicensCmd_Init;
     e.val.Init.init_ptr = &my->uniInitData;
     EnqueueCommand(my, &e);
@@ -838,6 +899,8 @@ static void OnLldCtrlStop( void *lld_user_ptr )
     my->uniLld = NULL;
     my->uniLldHPtr = NULL;
     UCSIPrint_SetNetworkAvailable(false, 0);
+    UCSIStatus_SetNetworkAvailable(false, 0);
+    Metrics_SetNetworkAvailable(false);
     UCSI_CB_OnStop(my->tag);
 }
 
@@ -900,13 +963,20 @@ static void OnUnicensRoutingResult(Ucs_Rm_Route_t* route_ptr, Ucs_Rm_RouteInfos_
         }
         my->pendingRoutePtr = NULL;
     }
+    else if (SceneOnRouteResult(my, route_ptr, route_infos))
+    {
+        SceneContinue(my);
+    }
     if (NULL == route_ptr ||
         UCS_RM_ROUTE_INFOS_ATD_UPDATE == route_infos ||
         UCS_RM_ROUTE_INFOS_ATD_ERROR == route_infos)
         return;
+    if (UCS_RM_ROUTE_INFOS_SUSPENDED == route_infos)
+        Metrics_Add(MetricsCounter_RouteFailures, 1);
     available = UCS_RM_ROUTE_INFOS_BUILT == route_infos;
     conLabel = Ucs_Rm_GetConnectionLabel(my->unicens, route_ptr);
     UCSIPrint_SetRouteState(route_ptr->route_id, available, conLabel);
+    UCSIStatus_SetRouteState(route_ptr->route_id, available, conLabel);
     UCSI_CB_OnRouteResult(my->tag, route_ptr->route_id, available, conLabel);
 }
 
@@ -919,6 +989,8 @@ static void OnUnicensNetworkStatus(uint16_t change_mask, uint16_t events, Ucs_Ne
     assert(MAGIC == my->magic);
     ProgrammingSetFoundNodeCount(my, available ? max_position : 0);
     UCSIPrint_SetNetworkAvailable(available, max_position);
+    UCSIStatus_SetNetworkAvailable(available, max_position);
+    Metrics_SetNetworkAvailable(available);
     UCSI_CB_OnNetworkState(my->tag, available, packet_bw, max_position);
 }
 
@@ -948,18 +1020,22 @@ static void OnUnicensDebugXrmResources(Ucs_Xrm_ResourceType_t resource_type,
     case UCS_XRM_INFOS_BUILT:
         msg = (char *)"has been built";
         UCSIPrint_SetObjectState(resource_ptr, ObjState_Build);
+        UCSIStatus_SetObjectState(resource_ptr, ObjState_Build);
         break;
     case UCS_XRM_INFOS_DESTROYED:
         msg = (char *)"has been destroyed";
         UCSIPrint_SetObjectState(resource_ptr, ObjState_Unused);
+        UCSIStatus_SetObjectState(resource_ptr, ObjState_Unused);
         break;
     case UCS_XRM_INFOS_ERR_BUILT:
         msg = (char *)"cannot be built";
         UCSIPrint_SetObjectState(resource_ptr, ObjState_Failed);
+        UCSIStatus_SetObjectState(resource_ptr, ObjState_Failed);
         break;
     case UCS_XRM_INFOS_ERR_DESTROYED:
         msg = (char *)"cannot be destroyed";
         UCSIPrint_SetObjectState(resource_ptr, ObjState_Failed);
+        UCSIStatus_SetObjectState(resource_ptr, ObjState_Failed);
         break;
     default:
         msg = (char *)"has unknown state";
@@ -1134,14 +1210,17 @@ static void OnUcsSupvReport(Ucs_Supv_Report_t code, Ucs_Signature_t *signature_p
     {
     case UCS_SUPV_REP_IGNORED_UNKNOWN:
         UCSIPrint_SetNodeAvailable(node_address, node_pos_addr, NodeState_Ignored);
+        UCSIStatus_SetNodeState(signature_ptr, NodeState_Ignored);
         UCSI_CB_OnUserMessage(my->tag, UCSI_MsgDebug, "Node=%X(%X): Ignored, because unknown", 2, node_address, node_pos_addr);
         break;
     case UCS_SUPV_REP_IGNORED_DUPLICATE:
         UCSIPrint_SetNodeAvailable(node_address, node_pos_addr, NodeState_Ignored);
+        UCSIStatus_SetNodeState(signature_ptr, NodeState_Ignored);
         UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Node=%X(%X): Ignored, because duplicated", 2, node_address, node_pos_addr);
         break;
     case UCS_SUPV_REP_NOT_AVAILABLE:
         UCSIPrint_SetNodeAvailable(node_address, node_pos_addr, NodeState_NotAvailable);
+        UCSIStatus_SetNodeState(signature_ptr, NodeState_NotAvailable);
         UCSI_CB_OnUserMessage(my->tag, UCSI_MsgDebug, "Node=%X(%X): Not available", 2, node_address, node_pos_addr);
         break;
     case UCS_SUPV_REP_WELCOMED:
@@ -1158,6 +1237,7 @@ static void OnUcsSupvReport(Ucs_Supv_Report_t code, Ucs_Signature_t *signature_p
         break;
     case UCS_SUPV_REP_AVAILABLE:
         UCSIPrint_SetNodeAvailable(node_address, node_pos_addr, NodeState_Available);
+        UCSIStatus_SetNodeState(signature_ptr, NodeState_Available);
         UCSI_CB_OnUserMessage(my->tag, UCSI_MsgDebug, "Node=%X(%X): Available", 2, node_address, node_pos_addr);
         break;
     default:
@@ -1171,7 +1251,7 @@ static void OnUcsNsRun(uint16_t node_address, Ucs_Ns_ResultCode_t result, Ucs_Ns
 {
     UCSI_Data_t *my = (UCSI_Data_t *)ucs_user_ptr;
     assert(MAGIC == my->magic);
-    UCSI_CB_OnCommandResult(my->tag, UnicensCmd_NsRun, (UCS_NS_RES_SUCCESS == result), node_address);
+    CommandResult(my, UnicensCmd_NsRun, (UCS_NS_RES_SUCCESS == result), node_address);
 #ifdef DEBUG_XRM
     UCSI_CB_OnUserMessage(my->tag, (UCS_NS_RES_SUCCESS != result), "OnUcsNsRun (%03X): script executed %s",
         2, node_address, (UCS_NS_RES_SUCCESS == result ? "succeeded" : "false"));
@@ -1320,6 +1400,30 @@ static const char *GetSupervisorModeString(Ucs_Supv_Mode_t mode)
     return pModeString;
 }
 
+static const char *GetCommandString(UnicensCmd_t cmd)
+{
+    switch(cmd)
+    {
+        case UnicensCmd_Init: return "Init";
+        case UnicensCmd_Stop: return "Stop";
+        case UnicensCmd_RmSetRoute: return "RmSetRoute";
+        case UnicensCmd_NsRun: return "NsRun";
+        case UnicensCmd_GpioCreatePort: return "GpioCreatePort";
+        case UnicensCmd_GpioWritePort: return "GpioWritePort";
+        case UnicensCmd_GpioPortMode: return "GpioPortMode";
+        case UnicensCmd_I2CWrite: return "I2CWrite";
+        case UnicensCmd_I2CRead: return "I2CRead";
+        case UnicensCmd_SendAmsMessage: return "SendAmsMessage";
+        case UnicensCmd_PacketFilterMode: return "PacketFilterMode";
+        case UnicensCmd_ProgramNode: return "ProgramNode";
+        case UnicensCmd_ProgramExit: return "ProgramExit";
+        case UnicensCmd_SupvSetMode: return "SupvSetMode";
+        case UnicensCmd_RmSetScene: return "RmSetScene";
+        default: break;
+    }
+    return "Unknown";
+}
+
 static void OnHdxReport(Ucs_Hdx_Report_t *result, void *user_ptr)
 {
     const char *pCodeString = "unknown";
@@ -1360,16 +1464,14 @@ static void OnHdxReport(Ucs_Hdx_Report_t *result, void *user_ptr)
     if (result->signature_ptr) {
         uint16_t nodeAddr = result->signature_ptr->node_address;
         uint16_t posAddr = result->signature_ptr->node_pos_addr;
-        snprintf(m_traceBuffer, sizeof(m_traceBuffer), "HalfDuplex Report code='%s', result=0x%X pos=0x%X nodeAddr=0x%X posAddr=0x%X",
-             pCodeString, result->cable_diag_result, result->position, nodeAddr, posAddr);
+        UCSI_CB_OnUserMessage(my->tag, UCSI_MsgDebug, "HalfDuplex Report code='%s', result=0x%X pos=0x%X nodeAddr=0x%X posAddr=0x%X",
+             5, pCodeString, result->cable_diag_result, result->position, nodeAddr, posAddr);
         if (result->position <= MAX_NODES) {
             my->cableResult[result->position - 1] = nodeAddr;
         }
     } else {
         uint8_t i = 0;
         uint8_t len = 0;
-        snprintf(m_traceBuffer, sizeof(m_traceBuffer), "HalfDuplex Report code='%s', result=0x%X pos=0x%X",
-             pCodeString, result->cable_diag_result, result->position);
         for (i = 0; i < MAX_NODES; i++) {
             if (my->cableResult[i]) {
                 len++;
@@ -1378,8 +1480,9 @@ static void OnHdxReport(Ucs_Hdx_Report_t *result, void *user_ptr)
             }
         }
         UCSI_CB_OnCableDiagnosisResult(my->tag, my->cableResult, len);
+        UCSI_CB_OnUserMessage(my->tag, UCSI_MsgDebug, "HalfDuplex Report code='%s', result=0x%X pos=0x%X",
+             3, pCodeString, result->cable_diag_result, result->position);
     }
-    UCSI_CB_OnUserMessage(my->tag, UCSI_MsgDebug, m_traceBuffer, 0);
     my->switchOnlyInInactive = true;
     my->supvShallMode = UCS_SUPV_MODE_NORMAL;
 }
@@ -1607,8 +1710,8 @@ static void OnNetworkAlive(Ucs_Network_AliveStatus_t *result, void *user_ptr)
     assert(MAGIC == my->magic);
     if (!result)
         return;
-    snprintf(m_traceBuffer, sizeof(m_traceBuffer), "On alive message, welcomed=%d, status=0x%X, nodeAddr=0x%X", result->welcomed, result->alive_status, result->signature.node_address);
-    UCSI_CB_OnUserMessage(my->tag, UCSI_MsgDebug, m_traceBuffer, 0);
+    UCSI_CB_OnUserMessage(my->tag, UCSI_MsgDebug, "On alive message, welcomed=%d, status=0x%X, nodeAddr=0x%X",
+        3, result->welcomed, result->alive_status, result->signature.node_address);
 }
 
 /************************************************************************/
@@ -1673,3 +1776,128 @@ void App_TraceInfo(void *ucs_user_ptr, const char module_str[], const char entry
 }
 #endif
 
+static void SceneStart(UCSI_Data_t *my)
+{
+    memset(&my->scene, 0, sizeof(UCSI_Scene_t));
+    my->scene.startTime = UCSI_CB_OnGetTime(my->tag);
+    my->scene.progressTime = my->scene.startTime;
+    SceneContinue(my);
+}
+
+static void SceneContinue(UCSI_Data_t *my)
+{
+    UnicensCmdRmSetScene_t *cmd;
+    if (my->scene.issuing || NULL == my->currentCmd || UnicensCmd_RmSetScene != my->currentCmd->cmd)
+        return;
+    cmd = &my->currentCmd->val.RmSetScene;
+    my->scene.issuing = true;
+    while (0 == my->scene.pendingCnt)
+    {
+        /*All deactivations must be finished, before the activations are started*/
+        while (my->scene.scanPos < my->uniInitData.supv.routes_list_size
+            && SCENE_MAX_ROUTES > my->scene.pendingCnt)
+        {
+            Ucs_Return_t result;
+            Ucs_Rm_Route_t *route = &my->uniInitData.supv.routes_list_ptr[my->scene.scanPos++];
+            if (my->scene.activatePhase)
+            {
+                if (route->active || !SceneIsMember(cmd->pActive, cmd->activeSize, route->route_id))
+                    continue;
+            }
+            else
+            {
+                if (!route->active || !SceneIsMember(cmd->pInactive, cmd->inactiveSize, route->route_id))
+                    continue;
+            }
+            result = Ucs_Rm_SetRouteActive(my->unicens, route, my->scene.activatePhase);
+            if (UCS_RET_SUCCESS == result)
+            {
+                UCSIStatus_SetRouteShall(route->route_id, my->scene.activatePhase);
+                my->scene.pending[my->scene.pendingCnt++] = route;
+                my->scene.progressTime = UCSI_CB_OnGetTime(my->tag);
+                ++my->scene.changes;
+            }
+            else if (UCS_RET_ERR_ALREADY_SET != result)
+            {
+                UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Scene could not set route=0x%X (result=0x%X)",
+                    2, route->route_id, result);
+                my->scene.failed = true;
+            }
+        }
+        if (0 != my->scene.pendingCnt)
+            break;
+        if (my->scene.scanPos < my->uniInitData.supv.routes_list_size)
+            continue;
+        if (my->scene.activatePhase)
+        {
+            SceneFinish(my);
+            break;
+        }
+        my->scene.activatePhase = true;
+        my->scene.scanPos = 0;
+    }
+    my->scene.issuing = false;
+}
+
+static bool SceneIsMember(const uint16_t *pIds, uint16_t size, uint16_t routeId)
+{
+    uint16_t i;
+    for (i = 0; i < size; i++)
+    {
+        if (routeId == pIds[i])
+            return true;
+    }
+    return false;
+}
+
+static bool SceneOnRouteResult(UCSI_Data_t *my, Ucs_Rm_Route_t *route, Ucs_Rm_RouteInfos_t routeInfos)
+{
+    uint16_t i;
+    if (NULL == route || 0 == my->scene.pendingCnt ||
+        UCS_RM_ROUTE_INFOS_ATD_UPDATE == routeInfos ||
+        UCS_RM_ROUTE_INFOS_ATD_ERROR == routeInfos)
+        return false;
+    for (i = 0; i < my->scene.pendingCnt; i++)
+    {
+        if (route != my->scene.pending[i])
+            continue;
+        if ((my->scene.activatePhase && UCS_RM_ROUTE_INFOS_BUILT != routeInfos)
+            || (!my->scene.activatePhase && UCS_RM_ROUTE_INFOS_DESTROYED != routeInfos))
+        {
+            my->scene.failed = true;
+        }
+        my->scene.pending[i] = my->scene.pending[--my->scene.pendingCnt];
+        my->scene.progressTime = UCSI_CB_OnGetTime(my->tag);
+        return (0 == my->scene.pendingCnt);
+    }
+    return false;
+}
+
+static void SceneCheckTimeout(UCSI_Data_t *my)
+{
+    uint16_t elapsed;
+    if (0 == my->scene.pendingCnt || my->scene.issuing)
+        return;
+    /*Only a stall times out, large scenes may take longer in total*/
+    elapsed = (uint16_t)(UCSI_CB_OnGetTime(my->tag) - my->scene.progressTime);
+    if (SCENE_TIMEOUT_MS > elapsed)
+        return;
+    UCSI_CB_OnUserMessage(my->tag, UCSI_MsgError, "Scene switch timed out, %d routes did not respond",
+        1, my->scene.pendingCnt);
+    /*Late route results are reported by UCSI_CB_OnRouteResult as usual*/
+    my->scene.pendingCnt = 0;
+    my->scene.failed = true;
+    SceneFinish(my);
+}
+
+static void SceneFinish(UCSI_Data_t *my)
+{
+    bool success = !my->scene.failed;
+    uint16_t duration = (uint16_t)(UCSI_CB_OnGetTime(my->tag) - my->scene.startTime);
+    /*Ignore all remaining routes, the next scene starts from scratch*/
+    my->scene.scanPos = my->uniInitData.supv.routes_list_size;
+    my->scene.activatePhase = true;
+    OnCommandExecuted(my, UnicensCmd_RmSetScene, success);
+    UCSI_CB_OnSceneResult(my->tag, success, my->scene.changes, duration);
+    UCSI_CB_OnServiceRequired(my->tag);
+}
@@ -39,9 +39,14 @@
 
 #ifdef ENABLE_RESOURCE_PRINT
 
+#ifdef UCSI_PRINT_THREAD
+#include <pthread.h>
+#endif
+
 #define SERVICE_TIME (200)
 #define MAX_TIMEOUT  (10000)
 #define MPR_RETRIES  (5)
+#define FULL_DUMP_INTERVAL (5000)
 #define INVALID_CON_LABEL (0xDEAD)
 
 #define RESETCOLOR "\033[0m"
@@ -52,6 +57,7 @@
 
 #define STR_BUF_LEN (384)
 #define STR_RES_LEN (60)
+#define STR_LINE   "---------------------------------------------------------------------------------------"
 
 struct ResourceList
 {
@@ -75,42 +81,110 @@ struct NodeList
     uint16_t pos;
 };
 
+/* Fields of a route taken on the service thread, UNICENS changes the route objects meanwhile */
+struct RowData
+{
+    uint16_t srcAddr;
+    uint16_t snkAddr;
+    uint16_t id;
+    uint8_t shallActive;
+    bool hasInJobs;
+    bool hasOutJobs;
+    char inRes[STR_RES_LEN];
+    char outRes[STR_RES_LEN];
+};
+
+/* Everything needed to format the table. The printer thread works on a copy of it
+ * and never touches the route objects */
+struct Snapshot
+{
+    void *tag;
+    uint16_t routesSize;
+    bool fullDump;
+    bool ignoredChanged;
+    uint16_t dirtyCount;
+    bool rowDirty[UCSI_PRINT_MAX_ROUTES];
+    struct ResourceList rList[UCSI_PRINT_MAX_RESOURCES];
+    struct ConnectionList cList[UCSI_PRINT_MAX_ROUTES];
+    struct NodeList nList[UCSI_PRINT_MAX_NODES];
+    struct RowData rows[UCSI_PRINT_MAX_ROUTES];
+};
+
 struct LocalVar
 {
     bool initialized;
     bool triggerService;
     uint32_t nextService;
     uint32_t timeOut;
-    void *tag;
-    Ucs_Rm_Route_t *pRoutes;
-    uint16_t routesSize;
+    bool fullDumped;
+    uint16_t lastFullDump;
     bool networkAvailable;
     uint8_t mpr;
     uint8_t waitForMprRetries;
-    struct ResourceList rList[UCSI_PRINT_MAX_RESOURCES];
-    struct ConnectionList cList[UCSI_PRINT_MAX_RESOURCES];
-    struct NodeList nList[UCSI_PRINT_MAX_NODES];
+    Ucs_Rm_Route_t *pRoutes;
+    struct Snapshot s;
+};
+
+#ifdef UCSI_PRINT_THREAD
+struct PrintThread
+{
+    bool started;
+    bool pending;
+    bool busy;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    struct Snapshot next;
+    struct Snapshot work;
 };
 
+static struct PrintThread t = { .mutex = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER };
+static void StartPrintThread(void);
+static void WaitPrintThreadIdle(void);
+static void *PrintThread(void *arg);
+#endif
+
 static struct LocalVar m = { 0 };
+/* Only used by the formatting, which runs either on the service thread or on the printer thread */
 static char strBuf[STR_BUF_LEN];
-static void PrintTable(void);
-static void ParseResources(Ucs_Xrm_ResObject_t **ppJobList, char *pBuf, uint32_t bufLen);
-static bool GetIgnoredNodeString(char *pBuf, uint32_t bufLen);
-static UCSIPrint_NodeState_t GetNodeState(uint16_t nodeAddress);
+static void PrintChanges(uint32_t timestamp);
+static void CaptureRows(struct Snapshot *s);
+static void PrintSnapshot(const struct Snapshot *s);
+static void PrintRow(const struct Snapshot *s, uint16_t i);
+static void ParseResources(const struct Snapshot *s, Ucs_Xrm_ResObject_t **ppJobList, char *pBuf, uint32_t bufLen);
+static bool GetIgnoredNodeString(const struct Snapshot *s, char *pBuf, uint32_t bufLen);
+static UCSIPrint_NodeState_t GetNodeState(const struct Snapshot *s, uint16_t nodeAddress);
 static uint8_t GetNodeCount(void);
-static bool GetRouteState(uint16_t routeId, bool *pIsActive, uint16_t *pConLabel);
+static bool GetRouteState(const struct Snapshot *s, uint16_t routeId, bool *pIsActive, uint16_t *pConLabel);
+static void MarkRow(uint16_t i);
+static void MarkNodeRows(uint16_t nodeAddress);
+static void MarkRouteRow(uint16_t routeId);
+static void MarkElementRows(Ucs_Xrm_ResObject_t *element);
+static bool ContainsJob(Ucs_Xrm_ResObject_t **ppJobList, Ucs_Xrm_ResObject_t *element);
+static void ClearDirtyRows(void);
 static void RequestTrigger(void);
 
 void UCSIPrint_Init(Ucs_Rm_Route_t *pRoutes, uint16_t routesSize, void *tag)
 {
+#ifdef UCSI_PRINT_THREAD
+    /* The previous route list may be released, as soon as UNICENS has stopped */
+    WaitPrintThreadIdle();
+#endif
     memset(&m, 0, sizeof(struct LocalVar));
     if (NULL == pRoutes || 0 == routesSize)
         return;
-    m.tag = tag;
+    if (UCSI_PRINT_MAX_ROUTES < routesSize)
+    {
+        UCSIPrint_CB_OnUserMessage(tag, RED "UCSI-Watchdog:Too many routes to print, increase UCSI_PRINT_MAX_ROUTES" RESETCOLOR);
+        routesSize = UCSI_PRINT_MAX_ROUTES;
+    }
+    m.s.tag = tag;
     m.pRoutes = pRoutes;
-    m.routesSize = routesSize;
+    m.s.routesSize = routesSize;
     m.initialized = true;
+#ifdef UCSI_PRINT_THREAD
+    StartPrintThread();
+#endif
 }
 
 void UCSIPrint_Service(uint32_t timestamp)
@@ -124,7 +198,7 @@ void UCSIPrint_Service(uint32_t timestamp)
         m.nextService = timestamp + SERVICE_TIME;
         if (0 == m.timeOut)
             m.timeOut = timestamp + MAX_TIMEOUT;
-        UCSIPrint_CB_NeedService(m.tag);
+        UCSIPrint_CB_NeedService(m.s.tag);
         return;
     }
     if (0 == m.nextService || 0 == m.timeOut)
@@ -146,11 +220,11 @@ void UCSIPrint_Service(uint32_t timestamp)
     {
         m.nextService = 0;
         m.timeOut = 0;
-        PrintTable();
+        PrintChanges(timestamp);
     }
     else
     {
-        UCSIPrint_CB_NeedService(m.tag);
+        UCSIPrint_CB_NeedService(m.s.tag);
     }
 }
 
@@ -163,30 +237,37 @@ void UCSIPrint_SetNetworkAvailable(bool available, uint8_t maxPos)
     m.waitForMprRetries = 0;
     m.timeOut = 0;
     if (available) {
+        m.s.fullDump = true;
         RequestTrigger();
     } else {
         m.triggerService = false;
         m.nextService = 0;
-        memset(m.rList, 0, sizeof(m.rList));
-        memset(m.cList, 0, sizeof(m.cList));
-        memset(m.nList, 0, sizeof(m.nList));
+        memset(m.s.rList, 0, sizeof(m.s.rList));
+        memset(m.s.cList, 0, sizeof(m.s.cList));
+        memset(m.s.nList, 0, sizeof(m.s.nList));
+        ClearDirtyRows();
     }
 }
 
 void UCSIPrint_SetNodeAvailable(uint16_t nodeAddress, uint16_t nodePosAddr, UCSIPrint_NodeState_t nodeState)
 {
     uint16_t i;
+    struct NodeList *nList = m.s.nList;
     if (!m.initialized)
         return;
     /* Find existing entry */
     for (i = 0; i < UCSI_PRINT_MAX_NODES; i++)
     {
-        if (m.nList[i].isValid && nodePosAddr == m.nList[i].pos)
+        if (nList[i].isValid && nodePosAddr == nList[i].pos)
         {
-            if (m.nList[i].nodeState != nodeState || m.nList[i].node != nodeAddress)
+            if (nList[i].nodeState != nodeState || nList[i].node != nodeAddress)
             {
-                m.nList[i].node = nodeAddress;
-                m.nList[i].nodeState = nodeState;
+                if (NodeState_Ignored == nList[i].nodeState || NodeState_Ignored == nodeState)
+                    m.s.ignoredChanged = true;
+                MarkNodeRows(nList[i].node);
+                MarkNodeRows(nodeAddress);
+                nList[i].node = nodeAddress;
+                nList[i].nodeState = nodeState;
                 RequestTrigger();
             }
             return;
@@ -195,63 +276,75 @@ void UCSIPrint_SetNodeAvailable(uint16_t nodeAddress, uint16_t nodePosAddr, UCSI
     /* Find empty entry and store it there */
     for (i = 0; i < UCSI_PRINT_MAX_NODES; i++)
     {
-        if (!m.nList[i].isValid)
+        if (!nList[i].isValid)
         {
-            m.nList[i].node = nodeAddress;
-            m.nList[i].pos = nodePosAddr;
-            m.nList[i].nodeState = nodeState;
-            m.nList[i].isValid = true;
+            nList[i].node = nodeAddress;
+            nList[i].pos = nodePosAddr;
+            nList[i].nodeState = nodeState;
+            nList[i].isValid = true;
+            if (NodeState_Ignored == nodeState)
+                m.s.ignoredChanged = true;
+            MarkNodeRows(nodeAddress);
             RequestTrigger();
             return;
         }
     }
-    UCSIPrint_CB_OnUserMessage(m.tag, RED "UCSI-Watchdog:Could not store node availability, increase UCSI_PRINT_MAX_NODES" RESETCOLOR);
+    UCSIPrint_CB_OnUserMessage(m.s.tag, RED "UCSI-Watchdog:Could not store node availability, increase UCSI_PRINT_MAX_NODES" RESETCOLOR);
 }
 
 void UCSIPrint_SetRouteState(uint16_t routeId, bool isActive, uint16_t connectionLabel)
 {
     uint16_t i;
+    struct ConnectionList *cList = m.s.cList;
     if (!m.initialized)
         return;
-    RequestTrigger();
     /* Find existing entry */
-    for (i = 0; i < UCSI_PRINT_MAX_RESOURCES; i++)
+    for (i = 0; i < UCSI_PRINT_MAX_ROUTES; i++)
     {
-        if (m.cList[i].isValid && routeId == m.cList[i].routeId)
+        if (cList[i].isValid && routeId == cList[i].routeId)
         {
-            m.cList[i].connectionLabel = connectionLabel;
-            m.cList[i].isActive = isActive;
+            if (cList[i].connectionLabel != connectionLabel || cList[i].isActive != isActive)
+            {
+                cList[i].connectionLabel = connectionLabel;
+                cList[i].isActive = isActive;
+                MarkRouteRow(routeId);
+                RequestTrigger();
+            }
             return;
         }
     }
     /* Find empty entry and store it there */
-    for (i = 0; i < UCSI_PRINT_MAX_RESOURCES; i++)
+    for (i = 0; i < UCSI_PRINT_MAX_ROUTES; i++)
     {
-        if (!m.cList[i].isValid)
+        if (!cList[i].isValid)
         {
-            m.cList[i].routeId = routeId;
-            m.cList[i].isActive = isActive;
-            m.cList[i].connectionLabel = connectionLabel;
-            m.cList[i].isValid = true;
+            cList[i].routeId = routeId;
+            cList[i].isActive = isActive;
+            cList[i].connectionLabel = connectionLabel;
+            cList[i].isValid = true;
+            MarkRouteRow(routeId);
+            RequestTrigger();
             return;
         }
     }
-    UCSIPrint_CB_OnUserMessage(m.tag, RED "UCSI-Watchdog:Could not store connection label, increase UCSI_PRINT_MAX_RESOURCES" RESETCOLOR);
+    UCSIPrint_CB_OnUserMessage(m.s.tag, RED "UCSI-Watchdog:Could not store connection label, increase UCSI_PRINT_MAX_ROUTES" RESETCOLOR);
 }
 
 void UCSIPrint_SetObjectState(Ucs_Xrm_ResObject_t *element, UCSIPrint_ObjectState_t state)
 {
     uint16_t i;
+    struct ResourceList *rList = m.s.rList;
     if (!m.initialized)
         return;
     /* Find existing entry */
     for (i = 0; i < UCSI_PRINT_MAX_RESOURCES; i++)
     {
-        if (element == m.rList[i].element)
+        if (element == rList[i].element)
         {
-            if (m.rList[i].state != state)
+            if (rList[i].state != state)
             {
-                m.rList[i].state = state;
+                rList[i].state = state;
+                MarkElementRows(element);
                 RequestTrigger();
             }
             return;
@@ -260,15 +353,16 @@ void UCSIPrint_SetObjectState(Ucs_Xrm_ResObject_t *element, UCSIPrint_ObjectStat
     /* Find empty entry and store it there */
     for (i = 0; i < UCSI_PRINT_MAX_RESOURCES; i++)
     {
-        if (NULL == m.rList[i].element)
+        if (NULL == rList[i].element)
         {
-            m.rList[i].element = element;
-            m.rList[i].state = state;
+            rList[i].element = element;
+            rList[i].state = state;
+            MarkElementRows(element);
             RequestTrigger();
             return;
         }
     }
-    UCSIPrint_CB_OnUserMessage(m.tag, RED "UCSI-Watchdog:Could not store object state, increase UCSI_PRINT_MAX_RESOURCES" RESETCOLOR);
+    UCSIPrint_CB_OnUserMessage(m.s.tag, RED "UCSI-Watchdog:Could not store object state, increase UCSI_PRINT_MAX_RESOURCES" RESETCOLOR);
 }
 
 void UCSIPrint_UnicensActivity(void)
@@ -278,105 +372,176 @@ void UCSIPrint_UnicensActivity(void)
     if (0 != m.nextService)
         RequestTrigger();
     else
-        UCSIPrint_CB_NeedService(m.tag);
+        UCSIPrint_CB_NeedService(m.s.tag);
 }
 
-static void PrintTable(void)
+static void PrintChanges(uint32_t timestamp)
 {
-    uint16_t i;
-    static char inRes[STR_RES_LEN];
-    static char outRes[STR_RES_LEN];
     if (!m.initialized)
         return;
     if (!m.networkAvailable)
         return;
-    UCSIPrint_CB_OnUserMessage(m.tag, "---------------------------------------------------------------------------------------");
-    UCSIPrint_CB_OnUserMessage(m.tag, " Source | Sink   | Active   | ID     | Label  | Resources");
-    for (i = 0; i < m.routesSize; i++)
-    {
-        const char *sourceAvail = " ";
-        const char *sourceReset = "";
-        const char *sinkAvail = " ";
-        const char *sinkReset = "";
-        const char *routeAvail = " ";
-        const char *routeReset = "";
-        char sourceAddr[24];
-        char sinkAddr[24];
-        char conLabel[20];
-        Ucs_Xrm_ResObject_t **inJobs = m.pRoutes[i].source_endpoint_ptr->jobs_list_ptr;
-        Ucs_Xrm_ResObject_t **outJobs = m.pRoutes[i].sink_endpoint_ptr->jobs_list_ptr;
-        uint16_t srcAddr = m.pRoutes[i].source_endpoint_ptr->node_obj_ptr->signature_ptr->node_address;
-        uint16_t snkAddr = m.pRoutes[i].sink_endpoint_ptr->node_obj_ptr->signature_ptr->node_address;
-        uint8_t shallActive = m.pRoutes[i].active;
-        uint16_t id = m.pRoutes[i].route_id;
-        bool isActive = false;
-        uint16_t label = INVALID_CON_LABEL;
-        UCSIPrint_NodeState_t srcState = GetNodeState(srcAddr);
-        UCSIPrint_NodeState_t snkState = GetNodeState(snkAddr);
-        GetRouteState(id, &isActive, &label);
-        ParseResources(inJobs, inRes, sizeof(inRes));
-        ParseResources(outJobs, outRes, sizeof(outRes));
-        if (NodeState_Available == srcState)
-        {
-            sourceAvail = GREEN "^";
-            sourceReset = RESETCOLOR;
-        }
-        else if (NodeState_Ignored == srcState)
-        {
-            sourceAvail = RED "^";
-            sourceReset = RESETCOLOR;
-        }
-        if (NodeState_Available == snkState)
+    /* Full tables are rate limited, in between only the changed rows are printed.
+     * The timestamp comes from UCSI_CB_OnGetTime and wraps at 16 bit */
+    if (m.s.fullDump && m.fullDumped && (uint16_t)(timestamp - m.lastFullDump) < FULL_DUMP_INTERVAL)
+    {
+        m.s.fullDump = false;
+    }
+    else if (m.s.fullDump)
+    {
+        m.fullDumped = true;
+        m.lastFullDump = (uint16_t)timestamp;
+    }
+    if (m.s.fullDump || 0 != m.s.dirtyCount || m.s.ignoredChanged)
+    {
+#ifdef UCSI_PRINT_THREAD
+        uint16_t i;
+        pthread_mutex_lock(&t.mutex);
+        if (t.pending)
         {
-            sinkAvail = GREEN "^";
-            sinkReset = RESETCOLOR;
+            /* Not printed yet, the newer state replaces it, but keeps its changed rows */
+            for (i = 0; i < m.s.routesSize; i++)
+                m.s.rowDirty[i] |= t.next.rowDirty[i];
+            m.s.fullDump |= t.next.fullDump;
+            m.s.ignoredChanged |= t.next.ignoredChanged;
+            m.s.dirtyCount = 0;
+            for (i = 0; i < m.s.routesSize; i++)
+                m.s.dirtyCount += m.s.rowDirty[i] ? 1 : 0;
         }
-        else if (NodeState_Ignored == snkState)
+        CaptureRows(&m.s);
+        t.next = m.s;
+        t.pending = t.started;
+        pthread_cond_broadcast(&t.cond);
+        pthread_mutex_unlock(&t.mutex);
+        if (!t.started)
+            PrintSnapshot(&m.s);
+#else
+        CaptureRows(&m.s);
+        PrintSnapshot(&m.s);
+#endif
+    }
+    ClearDirtyRows();
+}
+
+static void CaptureRows(struct Snapshot *s)
+{
+    uint16_t i;
+    for (i = 0; i < s->routesSize; i++)
+    {
+        Ucs_Rm_Route_t *route = &m.pRoutes[i];
+        struct RowData *row = &s->rows[i];
+        if (!s->fullDump && !s->rowDirty[i])
+            continue;
+        row->srcAddr = route->source_endpoint_ptr->node_obj_ptr->signature_ptr->node_address;
+        row->snkAddr = route->sink_endpoint_ptr->node_obj_ptr->signature_ptr->node_address;
+        row->id = route->route_id;
+        row->shallActive = route->active;
+        row->hasInJobs = (NULL != route->source_endpoint_ptr->jobs_list_ptr);
+        row->hasOutJobs = (NULL != route->sink_endpoint_ptr->jobs_list_ptr);
+        ParseResources(s, route->source_endpoint_ptr->jobs_list_ptr, row->inRes, sizeof(row->inRes));
+        ParseResources(s, route->sink_endpoint_ptr->jobs_list_ptr, row->outRes, sizeof(row->outRes));
+    }
+}
+
+static void PrintSnapshot(const struct Snapshot *s)
+{
+    uint16_t i;
+    static char ignored[STR_RES_LEN];
+    if (s->fullDump || 0 != s->dirtyCount)
+    {
+        UCSIPrint_CB_OnUserMessage(s->tag, STR_LINE);
+        if (!s->fullDump)
         {
-            sinkAvail = RED "!";
-            sinkReset = RESETCOLOR;
+            snprintf(strBuf, STR_BUF_LEN, " Changed routes: %u of %u", s->dirtyCount, s->routesSize);
+            UCSIPrint_CB_OnUserMessage(s->tag, strBuf);
         }
-        if (NodeState_Available == srcState && NodeState_Available == snkState)
+        UCSIPrint_CB_OnUserMessage(s->tag, " Source | Sink   | Active   | ID     | Label  | Resources");
+        for (i = 0; i < s->routesSize; i++)
         {
-            if (!inJobs) {
-                shallActive = false; /* Suppress red marks on fallback routes */
-            }
-            if (shallActive == isActive)
-                routeAvail = GREEN "^";
-            else
-                routeAvail = RED "!";
-            routeReset = RESETCOLOR;
-        }
-        if (inJobs) {
-            snprintf(sourceAddr, sizeof(sourceAddr), "%s0x%03X%s  ", sourceAvail, srcAddr, sourceReset);
-        } else {
-            snprintf(sourceAddr, sizeof(sourceAddr), "        ");
-        }
-        if (outJobs) {
-            snprintf(sinkAddr, sizeof(sinkAddr), "%s0x%03X%s  ", sinkAvail, snkAddr, sinkReset);
-        } else {
-            snprintf(sinkAddr, sizeof(sinkAddr), "        ");
+            if (s->fullDump || s->rowDirty[i])
+                PrintRow(s, i);
         }
-        if (INVALID_CON_LABEL == label || 0 == label)
-        {
-            snprintf(conLabel, sizeof(conLabel), "      ");
-        } else {
-            snprintf(conLabel, sizeof(conLabel), "0x%04X", label);
+        UCSIPrint_CB_OnUserMessage(s->tag, STR_LINE);
+    }
+    if ((s->fullDump || s->ignoredChanged) && GetIgnoredNodeString(s, ignored, sizeof(ignored)))
+    {
+        snprintf(strBuf, STR_BUF_LEN, RED "Ignored nodes = { %s }" RESETCOLOR, ignored);
+        UCSIPrint_CB_OnUserMessage(s->tag, strBuf);
+        UCSIPrint_CB_OnUserMessage(s->tag, STR_LINE);
+    }
+}
+
+static void PrintRow(const struct Snapshot *s, uint16_t i)
+{
+    const struct RowData *row = &s->rows[i];
+    const char *sourceAvail = " ";
+    const char *sourceReset = "";
+    const char *sinkAvail = " ";
+    const char *sinkReset = "";
+    const char *routeAvail = " ";
+    const char *routeReset = "";
+    char sourceAddr[24];
+    char sinkAddr[24];
+    char conLabel[20];
+    uint8_t shallActive = row->shallActive;
+    bool isActive = false;
+    uint16_t label = INVALID_CON_LABEL;
+    UCSIPrint_NodeState_t srcState = GetNodeState(s, row->srcAddr);
+    UCSIPrint_NodeState_t snkState = GetNodeState(s, row->snkAddr);
+    GetRouteState(s, row->id, &isActive, &label);
+    if (NodeState_Available == srcState)
+    {
+        sourceAvail = GREEN "^";
+        sourceReset = RESETCOLOR;
+    }
+    else if (NodeState_Ignored == srcState)
+    {
+        sourceAvail = RED "^";
+        sourceReset = RESETCOLOR;
+    }
+    if (NodeState_Available == snkState)
+    {
+        sinkAvail = GREEN "^";
+        sinkReset = RESETCOLOR;
+    }
+    else if (NodeState_Ignored == snkState)
+    {
+        sinkAvail = RED "!";
+        sinkReset = RESETCOLOR;
+    }
+    if (NodeState_Available == srcState && NodeState_Available == snkState)
+    {
+        if (!row->hasInJobs) {
+            shallActive = false; /* Suppress red marks on fallback routes */
         }
-        snprintf(strBuf, STR_BUF_LEN, "%s|%s| S:%d I:%s%d%s | 0x%04X | %s | Src:%s  Snk:%s",
-            sourceAddr, sinkAddr, shallActive, routeAvail, isActive, routeReset, id, conLabel, inRes, outRes);
-        UCSIPrint_CB_OnUserMessage(m.tag, strBuf);
+        if (shallActive == isActive)
+            routeAvail = GREEN "^";
+        else
+            routeAvail = RED "!";
+        routeReset = RESETCOLOR;
+    }
+    if (row->hasInJobs) {
+        snprintf(sourceAddr, sizeof(sourceAddr), "%s0x%03X%s  ", sourceAvail, row->srcAddr, sourceReset);
+    } else {
+        snprintf(sourceAddr, sizeof(sourceAddr), "        ");
+    }
+    if (row->hasOutJobs) {
+        snprintf(sinkAddr, sizeof(sinkAddr), "%s0x%03X%s  ", sinkAvail, row->snkAddr, sinkReset);
+    } else {
+        snprintf(sinkAddr, sizeof(sinkAddr), "        ");
     }
-    UCSIPrint_CB_OnUserMessage(m.tag, "---------------------------------------------------------------------------------------");
-    if (GetIgnoredNodeString(inRes, sizeof(inRes)))
+    if (INVALID_CON_LABEL == label || 0 == label)
     {
-        snprintf(strBuf, STR_BUF_LEN, RED "Ignored nodes = { %s }" RESETCOLOR, inRes);
-        UCSIPrint_CB_OnUserMessage(m.tag, strBuf);
-        UCSIPrint_CB_OnUserMessage(m.tag, "---------------------------------------------------------------------------------------");
+        snprintf(conLabel, sizeof(conLabel), "      ");
+    } else {
+        snprintf(conLabel, sizeof(conLabel), "0x%04X", label);
     }
+    snprintf(strBuf, STR_BUF_LEN, "%s|%s| S:%d I:%s%d%s | 0x%04X | %s | Src:%s  Snk:%s",
+        sourceAddr, sinkAddr, shallActive, routeAvail, isActive, routeReset, row->id, conLabel, row->inRes, row->outRes);
+    UCSIPrint_CB_OnUserMessage(s->tag, strBuf);
 }
 
-static void ParseResources(Ucs_Xrm_ResObject_t **ppJobList, char *pBuf, uint32_t bufLen)
+static void ParseResources(const struct Snapshot *s, Ucs_Xrm_ResObject_t **ppJobList, char *pBuf, uint32_t bufLen)
 {
     uint16_t i, j;
     Ucs_Xrm_ResObject_t *job;
@@ -395,12 +560,12 @@ static void ParseResources(Ucs_Xrm_ResObject_t **ppJobList, char *pBuf, uint32_t
             continue;
         for (j = 0; j < UCSI_PRINT_MAX_RESOURCES; j++)
         {
-            if (NULL == m.rList[j].element)
+            if (NULL == s->rList[j].element)
                 break;
             newState = ObjState_Unused;
-            if (job == m.rList[j].element)
+            if (job == s->rList[j].element)
             {
-                newState = m.rList[j].state;
+                newState = s->rList[j].state;
                 break;
             }
         }
@@ -468,7 +633,7 @@ static void ParseResources(Ucs_Xrm_ResObject_t **ppJobList, char *pBuf, uint32_t
     assert(strlen(pBuf) < bufLen);
 }
 
-static bool GetIgnoredNodeString(char *pBuf, uint32_t bufLen)
+static bool GetIgnoredNodeString(const struct Snapshot *s, char *pBuf, uint32_t bufLen)
 {
     uint16_t i;
     char pTmp[8];
@@ -478,10 +643,10 @@ static bool GetIgnoredNodeString(char *pBuf, uint32_t bufLen)
     /* Find existing entry */
     for (i = 0; i < UCSI_PRINT_MAX_NODES; i++)
     {
-        if (m.nList[i].isValid && NodeState_Ignored == m.nList[i].nodeState)
+        if (s->nList[i].isValid && NodeState_Ignored == s->nList[i].nodeState)
         {
             foundNodes = true;
-            snprintf(pTmp, sizeof(pTmp), "0x%X ", m.nList[i].node);
+            snprintf(pTmp, sizeof(pTmp), "0x%X ", s->nList[i].node);
             strcat(pBuf, pTmp);
         }
     }
@@ -489,15 +654,15 @@ static bool GetIgnoredNodeString(char *pBuf, uint32_t bufLen)
     return foundNodes;
 }
 
-static UCSIPrint_NodeState_t GetNodeState(uint16_t nodeAddress)
+static UCSIPrint_NodeState_t GetNodeState(const struct Snapshot *s, uint16_t nodeAddress)
 {
     uint16_t i;
     /* Find existing entry */
     for (i = 0; i < UCSI_PRINT_MAX_NODES; i++)
     {
-        if (m.nList[i].isValid && nodeAddress == m.nList[i].node)
+        if (s->nList[i].isValid && nodeAddress == s->nList[i].node)
         {
-            return m.nList[i].nodeState;
+            return s->nList[i].nodeState;
         }
     }
     return NodeState_NotAvailable;
@@ -509,35 +674,144 @@ static uint8_t GetNodeCount(void)
     uint8_t cnt = 0;
     for (i = 0; i < UCSI_PRINT_MAX_NODES; i++)
     {
-        if (m.nList[i].isValid && NodeState_NotAvailable != m.nList[i].nodeState)
+        if (m.s.nList[i].isValid && NodeState_NotAvailable != m.s.nList[i].nodeState)
             ++cnt;
     }
     return cnt;
 }
 
-static bool GetRouteState(uint16_t routeId, bool *pIsActive, uint16_t *pConLabel)
+static bool GetRouteState(const struct Snapshot *s, uint16_t routeId, bool *pIsActive, uint16_t *pConLabel)
 {
     uint16_t i;
     assert(NULL != pIsActive);
     assert(NULL != pConLabel);
     /* Find existing entry */
-    for (i = 0; i < UCSI_PRINT_MAX_RESOURCES; i++)
+    for (i = 0; i < UCSI_PRINT_MAX_ROUTES; i++)
     {
-        if (m.cList[i].isValid && routeId == m.cList[i].routeId)
+        if (s->cList[i].isValid && routeId == s->cList[i].routeId)
         {
-            *pIsActive = m.cList[i].isActive;
-            *pConLabel = m.cList[i].connectionLabel;
+            *pIsActive = s->cList[i].isActive;
+            *pConLabel = s->cList[i].connectionLabel;
             return true;
         }
     }
     return false;
 }
 
+static void MarkRow(uint16_t i)
+{
+    if (m.s.rowDirty[i])
+        return;
+    m.s.rowDirty[i] = true;
+    /* With most rows changed, the whole table is easier to read */
+    if (++m.s.dirtyCount > m.s.routesSize / 2)
+        m.s.fullDump = true;
+}
+
+static void MarkNodeRows(uint16_t nodeAddress)
+{
+    uint16_t i;
+    for (i = 0; i < m.s.routesSize; i++)
+    {
+        Ucs_Rm_Route_t *route = &m.pRoutes[i];
+        if (route->source_endpoint_ptr->node_obj_ptr->signature_ptr->node_address == nodeAddress
+            || route->sink_endpoint_ptr->node_obj_ptr->signature_ptr->node_address == nodeAddress)
+            MarkRow(i);
+    }
+}
+
+static void MarkRouteRow(uint16_t routeId)
+{
+    uint16_t i;
+    for (i = 0; i < m.s.routesSize; i++)
+    {
+        if (m.pRoutes[i].route_id == routeId)
+            MarkRow(i);
+    }
+}
+
+static void MarkElementRows(Ucs_Xrm_ResObject_t *element)
+{
+    uint16_t i;
+    for (i = 0; i < m.s.routesSize; i++)
+    {
+        Ucs_Rm_Route_t *route = &m.pRoutes[i];
+        if (ContainsJob(route->source_endpoint_ptr->jobs_list_ptr, element)
+            || ContainsJob(route->sink_endpoint_ptr->jobs_list_ptr, element))
+            MarkRow(i);
+    }
+}
+
+static bool ContainsJob(Ucs_Xrm_ResObject_t **ppJobList, Ucs_Xrm_ResObject_t *element)
+{
+    uint16_t i;
+    if (NULL == ppJobList)
+        return false;
+    for (i = 0; NULL != ppJobList[i]; i++)
+    {
+        if (element == ppJobList[i])
+            return true;
+    }
+    return false;
+}
+
+static void ClearDirtyRows(void)
+{
+    memset(m.s.rowDirty, 0, sizeof(m.s.rowDirty));
+    m.s.dirtyCount = 0;
+    m.s.fullDump = false;
+    m.s.ignoredChanged = false;
+}
+
 static void RequestTrigger(void)
 {
     m.triggerService = true;
-    UCSIPrint_CB_NeedService(m.tag);
+    UCSIPrint_CB_NeedService(m.s.tag);
+}
+
+#ifdef UCSI_PRINT_THREAD
+static void StartPrintThread(void)
+{
+    pthread_attr_t attr;
+    if (t.started)
+        return;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    t.started = (0 == pthread_create(&t.thread, &attr, PrintThread, NULL));
+    pthread_attr_destroy(&attr);
+    if (!t.started)
+        UCSIPrint_CB_OnUserMessage(m.s.tag, RED "UCSI-Watchdog:Could not start printer thread" RESETCOLOR);
+}
+
+static void WaitPrintThreadIdle(void)
+{
+    pthread_mutex_lock(&t.mutex);
+    t.pending = false;
+    while (t.busy)
+        pthread_cond_wait(&t.cond, &t.mutex);
+    pthread_mutex_unlock(&t.mutex);
+}
+
+static void *PrintThread(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&t.mutex);
+    while (true)
+    {
+        while (!t.pending)
+            pthread_cond_wait(&t.cond, &t.mutex);
+        t.work = t.next;
+        t.pending = false;
+        t.busy = true;
+        pthread_mutex_unlock(&t.mutex);
+        PrintSnapshot(&t.work);
+        pthread_mutex_lock(&t.mutex);
+        t.busy = false;
+        pthread_cond_broadcast(&t.cond);
+    }
+    return NULL;
 }
+#endif /* UCSI_PRINT_THREAD */
 #else /* ENABLE_RESOURCE_PRINT */
 void UCSIPrint_Init(Ucs_Rm_Route_t *pRoutes, uint16_t routesSize, void *tag) {}
 void UCSIPrint_Service(uint32_t timestamp) {}
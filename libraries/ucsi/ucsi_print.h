@@ -42,6 +42,11 @@ extern "C" {
 
 #define UCSI_PRINT_MAX_NODES (UCS_NUM_REMOTE_DEVICES + 1)
 #define UCSI_PRINT_MAX_RESOURCES (UCS_XRM_NUM_RESOURCES)
+#ifdef UCS_POOL_NUM_ROUTES
+#define UCSI_PRINT_MAX_ROUTES (UCS_POOL_NUM_ROUTES)
+#else
+#define UCSI_PRINT_MAX_ROUTES (UCS_XRM_NUM_RESOURCES)
+#endif
 
 typedef enum
 {
@@ -73,6 +78,9 @@ extern void UCSIPrint_CB_NeedService(void *tag);
 
 /**
  * \brief Callback when ever UNICENS_PRINT forms a human readable message.
+ * \note The first table after the network became available lists all routes, later ones only the changed routes.
+ *       A full table is printed at most every 5 seconds.
+ * \note If built with UCSI_PRINT_THREAD, this callback is called from the printer thread
  * \param tag - user pointer given along with UCSIPrint_Init
  * \param pMsg - zero terminated human readable string
  */
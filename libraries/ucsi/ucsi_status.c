@@ -0,0 +1,348 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Status Publishing module                                                               */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ucsi_cfg.h"
+#include "ucsi_status.h"
+
+#ifdef ENABLE_STATUS_SHM
+#include "StatusShm.h"
+
+struct LocalVar
+{
+    bool opened;
+    StatusShmWriter_t writer;
+    /* Same index as the resources in the segment */
+    Ucs_Xrm_ResObject_t *pResources[STATUS_SHM_MAX_RESOURCES];
+};
+
+static struct LocalVar m = { 0 };
+static bool AddEndpoint(StatusShmData_t *d, const Ucs_Rm_Route_t *route, const Ucs_Rm_EndPoint_t *ep, bool isSource);
+static StatusShmNode_t *FindNode(StatusShmData_t *d, uint16_t nodeAddress, bool add);
+static StatusShmRoute_t *FindRoute(StatusShmData_t *d, uint16_t routeId);
+static uint16_t GetNodeAddress(const Ucs_Rm_EndPoint_t *ep);
+static uint8_t GetResType(Ucs_Xrm_ResourceType_t typ);
+
+bool UCSIStatus_Open(const char *name)
+{
+    if (!m.opened)
+        m.opened = StatusShm_Create(&m.writer, (NULL != name) ? name : STATUS_SHM_NAME);
+    return m.opened;
+}
+
+void UCSIStatus_Close(void)
+{
+    if (!m.opened)
+        return;
+    StatusShm_Destroy(&m.writer);
+    m.opened = false;
+}
+
+bool UCSIStatus_Init(Ucs_Rm_Route_t *pRoutes, uint16_t routesSize, Ucs_Rm_Node_t *pNodes, uint16_t nodesSize)
+{
+    uint16_t i;
+    bool success = true;
+    StatusShmData_t *d = StatusShm_BeginWrite(&m.writer);
+    if (NULL == d)
+        return true;
+    memset(m.pResources, 0, sizeof(m.pResources));
+    d->networkAvailable = 0;
+    d->nodeCount = 0;
+    d->nodesSize = 0;
+    d->routesSize = 0;
+    d->resourcesSize = 0;
+    for (i = 0; NULL != pNodes && i < nodesSize; i++)
+    {
+        if (NULL == pNodes[i].signature_ptr)
+            continue;
+        if (NULL == FindNode(d, pNodes[i].signature_ptr->node_address, true))
+            success = false;
+    }
+    for (i = 0; NULL != pRoutes && i < routesSize; i++)
+    {
+        StatusShmRoute_t *r;
+        if (STATUS_SHM_MAX_ROUTES == d->routesSize)
+        {
+            success = false;
+            break;
+        }
+        r = &d->routes[d->routesSize++];
+        memset(r, 0, sizeof(StatusShmRoute_t));
+        r->routeId = pRoutes[i].route_id;
+        r->shallActive = (0 != pRoutes[i].active);
+        r->sourceNode = GetNodeAddress(pRoutes[i].source_endpoint_ptr);
+        r->sinkNode = GetNodeAddress(pRoutes[i].sink_endpoint_ptr);
+        if (!AddEndpoint(d, &pRoutes[i], pRoutes[i].source_endpoint_ptr, true)
+            || !AddEndpoint(d, &pRoutes[i], pRoutes[i].sink_endpoint_ptr, false))
+            success = false;
+    }
+    StatusShm_EndWrite(&m.writer);
+    return success;
+}
+
+void UCSIStatus_SetNetworkAvailable(bool available, uint8_t maxPos)
+{
+    uint16_t i;
+    StatusShmData_t *d = StatusShm_BeginWrite(&m.writer);
+    if (NULL == d)
+        return;
+    d->networkAvailable = available;
+    d->nodeCount = available ? maxPos : 0;
+    if (!available)
+    {
+        for (i = 0; i < d->nodesSize; i++)
+            d->nodes[i].state = StatusNode_NotAvailable;
+        for (i = 0; i < d->routesSize; i++)
+        {
+            d->routes[i].isBuilt = 0;
+            d->routes[i].connectionLabel = 0;
+        }
+        for (i = 0; i < d->resourcesSize; i++)
+            d->resources[i].state = StatusRes_Unused;
+    }
+    StatusShm_EndWrite(&m.writer);
+}
+
+void UCSIStatus_SetNodeState(const Ucs_Signature_t *signature, UCSIPrint_NodeState_t nodeState)
+{
+    StatusShmNode_t *n;
+    StatusShmSignature_t *s;
+    StatusShmData_t *d;
+    if (NULL == signature)
+        return;
+    d = StatusShm_BeginWrite(&m.writer);
+    if (NULL == d)
+        return;
+    n = FindNode(d, signature->node_address, true);
+    if (NULL != n)
+    {
+        if (NodeState_Available == nodeState)
+            n->state = StatusNode_Available;
+        else if (NodeState_Ignored == nodeState)
+            n->state = StatusNode_Ignored;
+        else
+            n->state = StatusNode_NotAvailable;
+        s = &n->signature;
+        s->fwBuild = signature->fw_build;
+        s->nodeAddress = signature->node_address;
+        s->groupAddress = signature->group_address;
+        s->nodePosAddr = signature->node_pos_addr;
+        s->diagnosisId = signature->diagnosis_id;
+        s->mac[0] = (uint8_t)(signature->mac_47_32 >> 8);
+        s->mac[1] = (uint8_t)(signature->mac_47_32);
+        s->mac[2] = (uint8_t)(signature->mac_31_16 >> 8);
+        s->mac[3] = (uint8_t)(signature->mac_31_16);
+        s->mac[4] = (uint8_t)(signature->mac_15_0 >> 8);
+        s->mac[5] = (uint8_t)(signature->mac_15_0);
+        s->numPorts = signature->num_ports;
+        s->chipId = signature->chip_id;
+        s->fwMajor = signature->fw_major;
+        s->fwMinor = signature->fw_minor;
+        s->fwRelease = signature->fw_release;
+        s->csMajor = signature->cs_major;
+        s->csMinor = signature->cs_minor;
+        s->csRelease = signature->cs_release;
+        n->signatureValid = 1;
+    }
+    StatusShm_EndWrite(&m.writer);
+}
+
+void UCSIStatus_SetRouteShall(uint16_t routeId, bool isActive)
+{
+    StatusShmRoute_t *r;
+    StatusShmData_t *d = StatusShm_BeginWrite(&m.writer);
+    if (NULL == d)
+        return;
+    r = FindRoute(d, routeId);
+    if (NULL != r)
+        r->shallActive = isActive;
+    StatusShm_EndWrite(&m.writer);
+}
+
+void UCSIStatus_SetRouteState(uint16_t routeId, bool isBuilt, uint16_t connectionLabel)
+{
+    StatusShmRoute_t *r;
+    StatusShmData_t *d = StatusShm_BeginWrite(&m.writer);
+    if (NULL == d)
+        return;
+    r = FindRoute(d, routeId);
+    if (NULL != r)
+    {
+        r->isBuilt = isBuilt;
+        r->connectionLabel = isBuilt ? connectionLabel : 0;
+    }
+    StatusShm_EndWrite(&m.writer);
+}
+
+void UCSIStatus_SetObjectState(Ucs_Xrm_ResObject_t *element, UCSIPrint_ObjectState_t state)
+{
+    uint16_t i;
+    StatusShmData_t *d;
+    if (NULL == element)
+        return;
+    d = StatusShm_BeginWrite(&m.writer);
+    if (NULL == d)
+        return;
+    for (i = 0; i < d->resourcesSize; i++)
+    {
+        if (element != m.pResources[i])
+            continue;
+        if (ObjState_Build == state)
+            d->resources[i].state = StatusRes_Built;
+        else if (ObjState_Failed == state)
+            d->resources[i].state = StatusRes_Failed;
+        else
+            d->resources[i].state = StatusRes_Unused;
+        break;
+    }
+    StatusShm_EndWrite(&m.writer);
+}
+
+/************************************************************************/
+/* Private Functions                                                    */
+/************************************************************************/
+
+static bool AddEndpoint(StatusShmData_t *d, const Ucs_Rm_Route_t *route, const Ucs_Rm_EndPoint_t *ep, bool isSource)
+{
+    uint16_t i, j;
+    Ucs_Xrm_ResObject_t *job;
+    if (NULL == ep || NULL == ep->jobs_list_ptr)
+        return true;
+    for (i = 0; NULL != (job = ep->jobs_list_ptr[i]); i++)
+    {
+        StatusShmResource_t *r;
+        Ucs_Xrm_ResourceType_t typ = *((Ucs_Xrm_ResourceType_t *)job);
+        /* Silently ignore default created port, same as the route table does */
+        if (UCS_XRM_RC_TYPE_DC_PORT == typ)
+            continue;
+        /* Resources shared by several routes are published once */
+        for (j = 0; j < d->resourcesSize; j++)
+        {
+            if (job == m.pResources[j])
+                break;
+        }
+        if (j != d->resourcesSize)
+            continue;
+        if (STATUS_SHM_MAX_RESOURCES == d->resourcesSize)
+            return false;
+        m.pResources[d->resourcesSize] = job;
+        r = &d->resources[d->resourcesSize++];
+        r->routeId = route->route_id;
+        r->nodeAddress = GetNodeAddress(ep);
+        r->type = GetResType(typ);
+        r->state = StatusRes_Unused;
+        r->isSource = isSource;
+        r->jobIndex = (uint8_t)i;
+    }
+    return true;
+}
+
+static StatusShmNode_t *FindNode(StatusShmData_t *d, uint16_t nodeAddress, bool add)
+{
+    uint16_t i;
+    StatusShmNode_t *n;
+    for (i = 0; i < d->nodesSize; i++)
+    {
+        if (nodeAddress == d->nodes[i].nodeAddress)
+            return &d->nodes[i];
+    }
+    if (!add || STATUS_SHM_MAX_NODES == d->nodesSize)
+        return NULL;
+    n = &d->nodes[d->nodesSize++];
+    memset(n, 0, sizeof(StatusShmNode_t));
+    n->nodeAddress = nodeAddress;
+    n->state = StatusNode_NotAvailable;
+    return n;
+}
+
+static StatusShmRoute_t *FindRoute(StatusShmData_t *d, uint16_t routeId)
+{
+    uint16_t i;
+    for (i = 0; i < d->routesSize; i++)
+    {
+        if (routeId == d->routes[i].routeId)
+            return &d->routes[i];
+    }
+    return NULL;
+}
+
+static uint16_t GetNodeAddress(const Ucs_Rm_EndPoint_t *ep)
+{
+    if (NULL == ep || NULL == ep->node_obj_ptr || NULL == ep->node_obj_ptr->signature_ptr)
+        return 0xFFFF;
+    return ep->node_obj_ptr->signature_ptr->node_address;
+}
+
+static uint8_t GetResType(Ucs_Xrm_ResourceType_t typ)
+{
+    switch(typ)
+    {
+    case UCS_XRM_RC_TYPE_NW_SOCKET:
+        return StatusResType_NetworkSocket;
+    case UCS_XRM_RC_TYPE_MLB_PORT:
+        return StatusResType_MlbPort;
+    case UCS_XRM_RC_TYPE_MLB_SOCKET:
+        return StatusResType_MlbSocket;
+    case UCS_XRM_RC_TYPE_USB_PORT:
+        return StatusResType_UsbPort;
+    case UCS_XRM_RC_TYPE_USB_SOCKET:
+        return StatusResType_UsbSocket;
+    case UCS_XRM_RC_TYPE_STRM_PORT:
+        return StatusResType_StreamPort;
+    case UCS_XRM_RC_TYPE_STRM_SOCKET:
+        return StatusResType_StreamSocket;
+    case UCS_XRM_RC_TYPE_SYNC_CON:
+        return StatusResType_SyncConnection;
+    case UCS_XRM_RC_TYPE_COMBINER:
+        return StatusResType_Combiner;
+    case UCS_XRM_RC_TYPE_SPLITTER:
+        return StatusResType_Splitter;
+    case UCS_XRM_RC_TYPE_AVP_CON:
+        return StatusResType_AvpConnection;
+    case UCS_XRM_RC_TYPE_RMCK_PORT:
+        return StatusResType_RmckPort;
+    default:
+        return StatusResType_Unknown;
+    }
+}
+
+#else /* ENABLE_STATUS_SHM */
+bool UCSIStatus_Open(const char *name) { return true; }
+void UCSIStatus_Close(void) {}
+bool UCSIStatus_Init(Ucs_Rm_Route_t *pRoutes, uint16_t routesSize, Ucs_Rm_Node_t *pNodes, uint16_t nodesSize) { return true; }
+void UCSIStatus_SetNetworkAvailable(bool available, uint8_t maxPos) {}
+void UCSIStatus_SetNodeState(const Ucs_Signature_t *signature, UCSIPrint_NodeState_t nodeState) {}
+void UCSIStatus_SetRouteShall(uint16_t routeId, bool isActive) {}
+void UCSIStatus_SetRouteState(uint16_t routeId, bool isBuilt, uint16_t connectionLabel) {}
+void UCSIStatus_SetObjectState(Ucs_Xrm_ResObject_t *element, UCSIPrint_ObjectState_t state) {}
+#endif
@@ -0,0 +1,71 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Status Publishing module                                                               */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#ifndef UCSI_STATUS_H_
+#define UCSI_STATUS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ucs_api.h"
+#include "ucsi_print.h"
+
+/**
+ * \brief Creates the shared memory status segment. Until then, all other functions of this module do nothing.
+ * \note The segment is described in StatusShm.h, use the reader functions there to access it.
+ * \note Without ENABLE_STATUS_SHM in ucsi_cfg.h, nothing is published and this function returns true.
+ * \param name - Name of the POSIX shared memory object, NULL to use the default name.
+ * \return true, if successful. false, otherwise.
+ */
+bool UCSIStatus_Open(const char *name);
+
+/**
+ * \brief Marks the daemon as not running in the status segment and unmaps it.
+ */
+void UCSIStatus_Close(void);
+
+/**
+ * \brief Publishes the nodes, routes and resources of a new configuration, all in their initial state.
+ * \return true, if successful. false, if the configuration exceeds the segment, the exceeding elements are not published.
+ */
+bool UCSIStatus_Init(Ucs_Rm_Route_t *pRoutes, uint16_t routesSize, Ucs_Rm_Node_t *pNodes, uint16_t nodesSize);
+void UCSIStatus_SetNetworkAvailable(bool available, uint8_t maxPos);
+void UCSIStatus_SetNodeState(const Ucs_Signature_t *signature, UCSIPrint_NodeState_t nodeState);
+void UCSIStatus_SetRouteShall(uint16_t routeId, bool isActive);
+void UCSIStatus_SetRouteState(uint16_t routeId, bool isBuilt, uint16_t connectionLabel);
+void UCSIStatus_SetObjectState(Ucs_Xrm_ResObject_t *element, UCSIPrint_ObjectState_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -40,6 +40,9 @@ extern "C"
 /* Includes                                                                                       */
 /*------------------------------------------------------------------------------------------------*/
 #include "ucs_types_cfg.h"
+#ifdef UCS_POOL_CFG
+#include "ucs_pool_cfg.h"
+#endif
 
 /*------------------------------------------------------------------------------------------------*/
 /* Multi Instance API                                                                             */
@@ -58,8 +61,11 @@ extern "C"
 /*------------------------------------------------------------------------------------------------*/
 /* Maximum number of remote devices used by Resources Management modules.
  * Valid range: 0..63. Default value: 0.
+ * May be sized to the configuration by ucs_pool_cfg.h, see xml2struct -pool.
  */
+#ifndef UCS_NUM_REMOTE_DEVICES
 #define UCS_NUM_REMOTE_DEVICES            63
+#endif
 
 /*------------------------------------------------------------------------------------------------*/
 /* Application Messages                                                                           */
@@ -41,19 +41,32 @@ extern "C"
 {
 #endif
 
+/*------------------------------------------------------------------------------------------------*/
+/* Includes                                                                                       */
+/*------------------------------------------------------------------------------------------------*/
+#ifdef UCS_POOL_CFG
+#include "ucs_pool_cfg.h"
+#endif
+
 /*------------------------------------------------------------------------------------------------*/
 /* Definitions                                                                                    */
 /*------------------------------------------------------------------------------------------------*/
 /* Defines the number of jobs executed by the Extended Resource Manager. Valid range: 1..254. 
  * Default value: 1.
+ * May be sized to the configuration by ucs_pool_cfg.h, see xml2struct -pool.
  */
+#ifndef UCS_XRM_NUM_JOBS
 #define UCS_XRM_NUM_JOBS             254
+#endif
 
 /* Defines the number of required resources. This value depends on the created resource objects 
  * associated with the jobs that are executed by the Extended Resource Manager. 
  * Valid range: 1..254.  Default value: 8.
+ * May be sized to the configuration by ucs_pool_cfg.h, see xml2struct -pool.
  */
+#ifndef UCS_XRM_NUM_RESOURCES
 #define UCS_XRM_NUM_RESOURCES       1024 
+#endif
 
 #ifdef __cplusplus
 }   /* extern "C" */
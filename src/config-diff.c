@@ -0,0 +1,317 @@
+/*------------------------------------------------------------------------------------------------*/
+/* Comparison of UNICENS configurations for incremental reload                                    */
+/* Copyright 2019, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "config-diff.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVATE FUNCTION PROTOTYPES                      */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static const Ucs_Rm_Route_t *FindRoute(const UcsXmlVal_t *pCfg, const Ucs_Rm_Route_t *pRoute, bool *pIdFound);
+static bool RouteEqual(const Ucs_Rm_Route_t *pA, const Ucs_Rm_Route_t *pB);
+static bool EndpointEqual(const Ucs_Rm_EndPoint_t *pA, const Ucs_Rm_EndPoint_t *pB);
+static bool ResourceEqual(const Ucs_Xrm_ResObject_t *pA, const Ucs_Xrm_ResObject_t *pB);
+static bool ConfigMsgEqual(const Ucs_Ns_ConfigMsg_t *pA, const Ucs_Ns_ConfigMsg_t *pB);
+static uint16_t GetNodeAddress(const Ucs_Rm_Node_t *pNode);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+bool ConfigDiff_Compare(const UcsXmlVal_t *pRunning, const bool *pActive, const UcsXmlVal_t *pNext, ConfigDiff_t *pDiff)
+{
+    uint16_t i;
+    if (NULL == pDiff)
+        return false;
+    memset(pDiff, 0, sizeof(ConfigDiff_t));
+    if (NULL == pRunning || NULL == pNext || (NULL == pActive && 0 != pRunning->routesSize))
+    {
+        snprintf(pDiff->restartReason, sizeof(pDiff->restartReason), "no running configuration");
+        return false;
+    }
+    if (pRunning->packetBw != pNext->packetBw || pRunning->proxyBw != pNext->proxyBw)
+    {
+        snprintf(pDiff->restartReason, sizeof(pDiff->restartReason), "bandwidth changed");
+        return false;
+    }
+    if (pRunning->nodSize != pNext->nodSize)
+    {
+        snprintf(pDiff->restartReason, sizeof(pDiff->restartReason), "node count changed");
+        return false;
+    }
+    for (i = 0; i < pNext->nodSize; i++)
+    {
+        uint16_t nodeAddress = GetNodeAddress(&pNext->pNod[i]);
+        if (NULL == ConfigDiff_FindNode(pRunning, nodeAddress))
+        {
+            snprintf(pDiff->restartReason, sizeof(pDiff->restartReason), "node 0x%X was added", nodeAddress);
+            return false;
+        }
+    }
+    for (i = 0; i < pNext->routesSize; i++)
+    {
+        bool idFound;
+        if (NULL != FindRoute(pRunning, &pNext->pRoutes[i], &idFound))
+            continue;
+        snprintf(pDiff->restartReason, sizeof(pDiff->restartReason), "route 0x%X %s",
+            pNext->pRoutes[i].route_id, idFound ? "changed its resources" : "was added");
+        return false;
+    }
+    for (i = 0; i < pRunning->routesSize; i++)
+    {
+        bool wanted = ConfigDiff_IsRouteWanted(pNext, &pRunning->pRoutes[i]);
+        if (wanted == pActive[i])
+            ++pDiff->routesUnchanged;
+        else if (wanted)
+            ++pDiff->routesToEnable;
+        else
+            ++pDiff->routesToDisable;
+    }
+    for (i = 0; i < pRunning->nodSize; i++)
+    {
+        const Ucs_Rm_Node_t *pNode = ConfigDiff_FindNode(pNext, GetNodeAddress(&pRunning->pNod[i]));
+        if (!ConfigDiff_ScriptsEqual(&pRunning->pNod[i], pNode))
+            ++pDiff->scriptsChanged;
+    }
+    return true;
+}
+
+bool ConfigDiff_IsRouteWanted(const UcsXmlVal_t *pNext, const Ucs_Rm_Route_t *pRoute)
+{
+    bool idFound;
+    const Ucs_Rm_Route_t *pMatch = FindRoute(pNext, pRoute, &idFound);
+    return (NULL != pMatch && 0 != pMatch->active);
+}
+
+Ucs_Rm_Node_t *ConfigDiff_FindNode(const UcsXmlVal_t *pCfg, uint16_t nodeAddress)
+{
+    uint16_t i;
+    if (NULL == pCfg)
+        return NULL;
+    for (i = 0; i < pCfg->nodSize; i++)
+    {
+        if (GetNodeAddress(&pCfg->pNod[i]) == nodeAddress)
+            return &pCfg->pNod[i];
+    }
+    return NULL;
+}
+
+bool ConfigDiff_ScriptsEqual(const Ucs_Rm_Node_t *pA, const Ucs_Rm_Node_t *pB)
+{
+    uint8_t i;
+    if (NULL == pA || NULL == pB)
+        return false;
+    if (pA->init_script_list_size != pB->init_script_list_size)
+        return false;
+    if (pA->init_script_list_ptr == pB->init_script_list_ptr)
+        return true;
+    for (i = 0; i < pA->init_script_list_size; i++)
+    {
+        const Ucs_Ns_Script_t *pScrA = &pA->init_script_list_ptr[i];
+        const Ucs_Ns_Script_t *pScrB = &pB->init_script_list_ptr[i];
+        if (pScrA->pause != pScrB->pause
+            || !ConfigMsgEqual(pScrA->send_cmd, pScrB->send_cmd)
+            || !ConfigMsgEqual(pScrA->exp_result, pScrB->exp_result))
+            return false;
+    }
+    return true;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static const Ucs_Rm_Route_t *FindRoute(const UcsXmlVal_t *pCfg, const Ucs_Rm_Route_t *pRoute, bool *pIdFound)
+{
+    uint16_t i;
+    *pIdFound = false;
+    for (i = 0; i < pCfg->routesSize; i++)
+    {
+        const Ucs_Rm_Route_t *pCandidate = &pCfg->pRoutes[i];
+        if (pCandidate->route_id != pRoute->route_id)
+            continue;
+        *pIdFound = true;
+        if (RouteEqual(pCandidate, pRoute))
+            return pCandidate;
+    }
+    return NULL;
+}
+
+static bool RouteEqual(const Ucs_Rm_Route_t *pA, const Ucs_Rm_Route_t *pB)
+{
+    /* The active flag is not compared, UNICENS changes it at runtime */
+    return pA->route_id == pB->route_id
+        && pA->static_connection.fallback_enabled == pB->static_connection.fallback_enabled
+        && pA->static_connection.static_con_label == pB->static_connection.static_con_label
+        && EndpointEqual(pA->source_endpoint_ptr, pB->source_endpoint_ptr)
+        && EndpointEqual(pA->sink_endpoint_ptr, pB->sink_endpoint_ptr);
+}
+
+static bool EndpointEqual(const Ucs_Rm_EndPoint_t *pA, const Ucs_Rm_EndPoint_t *pB)
+{
+    uint16_t i;
+    if (NULL == pA || NULL == pB)
+        return pA == pB;
+    if (pA->endpoint_type != pB->endpoint_type
+        || GetNodeAddress(pA->node_obj_ptr) != GetNodeAddress(pB->node_obj_ptr))
+        return false;
+    if (NULL == pA->jobs_list_ptr || NULL == pB->jobs_list_ptr)
+        return pA->jobs_list_ptr == pB->jobs_list_ptr;
+    for (i = 0; NULL != pA->jobs_list_ptr[i] || NULL != pB->jobs_list_ptr[i]; i++)
+    {
+        if (!ResourceEqual(pA->jobs_list_ptr[i], pB->jobs_list_ptr[i]))
+            return false;
+    }
+    return true;
+}
+
+static bool ResourceEqual(const Ucs_Xrm_ResObject_t *pA, const Ucs_Xrm_ResObject_t *pB)
+{
+    Ucs_Xrm_ResourceType_t typ;
+    if (NULL == pA || NULL == pB)
+        return pA == pB;
+    typ = *((const Ucs_Xrm_ResourceType_t *)pA);
+    if (typ != *((const Ucs_Xrm_ResourceType_t *)pB))
+        return false;
+    switch (typ)
+    {
+    case UCS_XRM_RC_TYPE_DC_PORT:
+    {
+        const Ucs_Xrm_DefaultCreatedPort_t *a = pA, *b = pB;
+        return a->port_type == b->port_type && a->index == b->index;
+    }
+    case UCS_XRM_RC_TYPE_NW_SOCKET:
+    {
+        const Ucs_Xrm_NetworkSocket_t *a = pA, *b = pB;
+        return a->nw_port_handle == b->nw_port_handle && a->direction == b->direction
+            && a->data_type == b->data_type && a->bandwidth == b->bandwidth;
+    }
+    case UCS_XRM_RC_TYPE_MLB_PORT:
+    {
+        const Ucs_Xrm_MlbPort_t *a = pA, *b = pB;
+        return a->index == b->index && a->clock_config == b->clock_config;
+    }
+    case UCS_XRM_RC_TYPE_MLB_SOCKET:
+    {
+        const Ucs_Xrm_MlbSocket_t *a = pA, *b = pB;
+        return a->direction == b->direction && a->data_type == b->data_type
+            && a->bandwidth == b->bandwidth && a->channel_address == b->channel_address
+            && ResourceEqual(a->mlb_port_obj_ptr, b->mlb_port_obj_ptr);
+    }
+    case UCS_XRM_RC_TYPE_USB_PORT:
+    {
+        const Ucs_Xrm_UsbPort_t *a = pA, *b = pB;
+        return a->index == b->index && a->physical_layer == b->physical_layer
+            && a->devices_interfaces == b->devices_interfaces
+            && a->streaming_if_ep_out_count == b->streaming_if_ep_out_count
+            && a->streaming_if_ep_in_count == b->streaming_if_ep_in_count;
+    }
+    case UCS_XRM_RC_TYPE_USB_SOCKET:
+    {
+        const Ucs_Xrm_UsbSocket_t *a = pA, *b = pB;
+        return a->direction == b->direction && a->data_type == b->data_type
+            && a->end_point_addr == b->end_point_addr && a->frames_per_transfer == b->frames_per_transfer
+            && ResourceEqual(a->usb_port_obj_ptr, b->usb_port_obj_ptr);
+    }
+    case UCS_XRM_RC_TYPE_STRM_PORT:
+    {
+        const Ucs_Xrm_StrmPort_t *a = pA, *b = pB;
+        return a->index == b->index && a->clock_config == b->clock_config
+            && a->data_alignment == b->data_alignment;
+    }
+    case UCS_XRM_RC_TYPE_STRM_SOCKET:
+    {
+        const Ucs_Xrm_StrmSocket_t *a = pA, *b = pB;
+        return a->direction == b->direction && a->data_type == b->data_type
+            && a->bandwidth == b->bandwidth && a->stream_pin_id == b->stream_pin_id
+            && ResourceEqual(a->stream_port_obj_ptr, b->stream_port_obj_ptr);
+    }
+    case UCS_XRM_RC_TYPE_RMCK_PORT:
+    {
+        const Ucs_Xrm_RmckPort_t *a = pA, *b = pB;
+        return a->index == b->index && a->clock_source == b->clock_source && a->divisor == b->divisor;
+    }
+    case UCS_XRM_RC_TYPE_SYNC_CON:
+    {
+        const Ucs_Xrm_SyncCon_t *a = pA, *b = pB;
+        return a->mute_mode == b->mute_mode && a->offset == b->offset
+            && ResourceEqual(a->socket_in_obj_ptr, b->socket_in_obj_ptr)
+            && ResourceEqual(a->socket_out_obj_ptr, b->socket_out_obj_ptr);
+    }
+    case UCS_XRM_RC_TYPE_AVP_CON:
+    {
+        const Ucs_Xrm_AvpCon_t *a = pA, *b = pB;
+        return a->isoc_packet_size == b->isoc_packet_size
+            && ResourceEqual(a->socket_in_obj_ptr, b->socket_in_obj_ptr)
+            && ResourceEqual(a->socket_out_obj_ptr, b->socket_out_obj_ptr);
+    }
+    case UCS_XRM_RC_TYPE_COMBINER:
+    {
+        const Ucs_Xrm_Combiner_t *a = pA, *b = pB;
+        return a->nw_port_handle == b->nw_port_handle && a->bytes_per_frame == b->bytes_per_frame
+            && ResourceEqual(a->port_socket_obj_ptr, b->port_socket_obj_ptr);
+    }
+    case UCS_XRM_RC_TYPE_SPLITTER:
+    {
+        const Ucs_Xrm_Splitter_t *a = pA, *b = pB;
+        return a->nw_port_handle == b->nw_port_handle && a->bytes_per_frame == b->bytes_per_frame
+            && ResourceEqual(a->socket_in_obj_ptr, b->socket_in_obj_ptr);
+    }
+    default:
+        /* Unknown resources are never treated as equal, this forces a full restart */
+        return false;
+    }
+}
+
+static bool ConfigMsgEqual(const Ucs_Ns_ConfigMsg_t *pA, const Ucs_Ns_ConfigMsg_t *pB)
+{
+    if (NULL == pA || NULL == pB)
+        return pA == pB;
+    if (pA->fblock_id != pB->fblock_id || pA->inst_id != pB->inst_id
+        || pA->funct_id != pB->funct_id || pA->op_type != pB->op_type
+        || pA->data_size != pB->data_size)
+        return false;
+    if (0 == pA->data_size)
+        return true;
+    if (NULL == pA->data_ptr || NULL == pB->data_ptr)
+        return pA->data_ptr == pB->data_ptr;
+    return 0 == memcmp(pA->data_ptr, pB->data_ptr, pA->data_size);
+}
+
+static uint16_t GetNodeAddress(const Ucs_Rm_Node_t *pNode)
+{
+    if (NULL == pNode || NULL == pNode->signature_ptr)
+        return 0xFFFF;
+    return pNode->signature_ptr->node_address;
+}
@@ -0,0 +1,99 @@
+/*------------------------------------------------------------------------------------------------*/
+/* Comparison of UNICENS configurations for incremental reload                                    */
+/* Copyright 2019, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#ifndef CONFIG_DIFF_H_
+#define CONFIG_DIFF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "UcsXml.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            Public API                                */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+typedef struct
+{
+    /** Zero terminated reason, why a full restart is needed. Empty, if the new configuration can be applied incrementally */
+    char restartReason[80];
+    /** Amount of running routes, which are not part of the new configuration anymore (or became inactive) */
+    uint16_t routesToDisable;
+    /** Amount of running routes, which shall become active with the new configuration */
+    uint16_t routesToEnable;
+    /** Amount of running routes, which stay as they are */
+    uint16_t routesUnchanged;
+    /** Amount of nodes, which got a different script */
+    uint16_t scriptsChanged;
+} ConfigDiff_t;
+
+/**
+ * \brief Compares the running configuration with a newly parsed one
+ * \note UNICENS keeps the route and node list of the running configuration, routes can only be
+ *       switched on and off, but not added or rebuilt. New routes, routes with changed resources,
+ *       different nodes and bandwidth changes need a full restart.
+ * \param pRunning - The configuration passed to UCSI_NewConfig
+ * \param pActive - Array with routesSize entries of pRunning, true for every route, which is active now
+ * \param pNext - The newly parsed configuration
+ * \param pDiff - Will be filled with the result
+ * \return true, if the new configuration can be applied by only switching routes and running scripts. false, if a full restart is needed
+ */
+bool ConfigDiff_Compare(const UcsXmlVal_t *pRunning, const bool *pActive, const UcsXmlVal_t *pNext, ConfigDiff_t *pDiff);
+
+/**
+ * \brief Checks, if the given route of the running configuration shall be active with the new configuration
+ * \param pNext - The newly parsed configuration
+ * \param pRoute - A route of the running configuration
+ * \return true, if pNext contains an active route with the same id and the same resources
+ */
+bool ConfigDiff_IsRouteWanted(const UcsXmlVal_t *pNext, const Ucs_Rm_Route_t *pRoute);
+
+/**
+ * \brief Searches a node by its address
+ * \param pCfg - The configuration to search in
+ * \param nodeAddress - The node address of the signature
+ * \return The node or NULL, if not found
+ */
+Ucs_Rm_Node_t *ConfigDiff_FindNode(const UcsXmlVal_t *pCfg, uint16_t nodeAddress);
+
+/**
+ * \brief Compares the initialization scripts of two nodes
+ * \return true, if both nodes would send the same messages
+ */
+bool ConfigDiff_ScriptsEqual(const Ucs_Rm_Node_t *pA, const Ucs_Rm_Node_t *pB);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_DIFF_H_ */
@@ -0,0 +1,148 @@
+/*------------------------------------------------------------------------------------------------*/
+/* Selection of precompiled UNICENS configurations                                                */
+/* Copyright 2019, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "config-registry.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVATE FUNCTION PROTOTYPES                      */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static bool ContainsNode(const Ucs_Rm_Node_t *pNodes, uint16_t nodesSize, uint16_t nodeAddress);
+static uint16_t GetNodeAddress(const Ucs_Rm_Node_t *pNode);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+const DefaultConfig_t *ConfigRegistry_Find(const char *name)
+{
+    uint16_t i;
+    if (0 == DefaultConfigsSize)
+        return NULL;
+    if (NULL == name)
+        return &DefaultConfigs[0];
+    for (i = 0; i < DefaultConfigsSize; i++)
+    {
+        if (0 == strcmp(DefaultConfigs[i].name, name))
+            return &DefaultConfigs[i];
+    }
+    return NULL;
+}
+
+bool ConfigRegistry_CreateDiscovery(Ucs_Rm_Node_t **ppNodes, uint16_t *pNodesSize)
+{
+    uint16_t i, j, total = 0, used = 0;
+    Ucs_Rm_Node_t *pNodes;
+    Ucs_Signature_t *pSignatures;
+    if (NULL == ppNodes || NULL == pNodesSize)
+        return false;
+    for (i = 0; i < DefaultConfigsSize; i++)
+        total += DefaultConfigs[i].nodesSize;
+    if (0 == total)
+        return false;
+    /* Nodes and their signatures share one allocation */
+    pNodes = calloc(total, sizeof(Ucs_Rm_Node_t) + sizeof(Ucs_Signature_t));
+    if (NULL == pNodes)
+        return false;
+    pSignatures = (Ucs_Signature_t *)&pNodes[total];
+    for (i = 0; i < DefaultConfigsSize; i++)
+    {
+        for (j = 0; j < DefaultConfigs[i].nodesSize; j++)
+        {
+            uint16_t nodeAddress = GetNodeAddress(&DefaultConfigs[i].pNodes[j]);
+            if (0 == nodeAddress || ContainsNode(pNodes, used, nodeAddress))
+                continue;
+            pSignatures[used].node_address = nodeAddress;
+            pNodes[used].signature_ptr = &pSignatures[used];
+            ++used;
+        }
+    }
+    *ppNodes = pNodes;
+    *pNodesSize = used;
+    return true;
+}
+
+void ConfigRegistry_FreeDiscovery(Ucs_Rm_Node_t *pNodes)
+{
+    free(pNodes);
+}
+
+const DefaultConfig_t *ConfigRegistry_Match(const uint16_t *pNodeAddrs, uint16_t nodeAddrsSize)
+{
+    uint16_t i, j;
+    const DefaultConfig_t *best = NULL;
+    uint16_t bestKnown = 0, bestMissing = 0;
+    for (i = 0; i < DefaultConfigsSize; i++)
+    {
+        const DefaultConfig_t *cfg = &DefaultConfigs[i];
+        uint16_t known = 0;
+        uint16_t missing;
+        for (j = 0; j < nodeAddrsSize; j++)
+        {
+            if (ContainsNode(cfg->pNodes, cfg->nodesSize, pNodeAddrs[j]))
+                ++known;
+        }
+        /* Found addresses are unique, so every known one is a node of cfg */
+        missing = cfg->nodesSize - known;
+        if (NULL == best || known > bestKnown || (known == bestKnown && missing < bestMissing))
+        {
+            best = cfg;
+            bestKnown = known;
+            bestMissing = missing;
+        }
+    }
+    return best;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static bool ContainsNode(const Ucs_Rm_Node_t *pNodes, uint16_t nodesSize, uint16_t nodeAddress)
+{
+    uint16_t i;
+    for (i = 0; i < nodesSize; i++)
+    {
+        if (GetNodeAddress(&pNodes[i]) == nodeAddress)
+            return true;
+    }
+    return false;
+}
+
+static uint16_t GetNodeAddress(const Ucs_Rm_Node_t *pNode)
+{
+    if (NULL == pNode || NULL == pNode->signature_ptr)
+        return 0;
+    return pNode->signature_ptr->node_address;
+}
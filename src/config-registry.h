@@ -0,0 +1,84 @@
+/*------------------------------------------------------------------------------------------------*/
+/* Selection of precompiled UNICENS configurations                                                */
+/* Copyright 2019, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#ifndef CONFIG_REGISTRY_H_
+#define CONFIG_REGISTRY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "default_config.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                            Public API                                */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/**
+ * \brief Searches a configuration of the DefaultConfigs table, written by "xml2struct -registry"
+ * \param name - Name of the configuration, NULL for the first one
+ * \return The configuration or NULL, if not found
+ */
+const DefaultConfig_t *ConfigRegistry_Find(const char *name);
+
+/**
+ * \brief Creates a node list containing every node address of all configurations without any script.
+ *        Started with this list, UNICENS reports all nodes found in the network, so the matching
+ *        configuration can be chosen before any resource is built or any script is executed.
+ * \param ppNodes - Will point to the allocated list, which must be released with ConfigRegistry_FreeDiscovery
+ * \param pNodesSize - Will hold the amount of nodes in the list
+ * \return true, if the list was created
+ */
+bool ConfigRegistry_CreateDiscovery(Ucs_Rm_Node_t **ppNodes, uint16_t *pNodesSize);
+
+/**
+ * \brief Releases a list created by ConfigRegistry_CreateDiscovery
+ * \note UNICENS must not use the list anymore
+ */
+void ConfigRegistry_FreeDiscovery(Ucs_Rm_Node_t *pNodes);
+
+/**
+ * \brief Chooses the configuration fitting best to the nodes found in the network
+ * \note A configuration containing all found nodes wins, the one with the fewest missing nodes first.
+ *       If none contains all found nodes, the one knowing most of them is taken.
+ *       On equal results, the configuration listed first wins.
+ * \param pNodeAddrs - Node addresses of the found nodes
+ * \param nodeAddrsSize - Amount of found nodes
+ * \return The best configuration or NULL, if the table is empty
+ */
+const DefaultConfig_t *ConfigRegistry_Match(const uint16_t *pNodeAddrs, uint16_t nodeAddrsSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_REGISTRY_H_ */
@@ -1,846 +1,848 @@
 /*------------------------------------------------------------------------------------------------*/
 /* UNICENS Generated Network Configuration                                                        */
-/* Generator: xml2struct for Linux V5.1.0                                                         */
+/* Generator: xml2struct for Linux V5.2.1                                                         */
 /*------------------------------------------------------------------------------------------------*/
 #include "ucs_api.h"
+#include "default_config.h"
 
-uint16_t PacketBandwidth = 80;
-uint16_t ProxyBandwidth = 0;
-uint16_t RoutesSize = 12;
-uint16_t NodeSize = 5;
+/* Configuration 'audio_kit' */
+uint16_t audio_kit_PacketBandwidth = 80;
+uint16_t audio_kit_ProxyBandwidth = 0;
+uint16_t audio_kit_RoutesSize = 12;
+uint16_t audio_kit_NodeSize = 5;
 
 /* Route 1 from source-node=0x200 to sink-node=0x200 */
-Ucs_Xrm_DefaultCreatedPort_t SrcOfRoute1_DcPort0 = { 
+const Ucs_Xrm_DefaultCreatedPort_t audio_kit_SrcOfRoute1_DcPort0 = { 
     .resource_type = UCS_XRM_RC_TYPE_DC_PORT,
     .port_type = UCS_XRM_PORT_TYPE_USB,
     .index = 0 };
-Ucs_Xrm_UsbSocket_t SrcOfRoute1_UsbSocket0 = { 
+const Ucs_Xrm_UsbSocket_t audio_kit_SrcOfRoute1_UsbSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
-    .usb_port_obj_ptr = &SrcOfRoute1_DcPort0,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_DcPort0,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_USB_SCKT_SYNC_DATA,
     .end_point_addr = 0x01,
     .frames_per_transfer = 128 };
-Ucs_Xrm_NetworkSocket_t SrcOfRoute1_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SrcOfRoute1_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_SyncCon_t SrcOfRoute1_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SrcOfRoute1_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SrcOfRoute1_UsbSocket0,
-    .socket_out_obj_ptr = &SrcOfRoute1_NetworkSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_UsbSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_NetworkSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SrcOfRoute1_JobList0[] = {
-    &SrcOfRoute1_DcPort0,
-    &SrcOfRoute1_UsbSocket0,
-    &SrcOfRoute1_NetworkSocket0,
-    &SrcOfRoute1_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SrcOfRoute1_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_SyncCon0,
     NULL };
-Ucs_Xrm_NetworkSocket_t SnkOfRoute1_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute1_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_UsbSocket_t SnkOfRoute1_UsbSocket0 = { 
+const Ucs_Xrm_UsbSocket_t audio_kit_SnkOfRoute1_UsbSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
-    .usb_port_obj_ptr = &SrcOfRoute1_DcPort0,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_DcPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_USB_SCKT_SYNC_DATA,
     .end_point_addr = 0x81,
     .frames_per_transfer = 128 };
-Ucs_Xrm_SyncCon_t SnkOfRoute1_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute1_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute1_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute1_UsbSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute1_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute1_UsbSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute1_JobList0[] = {
-    &SnkOfRoute1_NetworkSocket0,
-    &SrcOfRoute1_DcPort0,
-    &SnkOfRoute1_UsbSocket0,
-    &SnkOfRoute1_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute1_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute1_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute1_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute1_SyncCon0,
     NULL };
 /* Route 2 from source-node=0x200 to sink-node=0x2B0 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute2_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute2_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_DefaultCreatedPort_t SnkOfRoute2_DcPort0 = { 
+const Ucs_Xrm_DefaultCreatedPort_t audio_kit_SnkOfRoute2_DcPort0 = { 
     .resource_type = UCS_XRM_RC_TYPE_DC_PORT,
     .port_type = UCS_XRM_PORT_TYPE_USB,
     .index = 0 };
-Ucs_Xrm_UsbSocket_t SnkOfRoute2_UsbSocket0 = { 
+const Ucs_Xrm_UsbSocket_t audio_kit_SnkOfRoute2_UsbSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
-    .usb_port_obj_ptr = &SnkOfRoute2_DcPort0,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_DcPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_USB_SCKT_SYNC_DATA,
     .end_point_addr = 0x81,
     .frames_per_transfer = 128 };
-Ucs_Xrm_SyncCon_t SnkOfRoute2_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute2_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute2_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute2_UsbSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_UsbSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute2_JobList0[] = {
-    &SnkOfRoute2_NetworkSocket0,
-    &SnkOfRoute2_DcPort0,
-    &SnkOfRoute2_UsbSocket0,
-    &SnkOfRoute2_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute2_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_SyncCon0,
     NULL };
 /* Route 3 from source-node=0x200 to sink-node=0x240 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute3_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute3_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_StrmPort_t SnkOfRoute3_StrmPort0 = { 
+const Ucs_Xrm_StrmPort_t audio_kit_SnkOfRoute3_StrmPort0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
     .index = 0,
     .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
     .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
-Ucs_Xrm_StrmPort_t SnkOfRoute3_StrmPort1 = { 
+const Ucs_Xrm_StrmPort_t audio_kit_SnkOfRoute3_StrmPort1 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
     .index = 1,
     .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
     .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
-Ucs_Xrm_StrmSocket_t SnkOfRoute3_StrmSocket0 = { 
+const Ucs_Xrm_StrmSocket_t audio_kit_SnkOfRoute3_StrmSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
-    .stream_port_obj_ptr = &SnkOfRoute3_StrmPort0,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
     .bandwidth = 4,
     .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA1 };
-Ucs_Xrm_SyncCon_t SnkOfRoute3_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute3_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute3_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute3_StrmSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute3_JobList0[] = {
-    &SnkOfRoute3_NetworkSocket0,
-    &SnkOfRoute3_StrmPort0,
-    &SnkOfRoute3_StrmPort1,
-    &SnkOfRoute3_StrmSocket0,
-    &SnkOfRoute3_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute3_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_SyncCon0,
     NULL };
 /* Route 4 from source-node=0x200 to sink-node=0x270 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute4_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute4_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_StrmPort_t SnkOfRoute4_StrmPort0 = { 
+const Ucs_Xrm_StrmPort_t audio_kit_SnkOfRoute4_StrmPort0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
     .index = 0,
     .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
     .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
-Ucs_Xrm_StrmPort_t SnkOfRoute4_StrmPort1 = { 
+const Ucs_Xrm_StrmPort_t audio_kit_SnkOfRoute4_StrmPort1 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
     .index = 1,
     .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
     .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
-Ucs_Xrm_StrmSocket_t SnkOfRoute4_StrmSocket0 = { 
+const Ucs_Xrm_StrmSocket_t audio_kit_SnkOfRoute4_StrmSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
-    .stream_port_obj_ptr = &SnkOfRoute4_StrmPort0,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
     .bandwidth = 4,
     .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
-Ucs_Xrm_SyncCon_t SnkOfRoute4_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute4_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute4_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute4_StrmSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute4_JobList0[] = {
-    &SnkOfRoute4_NetworkSocket0,
-    &SnkOfRoute4_StrmPort0,
-    &SnkOfRoute4_StrmPort1,
-    &SnkOfRoute4_StrmSocket0,
-    &SnkOfRoute4_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute4_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_SyncCon0,
     NULL };
 /* Route 5 from source-node=0x210 to sink-node=0x200 */
-Ucs_Xrm_StrmPort_t SrcOfRoute5_StrmPort0 = { 
+const Ucs_Xrm_StrmPort_t audio_kit_SrcOfRoute5_StrmPort0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
     .index = 0,
     .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
     .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
-Ucs_Xrm_StrmPort_t SrcOfRoute5_StrmPort1 = { 
+const Ucs_Xrm_StrmPort_t audio_kit_SrcOfRoute5_StrmPort1 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
     .index = 1,
     .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
     .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
-Ucs_Xrm_StrmSocket_t SrcOfRoute5_StrmSocket0 = { 
+const Ucs_Xrm_StrmSocket_t audio_kit_SrcOfRoute5_StrmSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
-    .stream_port_obj_ptr = &SrcOfRoute5_StrmPort0,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute5_StrmPort0,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
     .bandwidth = 4,
     .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
-Ucs_Xrm_NetworkSocket_t SrcOfRoute5_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SrcOfRoute5_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_SyncCon_t SrcOfRoute5_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SrcOfRoute5_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SrcOfRoute5_StrmSocket0,
-    .socket_out_obj_ptr = &SrcOfRoute5_NetworkSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute5_StrmSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute5_NetworkSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SrcOfRoute5_JobList0[] = {
-    &SrcOfRoute5_StrmPort0,
-    &SrcOfRoute5_StrmPort1,
-    &SrcOfRoute5_StrmSocket0,
-    &SrcOfRoute5_NetworkSocket0,
-    &SrcOfRoute5_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SrcOfRoute5_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute5_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute5_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute5_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute5_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute5_SyncCon0,
     NULL };
-Ucs_Xrm_NetworkSocket_t SnkOfRoute5_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute5_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_UsbSocket_t SnkOfRoute5_UsbSocket0 = { 
+const Ucs_Xrm_UsbSocket_t audio_kit_SnkOfRoute5_UsbSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
-    .usb_port_obj_ptr = &SrcOfRoute1_DcPort0,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_DcPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_USB_SCKT_SYNC_DATA,
     .end_point_addr = 0x82,
     .frames_per_transfer = 128 };
-Ucs_Xrm_SyncCon_t SnkOfRoute5_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute5_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute5_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute5_UsbSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute5_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute5_UsbSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute5_JobList0[] = {
-    &SnkOfRoute5_NetworkSocket0,
-    &SrcOfRoute1_DcPort0,
-    &SnkOfRoute5_UsbSocket0,
-    &SnkOfRoute5_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute5_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute5_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute5_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute5_SyncCon0,
     NULL };
 /* Route 6 from source-node=0x210 to sink-node=0x2B0 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute6_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute6_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_UsbSocket_t SnkOfRoute6_UsbSocket0 = { 
+const Ucs_Xrm_UsbSocket_t audio_kit_SnkOfRoute6_UsbSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
-    .usb_port_obj_ptr = &SnkOfRoute2_DcPort0,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_DcPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_USB_SCKT_SYNC_DATA,
     .end_point_addr = 0x82,
     .frames_per_transfer = 128 };
-Ucs_Xrm_SyncCon_t SnkOfRoute6_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute6_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute6_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute6_UsbSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute6_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute6_UsbSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute6_JobList0[] = {
-    &SnkOfRoute6_NetworkSocket0,
-    &SnkOfRoute2_DcPort0,
-    &SnkOfRoute6_UsbSocket0,
-    &SnkOfRoute6_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute6_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute6_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute6_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute6_SyncCon0,
     NULL };
 /* Route 7 from source-node=0x210 to sink-node=0x240 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute7_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute7_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_StrmSocket_t SnkOfRoute7_StrmSocket0 = { 
+const Ucs_Xrm_StrmSocket_t audio_kit_SnkOfRoute7_StrmSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
-    .stream_port_obj_ptr = &SnkOfRoute3_StrmPort0,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
     .bandwidth = 4,
     .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA1 };
-Ucs_Xrm_SyncCon_t SnkOfRoute7_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute7_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute7_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute7_StrmSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute7_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute7_StrmSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute7_JobList0[] = {
-    &SnkOfRoute7_NetworkSocket0,
-    &SnkOfRoute3_StrmPort0,
-    &SnkOfRoute3_StrmPort1,
-    &SnkOfRoute7_StrmSocket0,
-    &SnkOfRoute7_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute7_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute7_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute7_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute7_SyncCon0,
     NULL };
 /* Route 8 from source-node=0x210 to sink-node=0x270 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute8_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute8_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_StrmSocket_t SnkOfRoute8_StrmSocket0 = { 
+const Ucs_Xrm_StrmSocket_t audio_kit_SnkOfRoute8_StrmSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
-    .stream_port_obj_ptr = &SnkOfRoute4_StrmPort0,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
     .bandwidth = 4,
     .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
-Ucs_Xrm_SyncCon_t SnkOfRoute8_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute8_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute8_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute8_StrmSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute8_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute8_StrmSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute8_JobList0[] = {
-    &SnkOfRoute8_NetworkSocket0,
-    &SnkOfRoute4_StrmPort0,
-    &SnkOfRoute4_StrmPort1,
-    &SnkOfRoute8_StrmSocket0,
-    &SnkOfRoute8_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute8_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute8_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute8_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute8_SyncCon0,
     NULL };
 /* Route 9 from source-node=0x240 to sink-node=0x200 */
-Ucs_Xrm_StrmSocket_t SrcOfRoute9_StrmSocket0 = { 
+const Ucs_Xrm_StrmSocket_t audio_kit_SrcOfRoute9_StrmSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
-    .stream_port_obj_ptr = &SnkOfRoute3_StrmPort0,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort0,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
     .bandwidth = 4,
     .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
-Ucs_Xrm_NetworkSocket_t SrcOfRoute9_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SrcOfRoute9_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_SyncCon_t SrcOfRoute9_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SrcOfRoute9_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SrcOfRoute9_StrmSocket0,
-    .socket_out_obj_ptr = &SrcOfRoute9_NetworkSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute9_StrmSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute9_NetworkSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SrcOfRoute9_JobList0[] = {
-    &SnkOfRoute3_StrmPort0,
-    &SnkOfRoute3_StrmPort1,
-    &SrcOfRoute9_StrmSocket0,
-    &SrcOfRoute9_NetworkSocket0,
-    &SrcOfRoute9_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SrcOfRoute9_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute9_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute9_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute9_SyncCon0,
     NULL };
-Ucs_Xrm_NetworkSocket_t SnkOfRoute9_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute9_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_UsbSocket_t SnkOfRoute9_UsbSocket0 = { 
+const Ucs_Xrm_UsbSocket_t audio_kit_SnkOfRoute9_UsbSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
-    .usb_port_obj_ptr = &SrcOfRoute1_DcPort0,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_DcPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_USB_SCKT_SYNC_DATA,
     .end_point_addr = 0x83,
     .frames_per_transfer = 128 };
-Ucs_Xrm_SyncCon_t SnkOfRoute9_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute9_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute9_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute9_UsbSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute9_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute9_UsbSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute9_JobList0[] = {
-    &SnkOfRoute9_NetworkSocket0,
-    &SrcOfRoute1_DcPort0,
-    &SnkOfRoute9_UsbSocket0,
-    &SnkOfRoute9_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute9_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute9_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SrcOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute9_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute9_SyncCon0,
     NULL };
 /* Route 10 from source-node=0x240 to sink-node=0x2B0 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute10_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute10_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_UsbSocket_t SnkOfRoute10_UsbSocket0 = { 
+const Ucs_Xrm_UsbSocket_t audio_kit_SnkOfRoute10_UsbSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
-    .usb_port_obj_ptr = &SnkOfRoute2_DcPort0,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_DcPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_USB_SCKT_SYNC_DATA,
     .end_point_addr = 0x83,
     .frames_per_transfer = 128 };
-Ucs_Xrm_SyncCon_t SnkOfRoute10_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute10_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute10_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute10_UsbSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute10_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute10_UsbSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute10_JobList0[] = {
-    &SnkOfRoute10_NetworkSocket0,
-    &SnkOfRoute2_DcPort0,
-    &SnkOfRoute10_UsbSocket0,
-    &SnkOfRoute10_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute10_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute10_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute2_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute10_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute10_SyncCon0,
     NULL };
 /* Route 11 from source-node=0x240 to sink-node=0x240 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute11_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute11_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_StrmSocket_t SnkOfRoute11_StrmSocket0 = { 
+const Ucs_Xrm_StrmSocket_t audio_kit_SnkOfRoute11_StrmSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
-    .stream_port_obj_ptr = &SnkOfRoute3_StrmPort0,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
     .bandwidth = 4,
     .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA1 };
-Ucs_Xrm_SyncCon_t SnkOfRoute11_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute11_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute11_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute11_StrmSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute11_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute11_StrmSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute11_JobList0[] = {
-    &SnkOfRoute11_NetworkSocket0,
-    &SnkOfRoute3_StrmPort0,
-    &SnkOfRoute3_StrmPort1,
-    &SnkOfRoute11_StrmSocket0,
-    &SnkOfRoute11_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute11_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute11_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute3_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute11_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute11_SyncCon0,
     NULL };
 /* Route 12 from source-node=0x240 to sink-node=0x270 */
-Ucs_Xrm_NetworkSocket_t SnkOfRoute12_NetworkSocket0 = { 
+const Ucs_Xrm_NetworkSocket_t audio_kit_SnkOfRoute12_NetworkSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
     .nw_port_handle = 0x0D00,
     .direction = UCS_SOCKET_DIR_INPUT,
     .data_type = UCS_NW_SCKT_SYNC_DATA,
     .bandwidth = 4 };
-Ucs_Xrm_StrmSocket_t SnkOfRoute12_StrmSocket0 = { 
+const Ucs_Xrm_StrmSocket_t audio_kit_SnkOfRoute12_StrmSocket0 = { 
     .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
-    .stream_port_obj_ptr = &SnkOfRoute4_StrmPort0,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort0,
     .direction = UCS_SOCKET_DIR_OUTPUT,
     .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
     .bandwidth = 4,
     .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
-Ucs_Xrm_SyncCon_t SnkOfRoute12_SyncCon0 = { 
+const Ucs_Xrm_SyncCon_t audio_kit_SnkOfRoute12_SyncCon0 = { 
     .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
-    .socket_in_obj_ptr = &SnkOfRoute12_NetworkSocket0,
-    .socket_out_obj_ptr = &SnkOfRoute12_StrmSocket0,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute12_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute12_StrmSocket0,
     .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
     .offset = 0 };
-Ucs_Xrm_ResObject_t *SnkOfRoute12_JobList0[] = {
-    &SnkOfRoute12_NetworkSocket0,
-    &SnkOfRoute4_StrmPort0,
-    &SnkOfRoute4_StrmPort1,
-    &SnkOfRoute12_StrmSocket0,
-    &SnkOfRoute12_SyncCon0,
+Ucs_Xrm_ResObject_t *const audio_kit_SnkOfRoute12_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute12_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute4_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute12_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&audio_kit_SnkOfRoute12_SyncCon0,
     NULL };
-UCS_NS_CONST uint8_t PayloadRequest1ForNode240[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request1ForNode240[] = {
     0x00, 0x00, 0x01, 0x01 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request1ForNode240 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request1ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C1,
     .op_type = 0x02,
     .data_size = 0x04,
-    .data_ptr = PayloadRequest1ForNode240 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response1ForNode240 = {
+    .data_ptr = Payloadaudio_kit_Request1ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response1ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C1,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest2ForNode240[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request2ForNode240[] = {
     0x0F, 0x00, 0x02, 0x0A, 0x18, 0x03, 0x00, 0x64, 0x00, 0x0F, 0x02, 0x01, 0x00, 0x00, 0x02, 0xA5, 0xDF, 0x03, 0x3F, 0x3F, 0x04, 0x02, 0x02, 0x10, 0x50, 0x50, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x13, 0x00, 0x00, 0x14, 0x00, 0x00 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request2ForNode240 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request2ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x26,
-    .data_ptr = PayloadRequest2ForNode240 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response2ForNode240 = {
+    .data_ptr = Payloadaudio_kit_Request2ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response2ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest3ForNode240[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request3ForNode240[] = {
     0x0F, 0x00, 0x02, 0x04, 0x18, 0x03, 0x00, 0x64, 0x20, 0x00, 0x00, 0x21, 0x00, 0x00, 0x22, 0x00, 0x00, 0x23, 0x00, 0x00 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request3ForNode240 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request3ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x14,
-    .data_ptr = PayloadRequest3ForNode240 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response3ForNode240 = {
+    .data_ptr = Payloadaudio_kit_Request3ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response3ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest4ForNode240[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request4ForNode240[] = {
     0x00, 0x00, 0x14 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request4ForNode240 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request4ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x0701,
     .op_type = 0x02,
     .data_size = 0x03,
-    .data_ptr = PayloadRequest4ForNode240 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response4ForNode240 = {
+    .data_ptr = Payloadaudio_kit_Request4ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response4ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x0701,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest5ForNode240[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request5ForNode240[] = {
     0x1D, 0x00, 0x03, 0x35, 0x04, 0x35, 0x05, 0x35, 0x06, 0x35, 0x07, 0x41, 0x08, 0x40 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request5ForNode240 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request5ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x0703,
     .op_type = 0x02,
     .data_size = 0x0E,
-    .data_ptr = PayloadRequest5ForNode240 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response5ForNode240 = {
+    .data_ptr = Payloadaudio_kit_Request5ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response5ForNode240 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x0703,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST Ucs_Ns_Script_t ScriptsForNode240[] = {
+UCS_NS_CONST Ucs_Ns_Script_t audio_kit_ScriptsForNode240[] = {
     {
         .pause = 0,
-        .send_cmd = &Request1ForNode240,
-        .exp_result = &Response1ForNode240
+        .send_cmd = &audio_kit_Request1ForNode240,
+        .exp_result = &audio_kit_Response1ForNode240
     }, {
         .pause = 0,
-        .send_cmd = &Request2ForNode240,
-        .exp_result = &Response2ForNode240
+        .send_cmd = &audio_kit_Request2ForNode240,
+        .exp_result = &audio_kit_Response2ForNode240
     }, {
         .pause = 0,
-        .send_cmd = &Request3ForNode240,
-        .exp_result = &Response3ForNode240
+        .send_cmd = &audio_kit_Request3ForNode240,
+        .exp_result = &audio_kit_Response3ForNode240
     }, {
         .pause = 0,
-        .send_cmd = &Request4ForNode240,
-        .exp_result = &Response4ForNode240
+        .send_cmd = &audio_kit_Request4ForNode240,
+        .exp_result = &audio_kit_Response4ForNode240
     }, {
         .pause = 0,
-        .send_cmd = &Request5ForNode240,
-        .exp_result = &Response5ForNode240
+        .send_cmd = &audio_kit_Request5ForNode240,
+        .exp_result = &audio_kit_Response5ForNode240
     } };
-UCS_NS_CONST uint8_t PayloadRequest1ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request1ForNode270[] = {
     0x00, 0x00, 0x01, 0x01 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request1ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request1ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C1,
     .op_type = 0x02,
     .data_size = 0x04,
-    .data_ptr = PayloadRequest1ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response1ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request1ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response1ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C1,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest2ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request2ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x1B, 0x80 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request2ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request2ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0A,
-    .data_ptr = PayloadRequest2ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response2ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request2ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response2ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest3ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request3ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x11, 0xB8 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request3ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request3ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0A,
-    .data_ptr = PayloadRequest3ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response3ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request3ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response3ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest4ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request4ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x12, 0x60 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request4ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request4ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0A,
-    .data_ptr = PayloadRequest4ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response4ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request4ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response4ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest5ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request5ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x13, 0xA0 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request5ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request5ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0A,
-    .data_ptr = PayloadRequest5ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response5ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request5ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response5ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest6ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request6ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x14, 0x48 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request6ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request6ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0A,
-    .data_ptr = PayloadRequest6ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response6ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request6ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response6ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest7ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request7ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x05, 0x00, 0x64, 0x20, 0x00, 0x89, 0x77, 0x72 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request7ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request7ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0D,
-    .data_ptr = PayloadRequest7ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response7ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request7ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response7ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest8ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request8ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x06, 0x00 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request8ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request8ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0A,
-    .data_ptr = PayloadRequest8ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response8ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request8ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response8ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest9ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request9ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x05, 0x00 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request9ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request9ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0A,
-    .data_ptr = PayloadRequest9ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response9ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request9ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response9ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST uint8_t PayloadRequest10ForNode270[] = {
+UCS_NS_CONST uint8_t Payloadaudio_kit_Request10ForNode270[] = {
     0x0F, 0x00, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x64, 0x07, 0x01, 0x50 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Request10ForNode270 = {
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Request10ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x02,
     .data_size = 0x0B,
-    .data_ptr = PayloadRequest10ForNode270 };
-UCS_NS_CONST Ucs_Ns_ConfigMsg_t Response10ForNode270 = {
+    .data_ptr = Payloadaudio_kit_Request10ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t audio_kit_Response10ForNode270 = {
     .fblock_id = 0x00,
     .inst_id = 0x01,
     .funct_id = 0x06C4,
     .op_type = 0x0C,
     .data_size = 0x00,
     .data_ptr = NULL };
-UCS_NS_CONST Ucs_Ns_Script_t ScriptsForNode270[] = {
+UCS_NS_CONST Ucs_Ns_Script_t audio_kit_ScriptsForNode270[] = {
     {
         .pause = 0,
-        .send_cmd = &Request1ForNode270,
-        .exp_result = &Response1ForNode270
+        .send_cmd = &audio_kit_Request1ForNode270,
+        .exp_result = &audio_kit_Response1ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request2ForNode270,
-        .exp_result = &Response2ForNode270
+        .send_cmd = &audio_kit_Request2ForNode270,
+        .exp_result = &audio_kit_Response2ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request3ForNode270,
-        .exp_result = &Response3ForNode270
+        .send_cmd = &audio_kit_Request3ForNode270,
+        .exp_result = &audio_kit_Response3ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request4ForNode270,
-        .exp_result = &Response4ForNode270
+        .send_cmd = &audio_kit_Request4ForNode270,
+        .exp_result = &audio_kit_Response4ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request5ForNode270,
-        .exp_result = &Response5ForNode270
+        .send_cmd = &audio_kit_Request5ForNode270,
+        .exp_result = &audio_kit_Response5ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request6ForNode270,
-        .exp_result = &Response6ForNode270
+        .send_cmd = &audio_kit_Request6ForNode270,
+        .exp_result = &audio_kit_Response6ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request7ForNode270,
-        .exp_result = &Response7ForNode270
+        .send_cmd = &audio_kit_Request7ForNode270,
+        .exp_result = &audio_kit_Response7ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request8ForNode270,
-        .exp_result = &Response8ForNode270
+        .send_cmd = &audio_kit_Request8ForNode270,
+        .exp_result = &audio_kit_Response8ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request9ForNode270,
-        .exp_result = &Response9ForNode270
+        .send_cmd = &audio_kit_Request9ForNode270,
+        .exp_result = &audio_kit_Response9ForNode270
     }, {
         .pause = 0,
-        .send_cmd = &Request10ForNode270,
-        .exp_result = &Response10ForNode270
+        .send_cmd = &audio_kit_Request10ForNode270,
+        .exp_result = &audio_kit_Response10ForNode270
     } };
-Ucs_Signature_t SignatureForNode200 = { .node_address = 0x200 };
-Ucs_Signature_t SignatureForNode2B0 = { .node_address = 0x2B0 };
-Ucs_Signature_t SignatureForNode210 = { .node_address = 0x210 };
-Ucs_Signature_t SignatureForNode240 = { .node_address = 0x240 };
-Ucs_Signature_t SignatureForNode270 = { .node_address = 0x270 };
-Ucs_Rm_Node_t AllNodes[] = {
+Ucs_Signature_t audio_kit_SignatureForNode200 = { .node_address = 0x200 };
+Ucs_Signature_t audio_kit_SignatureForNode2B0 = { .node_address = 0x2B0 };
+Ucs_Signature_t audio_kit_SignatureForNode210 = { .node_address = 0x210 };
+Ucs_Signature_t audio_kit_SignatureForNode240 = { .node_address = 0x240 };
+Ucs_Signature_t audio_kit_SignatureForNode270 = { .node_address = 0x270 };
+Ucs_Rm_Node_t audio_kit_AllNodes[] = {
     {
-        .signature_ptr = &SignatureForNode200,
+        .signature_ptr = &audio_kit_SignatureForNode200,
         .init_script_list_ptr = NULL,
         .init_script_list_size = 0,
         .remote_attach_disabled = 0
     }, {
-        .signature_ptr = &SignatureForNode2B0,
+        .signature_ptr = &audio_kit_SignatureForNode2B0,
         .init_script_list_ptr = NULL,
         .init_script_list_size = 0,
         .remote_attach_disabled = 0
     }, {
-        .signature_ptr = &SignatureForNode210,
+        .signature_ptr = &audio_kit_SignatureForNode210,
         .init_script_list_ptr = NULL,
         .init_script_list_size = 0,
         .remote_attach_disabled = 0
     }, {
-        .signature_ptr = &SignatureForNode240,
-        .init_script_list_ptr = ScriptsForNode240,
+        .signature_ptr = &audio_kit_SignatureForNode240,
+        .init_script_list_ptr = audio_kit_ScriptsForNode240,
         .init_script_list_size = 5,
         .remote_attach_disabled = 0
     }, {
-        .signature_ptr = &SignatureForNode270,
-        .init_script_list_ptr = ScriptsForNode270,
+        .signature_ptr = &audio_kit_SignatureForNode270,
+        .init_script_list_ptr = audio_kit_ScriptsForNode270,
         .init_script_list_size = 10,
         .remote_attach_disabled = 0
     } };
-Ucs_Rm_EndPoint_t SourceEndpointForRoute1 = {
+Ucs_Rm_EndPoint_t audio_kit_SourceEndpointForRoute1 = {
     .endpoint_type = UCS_RM_EP_SOURCE,
-    .jobs_list_ptr = SrcOfRoute1_JobList0,
-    .node_obj_ptr = &AllNodes[0] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute1 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SrcOfRoute1_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[0] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute1 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute1_JobList0,
-    .node_obj_ptr = &AllNodes[0] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute2 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute1_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[0] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute2 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute2_JobList0,
-    .node_obj_ptr = &AllNodes[1] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute3 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute2_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[1] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute3 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute3_JobList0,
-    .node_obj_ptr = &AllNodes[3] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute4 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute3_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[3] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute4 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute4_JobList0,
-    .node_obj_ptr = &AllNodes[4] };
-Ucs_Rm_EndPoint_t SourceEndpointForRoute5 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute4_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[4] };
+Ucs_Rm_EndPoint_t audio_kit_SourceEndpointForRoute5 = {
     .endpoint_type = UCS_RM_EP_SOURCE,
-    .jobs_list_ptr = SrcOfRoute5_JobList0,
-    .node_obj_ptr = &AllNodes[2] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute5 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SrcOfRoute5_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[2] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute5 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute5_JobList0,
-    .node_obj_ptr = &AllNodes[0] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute6 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute5_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[0] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute6 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute6_JobList0,
-    .node_obj_ptr = &AllNodes[1] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute7 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute6_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[1] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute7 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute7_JobList0,
-    .node_obj_ptr = &AllNodes[3] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute8 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute7_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[3] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute8 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute8_JobList0,
-    .node_obj_ptr = &AllNodes[4] };
-Ucs_Rm_EndPoint_t SourceEndpointForRoute9 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute8_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[4] };
+Ucs_Rm_EndPoint_t audio_kit_SourceEndpointForRoute9 = {
     .endpoint_type = UCS_RM_EP_SOURCE,
-    .jobs_list_ptr = SrcOfRoute9_JobList0,
-    .node_obj_ptr = &AllNodes[3] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute9 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SrcOfRoute9_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[3] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute9 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute9_JobList0,
-    .node_obj_ptr = &AllNodes[0] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute10 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute9_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[0] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute10 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute10_JobList0,
-    .node_obj_ptr = &AllNodes[1] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute11 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute10_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[1] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute11 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute11_JobList0,
-    .node_obj_ptr = &AllNodes[3] };
-Ucs_Rm_EndPoint_t SinkEndpointForRoute12 = {
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute11_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[3] };
+Ucs_Rm_EndPoint_t audio_kit_SinkEndpointForRoute12 = {
     .endpoint_type = UCS_RM_EP_SINK,
-    .jobs_list_ptr = SnkOfRoute12_JobList0,
-    .node_obj_ptr = &AllNodes[4] };
-Ucs_Rm_Route_t AllRoutes[] = { {
-        .source_endpoint_ptr = &SourceEndpointForRoute1,
-        .sink_endpoint_ptr = &SinkEndpointForRoute1,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)audio_kit_SnkOfRoute12_JobList0,
+    .node_obj_ptr = &audio_kit_AllNodes[4] };
+Ucs_Rm_Route_t audio_kit_AllRoutes[] = { {
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute1,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute1,
         .active = 1,
         .route_id = 0x8000,
         .atd = { 
@@ -852,8 +854,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute1,
-        .sink_endpoint_ptr = &SinkEndpointForRoute2,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute1,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute2,
         .active = 1,
         .route_id = 0x8001,
         .atd = { 
@@ -865,8 +867,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute1,
-        .sink_endpoint_ptr = &SinkEndpointForRoute3,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute1,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute3,
         .active = 1,
         .route_id = 0x1001,
         .atd = { 
@@ -878,8 +880,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute1,
-        .sink_endpoint_ptr = &SinkEndpointForRoute4,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute1,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute4,
         .active = 1,
         .route_id = 0x2001,
         .atd = { 
@@ -891,8 +893,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute5,
-        .sink_endpoint_ptr = &SinkEndpointForRoute5,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute5,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute5,
         .active = 1,
         .route_id = 0x8002,
         .atd = { 
@@ -904,8 +906,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute5,
-        .sink_endpoint_ptr = &SinkEndpointForRoute6,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute5,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute6,
         .active = 1,
         .route_id = 0x8003,
         .atd = { 
@@ -917,8 +919,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute5,
-        .sink_endpoint_ptr = &SinkEndpointForRoute7,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute5,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute7,
         .active = 0,
         .route_id = 0x1002,
         .atd = { 
@@ -930,8 +932,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute5,
-        .sink_endpoint_ptr = &SinkEndpointForRoute8,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute5,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute8,
         .active = 0,
         .route_id = 0x2002,
         .atd = { 
@@ -943,8 +945,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute9,
-        .sink_endpoint_ptr = &SinkEndpointForRoute9,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute9,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute9,
         .active = 1,
         .route_id = 0x8004,
         .atd = { 
@@ -956,8 +958,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute9,
-        .sink_endpoint_ptr = &SinkEndpointForRoute10,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute9,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute10,
         .active = 1,
         .route_id = 0x8005,
         .atd = { 
@@ -969,8 +971,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute9,
-        .sink_endpoint_ptr = &SinkEndpointForRoute11,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute9,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute11,
         .active = 0,
         .route_id = 0x1003,
         .atd = { 
@@ -982,8 +984,8 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     }, {
-        .source_endpoint_ptr = &SourceEndpointForRoute9,
-        .sink_endpoint_ptr = &SinkEndpointForRoute12,
+        .source_endpoint_ptr = &audio_kit_SourceEndpointForRoute9,
+        .sink_endpoint_ptr = &audio_kit_SinkEndpointForRoute12,
         .active = 0,
         .route_id = 0x2003,
         .atd = { 
@@ -995,3 +997,1309 @@ Ucs_Rm_Route_t AllRoutes[] = { {
             .fallback_enabled = 0
         }    
     } };
+
+/* Configuration 'multichannel_audio_kit' */
+uint16_t multichannel_audio_kit_PacketBandwidth = 104;
+uint16_t multichannel_audio_kit_ProxyBandwidth = 0;
+uint16_t multichannel_audio_kit_RoutesSize = 6;
+uint16_t multichannel_audio_kit_NodeSize = 7;
+
+/* Route 1 from source-node=0x200 to sink-node=0x270 */
+const Ucs_Xrm_DefaultCreatedPort_t multichannel_audio_kit_SrcOfRoute1_DcPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_DC_PORT,
+    .port_type = UCS_XRM_PORT_TYPE_USB,
+    .index = 0 };
+const Ucs_Xrm_UsbSocket_t multichannel_audio_kit_SrcOfRoute1_UsbSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_DcPort0,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_USB_SCKT_SYNC_DATA,
+    .end_point_addr = 0x01,
+    .frames_per_transfer = 42 };
+const Ucs_Xrm_Splitter_t multichannel_audio_kit_SrcOfRoute1_Splitter0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SPLITTER,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_UsbSocket0,
+    .nw_port_handle = 0x0D00,
+    .bytes_per_frame = 12 };
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SrcOfRoute1_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SrcOfRoute1_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_Splitter0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_NetworkSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SrcOfRoute1_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_Splitter0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_SyncCon0,
+    NULL };
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SnkOfRoute1_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute1_StrmPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 0,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute1_StrmPort1 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 1,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmSocket_t multichannel_audio_kit_SnkOfRoute1_StrmSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute1_StrmPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
+    .bandwidth = 4,
+    .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SnkOfRoute1_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute1_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute1_StrmSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SnkOfRoute1_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute1_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute1_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute1_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute1_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute1_SyncCon0,
+    NULL };
+/* Route 2 from source-node=0x200 to sink-node=0x240 */
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SnkOfRoute2_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute2_StrmPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 0,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute2_StrmPort1 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 1,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmSocket_t multichannel_audio_kit_SnkOfRoute2_StrmSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute2_StrmPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
+    .bandwidth = 4,
+    .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA1 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SnkOfRoute2_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute2_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute2_StrmSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SnkOfRoute2_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute2_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute2_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute2_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute2_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute2_SyncCon0,
+    NULL };
+/* Route 3 from source-node=0x200 to sink-node=0x271 */
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SrcOfRoute3_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SrcOfRoute3_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_Splitter0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute3_NetworkSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 4 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SrcOfRoute3_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_Splitter0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute3_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute3_SyncCon0,
+    NULL };
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SnkOfRoute3_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute3_StrmPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 0,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute3_StrmPort1 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 1,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmSocket_t multichannel_audio_kit_SnkOfRoute3_StrmSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute3_StrmPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
+    .bandwidth = 4,
+    .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SnkOfRoute3_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute3_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute3_StrmSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SnkOfRoute3_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute3_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute3_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute3_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute3_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute3_SyncCon0,
+    NULL };
+/* Route 4 from source-node=0x200 to sink-node=0x241 */
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SnkOfRoute4_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute4_StrmPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 0,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute4_StrmPort1 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 1,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmSocket_t multichannel_audio_kit_SnkOfRoute4_StrmSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute4_StrmPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
+    .bandwidth = 4,
+    .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA1 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SnkOfRoute4_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute4_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute4_StrmSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SnkOfRoute4_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute4_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute4_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute4_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute4_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute4_SyncCon0,
+    NULL };
+/* Route 5 from source-node=0x200 to sink-node=0x272 */
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SrcOfRoute5_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SrcOfRoute5_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_Splitter0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute5_NetworkSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 8 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SrcOfRoute5_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute1_Splitter0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute5_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SrcOfRoute5_SyncCon0,
+    NULL };
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SnkOfRoute5_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute5_StrmPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 0,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute5_StrmPort1 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 1,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmSocket_t multichannel_audio_kit_SnkOfRoute5_StrmSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute5_StrmPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
+    .bandwidth = 4,
+    .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SnkOfRoute5_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute5_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute5_StrmSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SnkOfRoute5_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute5_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute5_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute5_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute5_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute5_SyncCon0,
+    NULL };
+/* Route 6 from source-node=0x200 to sink-node=0x242 */
+const Ucs_Xrm_NetworkSocket_t multichannel_audio_kit_SnkOfRoute6_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute6_StrmPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 0,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmPort_t multichannel_audio_kit_SnkOfRoute6_StrmPort1 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 1,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmSocket_t multichannel_audio_kit_SnkOfRoute6_StrmSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute6_StrmPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
+    .bandwidth = 4,
+    .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA1 };
+const Ucs_Xrm_SyncCon_t multichannel_audio_kit_SnkOfRoute6_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute6_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute6_StrmSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const multichannel_audio_kit_SnkOfRoute6_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute6_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute6_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute6_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute6_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&multichannel_audio_kit_SnkOfRoute6_SyncCon0,
+    NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request1ForNode270[] = {
+    0x00, 0x00, 0x01, 0x01 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request1ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C1,
+    .op_type = 0x02,
+    .data_size = 0x04,
+    .data_ptr = Payloadmultichannel_audio_kit_Request1ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response1ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C1,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request2ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x1B, 0x80 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request2ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadmultichannel_audio_kit_Request2ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response2ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request3ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x11, 0xB8 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request3ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadmultichannel_audio_kit_Request3ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response3ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request4ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x12, 0x60 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request4ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadmultichannel_audio_kit_Request4ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response4ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request5ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x13, 0xA0 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request5ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadmultichannel_audio_kit_Request5ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response5ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request6ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x14, 0x48 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request6ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadmultichannel_audio_kit_Request6ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response6ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request7ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x05, 0x00, 0x64, 0x20, 0x00, 0x89, 0x77, 0x72 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request7ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0D,
+    .data_ptr = Payloadmultichannel_audio_kit_Request7ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response7ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request8ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x06, 0x00 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request8ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadmultichannel_audio_kit_Request8ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response8ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request9ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x05, 0x00 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request9ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadmultichannel_audio_kit_Request9ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response9ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request10ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x64, 0x07, 0x01, 0x50 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request10ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0B,
+    .data_ptr = Payloadmultichannel_audio_kit_Request10ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response10ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST Ucs_Ns_Script_t multichannel_audio_kit_ScriptsForNode270[] = {
+    {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request1ForNode270,
+        .exp_result = &multichannel_audio_kit_Response1ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request2ForNode270,
+        .exp_result = &multichannel_audio_kit_Response2ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request3ForNode270,
+        .exp_result = &multichannel_audio_kit_Response3ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request4ForNode270,
+        .exp_result = &multichannel_audio_kit_Response4ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request5ForNode270,
+        .exp_result = &multichannel_audio_kit_Response5ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request6ForNode270,
+        .exp_result = &multichannel_audio_kit_Response6ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request7ForNode270,
+        .exp_result = &multichannel_audio_kit_Response7ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request8ForNode270,
+        .exp_result = &multichannel_audio_kit_Response8ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request9ForNode270,
+        .exp_result = &multichannel_audio_kit_Response9ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request10ForNode270,
+        .exp_result = &multichannel_audio_kit_Response10ForNode270
+    } };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request1ForNode240[] = {
+    0x00, 0x00, 0x01, 0x01 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request1ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C1,
+    .op_type = 0x02,
+    .data_size = 0x04,
+    .data_ptr = Payloadmultichannel_audio_kit_Request1ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response1ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C1,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request2ForNode240[] = {
+    0x0F, 0x00, 0x02, 0x0A, 0x18, 0x03, 0x00, 0x64, 0x00, 0x0F, 0x02, 0x01, 0x00, 0x00, 0x02, 0xA5, 0xDF, 0x03, 0x3F, 0x3F, 0x04, 0x02, 0x02, 0x10, 0x50, 0x50, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x13, 0x00, 0x00, 0x14, 0x00, 0x00 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request2ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x26,
+    .data_ptr = Payloadmultichannel_audio_kit_Request2ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response2ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request3ForNode240[] = {
+    0x0F, 0x00, 0x02, 0x04, 0x18, 0x03, 0x00, 0x64, 0x20, 0x00, 0x00, 0x21, 0x00, 0x00, 0x22, 0x00, 0x00, 0x23, 0x00, 0x00 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request3ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x14,
+    .data_ptr = Payloadmultichannel_audio_kit_Request3ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response3ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request4ForNode240[] = {
+    0x00, 0x00, 0x14 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request4ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x0701,
+    .op_type = 0x02,
+    .data_size = 0x03,
+    .data_ptr = Payloadmultichannel_audio_kit_Request4ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response4ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x0701,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadmultichannel_audio_kit_Request5ForNode240[] = {
+    0x1D, 0x00, 0x03, 0x35, 0x04, 0x35, 0x05, 0x35, 0x06, 0x35, 0x07, 0x41, 0x08, 0x40 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Request5ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x0703,
+    .op_type = 0x02,
+    .data_size = 0x0E,
+    .data_ptr = Payloadmultichannel_audio_kit_Request5ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t multichannel_audio_kit_Response5ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x0703,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST Ucs_Ns_Script_t multichannel_audio_kit_ScriptsForNode240[] = {
+    {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request1ForNode240,
+        .exp_result = &multichannel_audio_kit_Response1ForNode240
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request2ForNode240,
+        .exp_result = &multichannel_audio_kit_Response2ForNode240
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request3ForNode240,
+        .exp_result = &multichannel_audio_kit_Response3ForNode240
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request4ForNode240,
+        .exp_result = &multichannel_audio_kit_Response4ForNode240
+    }, {
+        .pause = 0,
+        .send_cmd = &multichannel_audio_kit_Request5ForNode240,
+        .exp_result = &multichannel_audio_kit_Response5ForNode240
+    } };
+Ucs_Signature_t multichannel_audio_kit_SignatureForNode200 = { .node_address = 0x200 };
+Ucs_Signature_t multichannel_audio_kit_SignatureForNode270 = { .node_address = 0x270 };
+Ucs_Signature_t multichannel_audio_kit_SignatureForNode271 = { .node_address = 0x271 };
+Ucs_Signature_t multichannel_audio_kit_SignatureForNode272 = { .node_address = 0x272 };
+Ucs_Signature_t multichannel_audio_kit_SignatureForNode240 = { .node_address = 0x240 };
+Ucs_Signature_t multichannel_audio_kit_SignatureForNode241 = { .node_address = 0x241 };
+Ucs_Signature_t multichannel_audio_kit_SignatureForNode242 = { .node_address = 0x242 };
+Ucs_Rm_Node_t multichannel_audio_kit_AllNodes[] = {
+    {
+        .signature_ptr = &multichannel_audio_kit_SignatureForNode200,
+        .init_script_list_ptr = NULL,
+        .init_script_list_size = 0,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &multichannel_audio_kit_SignatureForNode270,
+        .init_script_list_ptr = multichannel_audio_kit_ScriptsForNode270,
+        .init_script_list_size = 10,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &multichannel_audio_kit_SignatureForNode271,
+        .init_script_list_ptr = multichannel_audio_kit_ScriptsForNode270,
+        .init_script_list_size = 10,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &multichannel_audio_kit_SignatureForNode272,
+        .init_script_list_ptr = multichannel_audio_kit_ScriptsForNode270,
+        .init_script_list_size = 10,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &multichannel_audio_kit_SignatureForNode240,
+        .init_script_list_ptr = multichannel_audio_kit_ScriptsForNode240,
+        .init_script_list_size = 5,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &multichannel_audio_kit_SignatureForNode241,
+        .init_script_list_ptr = multichannel_audio_kit_ScriptsForNode240,
+        .init_script_list_size = 5,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &multichannel_audio_kit_SignatureForNode242,
+        .init_script_list_ptr = multichannel_audio_kit_ScriptsForNode240,
+        .init_script_list_size = 5,
+        .remote_attach_disabled = 0
+    } };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SourceEndpointForRoute1 = {
+    .endpoint_type = UCS_RM_EP_SOURCE,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SrcOfRoute1_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[0] };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SinkEndpointForRoute1 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SnkOfRoute1_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[1] };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SinkEndpointForRoute2 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SnkOfRoute2_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[4] };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SourceEndpointForRoute3 = {
+    .endpoint_type = UCS_RM_EP_SOURCE,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SrcOfRoute3_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[0] };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SinkEndpointForRoute3 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SnkOfRoute3_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[2] };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SinkEndpointForRoute4 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SnkOfRoute4_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[5] };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SourceEndpointForRoute5 = {
+    .endpoint_type = UCS_RM_EP_SOURCE,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SrcOfRoute5_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[0] };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SinkEndpointForRoute5 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SnkOfRoute5_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[3] };
+Ucs_Rm_EndPoint_t multichannel_audio_kit_SinkEndpointForRoute6 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)multichannel_audio_kit_SnkOfRoute6_JobList0,
+    .node_obj_ptr = &multichannel_audio_kit_AllNodes[6] };
+Ucs_Rm_Route_t multichannel_audio_kit_AllRoutes[] = { {
+        .source_endpoint_ptr = &multichannel_audio_kit_SourceEndpointForRoute1,
+        .sink_endpoint_ptr = &multichannel_audio_kit_SinkEndpointForRoute1,
+        .active = 1,
+        .route_id = 0x8000,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    }, {
+        .source_endpoint_ptr = &multichannel_audio_kit_SourceEndpointForRoute1,
+        .sink_endpoint_ptr = &multichannel_audio_kit_SinkEndpointForRoute2,
+        .active = 1,
+        .route_id = 0x8001,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    }, {
+        .source_endpoint_ptr = &multichannel_audio_kit_SourceEndpointForRoute3,
+        .sink_endpoint_ptr = &multichannel_audio_kit_SinkEndpointForRoute3,
+        .active = 1,
+        .route_id = 0x8002,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    }, {
+        .source_endpoint_ptr = &multichannel_audio_kit_SourceEndpointForRoute3,
+        .sink_endpoint_ptr = &multichannel_audio_kit_SinkEndpointForRoute4,
+        .active = 1,
+        .route_id = 0x8003,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    }, {
+        .source_endpoint_ptr = &multichannel_audio_kit_SourceEndpointForRoute5,
+        .sink_endpoint_ptr = &multichannel_audio_kit_SinkEndpointForRoute5,
+        .active = 1,
+        .route_id = 0x8004,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    }, {
+        .source_endpoint_ptr = &multichannel_audio_kit_SourceEndpointForRoute5,
+        .sink_endpoint_ptr = &multichannel_audio_kit_SinkEndpointForRoute6,
+        .active = 1,
+        .route_id = 0x8005,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    } };
+
+/* Configuration 'video_on_demand' */
+uint16_t video_on_demand_PacketBandwidth = 52;
+uint16_t video_on_demand_ProxyBandwidth = 0;
+uint16_t video_on_demand_RoutesSize = 3;
+uint16_t video_on_demand_NodeSize = 4;
+
+/* Route 1 from source-node=0x200 to sink-node=0x2B0 */
+const Ucs_Xrm_DefaultCreatedPort_t video_on_demand_SrcOfRoute1_DcPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_DC_PORT,
+    .port_type = UCS_XRM_PORT_TYPE_USB,
+    .index = 0 };
+const Ucs_Xrm_UsbSocket_t video_on_demand_SrcOfRoute1_UsbSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute1_DcPort0,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_USB_SCKT_AV_PACKETIZED,
+    .end_point_addr = 0x01,
+    .frames_per_transfer = 2 };
+const Ucs_Xrm_NetworkSocket_t video_on_demand_SrcOfRoute1_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_NW_SCKT_AV_PACKETIZED,
+    .bandwidth = 60 };
+const Ucs_Xrm_AvpCon_t video_on_demand_SrcOfRoute1_AvpCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_AVP_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute1_UsbSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute1_NetworkSocket0,
+    .isoc_packet_size = UCS_ISOC_PCKT_SIZE_188 };
+Ucs_Xrm_ResObject_t *const video_on_demand_SrcOfRoute1_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute1_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute1_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute1_AvpCon0,
+    NULL };
+const Ucs_Xrm_NetworkSocket_t video_on_demand_SnkOfRoute1_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_AV_PACKETIZED,
+    .bandwidth = 60 };
+const Ucs_Xrm_DefaultCreatedPort_t video_on_demand_SnkOfRoute1_DcPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_DC_PORT,
+    .port_type = UCS_XRM_PORT_TYPE_USB,
+    .index = 0 };
+const Ucs_Xrm_UsbSocket_t video_on_demand_SnkOfRoute1_UsbSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_DcPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_USB_SCKT_AV_PACKETIZED,
+    .end_point_addr = 0x81,
+    .frames_per_transfer = 2 };
+const Ucs_Xrm_AvpCon_t video_on_demand_SnkOfRoute1_AvpCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_AVP_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_UsbSocket0,
+    .isoc_packet_size = UCS_ISOC_PCKT_SIZE_188 };
+Ucs_Xrm_ResObject_t *const video_on_demand_SnkOfRoute1_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_AvpCon0,
+    NULL };
+/* Route 2 from source-node=0x2B0 to sink-node=0x270 */
+const Ucs_Xrm_UsbSocket_t video_on_demand_SrcOfRoute2_UsbSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_USB_SOCKET,
+    .usb_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_DcPort0,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_USB_SCKT_SYNC_DATA,
+    .end_point_addr = 0x01,
+    .frames_per_transfer = 128 };
+const Ucs_Xrm_NetworkSocket_t video_on_demand_SrcOfRoute2_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_SyncCon_t video_on_demand_SrcOfRoute2_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute2_UsbSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute2_NetworkSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const video_on_demand_SrcOfRoute2_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute1_DcPort0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute2_UsbSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute2_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SrcOfRoute2_SyncCon0,
+    NULL };
+const Ucs_Xrm_NetworkSocket_t video_on_demand_SnkOfRoute2_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_StrmPort_t video_on_demand_SnkOfRoute2_StrmPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 0,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmPort_t video_on_demand_SnkOfRoute2_StrmPort1 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 1,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmSocket_t video_on_demand_SnkOfRoute2_StrmSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute2_StrmPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
+    .bandwidth = 4,
+    .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA0 };
+const Ucs_Xrm_SyncCon_t video_on_demand_SnkOfRoute2_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute2_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute2_StrmSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const video_on_demand_SnkOfRoute2_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute2_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute2_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute2_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute2_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute2_SyncCon0,
+    NULL };
+/* Route 3 from source-node=0x2B0 to sink-node=0x240 */
+const Ucs_Xrm_NetworkSocket_t video_on_demand_SnkOfRoute3_NetworkSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_NW_SOCKET,
+    .nw_port_handle = 0x0D00,
+    .direction = UCS_SOCKET_DIR_INPUT,
+    .data_type = UCS_NW_SCKT_SYNC_DATA,
+    .bandwidth = 4 };
+const Ucs_Xrm_StrmPort_t video_on_demand_SnkOfRoute3_StrmPort0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 0,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_64FS,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmPort_t video_on_demand_SnkOfRoute3_StrmPort1 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_PORT,
+    .index = 1,
+    .clock_config = UCS_STREAM_PORT_CLK_CFG_WILD,
+    .data_alignment = UCS_STREAM_PORT_ALGN_LEFT16BIT };
+const Ucs_Xrm_StrmSocket_t video_on_demand_SnkOfRoute3_StrmSocket0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_STRM_SOCKET,
+    .stream_port_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute3_StrmPort0,
+    .direction = UCS_SOCKET_DIR_OUTPUT,
+    .data_type = UCS_STREAM_PORT_SCKT_SYNC_DATA,
+    .bandwidth = 4,
+    .stream_pin_id = UCS_STREAM_PORT_PIN_ID_SRXA1 };
+const Ucs_Xrm_SyncCon_t video_on_demand_SnkOfRoute3_SyncCon0 = { 
+    .resource_type = UCS_XRM_RC_TYPE_SYNC_CON,
+    .socket_in_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute3_NetworkSocket0,
+    .socket_out_obj_ptr = (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute3_StrmSocket0,
+    .mute_mode = UCS_SYNC_MUTE_MODE_NO_MUTING,
+    .offset = 0 };
+Ucs_Xrm_ResObject_t *const video_on_demand_SnkOfRoute3_JobList0[] = {
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute3_NetworkSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute3_StrmPort0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute3_StrmPort1,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute3_StrmSocket0,
+    (Ucs_Xrm_ResObject_t *)&video_on_demand_SnkOfRoute3_SyncCon0,
+    NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request1ForNode270[] = {
+    0x00, 0x00, 0x01, 0x01 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request1ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C1,
+    .op_type = 0x02,
+    .data_size = 0x04,
+    .data_ptr = Payloadvideo_on_demand_Request1ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response1ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C1,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request2ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x1B, 0x80 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request2ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadvideo_on_demand_Request2ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response2ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request3ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x11, 0xB8 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request3ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadvideo_on_demand_Request3ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response3ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request4ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x12, 0x60 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request4ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadvideo_on_demand_Request4ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response4ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request5ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x13, 0xA0 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request5ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadvideo_on_demand_Request5ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response5ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request6ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x14, 0x48 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request6ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadvideo_on_demand_Request6ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response6ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request7ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x05, 0x00, 0x64, 0x20, 0x00, 0x89, 0x77, 0x72 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request7ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0D,
+    .data_ptr = Payloadvideo_on_demand_Request7ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response7ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request8ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x06, 0x00 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request8ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadvideo_on_demand_Request8ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response8ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request9ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x64, 0x05, 0x00 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request9ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0A,
+    .data_ptr = Payloadvideo_on_demand_Request9ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response9ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request10ForNode270[] = {
+    0x0F, 0x00, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x64, 0x07, 0x01, 0x50 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request10ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x0B,
+    .data_ptr = Payloadvideo_on_demand_Request10ForNode270 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response10ForNode270 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST Ucs_Ns_Script_t video_on_demand_ScriptsForNode270[] = {
+    {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request1ForNode270,
+        .exp_result = &video_on_demand_Response1ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request2ForNode270,
+        .exp_result = &video_on_demand_Response2ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request3ForNode270,
+        .exp_result = &video_on_demand_Response3ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request4ForNode270,
+        .exp_result = &video_on_demand_Response4ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request5ForNode270,
+        .exp_result = &video_on_demand_Response5ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request6ForNode270,
+        .exp_result = &video_on_demand_Response6ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request7ForNode270,
+        .exp_result = &video_on_demand_Response7ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request8ForNode270,
+        .exp_result = &video_on_demand_Response8ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request9ForNode270,
+        .exp_result = &video_on_demand_Response9ForNode270
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request10ForNode270,
+        .exp_result = &video_on_demand_Response10ForNode270
+    } };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request1ForNode240[] = {
+    0x00, 0x00, 0x01, 0x01 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request1ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C1,
+    .op_type = 0x02,
+    .data_size = 0x04,
+    .data_ptr = Payloadvideo_on_demand_Request1ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response1ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C1,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request2ForNode240[] = {
+    0x0F, 0x00, 0x02, 0x0A, 0x18, 0x03, 0x00, 0x64, 0x00, 0x0F, 0x02, 0x01, 0x00, 0x00, 0x02, 0xA5, 0xDF, 0x03, 0x3F, 0x3F, 0x04, 0x02, 0x02, 0x10, 0x30, 0x30, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x13, 0x00, 0x00, 0x14, 0x00, 0x00 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request2ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x26,
+    .data_ptr = Payloadvideo_on_demand_Request2ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response2ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST uint8_t Payloadvideo_on_demand_Request3ForNode240[] = {
+    0x0F, 0x00, 0x02, 0x04, 0x18, 0x03, 0x00, 0x64, 0x20, 0x00, 0x00, 0x21, 0x00, 0x00, 0x22, 0x00, 0x00, 0x23, 0x00, 0x00 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Request3ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x02,
+    .data_size = 0x14,
+    .data_ptr = Payloadvideo_on_demand_Request3ForNode240 };
+UCS_NS_CONST Ucs_Ns_ConfigMsg_t video_on_demand_Response3ForNode240 = {
+    .fblock_id = 0x00,
+    .inst_id = 0x01,
+    .funct_id = 0x06C4,
+    .op_type = 0x0C,
+    .data_size = 0x00,
+    .data_ptr = NULL };
+UCS_NS_CONST Ucs_Ns_Script_t video_on_demand_ScriptsForNode240[] = {
+    {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request1ForNode240,
+        .exp_result = &video_on_demand_Response1ForNode240
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request2ForNode240,
+        .exp_result = &video_on_demand_Response2ForNode240
+    }, {
+        .pause = 0,
+        .send_cmd = &video_on_demand_Request3ForNode240,
+        .exp_result = &video_on_demand_Response3ForNode240
+    } };
+Ucs_Signature_t video_on_demand_SignatureForNode200 = { .node_address = 0x200 };
+Ucs_Signature_t video_on_demand_SignatureForNode2B0 = { .node_address = 0x2B0 };
+Ucs_Signature_t video_on_demand_SignatureForNode270 = { .node_address = 0x270 };
+Ucs_Signature_t video_on_demand_SignatureForNode240 = { .node_address = 0x240 };
+Ucs_Rm_Node_t video_on_demand_AllNodes[] = {
+    {
+        .signature_ptr = &video_on_demand_SignatureForNode200,
+        .init_script_list_ptr = NULL,
+        .init_script_list_size = 0,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &video_on_demand_SignatureForNode2B0,
+        .init_script_list_ptr = NULL,
+        .init_script_list_size = 0,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &video_on_demand_SignatureForNode270,
+        .init_script_list_ptr = video_on_demand_ScriptsForNode270,
+        .init_script_list_size = 10,
+        .remote_attach_disabled = 0
+    }, {
+        .signature_ptr = &video_on_demand_SignatureForNode240,
+        .init_script_list_ptr = video_on_demand_ScriptsForNode240,
+        .init_script_list_size = 3,
+        .remote_attach_disabled = 0
+    } };
+Ucs_Rm_EndPoint_t video_on_demand_SourceEndpointForRoute1 = {
+    .endpoint_type = UCS_RM_EP_SOURCE,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)video_on_demand_SrcOfRoute1_JobList0,
+    .node_obj_ptr = &video_on_demand_AllNodes[0] };
+Ucs_Rm_EndPoint_t video_on_demand_SinkEndpointForRoute1 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)video_on_demand_SnkOfRoute1_JobList0,
+    .node_obj_ptr = &video_on_demand_AllNodes[1] };
+Ucs_Rm_EndPoint_t video_on_demand_SourceEndpointForRoute2 = {
+    .endpoint_type = UCS_RM_EP_SOURCE,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)video_on_demand_SrcOfRoute2_JobList0,
+    .node_obj_ptr = &video_on_demand_AllNodes[1] };
+Ucs_Rm_EndPoint_t video_on_demand_SinkEndpointForRoute2 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)video_on_demand_SnkOfRoute2_JobList0,
+    .node_obj_ptr = &video_on_demand_AllNodes[2] };
+Ucs_Rm_EndPoint_t video_on_demand_SinkEndpointForRoute3 = {
+    .endpoint_type = UCS_RM_EP_SINK,
+    .jobs_list_ptr = (Ucs_Xrm_ResObject_t **)video_on_demand_SnkOfRoute3_JobList0,
+    .node_obj_ptr = &video_on_demand_AllNodes[3] };
+Ucs_Rm_Route_t video_on_demand_AllRoutes[] = { {
+        .source_endpoint_ptr = &video_on_demand_SourceEndpointForRoute1,
+        .sink_endpoint_ptr = &video_on_demand_SinkEndpointForRoute1,
+        .active = 1,
+        .route_id = 0x8000,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    }, {
+        .source_endpoint_ptr = &video_on_demand_SourceEndpointForRoute2,
+        .sink_endpoint_ptr = &video_on_demand_SinkEndpointForRoute2,
+        .active = 1,
+        .route_id = 0x8001,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    }, {
+        .source_endpoint_ptr = &video_on_demand_SourceEndpointForRoute2,
+        .sink_endpoint_ptr = &video_on_demand_SinkEndpointForRoute3,
+        .active = 1,
+        .route_id = 0x8002,
+        .atd = { 
+            .enabled = 0,
+            .clk_config = UCS_STREAM_PORT_CLK_CFG_NONE
+        },
+        .static_connection = { 
+            .static_con_label = 0x0,
+            .fallback_enabled = 0
+        }    
+    } };
+
+const DefaultConfig_t DefaultConfigs[] = {
+    {
+        .name = "audio_kit",
+        .packetBw = 80,
+        .proxyBw = 0,
+        .pRoutes = audio_kit_AllRoutes,
+        .routesSize = 12,
+        .pNodes = audio_kit_AllNodes,
+        .nodesSize = 5 },
+    {
+        .name = "multichannel_audio_kit",
+        .packetBw = 104,
+        .proxyBw = 0,
+        .pRoutes = multichannel_audio_kit_AllRoutes,
+        .routesSize = 6,
+        .pNodes = multichannel_audio_kit_AllNodes,
+        .nodesSize = 7 },
+    {
+        .name = "video_on_demand",
+        .packetBw = 52,
+        .proxyBw = 0,
+        .pRoutes = video_on_demand_AllRoutes,
+        .routesSize = 3,
+        .pNodes = video_on_demand_AllNodes,
+        .nodesSize = 4 }
+};
+const uint16_t DefaultConfigsSize = 3;
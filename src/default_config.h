@@ -1,6 +1,6 @@
 /*------------------------------------------------------------------------------------------------*/
 /* UNICENS Generated Network Configuration                                                        */
-/* Generator: xml2struct for Linux V5.0.0                                                         */
+/* Generator: xml2struct for Linux V5.2.1                                                         */
 /*------------------------------------------------------------------------------------------------*/
 #ifndef _DEFAULT_CONFIG_H_
 #define _DEFAULT_CONFIG_H_
@@ -11,12 +11,25 @@ extern "C" {
 
 #include "ucs_api.h"
 
-extern uint16_t PacketBandwidth;
-extern uint16_t ProxyBandwidth;
-extern uint16_t RoutesSize;
-extern uint16_t NodeSize;
-extern Ucs_Rm_Route_t AllRoutes[];
-extern Ucs_Rm_Node_t AllNodes[];
+#ifndef DEFAULT_CONFIG_REGISTRY_
+#define DEFAULT_CONFIG_REGISTRY_
+
+typedef struct
+{
+    const char *name;
+    uint16_t packetBw;
+    uint16_t proxyBw;
+    Ucs_Rm_Route_t *pRoutes;
+    uint16_t routesSize;
+    Ucs_Rm_Node_t *pNodes;
+    uint16_t nodesSize;
+} DefaultConfig_t;
+
+/* Written by xml2struct -registry */
+extern const DefaultConfig_t DefaultConfigs[];
+extern const uint16_t DefaultConfigsSize;
+
+#endif /* DEFAULT_CONFIG_REGISTRY_ */
 
 #ifdef __cplusplus
 }
@@ -32,6 +32,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include <signal.h>
 #include "Console.h"
 #include "task-unicens.h"
 
@@ -52,6 +53,8 @@
 
 static bool ParseCommandLine(int argc, char *argv[], TaskUnicens_t *pVar);
 static void PrintHelp(void);
+static void OnSignalHangup(int sig);
+static void OnSignalUser1(int sig);
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                         PUBLIC FUNCTIONS                             */
@@ -60,6 +63,8 @@ static void PrintHelp(void);
 int main(int argc, char *argv[])
 {
     static TaskUnicens_t taskVars;
+    struct sigaction hangup;
+    struct sigaction user1;
     ConsoleSetPrio(PRIO_HIGH);
     ConsolePrintf(PRIO_HIGH, BLUE "\r   __  ___   ___________________   _______\r\n" \
                                   "  / / / / | / /  _/ ____/ ____/ | / / ___/\r\n" \
@@ -77,13 +82,20 @@ int main(int argc, char *argv[])
         ConsolePrintf(PRIO_ERROR, RED "Initialization of UNICENS task failed" RESETCOLOR "\r\n");
         return -1;
     }
-    while(true)
-    {
-        /* TaskUnicens_Service may block very long. 
-         * You may call it in an own thread.
-         */
-        TaskUnicens_Service();
-    }
+    memset(&hangup, 0, sizeof(hangup));
+    hangup.sa_handler = &OnSignalHangup;
+    sigemptyset(&hangup.sa_mask);
+    if (0 != sigaction(SIGHUP, &hangup, NULL))
+        ConsolePrintf(PRIO_ERROR, YELLOW "Could not install SIGHUP handler, reloading is not possible" RESETCOLOR "\r\n");
+    memset(&user1, 0, sizeof(user1));
+    user1.sa_handler = &OnSignalUser1;
+    sigemptyset(&user1.sa_mask);
+    if (0 != sigaction(SIGUSR1, &user1, NULL))
+        ConsolePrintf(PRIO_ERROR, YELLOW "Could not install SIGUSR1 handler, switching scenes is not possible" RESETCOLOR "\r\n");
+    /* TaskUnicens_Service may block very long. 
+     * You may call it in an own thread.
+     */
+    while(TaskUnicens_Service());
     return 0;
 }
 
@@ -94,10 +106,12 @@ int main(int argc, char *argv[])
 static bool ParseCommandLine(int argc, char *argv[], TaskUnicens_t *pVar)
 {
     bool defaultSet = false;
+    bool replaySpeedSet = false;
     int32_t i;
     if (argc < 1 || NULL == argv || NULL == pVar)
         return false;
     memset(pVar, 0, sizeof(TaskUnicens_t));
+    pVar->replaySpeed = 1.0;
     for (i = 1; i < argc; i++)
     {
         if ('-' != argv[i][0])
@@ -130,6 +144,17 @@ static bool ParseCommandLine(int argc, char *argv[], TaskUnicens_t *pVar)
         {
             defaultSet = true;
         }
+        else if (0 == strcmp("-variant", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-variant parameter needs additional configuration name or \"auto\"" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->variantName = argv[i + 1];
+            defaultSet = true;
+            ++i;
+        }
         else if (0 == strcmp("-drv1", argv[i]) || 0 == strcmp("-drv2", argv[i]))
         {
             uint8_t j = 0;
@@ -157,6 +182,87 @@ static bool ParseCommandLine(int argc, char *argv[], TaskUnicens_t *pVar)
         {
             pVar->lldTrace = true;
         }
+        else if (0 == strcmp("-lldcap", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-lldcap parameter needs additional file name" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->lldCaptureName = argv[i + 1];
+            ++i;
+        }
+        else if (0 == strcmp("-lldrotate", argv[i]))
+        {
+            long size;
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-lldrotate parameter needs additional file size in kB" RESETCOLOR "\r\n");
+                return false;
+            }
+            size = strtol(argv[i + 1], NULL, 0);
+            if (0 >= size || 4 * 1024 * 1024 <= size)
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-lldrotate file size must be between 1 and 4194303 kB" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->lldCaptureSize = (uint32_t)size * 1024;
+            ++i;
+        }
+        else if (0 == strcmp("-replay", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-replay parameter needs additional capture file name" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->replayName = argv[i + 1];
+            ++i;
+        }
+        else if (0 == strcmp("-replayspeed", argv[i]))
+        {
+            char *pEnd = NULL;
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-replayspeed parameter needs additional speed factor" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->replaySpeed = strtod(argv[i + 1], &pEnd);
+            if (pEnd == argv[i + 1] || '\0' != *pEnd || 0.0 > pVar->replaySpeed)
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-replayspeed factor must be 0 or a positive number" RESETCOLOR "\r\n");
+                return false;
+            }
+            replaySpeedSet = true;
+            ++i;
+        }
+        else if (0 == strcmp("-metrics", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-metrics parameter needs additional file name" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->metricsName = argv[i + 1];
+            ++i;
+        }
+        else if (0 == strcmp("-metricsinterval", argv[i]))
+        {
+            long interval;
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-metricsinterval parameter needs additional interval in ms" RESETCOLOR "\r\n");
+                return false;
+            }
+            interval = strtol(argv[i + 1], NULL, 0);
+            if (100 > interval || 3600000 < interval)
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-metricsinterval must be between 100 and 3600000 ms" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->metricsInterval = (uint32_t)interval;
+            ++i;
+        }
         else if (0 == strcmp("-promisc", argv[i]))
         {
             ConsolePrintf(PRIO_ERROR, YELLOW "Promiscuous Mode active for all nodes" RESETCOLOR "\r\n");
@@ -198,6 +304,40 @@ static bool ParseCommandLine(int argc, char *argv[], TaskUnicens_t *pVar)
             ++i;
             ConsolePrintf(PRIO_HIGH, YELLOW "Programming is enabled. Target node count is=%d" RESETCOLOR "\r\n", pVar->programNodeCnt);
         }
+        else if (0 == strcmp("-scene", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-scene parameter needs additional scene name" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->sceneName = argv[i + 1];
+            ++i;
+        }
+        else if (0 == strcmp("-status", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-status parameter needs additional shared memory name" RESETCOLOR "\r\n");
+                return false;
+            }
+            pVar->statusName = argv[i + 1];
+            ++i;
+        }
+        else if (0 == strcmp("-blog", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "-blog parameter needs additional file name" RESETCOLOR "\r\n");
+                return false;
+            }
+            if (!ConsoleSetBinaryFile(argv[i + 1]))
+            {
+                ConsolePrintf(PRIO_ERROR, RED "Could not create binary log file='%s'" RESETCOLOR "\r\n", argv[i + 1]);
+                return false;
+            }
+            ++i;
+        }
         else if (0 == strcmp("--persistent", argv[i]))
         {
             ConsolePrintf(PRIO_ERROR, YELLOW "Persistent programming mode chosen" RESETCOLOR "\r\n");
@@ -211,11 +351,36 @@ static bool ParseCommandLine(int argc, char *argv[], TaskUnicens_t *pVar)
     }
     if (!pVar->cfgFileName && !defaultSet)
         ConsolePrintf(PRIO_HIGH, YELLOW "No filename was provided, executing default configuration (default_config.c).\r\nUse \"--help\" for details. Use \"-default\" to suppress this waring." RESETCOLOR "\r\n");
+    if (pVar->cfgFileName && pVar->variantName)
+    {
+        ConsolePrintf(PRIO_ERROR, RED "-variant option only allowed without path to UNICENS XML file" RESETCOLOR "\r\n");
+        return false;
+    }
     if (!pVar->cfgFileName && 0 != pVar->drvLocalNodeAddr)
     {
         ConsolePrintf(PRIO_ERROR, RED "-drv1 and -drv2 option only allowed, when specified an path to UNICENS XML file" RESETCOLOR "\r\n");
         return false;
     }
+    if (0 != pVar->lldCaptureSize && NULL == pVar->lldCaptureName)
+    {
+        ConsolePrintf(PRIO_ERROR, RED "-lldrotate option only allowed along with -lldcap" RESETCOLOR "\r\n");
+        return false;
+    }
+    if (replaySpeedSet && NULL == pVar->replayName)
+    {
+        ConsolePrintf(PRIO_ERROR, RED "-replayspeed option only allowed along with -replay" RESETCOLOR "\r\n");
+        return false;
+    }
+    if (0 != pVar->metricsInterval && NULL == pVar->metricsName)
+    {
+        ConsolePrintf(PRIO_ERROR, RED "-metricsinterval option only allowed along with -metrics" RESETCOLOR "\r\n");
+        return false;
+    }
+    if (NULL != pVar->replayName && (0 != pVar->drvVersion || NULL != pVar->controlRxCdev || NULL != pVar->controlTxCdev))
+    {
+        ConsolePrintf(PRIO_ERROR, RED "-replay option can not be combined with -drv1, -drv2, -crx or -ctx" RESETCOLOR "\r\n");
+        return false;
+    }
     if (0 == pVar->drvLocalNodeAddr && (NULL == pVar->controlRxCdev || NULL == pVar->controlTxCdev))
     {
         pVar->controlRxCdev = DEFAULT_CONTROL_CDEV_RX;
@@ -229,12 +394,17 @@ static void PrintHelp(void)
     ConsolePrintfStart(PRIO_HIGH, "Usage: unicensd [OPTION]... [FILE]\r\n");
     ConsolePrintfContinue("Executes the UNICENS daemon to start and configure INICnet devices.\r\n\r\n");
     ConsolePrintfContinue("  [File]                   Path to UNICENS XML configuration file, if not set, the compiled default config will be used\r\n");
+    ConsolePrintfContinue("                           A binary configuration written by \"xml2struct -bin\" can be passed instead of the XML file\r\n");
     ConsolePrintfContinue("  -v                       Verbose mode, prints debug informations\r\n");
     ConsolePrintfContinue("  -vv                      Very Verbose mode, prints even more debug informations\r\n");
     ConsolePrintfContinue("  -hide                    Disable node and route table printing\r\n");
     ConsolePrintfContinue("  -default                 Uses default configuration (default_config.c) instead of parsing XML file\r\n");
+    ConsolePrintfContinue("  -variant [Name]          Uses the configuration with the given name out of default_config.c (see xml2struct -registry).\r\n");
+    ConsolePrintfContinue("                           With \"auto\" the configuration is chosen by the nodes found in the network. The network\r\n");
+    ConsolePrintfContinue("                           is started without routes and scripts, then restarted with the best matching configuration\r\n");
     ConsolePrintfContinue("  -crx [RX char device]    Path to the receiver character device\r\n");
     ConsolePrintfContinue("  -ctx [TX char device]    Path to the sender character device\r\n");
+    ConsolePrintfContinue("                           Unix sockets are connected instead, pass the sockets of unicens-inicsim to run without hardware\r\n");
     ConsolePrintfContinue("  -drv1 [Node Addr:Filter] Configures the Microchip MOST Linux Driver V1.X with the XML file and the local node address\r\n");
     ConsolePrintfContinue("                           An additional filter string can be passed with a colon as delimiter. This filter applies to\r\n");
     ConsolePrintfContinue("                           description file inside the sys fs from the MOST Linux Driver.\r\n");
@@ -243,17 +413,56 @@ static void PrintHelp(void)
                           "                           Promiscuous mode disables packet filter in all INICS, so all Ethernet packets will be received by all nodes.\r\n");
     ConsolePrintfContinue("  -local                   Special mode for INICnet sniffer. Messages sent to local attached INIC will be duplicated sent to debug node address.\r\n");
     ConsolePrintfContinue("  -lld                     Prints out the byte arrays send and received via Low Level Driver\r\n");
+    ConsolePrintfContinue("  -lldcap [File]           Captures the byte arrays send and received via Low Level Driver into a pcap file,\r\n");
+    ConsolePrintfContinue("                           without disturbing the timing. Use unicens-lldtrace to decode it\r\n");
+    ConsolePrintfContinue("  -lldrotate [Size]        Only valid along with -lldcap. When the capture file reaches [Size] kB, it is renamed\r\n");
+    ConsolePrintfContinue("                           to [File].1 and a new one is started\r\n");
+    ConsolePrintfContinue("  -replay [File]           Replays a capture written with -lldcap instead of using the INIC. Received messages are passed\r\n");
+    ConsolePrintfContinue("                           to UNICENS, as soon as it has sent the messages preceding them in the capture. When finished,\r\n");
+    ConsolePrintfContinue("                           throughput, latencies and CPU time are printed and the daemon terminates\r\n");
+    ConsolePrintfContinue("  -replayspeed [Factor]    Only valid along with -replay. 1 replays the recorded response times of the INIC (default),\r\n");
+    ConsolePrintfContinue("                           10 replays ten times faster, 0 as fast as possible\r\n");
+    ConsolePrintfContinue("  -metrics [File]          Exports command, traffic and error counters and latency histograms in the Prometheus\r\n");
+    ConsolePrintfContinue("                           text format into the given file (e.g. for the textfile collector of node_exporter)\r\n");
+    ConsolePrintfContinue("  -metricsinterval [ms]    Only valid along with -metrics. Interval the file is rewritten with, default is 1000 ms\r\n");
     ConsolePrintfContinue("  -program [Node Count]    Enables automatic reprogramming mode. If there is a node address collision,\r\n");
     ConsolePrintfContinue("                           the conflicting devices will get the next free node address assigned. By default the changes are\r\n");
     ConsolePrintfContinue("                           written to RAM only (not persistent). The programming starts when the number of devices found reaches\r\n");
     ConsolePrintfContinue("                           the given [Node Count] value.\r\n");
     ConsolePrintfContinue("  --persistent             Only valid along with -program parameter. If set, the changes are written into persistent memory (Flash or OTP)\r\n");
     ConsolePrintfContinue("                           !!WARNING: Use this parameter with care. On OS8121/0/2/4/6 you can only write changes two times!!\r\n");
+    ConsolePrintfContinue("  -scene [Name]            Switches to the given scene of the XML file, as soon as the network is running\r\n");
+    ConsolePrintfContinue("  -status [Name]           Name of the shared memory, the node, route and resource states are published to.\r\n");
+    ConsolePrintfContinue("                           Default is \"/unicensd-status\", use unicens-status to dump it\r\n");
+    ConsolePrintfContinue("  -blog [File]             Writes all messages except errors unformatted into the given binary file,\r\n");
+    ConsolePrintfContinue("                           use unicens-logdecode to print it. Reduces the logging overhead along with -v and -vv\r\n");
     ConsolePrintfContinue("  --help                   Shows this help and exit\r\n\r\n");
+    ConsolePrintfContinue("Send SIGHUP to reload [FILE]. Unchanged routes keep streaming, only removed or (de)activated routes\r\n");
+    ConsolePrintfContinue("are switched and only changed scripts are executed. Changed nodes, bandwidths or route resources\r\n");
+    ConsolePrintfContinue("restart the whole network.\r\n");
+    ConsolePrintfContinue("Send SIGUSR1 to switch to the next scene of [FILE]. Only routes differing from the current state are switched.\r\n\r\n");
     ConsolePrintfContinue("Examples:\r\n");
     ConsolePrintfExit("  unicensd -default\r\n");
+    ConsolePrintfExit("  unicensd -variant video_on_demand\r\n");
+    ConsolePrintfExit("  unicensd -variant auto\r\n");
     ConsolePrintfExit("  unicensd config.xml\r\n");
+    ConsolePrintfExit("  unicensd config.bin\r\n");
     ConsolePrintfExit("  unicensd config.xml -drv1 0x200\r\n");
+    ConsolePrintfExit("  unicensd config.xml -scene PhoneCall\r\n");
     ConsolePrintfExit("  unicensd config.xml -drv1 0x200:1-1.3:1\r\n");
     ConsolePrintfExit("  unicensd -ctx /dev/inic-control-tx -crx /dev/inic-control-rx\r\n");
+    ConsolePrintfExit("  unicensd config.xml -replay startup.pcap -replayspeed 0\r\n");
+    ConsolePrintfExit("  unicensd config.xml -metrics /var/lib/node_exporter/unicensd.prom\r\n");
+}
+
+static void OnSignalHangup(int sig)
+{
+    sig = sig;
+    TaskUnicens_RequestReload();
+}
+
+static void OnSignalUser1(int sig)
+{
+    sig = sig;
+    TaskUnicens_RequestNextScene();
 }
@@ -39,12 +39,20 @@
 #include <time.h>
 #include <semaphore.h>
 #include "Console.h"
+#include "LldTrace.h"
+#include "LldReplay.h"
+#include "Metrics.h"
 #include "ucsi_api.h"
+#include "ucsi_status.h"
+#include "ucs_cfg.h"
+#include "ucs_xrm_cfg.h"
 #include "UcsXml.h"
 #include "CdevHandler.h"
 #include "mld-configurator-v1.h"
 #include "mld-configurator-v2.h"
 #include "default_config.h"
+#include "config-diff.h"
+#include "config-registry.h"
 #include "task-unicens.h"
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
@@ -60,6 +68,12 @@
 #define CDEV_PATH_LEN (64)
 #define DEBUG_TABLE_PRINT_TIME_MS  (250)
 #define CABLE_DIAGNOSYS_DELAY      (1000)
+#define MAX_STALE_CONFIGS          (3)
+#define DETECT_TIMEOUT             (5000)
+#define MAX_DETECTED_NODES         (64)
+#define DETECT_VARIANT_NAME        "auto"
+/* Longer port messages are cut when printed with -lld, use -lldcap to get them completely */
+#define LLD_PRINT_MAX              (256)
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                      DEFINES AND LOCAL VARIABLES                     */
@@ -71,6 +85,18 @@ typedef struct
     bool lldTrace;
     bool noRouteTable;
     UcsXmlVal_t *cfg;
+    UcsXmlVal_t *scriptCfg;
+    UcsXmlVal_t *retiredCfg;
+    UcsXmlVal_t *staleCfg[MAX_STALE_CONFIGS];
+    bool *routeActive;
+    const char *cfgFileName;
+    volatile sig_atomic_t reloadRequested;
+    volatile sig_atomic_t nextSceneRequested;
+    const char *sceneRequested;
+    int32_t sceneIndex;
+    bool scenePending;
+    bool unicensInitialized;
+    uint16_t pendingScripts;
     UCSI_Data_t unicens;
     bool unicensRunning;
     bool unicensTimeout;
@@ -88,23 +114,61 @@ typedef struct
     char controlTxCdev[CDEV_PATH_LEN];
     uint8_t programNodeCnt;
     bool programPersistent;
+    Ucs_Rm_Node_t *discoveryNodes;
+    Ucs_Rm_Node_t *staleDiscovery;
+    bool detecting;
+    bool detectDone;
+    uint32_t detectTimer;
+    uint8_t networkNodes;
+    uint16_t foundNodes[MAX_DETECTED_NODES];
+    uint16_t foundSize;
+    const char *replayName;
+    double replaySpeed;
+    volatile sig_atomic_t replayFinished;
+    const TaskUnicensEnv_t *env;
+    uint32_t replayAmsCount;
+    uint64_t replayNetworkUs;
+    uint64_t replayRoutesUs;
 } LocalVar_t;
 
 static LocalVar_t m;
 static char m_outbuf[300];
+static char m_lldHex[LLD_PRINT_MAX * 3 + 4];
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                     PRIVATE FUNCTION PROTOTYPES                      */
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
 static bool TimerInitialize(void);
-static void TimerSetTimeOut(uint16_t timeout, timer_t timer);
+static void TimerSetTimeOut(uint16_t timeout);
 static void UcsTimerOnTimeout(union sigval sv);
 static bool SemInitialize(void);
 static void SemWait(void);
 static void SemPost(void);
 static bool InitializeCdevs(void);
+static bool ControlGetRx(uint8_t **pData, uint32_t *len);
+static bool ControlPopRx(void);
+static bool ControlWrite(const uint8_t *pData, uint32_t len);
+static void PrintReplayReport(void);
+static void PrintReplayLatency(const char *name, const LldReplayLatency_t *pLatency);
 static uint32_t GetTicks(void);
+static void PrintLldMessage(bool isTx, const uint8_t *pData, uint32_t len);
+static bool StoreRouteStates(void);
+static bool IsReloadPossible(void);
+static void ReloadConfig(void);
+static void RestartWithConfig(UcsXmlVal_t *next);
+static void FreeStaleConfigs(void);
+static void CheckBandwidth(const UcsXmlVal_t *cfg);
+static void CheckPools(const UcsXmlVal_t *cfg);
+static bool IsSceneSwitchPossible(void);
+static void SwitchScene(void);
+static void StoreSceneStates(const UcsXmlScene_t *scene);
+static bool StartDefaultConfig(const char *variantName);
+static bool StartCompiledConfig(const DefaultConfig_t *cfg);
+static bool StartDiscovery(void);
+static void AddFoundNode(uint16_t nodeAddress);
+static void UpdateDetection(void);
+static void ApplyDetectedConfig(void);
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                         PUBLIC FUNCTIONS                             */
@@ -125,6 +189,11 @@ bool TaskUnicens_Init(TaskUnicens_t *pVar)
     m.promiscuousMode = pVar->promiscuousMode;
     m.programNodeCnt = pVar->programNodeCnt;
     m.programPersistent = pVar->programPersistent;
+    m.sceneRequested = pVar->sceneName;
+    m.sceneIndex = -1;
+    m.replayName = pVar->replayName;
+    m.replaySpeed = pVar->replaySpeed;
+    m.env = pVar->env;
     if (!TimerInitialize() || !SemInitialize())
     {
         ConsolePrintf(PRIO_ERROR, RED "Failed to initialize timer/threading resources" RESETCOLOR "\r\n");
@@ -138,7 +207,25 @@ bool TaskUnicens_Init(TaskUnicens_t *pVar)
             ConsolePrintf(PRIO_ERROR, RED "XML Parser error" RESETCOLOR "\r\n");
             return false;
         }
+        CheckBandwidth(m.cfg);
+        CheckPools(m.cfg);
+        m.scriptCfg = m.cfg;
+        m.cfgFileName = pVar->cfgFileName;
+        if (!StoreRouteStates())
+        {
+            ConsolePrintf(PRIO_ERROR, RED "Failed to allocate route states" RESETCOLOR "\r\n");
+            return false;
+        }
     }
+    if (!UCSIStatus_Open(pVar->statusName))
+        ConsolePrintf(PRIO_ERROR, YELLOW "Could not create status shared memory, status will not be published" RESETCOLOR "\r\n");
+    if (NULL != pVar->lldCaptureName && !LldTrace_Open(pVar->lldCaptureName, pVar->lldCaptureSize))
+        ConsolePrintf(PRIO_ERROR, YELLOW "Could not create LLD capture file='%s', port messages will not be captured" RESETCOLOR "\r\n",
+            pVar->lldCaptureName);
+    if (NULL != pVar->metricsName && !Metrics_Open(pVar->metricsName,
+        0 != pVar->metricsInterval ? pVar->metricsInterval : METRICS_DEFAULT_INTERVAL))
+        ConsolePrintf(PRIO_ERROR, YELLOW "Could not start metrics export to file='%s', metrics will not be exported" RESETCOLOR "\r\n",
+            pVar->metricsName);
     /* Initialize UNICENS */
     UCSI_Init(&m.unicens, &m, pVar->debugLocalMsg);
     if (m.programPersistent && 0 == m.programNodeCnt)
@@ -195,14 +282,9 @@ bool TaskUnicens_Init(TaskUnicens_t *pVar)
             return false;
         }
     }
-    else
+    else if (!StartDefaultConfig(pVar->variantName))
     {
-        if (!UCSI_NewConfig(&m.unicens, PacketBandwidth, ProxyBandwidth, AllRoutes, RoutesSize, AllNodes, NodeSize, m.programNodeCnt, m.programPersistent))
-        {
-            ConsolePrintf(PRIO_ERROR, RED "Could not enqueue default UNICENS config" RESETCOLOR "\r\n");
-            assert(false);
-            return false;
-        }
+        return false;
     }
     if (!InitializeCdevs())
     {
@@ -213,8 +295,17 @@ bool TaskUnicens_Init(TaskUnicens_t *pVar)
     return true;
 }
 
-void TaskUnicens_Service(void)
+bool TaskUnicens_Service(void)
+{
+    if (!TaskUnicens_Process())
+        return false;
+    SemWait();
+    return true;
+}
+
+bool TaskUnicens_Process(void)
 {
+    uint64_t startUs = Metrics_GetUs();
     /* UNICENS Service */
     if (m.unicensTrigger)
     {
@@ -230,29 +321,24 @@ void TaskUnicens_Service(void)
     {
         uint8_t *pData;
         uint32_t len;
-        if (Cdev_GetRx(&m.ctrlRx, &pData, &len))
+        if (ControlGetRx(&pData, &len))
         {
             if (!m.unicensRunning)
             {
                 /* Discard data, UNICENS is not yet ready */
                 m.unicensDataAvailable = false;
-                Cdev_PopRx(&m.ctrlRx);
+                ControlPopRx();
             }
             else if (UCSI_ProcessRxData(&m.unicens, pData, len))
             {
+                Metrics_Add(MetricsCounter_RxFrames, 1);
+                Metrics_Add(MetricsCounter_RxBytes, len);
+                LldTrace_Capture(LldTraceDir_Rx, pData, len);
                 if (m.lldTrace)
-                {
-                    uint32_t i;
-                    ConsolePrintfStart( PRIO_HIGH, YELLOW "%08d: MSG_RX: ", GetTicks());
-                    for ( i = 0; i < len; i++ )
-                    {
-                        ConsolePrintfContinue( "%02X ", pData[i] );
-                    }
-                    ConsolePrintfExit(RESETCOLOR"\n");
-                }
+                    PrintLldMessage(false, pData, len);
                 /*Remove flag only in case of successful enqueuing*/
                 m.unicensDataAvailable = false;
-                Cdev_PopRx(&m.ctrlRx);
+                ControlPopRx();
             }
             else
             {
@@ -272,6 +358,7 @@ void TaskUnicens_Service(void)
         m.amsReceived = false;
         if (UCSI_GetAmsMessage(&m.unicens, &amsId, &sourceAddress, &pBuf, &len))
         {
+            ++m.replayAmsCount;
             if (m.lldTrace)
             {
                 ConsolePrintf(PRIO_HIGH, "Received AMS, id=0x%X, source=0x%X, len=%u\r\n", amsId, sourceAddress, len);
@@ -285,7 +372,65 @@ void TaskUnicens_Service(void)
         ConsolePrintf(PRIO_HIGH, "Starting network diagnosis..\r\n");
         UCSI_RunCableDiagnosis(&m.unicens);
     }
-    SemWait();
+    if (m.detecting && (m.detectDone || (m.detectTimer && GetTicks() >= m.detectTimer)))
+    {
+        ApplyDetectedConfig();
+    }
+    if (m.reloadRequested && IsReloadPossible())
+    {
+        m.reloadRequested = false;
+        ReloadConfig();
+    }
+    if ((NULL != m.sceneRequested || m.nextSceneRequested) && IsSceneSwitchPossible())
+    {
+        SwitchScene();
+    }
+    if (m.replayFinished)
+    {
+        PrintReplayReport();
+        LldReplay_Close();
+        m.allowRun = false;
+        return false;
+    }
+    Metrics_ServiceDuration((uint32_t)(Metrics_GetUs() - startUs));
+    return true;
+}
+
+bool TaskUnicens_IsPending(void)
+{
+    return m.allowRun && (m.unicensTrigger || m.unicensTimeout || m.unicensDataAvailable || m.amsReceived || m.replayFinished);
+}
+
+void TaskUnicens_OnTimeout(void)
+{
+    m.unicensTimeout = true;
+    SemPost();
+}
+
+void TaskUnicens_OnDataAvailable(void)
+{
+    m.unicensDataAvailable = true;
+    SemPost();
+}
+
+void TaskUnicens_RequestReload(void)
+{
+    m.reloadRequested = true;
+    SemPost();
+}
+
+void TaskUnicens_SwitchScene(const char *sceneName)
+{
+    if (NULL == sceneName)
+        return;
+    m.sceneRequested = sceneName;
+    SemPost();
+}
+
+void TaskUnicens_RequestNextScene(void)
+{
+    m.nextSceneRequested = true;
+    SemPost();
 }
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
@@ -311,6 +456,27 @@ void Cdev_CB_OnDataAvailable()
     SemPost();
 }
 
+void Cdev_CB_OnReopen()
+{
+    Metrics_Add(MetricsCounter_CdevReopens, 1);
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                 CALLBACK FUNCTION FROM REPLAY THREAD                 */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+void LldReplay_CB_OnDataAvailable(void)
+{
+    m.unicensDataAvailable = true;
+    SemPost();
+}
+
+void LldReplay_CB_OnFinished(void)
+{
+    m.replayFinished = true;
+    SemPost();
+}
+
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                  CALLBACK FUNCTIONS FROM UNICENS                     */
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
@@ -318,9 +484,29 @@ void Cdev_CB_OnDataAvailable()
 void UCSI_CB_OnCommandResult(void *pTag, UnicensCmd_t command, bool success, uint16_t nodeAddress)
 {
     pTag = pTag;
-    command = command;
-    success = success;
     nodeAddress = nodeAddress;
+    switch (command)
+    {
+        case UnicensCmd_Init:
+            m.unicensInitialized = success;
+            break;
+        case UnicensCmd_Stop:
+            m.unicensInitialized = false;
+            if (success)
+            {
+                /* UNICENS does not reference the previous route and node lists anymore,
+                 * scripts interrupted by the stop will never report their result */
+                m.pendingScripts = 0;
+                FreeStaleConfigs();
+            }
+            break;
+        case UnicensCmd_NsRun:
+            if (0 != m.pendingScripts)
+                --m.pendingScripts;
+            break;
+        default:
+            break;
+    }
 }
 
 uint16_t UCSI_CB_OnGetTime(void *pTag)
@@ -332,7 +518,7 @@ uint16_t UCSI_CB_OnGetTime(void *pTag)
 void UCSI_CB_OnSetServiceTimer(void *pTag, uint16_t timeout)
 {
     pTag = pTag;
-    TimerSetTimeOut(timeout, m.ucsTimer);
+    TimerSetTimeOut(timeout);
 }
 
 void UCSI_CB_OnNetworkState(void *pTag, bool isAvailable, uint16_t packetBandwidth, uint8_t amountOfNodes)
@@ -342,30 +528,61 @@ void UCSI_CB_OnNetworkState(void *pTag, bool isAvailable, uint16_t packetBandwid
                   isAvailable ? "yes" : "no",
                   packetBandwidth,
                   amountOfNodes);
+    if (isAvailable && NULL != m.replayName && 0 == m.replayNetworkUs)
+        m.replayNetworkUs = LldReplay_GetElapsedUs();
     if (isAvailable) {
         m.cableDiagnosisTimer = 0;
     } else {
         m.cableDiagnosisTimer = GetTicks() + CABLE_DIAGNOSYS_DELAY;
     }
+    if (m.detecting && isAvailable) {
+        m.networkNodes = amountOfNodes;
+        if (0 == m.detectTimer)
+            m.detectTimer = GetTicks() + DETECT_TIMEOUT;
+        UpdateDetection();
+    }
 }
 
 void UCSI_CB_OnUserMessage(void *pTag, UCSI_UserMessageUrgency_t urgency, const char format[], uint16_t vargsCnt, ...)
 {
     va_list argptr;
     char outbuf[300];
+    ConsolePrio_t prio;
     pTag = pTag;
+    switch(urgency)
+    {
+        case UCSI_MsgError:
+            prio = PRIO_ERROR;
+            break;
+        case UCSI_MsgUrgent:
+            prio = PRIO_HIGH;
+            break;
+        case UCSI_MsgDebug:
+        default:
+            prio = PRIO_LOW;
+            break;
+    }
+    /* Debug messages are the majority, do not format them just to discard them afterwards */
+    if (!ConsoleIsEnabled(prio))
+        return;
     va_start(argptr, vargsCnt);
+    if (ConsoleIsBinary() && PRIO_ERROR != prio)
+    {
+        /* Formatted later by unicens-logdecode */
+        ConsoleVPrintf(prio, format, argptr);
+        va_end(argptr);
+        return;
+    }
     vsnprintf(outbuf, sizeof(outbuf), format, argptr);
     va_end(argptr);
-    switch(urgency)
+    switch(prio)
     {
-        case UCSI_MsgError:
+        case PRIO_ERROR:
             ConsolePrintf(PRIO_ERROR, RED "%s" RESETCOLOR "\r\n", outbuf);
             break;
-        case UCSI_MsgUrgent:
+        case PRIO_HIGH:
             ConsolePrintf(PRIO_HIGH, YELLOW "%s" RESETCOLOR "\r\n", outbuf);
-            break;            
-        case UCSI_MsgDebug:
+            break;
         default:
             ConsolePrintf(PRIO_LOW, "%s\r\n", outbuf);
             break;
@@ -394,18 +611,13 @@ void UCSI_CB_OnTxRequest(void *pTag,
     const uint8_t *pPayload, uint32_t payloadLen)
 {
     pTag = pTag;
+    LldTrace_Capture(LldTraceDir_Tx, pPayload, payloadLen);
     if (m.lldTrace)
+        PrintLldMessage(true, pPayload, payloadLen);
+    if(ControlWrite(pPayload, payloadLen))
     {
-        uint32_t i;
-        ConsolePrintfStart( PRIO_HIGH, BLUE "%08d: MSG_TX: ", GetTicks());
-        for ( i = 0; i < payloadLen; i++ )
-        {
-            ConsolePrintfContinue( "%02X ", pPayload[i] );
-        }
-        ConsolePrintfExit(RESETCOLOR"\n");
-    }
-    if(Cdev_Write(&m.ctrlTx, pPayload, payloadLen))
-    {
+        Metrics_Add(MetricsCounter_TxFrames, 1);
+        Metrics_Add(MetricsCounter_TxBytes, payloadLen);
         if (m.txErrorState)
         {
             m.txErrorState = false;
@@ -444,12 +656,26 @@ void UCSI_CB_OnAmsMessageReceived(void *pTag)
 void UCSI_CB_OnRouteResult(void *pTag, uint16_t routeId, bool isActive, uint16_t connectionLabel)
 {
     pTag = pTag;
+    if (isActive && NULL != m.replayName)
+        m.replayRoutesUs = LldReplay_GetElapsedUs();
     if (isActive)
         ConsolePrintf(PRIO_MEDIUM, "Route id=0x%X isActive=true ConLabel=0x%X\r\n", routeId, connectionLabel);
     else
         ConsolePrintf(PRIO_MEDIUM, "Route id=0x%X isActive=" YELLOW "false" RESETCOLOR " ConLabel=0x%X\r\n", routeId, connectionLabel);
 }
 
+void UCSI_CB_OnSceneResult(void *pTag, bool success, uint16_t routeChanges, uint16_t durationMs)
+{
+    pTag = pTag;
+    m.scenePending = false;
+    if (success)
+        ConsolePrintf(PRIO_HIGH, GREEN "Scene switched, %d routes changed in %d ms" RESETCOLOR "\r\n", routeChanges, durationMs);
+    else
+        ConsolePrintf(PRIO_ERROR, RED "Scene switch failed, %d routes changed in %d ms" RESETCOLOR "\r\n", routeChanges, durationMs);
+    /* A reload may have been deferred by this scene switch */
+    SemPost();
+}
+
 void UCSI_CB_OnGpioStateChange(void *pTag, uint16_t nodeAddress, uint8_t gpioPinId, bool isHighState)
 {
     pTag = pTag;
@@ -460,6 +686,10 @@ void UCSI_CB_OnGpioStateChange(void *pTag, uint16_t nodeAddress, uint8_t gpioPin
 void UCSI_CB_OnMgrReport(void *pTag, Ucs_Supv_Report_t code, Ucs_Signature_t *signature, Ucs_Rm_Node_t *pNode)
 {
     pTag = pTag;
+    if (m.detecting && NULL != signature
+        && (UCS_SUPV_REP_AVAILABLE == code || UCS_SUPV_REP_IGNORED_UNKNOWN == code)) {
+        AddFoundNode(signature->node_address);
+    }
     if (NULL != signature && UCS_SUPV_REP_AVAILABLE == code) {
         ConsolePrintf(PRIO_MEDIUM, GREEN "*********************************************\r\n");
         ConsolePrintf(PRIO_MEDIUM, "* NODE SIGNATURE:\r\n");
@@ -535,6 +765,8 @@ void MldConfigV2_CB_OnMessage(bool isError, const char format[], uint16_t vargsC
 static bool TimerInitialize(void)
 {
     struct sigevent t_sev;
+    if (NULL != m.env)
+        return true;
     memset(&t_sev, 0, sizeof(t_sev));
     t_sev.sigev_notify = SIGEV_THREAD;
     t_sev.sigev_notify_function = &UcsTimerOnTimeout;
@@ -544,13 +776,18 @@ static bool TimerInitialize(void)
     return true;
 }
 
-static void TimerSetTimeOut(uint16_t timeout, timer_t timer)
+static void TimerSetTimeOut(uint16_t timeout)
 {
     struct itimerspec t_spec;
+    if (NULL != m.env)
+    {
+        m.env->setTimer(m.env->pTag, timeout);
+        return;
+    }
     memset(&t_spec, 0, sizeof(t_spec));
     t_spec.it_value.tv_sec = timeout / 1000;
     t_spec.it_value.tv_nsec = (timeout % 1000) * 1000000U;  /* value '0' disarms the timer */
-    timer_settime(timer, 0, &t_spec, NULL);
+    timer_settime(m.ucsTimer, 0, &t_spec, NULL);
 }
 
 static void UcsTimerOnTimeout(union sigval sv)
@@ -573,11 +810,23 @@ static void SemWait(void)
 
 static void SemPost(void)
 {
-    sem_post(&m.serviceSem);
+    /* With an environment, nobody waits, TaskUnicens_IsPending is polled instead */
+    if (NULL == m.env)
+        sem_post(&m.serviceSem);
 }
 
 static bool InitializeCdevs(void)
 {
+    if (NULL != m.env)
+    {
+        ConsolePrintf(PRIO_LOW, "Using the given environment instead of the control CDEVs\r\n");
+        return true;
+    }
+    if (NULL != m.replayName)
+    {
+        ConsolePrintf(PRIO_HIGH, YELLOW "Replaying '%s' instead of using the INIC" RESETCOLOR "\r\n", m.replayName);
+        return LldReplay_Open(m.replayName, m.replaySpeed);
+    }
     ConsolePrintf(PRIO_LOW, "RX-CDEV='%s', TX-CDEV='%s'\r\n", m.controlRxCdev, m.controlTxCdev);
     if(!Cdev_Init(&m.ctrlTx, m.controlTxCdev, false, true))
         return false;
@@ -588,9 +837,68 @@ static bool InitializeCdevs(void)
     return true;
 }
 
+static bool ControlGetRx(uint8_t **pData, uint32_t *len)
+{
+    if (NULL != m.env)
+        return m.env->getRx(m.env->pTag, pData, len);
+    if (NULL != m.replayName)
+        return LldReplay_GetRx(pData, len);
+    return Cdev_GetRx(&m.ctrlRx, pData, len);
+}
+
+static bool ControlPopRx(void)
+{
+    if (NULL != m.env)
+        return m.env->popRx(m.env->pTag);
+    if (NULL != m.replayName)
+        return LldReplay_PopRx();
+    return Cdev_PopRx(&m.ctrlRx);
+}
+
+static bool ControlWrite(const uint8_t *pData, uint32_t len)
+{
+    if (NULL != m.env)
+        return m.env->write(m.env->pTag, pData, len);
+    if (NULL != m.replayName)
+        return LldReplay_Write(pData, len);
+    return Cdev_Write(&m.ctrlTx, pData, len);
+}
+
+static void PrintReplayReport(void)
+{
+    LldReplayStats_t s;
+    double replayMs, cpuMs;
+    if (!LldReplay_GetStats(&s))
+        return;
+    replayMs = s.replayUs / 1000.0;
+    cpuMs = (s.cpuUserUs + s.cpuSystemUs) / 1000.0;
+    ConsolePrintfStart(PRIO_HIGH, GREEN "Replay finished in %.3f ms, recorded %.3f ms" RESETCOLOR "\r\n",
+        replayMs, s.recordedUs / 1000.0);
+    ConsolePrintfContinue("  Messages    : %u received, %u sent, %u sent but not recorded, %u recorded but not sent, %u not replayable\r\n",
+        s.rxMessages, s.txMatched, s.txUnexpected, s.txMissing, s.skipped);
+    ConsolePrintfContinue("  Throughput  : %.0f messages/s\r\n",
+        (0.0 < replayMs) ? (s.rxMessages + s.txMatched + s.txUnexpected) * 1000.0 / replayMs : 0.0);
+    ConsolePrintfContinue("  CPU         : user %.3f ms, system %.3f ms, %.1f %%\r\n",
+        s.cpuUserUs / 1000.0, s.cpuSystemUs / 1000.0, (0.0 < replayMs) ? cpuMs * 100.0 / replayMs : 0.0);
+    PrintReplayLatency("Delivery", &s.delivery);
+    PrintReplayLatency("Response", &s.response);
+    ConsolePrintfContinue("  Milestones  : network available after %.3f ms, last route built after %.3f ms, %u AMS received\r\n",
+        m.replayNetworkUs / 1000.0, m.replayRoutesUs / 1000.0, m.replayAmsCount);
+    ConsolePrintfExit("\r\n");
+}
+
+static void PrintReplayLatency(const char *name, const LldReplayLatency_t *pLatency)
+{
+    ConsolePrintfContinue("  %-12s: %u samples, min %u us, avg %u us, p50 %u us, p99 %u us, max %u us\r\n", name, pLatency->count,
+        pLatency->minUs, (0 != pLatency->count) ? (uint32_t)(pLatency->sumUs / pLatency->count) : 0,
+        LldReplay_GetPercentile(pLatency, 50), LldReplay_GetPercentile(pLatency, 99), pLatency->maxUs);
+}
+
 static uint32_t GetTicks( void )
 {
     struct timespec currentTime;
+    if (NULL != m.env)
+        return m.env->getTicks(m.env->pTag);
     if (clock_gettime(CLOCK_SRC, &currentTime))
     {
         assert(false);
@@ -598,3 +906,337 @@ static uint32_t GetTicks( void )
     }
     return ( currentTime.tv_sec * 1000 ) + ( currentTime.tv_nsec / 1000000 );
 }
+
+/* Formats the whole message at once, instead of passing every byte to the console */
+static void PrintLldMessage(bool isTx, const uint8_t *pData, uint32_t len)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    uint32_t i, pos = 0;
+    for (i = 0; i < len && i < LLD_PRINT_MAX; i++)
+    {
+        m_lldHex[pos++] = hex[pData[i] >> 4];
+        m_lldHex[pos++] = hex[pData[i] & 0xF];
+        m_lldHex[pos++] = ' ';
+    }
+    if (LLD_PRINT_MAX < len)
+    {
+        memcpy(&m_lldHex[pos], "...", 3);
+        pos += 3;
+    }
+    m_lldHex[pos] = '\0';
+    ConsolePrintf(PRIO_HIGH, "%s%08d: MSG_%s: %s" RESETCOLOR "\n", isTx ? BLUE : YELLOW, GetTicks(),
+        isTx ? "TX" : "RX", m_lldHex);
+}
+
+static bool StoreRouteStates(void)
+{
+    uint16_t i;
+    free(m.routeActive);
+    m.routeActive = NULL;
+    if (0 == m.cfg->routesSize)
+        return true;
+    m.routeActive = calloc(m.cfg->routesSize, sizeof(bool));
+    if (NULL == m.routeActive)
+        return false;
+    /* Must be called before UNICENS starts, as it changes the active flag of the routes */
+    for (i = 0; i < m.cfg->routesSize; i++)
+        m.routeActive[i] = (0 != m.cfg->pRoutes[i].active);
+    return true;
+}
+
+static bool IsReloadPossible(void)
+{
+    if (NULL == m.cfgFileName)
+    {
+        ConsolePrintf(PRIO_ERROR, YELLOW "Reload ignored, the compiled default configuration is used" RESETCOLOR "\r\n");
+        m.reloadRequested = false;
+        return false;
+    }
+    /* Scripts of the previous reload may still use the old configuration, the same for a pending restart.
+     * A running scene switch uses the route identifiers of the newest configuration */
+    return m.unicensInitialized && 0 == m.pendingScripts && NULL == m.staleCfg[0] && !m.scenePending;
+}
+
+static void ReloadConfig(void)
+{
+    uint16_t i;
+    ConfigDiff_t diff;
+    UcsXmlVal_t *next;
+    ConsolePrintf(PRIO_HIGH, "Reloading configuration '%s'\r\n", m.cfgFileName);
+    next = UcsXml_ParseFile(m.cfgFileName);
+    if (NULL == next)
+    {
+        ConsolePrintf(PRIO_ERROR, RED "XML Parser error, keeping the running configuration" RESETCOLOR "\r\n");
+        return;
+    }
+    CheckBandwidth(next);
+    CheckPools(next);
+    if (!ConfigDiff_Compare(m.cfg, m.routeActive, next, &diff))
+    {
+        ConsolePrintf(PRIO_HIGH, YELLOW "Restarting network, %s" RESETCOLOR "\r\n", diff.restartReason);
+        RestartWithConfig(next);
+        return;
+    }
+    for (i = 0; i < m.cfg->routesSize; i++)
+    {
+        Ucs_Rm_Route_t *route = &m.cfg->pRoutes[i];
+        bool wanted = ConfigDiff_IsRouteWanted(next, route);
+        if (wanted == m.routeActive[i])
+            continue;
+        if (UCSI_SetRouteActive(&m.unicens, route->route_id, wanted))
+            m.routeActive[i] = wanted;
+        else
+            ConsolePrintf(PRIO_ERROR, RED "Could not enqueue route id=0x%X isActive=%s" RESETCOLOR "\r\n",
+                route->route_id, wanted ? "true" : "false");
+    }
+    for (i = 0; i < m.cfg->nodSize; i++)
+    {
+        Ucs_Rm_Node_t *node = &m.cfg->pNod[i];
+        Ucs_Rm_Node_t *nextNode = ConfigDiff_FindNode(next, node->signature_ptr->node_address);
+        assert(NULL != nextNode);
+        if (!ConfigDiff_ScriptsEqual(node, nextNode) && 0 != nextNode->init_script_list_size)
+        {
+            if (UCSI_ExecuteScript(&m.unicens, node->signature_ptr->node_address,
+                (Ucs_Ns_Script_t *)nextNode->init_script_list_ptr, nextNode->init_script_list_size))
+                ++m.pendingScripts;
+            else
+                ConsolePrintf(PRIO_ERROR, RED "Could not enqueue script for node=0x%X" RESETCOLOR "\r\n",
+                    node->signature_ptr->node_address);
+        }
+        /* UNICENS runs the new scripts, when the node is attached again */
+        node->init_script_list_ptr = nextNode->init_script_list_ptr;
+        node->init_script_list_size = nextNode->init_script_list_size;
+    }
+    /* Every node points to the new scripts now. The previous ones are kept one more reload,
+     * in case UNICENS is just executing them for a node, which was attached right now */
+    if (NULL != m.retiredCfg)
+        UcsXml_FreeVal(m.retiredCfg);
+    m.retiredCfg = (m.scriptCfg != m.cfg) ? m.scriptCfg : NULL;
+    m.scriptCfg = next;
+    ConsolePrintf(PRIO_HIGH, GREEN "Configuration reloaded, routes disabled=%d enabled=%d unchanged=%d, scripts changed=%d" RESETCOLOR "\r\n",
+        diff.routesToDisable, diff.routesToEnable, diff.routesUnchanged, diff.scriptsChanged);
+}
+
+static void RestartWithConfig(UcsXmlVal_t *next)
+{
+    uint8_t staleCnt = 0;
+    /* UNICENS uses the old lists until the stop command has finished */
+    m.staleCfg[staleCnt++] = m.cfg;
+    if (m.scriptCfg != m.cfg)
+        m.staleCfg[staleCnt++] = m.scriptCfg;
+    if (NULL != m.retiredCfg)
+        m.staleCfg[staleCnt++] = m.retiredCfg;
+    m.cfg = next;
+    m.scriptCfg = next;
+    m.retiredCfg = NULL;
+    if (!StoreRouteStates())
+        ConsolePrintf(PRIO_ERROR, RED "Failed to allocate route states" RESETCOLOR "\r\n");
+    if (!UCSI_NewConfig(&m.unicens, m.cfg->packetBw, m.cfg->proxyBw, m.cfg->pRoutes, m.cfg->routesSize, m.cfg->pNod, m.cfg->nodSize, m.programNodeCnt, m.programPersistent))
+        ConsolePrintf(PRIO_ERROR, RED "Could not enqueue reloaded UNICENS config" RESETCOLOR "\r\n");
+}
+
+static void FreeStaleConfigs(void)
+{
+    uint8_t i;
+    for (i = 0; i < MAX_STALE_CONFIGS; i++)
+    {
+        if (NULL != m.staleCfg[i])
+            UcsXml_FreeVal(m.staleCfg[i]);
+        m.staleCfg[i] = NULL;
+    }
+    ConfigRegistry_FreeDiscovery(m.staleDiscovery);
+    m.staleDiscovery = NULL;
+}
+
+static void CheckBandwidth(const UcsXmlVal_t *cfg)
+{
+    UcsXmlBandwidth_t bw;
+    if (!UcsXml_AnalyzeBandwidth(cfg, &bw, NULL, 0, NULL))
+        return;
+    ConsolePrintf(PRIO_MEDIUM, "Network bandwidth=%u async=%u proxy=%u, routes peak=%u (%s), headroom=%d bytes\r\n",
+        bw.networkBw, bw.packetBw, bw.proxyBw, bw.peakBw, bw.peakScene ? bw.peakScene->name : "startup", bw.headroom);
+    if (bw.oversubscribed)
+        ConsolePrintf(PRIO_ERROR, RED "Network oversubscribed by %d bytes, routes may fail to build. Set AsyncBandwidth to %u or less" RESETCOLOR "\r\n",
+            -bw.headroom, bw.proposedPacketBw);
+}
+
+static void CheckPools(const UcsXmlVal_t *cfg)
+{
+    UcsXmlPoolUsage_t usage;
+    if (!UcsXml_GetPoolUsage(cfg, &usage))
+        return;
+    /* The node list contains the local INIC as well */
+    if (UCS_XRM_NUM_JOBS < usage.endpoints || UCS_XRM_NUM_RESOURCES < usage.resources
+        || UCS_NUM_REMOTE_DEVICES + 1 < usage.nodes)
+        ConsolePrintf(PRIO_ERROR, RED "UNICENS pools too small, endpoints=%u/%u resources=%u/%u nodes=%u/%u. Regenerate ucs_pool_cfg.h with xml2struct -pool" RESETCOLOR "\r\n",
+            usage.endpoints, UCS_XRM_NUM_JOBS, usage.resources, UCS_XRM_NUM_RESOURCES, usage.nodes, UCS_NUM_REMOTE_DEVICES + 1);
+}
+
+static bool IsSceneSwitchPossible(void)
+{
+    if (NULL == m.scriptCfg)
+    {
+        ConsolePrintf(PRIO_ERROR, YELLOW "Scene switch ignored, the compiled default configuration is used" RESETCOLOR "\r\n");
+        m.sceneRequested = NULL;
+        m.nextSceneRequested = false;
+        return false;
+    }
+    return m.unicensInitialized && !m.scenePending && NULL == m.staleCfg[0];
+}
+
+static void SwitchScene(void)
+{
+    uint16_t i;
+    const UcsXmlScene_t *scene = NULL;
+    /* The newest configuration holds the current scenes, route identifiers never change without a restart */
+    const UcsXmlVal_t *cfg = m.scriptCfg;
+    if (NULL != m.sceneRequested)
+    {
+        for (i = 0; i < cfg->sceneSize; i++)
+        {
+            if (0 == strcmp(m.sceneRequested, cfg->pScenes[i].name))
+            {
+                scene = &cfg->pScenes[i];
+                m.sceneIndex = i;
+                break;
+            }
+        }
+        if (NULL == scene)
+            ConsolePrintf(PRIO_ERROR, RED "Scene '%s' is not defined" RESETCOLOR "\r\n", m.sceneRequested);
+    }
+    else if (0 != cfg->sceneSize)
+    {
+        m.sceneIndex = (m.sceneIndex + 1) % cfg->sceneSize;
+        scene = &cfg->pScenes[m.sceneIndex];
+    }
+    else
+    {
+        ConsolePrintf(PRIO_ERROR, YELLOW "No scene defined in configuration" RESETCOLOR "\r\n");
+    }
+    m.sceneRequested = NULL;
+    m.nextSceneRequested = false;
+    if (NULL == scene)
+        return;
+    if (!UCSI_SwitchScene(&m.unicens, scene->pActiveRoutes, scene->activeSize, scene->pInactiveRoutes, scene->inactiveSize))
+    {
+        ConsolePrintf(PRIO_ERROR, RED "Could not enqueue scene '%s'" RESETCOLOR "\r\n", scene->name);
+        return;
+    }
+    ConsolePrintf(PRIO_HIGH, "Switching to scene '%s'\r\n", scene->name);
+    m.scenePending = true;
+    StoreSceneStates(scene);
+}
+
+static void StoreSceneStates(const UcsXmlScene_t *scene)
+{
+    uint16_t i, j;
+    /* Keep the reload comparison in sync with the state set by the scene */
+    for (i = 0; NULL != m.routeActive && i < m.cfg->routesSize; i++)
+    {
+        uint16_t routeId = m.cfg->pRoutes[i].route_id;
+        for (j = 0; j < scene->activeSize; j++)
+        {
+            if (routeId == scene->pActiveRoutes[j])
+                m.routeActive[i] = true;
+        }
+        for (j = 0; j < scene->inactiveSize; j++)
+        {
+            if (routeId == scene->pInactiveRoutes[j])
+                m.routeActive[i] = false;
+        }
+    }
+}
+
+static bool StartDefaultConfig(const char *variantName)
+{
+    uint16_t i;
+    const DefaultConfig_t *cfg;
+    if (NULL != variantName && 0 == strcmp(DETECT_VARIANT_NAME, variantName) && 1 < DefaultConfigsSize)
+        return StartDiscovery();
+    if (NULL != variantName && 0 == strcmp(DETECT_VARIANT_NAME, variantName))
+        variantName = NULL; /* Nothing to choose from */
+    cfg = ConfigRegistry_Find(variantName);
+    if (NULL == cfg)
+    {
+        ConsolePrintfStart(PRIO_ERROR, RED "Configuration '%s' is not compiled in, available are:", variantName ? variantName : "");
+        for (i = 0; i < DefaultConfigsSize; i++)
+            ConsolePrintfContinue(" %s", DefaultConfigs[i].name);
+        ConsolePrintfExit(RESETCOLOR "\r\n");
+        return false;
+    }
+    return StartCompiledConfig(cfg);
+}
+
+static bool StartCompiledConfig(const DefaultConfig_t *cfg)
+{
+    ConsolePrintf(PRIO_HIGH, "Starting compiled configuration '%s'\r\n", cfg->name);
+    if (!UCSI_NewConfig(&m.unicens, cfg->packetBw, cfg->proxyBw, cfg->pRoutes, cfg->routesSize,
+        cfg->pNodes, cfg->nodesSize, m.programNodeCnt, m.programPersistent))
+    {
+        ConsolePrintf(PRIO_ERROR, RED "Could not enqueue default UNICENS config" RESETCOLOR "\r\n");
+        assert(false);
+        return false;
+    }
+    return true;
+}
+
+static bool StartDiscovery(void)
+{
+    uint16_t nodesSize;
+    /* No routes and no scripts, UNICENS only reports the found nodes. The bandwidth of the
+     * first configuration is taken, the network is restarted with the chosen one anyway */
+    if (!ConfigRegistry_CreateDiscovery(&m.discoveryNodes, &nodesSize))
+    {
+        ConsolePrintf(PRIO_ERROR, RED "Could not create node list for configuration detection" RESETCOLOR "\r\n");
+        return false;
+    }
+    ConsolePrintf(PRIO_HIGH, "Detecting configuration out of %u compiled ones by %u possible nodes\r\n", DefaultConfigsSize, nodesSize);
+    m.detecting = true;
+    if (!UCSI_NewConfig(&m.unicens, DefaultConfigs[0].packetBw, DefaultConfigs[0].proxyBw, NULL, 0,
+        m.discoveryNodes, nodesSize, m.programNodeCnt, m.programPersistent))
+    {
+        ConsolePrintf(PRIO_ERROR, RED "Could not enqueue UNICENS config for detection" RESETCOLOR "\r\n");
+        assert(false);
+        return false;
+    }
+    return true;
+}
+
+static void AddFoundNode(uint16_t nodeAddress)
+{
+    uint16_t i;
+    for (i = 0; i < m.foundSize; i++)
+    {
+        if (m.foundNodes[i] == nodeAddress)
+            return;
+    }
+    if (MAX_DETECTED_NODES <= m.foundSize)
+        return;
+    m.foundNodes[m.foundSize++] = nodeAddress;
+    UpdateDetection();
+}
+
+static void UpdateDetection(void)
+{
+    /* Nodes, which do not answer, are covered by the timeout */
+    if (0 != m.networkNodes && m.foundSize >= m.networkNodes)
+    {
+        m.detectDone = true;
+        SemPost();
+    }
+}
+
+static void ApplyDetectedConfig(void)
+{
+    const DefaultConfig_t *cfg = ConfigRegistry_Match(m.foundNodes, m.foundSize);
+    assert(NULL != cfg);
+    m.detecting = false;
+    m.detectDone = false;
+    m.detectTimer = 0;
+    ConsolePrintf(PRIO_HIGH, GREEN "Detected configuration '%s' by %u of %u nodes" RESETCOLOR "\r\n",
+        cfg->name, m.foundSize, m.networkNodes);
+    /* UNICENS uses the discovery list until the stop command has finished */
+    m.staleDiscovery = m.discoveryNodes;
+    m.discoveryNodes = NULL;
+    StartCompiledConfig(cfg);
+}
@@ -39,6 +39,29 @@ extern "C" {
 /*                            Public API                                */
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
     
+/**
+ * \brief Replaces the clock, the service timer and the control channel of the UNICENS Task, so it can run in
+ *        virtual time on a single thread, e.g. against a simulated INIC.
+ * \note Without it, CLOCK_MONOTONIC_RAW, a POSIX timer and the control CDEVs (or the replayed capture) are used.
+ * \note With it, TaskUnicens_Service must not be used. Call TaskUnicens_Process as long as TaskUnicens_IsPending
+ *       returns true and whenever the time was advanced.
+ */
+typedef struct
+{
+    /** Passed to all functions */
+    void *pTag;
+    /** Returns the current time in milliseconds */
+    uint32_t (*getTicks)(void *pTag);
+    /** Arms the service timer, 0 disarms it. Call TaskUnicens_OnTimeout, when it has expired */
+    void (*setTimer)(void *pTag, uint16_t timeout);
+    /** Returns the oldest port message received from the INIC without removing it */
+    bool (*getRx)(void *pTag, uint8_t **pData, uint32_t *len);
+    /** Removes the port message returned by getRx */
+    bool (*popRx)(void *pTag);
+    /** Sends a port message to the INIC */
+    bool (*write)(void *pTag, const uint8_t *pData, uint32_t len);
+} TaskUnicensEnv_t;
+
 typedef struct
 {
     bool noRouteTable;
@@ -53,6 +76,16 @@ typedef struct
     char *controlTxCdev;
     uint8_t programNodeCnt;
     bool programPersistent;
+    const char *sceneName;
+    const char *variantName;
+    const char *statusName;
+    const char *lldCaptureName;
+    uint32_t lldCaptureSize;
+    const char *replayName;
+    double replaySpeed;
+    const char *metricsName;
+    uint32_t metricsInterval;
+    const TaskUnicensEnv_t *env;
 } TaskUnicens_t;
 
 /**
@@ -65,8 +98,56 @@ bool TaskUnicens_Init(TaskUnicens_t *pVar);
 
 /**
  * \brief Gives the UNICENS Task time to maintain it's service routines
+ * \return true, if it shall be called again. false, if the task has finished, this only happens after replaying a capture
+ */
+bool TaskUnicens_Service(void);
+
+/**
+ * \brief Does the work pending in the UNICENS Task without waiting for new events
+ * \note TaskUnicens_Service calls it before waiting, call it directly only when running with an environment
+ * \return true, if it shall be called again. false, if the task has finished, this only happens after replaying a capture
+ */
+bool TaskUnicens_Process(void);
+
+/**
+ * \brief Checks if TaskUnicens_Process has work to do
+ * \return true, if there is pending work. false, if the task waits for new events.
+ */
+bool TaskUnicens_IsPending(void);
+
+/**
+ * \brief Signals the expiry of the service timer armed by the environment
+ */
+void TaskUnicens_OnTimeout(void);
+
+/**
+ * \brief Signals that the environment has received a port message from the INIC
+ */
+void TaskUnicens_OnDataAvailable(void);
+
+/**
+ * \brief Requests to reload the XML file given by cfgFileName
+ * \note Routes, which were not changed, keep streaming. Only removed or deactivated routes are
+ *       destroyed, only (re)activated routes are built and only changed scripts are executed.
+ *       A full restart is done, if nodes, bandwidths or the resources of a route have changed.
+ * \note Safe to be called from a signal handler or any other thread, the reload is done by TaskUnicens_Service
+ */
+void TaskUnicens_RequestReload(void);
+
+/**
+ * \brief Requests to switch to the scene with the given name, as defined in the XML file
+ * \note Only the routes differing from their current state are switched, all deactivations are done before
+ *       the first activation. The switch is done by TaskUnicens_Service, as soon as UNICENS is running.
+ * \note Call this function from the same thread as TaskUnicens_Service
+ * \param sceneName - Name of the scene, the string must stay valid until the switch has started
+ */
+void TaskUnicens_SwitchScene(const char *sceneName);
+
+/**
+ * \brief Requests to switch to the scene following the current one, in the order of the XML file
+ * \note Safe to be called from a signal handler or any other thread
  */
-void TaskUnicens_Service(void);
+void TaskUnicens_RequestNextScene(void);
 
 #ifdef __cplusplus
 }
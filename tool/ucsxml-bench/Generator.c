@@ -0,0 +1,191 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Stucture Printing module                                                               */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include "Generator.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                        PRIVATE DEFINES                               */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define FIRST_NODE_ADDRESS  (0x200)
+#define USB_ENDPOINTS       (15)
+#define INITIAL_SIZE        (64 * 1024)
+
+typedef struct
+{
+    char *data;
+    size_t size;
+    size_t capacity;
+    bool failed;
+} Buffer_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVATE FUNCTION PROTOTYPES                      */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void Append(Buffer_t *buf, const char *format, ...) __attribute__ ((format (gnu_printf, 2, 3)));
+static void AppendNode(Buffer_t *buf, const GeneratorParams_t *p, uint8_t node);
+static void AppendScript(Buffer_t *buf, uint16_t script);
+static void AppendDriver(Buffer_t *buf, uint16_t driver);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+char *GenerateConfig(GeneratorParams_t *params, uint32_t *pRoutes)
+{
+    uint16_t i;
+    Buffer_t buf = { 0 };
+    if (NULL == params) return NULL;
+    if (0 == params->nodes) params->nodes = 1;
+    if (GENERATOR_MAX_NODES < params->nodes) params->nodes = GENERATOR_MAX_NODES;
+    if (params->fanout >= params->nodes) params->fanout = params->nodes - 1;
+    if (0 == params->fanout) params->connections = 0; /* A route needs at least one sink */
+    if (params->scripts > params->nodes) params->scripts = params->nodes; /* Unreferenced scripts are rejected */
+    if (params->drivers > params->nodes * params->connections)
+        params->drivers = params->nodes * params->connections;
+    Append(&buf, "<?xml version=\"1.0\"?>\n");
+    Append(&buf, "<Unicens AsyncBandwidth=\"80\">\n");
+    for (i = 0; i < params->nodes; i++)
+        AppendNode(&buf, params, i);
+    for (i = 0; i < params->scripts; i++)
+        AppendScript(&buf, i);
+    for (i = 0; i < params->drivers; i++)
+        AppendDriver(&buf, i);
+    Append(&buf, "</Unicens>\n");
+    if (buf.failed)
+    {
+        free(buf.data);
+        return NULL;
+    }
+    if (pRoutes)
+        *pRoutes = (uint32_t)params->nodes * params->connections;
+    return buf.data;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void Append(Buffer_t *buf, const char *format, ...)
+{
+    int len;
+    va_list args;
+    if (buf->failed) return;
+    while (true)
+    {
+        size_t space = buf->capacity - buf->size;
+        va_start(args, format);
+        len = vsnprintf(buf->data ? buf->data + buf->size : NULL, space, format, args);
+        va_end(args);
+        if (len < 0)
+        {
+            buf->failed = true;
+            return;
+        }
+        if ((size_t)len < space)
+        {
+            buf->size += len;
+            return;
+        }
+        else
+        {
+            size_t capacity = buf->capacity ? 2 * buf->capacity : INITIAL_SIZE;
+            char *data = realloc(buf->data, capacity);
+            if (NULL == data)
+            {
+                buf->failed = true;
+                return;
+            }
+            buf->data = data;
+            buf->capacity = capacity;
+        }
+    }
+}
+
+static void AppendNode(Buffer_t *buf, const GeneratorParams_t *p, uint8_t node)
+{
+    uint16_t i;
+    uint8_t k;
+    uint16_t sinks = 0;
+    Append(buf, "    <Node Address=\"0x%X\" Name=\"Node %u\"", FIRST_NODE_ADDRESS + node, node);
+    if (p->scripts)
+        Append(buf, " Script=\"Script_%u\"", node % p->scripts);
+    Append(buf, ">\n");
+    /* Routes started by this node */
+    for (i = 0; i < p->connections; i++)
+    {
+        uint32_t route = (uint32_t)node * p->connections + i;
+        if (route < p->drivers)
+            Append(buf, "        <SyncConnection Driver=\"Driver_%u\">\n", route);
+        else
+            Append(buf, "        <SyncConnection>\n");
+        Append(buf, "            <USBSocket EndpointAddress=\"0x%X\" FramesPerTransaction=\"128\"/>\n", 1 + (i % USB_ENDPOINTS));
+        Append(buf, "            <NetworkSocket Route=\"Route_%u_%u\" Bandwidth=\"4\"/>\n", node, i);
+        Append(buf, "        </SyncConnection>\n");
+    }
+    /* Sinks of the routes started by the previous nodes */
+    for (k = 1; k <= p->fanout; k++)
+    {
+        uint8_t source = (node + p->nodes - k) % p->nodes;
+        for (i = 0; i < p->connections; i++)
+        {
+            Append(buf, "        <SyncConnection>\n");
+            Append(buf, "            <NetworkSocket Route=\"Route_%u_%u\" Bandwidth=\"4\"/>\n", source, i);
+            Append(buf, "            <USBSocket EndpointAddress=\"0x%X\" FramesPerTransaction=\"128\"/>\n", 0x81 + (sinks++ % USB_ENDPOINTS));
+            Append(buf, "        </SyncConnection>\n");
+        }
+    }
+    Append(buf, "    </Node>\n");
+}
+
+static void AppendScript(Buffer_t *buf, uint16_t script)
+{
+    Append(buf, "    <Script Name=\"Script_%u\">\n", script);
+    Append(buf, "        <I2CPortCreate Speed=\"FastMode\"/>\n");
+    Append(buf, "        <I2CPortWrite Address=\"0x2A\" Payload=\"1B 80\"/>\n");
+    Append(buf, "        <I2CPortWrite Address=\"0x2A\" Payload=\"20 00 89 77 72\"/>\n");
+    Append(buf, "        <I2CPortWrite Mode=\"BurstMode\" BlockCount=\"2\" Address=\"0x18\" Length=\"3\" Timeout=\"100\" Payload=\"20 00 00 21 00 00\"/>\n");
+    Append(buf, "        <GPIOPortCreate DebounceTime=\"20\"/>\n");
+    Append(buf, "        <GPIOPortPinMode PinConfiguration=\"03 35 04 35\"/>\n");
+    Append(buf, "        <MsgSend FBlockId=\"0x00\" FunctionId=\"0x6C1\" OpTypeRequest=\"0x02\" PayloadRequest=\"00 00 01 01\"/>\n");
+    Append(buf, "        <Pause WaitTime=\"100\"/>\n");
+    Append(buf, "    </Script>\n");
+}
+
+static void AppendDriver(Buffer_t *buf, uint16_t driver)
+{
+    Append(buf, "    <Driver Name=\"Driver_%u\">\n", driver);
+    Append(buf, "        <Cdev BufferSize=\"1024\" BufferCount=\"8\" Name=\"sync-tx-%u\"/>\n", driver);
+    Append(buf, "    </Driver>\n");
+}
@@ -0,0 +1,68 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Stucture Printing module                                                               */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#ifndef UCSXML_GENERATOR_H_
+#define UCSXML_GENERATOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define GENERATOR_MAX_NODES     (63)
+
+/** Parameters of a synthetic UNICENS XML configuration */
+typedef struct
+{
+    /** Amount of nodes, 1 to 63 */
+    uint8_t nodes;
+    /** Amount of source connections on every node, each one starts its own route */
+    uint16_t connections;
+    /** Amount of sinks of each route, they are placed on the following nodes */
+    uint8_t fanout;
+    /** Amount of scripts, the nodes refer to them in turn. At most one script per node. */
+    uint16_t scripts;
+    /** Amount of source connections with a driver entry */
+    uint16_t drivers;
+} GeneratorParams_t;
+
+/**
+ * \brief Generates a valid UNICENS XML configuration
+ * \param params - Shape of the configuration. Out of range values are clipped.
+ * \param pRoutes - If not NULL, receives the amount of generated routes
+ * \return Zero terminated XML string, to be freed with free(). NULL, if there was no memory.
+ */
+char *GenerateConfig(GeneratorParams_t *params, uint32_t *pRoutes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UCSXML_GENERATOR_H_ */
@@ -0,0 +1,437 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Stucture Printing module                                                               */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <malloc.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include "UcsXml.h"
+#include "Generator.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     USED ADJUSTABLE DEFINES                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define DEFAULT_ITERATIONS  (20)
+#define CSV_HEADER          "nodes,connections,fanout,scripts,drivers,xml_bytes,routes,iterations," \
+                            "parse_us,free_us,allocs,alloc_bytes,peak_heap_bytes,max_rss_kb\n"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                        PRIVATE DEFINES                               */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+typedef struct
+{
+    uint64_t allocs;
+    uint64_t allocBytes;
+    int64_t liveBytes;
+    int64_t peakBytes;
+} AllocStats_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void);
+static int RunSuite(uint32_t iterations);
+static int RunScenario(GeneratorParams_t *params, uint32_t iterations);
+static int MeasureScenario(GeneratorParams_t *params, uint32_t iterations);
+static int WriteConfig(GeneratorParams_t *params, const char *fileName);
+static bool ParseNumber(int argc, char *argv[], uint16_t *i, long max, long *pValue);
+static void OnAlloc(void *ptr);
+static void OnFree(void *ptr);
+static double GetTimeUs(void);
+
+/* Replacements for the allocator, activated with -Wl,--wrap=<function> */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t nmemb, size_t size);
+void *__wrap_realloc(void *ptr, size_t size);
+void __wrap_free(void *ptr);
+char *__wrap_strdup(const char *s);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                          PRIVTATE Variables                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static AllocStats_t stats;
+
+/* Every parameter is varied separately, the others keep the values of the first line */
+static const GeneratorParams_t suite[] =
+{
+    /* nodes, connections, fanout, scripts, drivers */
+    { 16, 4, 2, 4, 4 },
+    { 2, 4, 2, 4, 4 },
+    { 4, 4, 2, 4, 4 },
+    { 8, 4, 2, 4, 4 },
+    { 32, 4, 2, 4, 4 },
+    { 63, 4, 2, 4, 4 },
+    { 16, 1, 2, 4, 4 },
+    { 16, 2, 2, 4, 4 },
+    { 16, 8, 2, 4, 4 },
+    { 16, 16, 2, 4, 4 },
+    { 16, 4, 1, 4, 4 },
+    { 16, 4, 4, 4, 4 },
+    { 16, 4, 8, 4, 4 },
+    { 16, 4, 15, 4, 4 },
+    { 16, 4, 2, 0, 4 },
+    { 16, 4, 2, 1, 4 },
+    { 16, 4, 2, 8, 4 },
+    { 16, 4, 2, 16, 4 },
+    { 16, 4, 2, 4, 0 },
+    { 16, 4, 2, 4, 16 },
+    { 16, 4, 2, 4, 64 },
+};
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+int main(int argc, char *argv[])
+{
+    bool single = false;
+    const char *outFileName = NULL;
+    GeneratorParams_t params = suite[0];
+    uint32_t iterations = DEFAULT_ITERATIONS;
+    uint16_t i;
+    long value;
+    for (i = 1; i < argc; i++)
+    {
+        if (0 == strcmp("-nodes", argv[i]))
+        {
+            if (!ParseNumber(argc, argv, &i, GENERATOR_MAX_NODES, &value)) return -1;
+            params.nodes = value;
+            single = true;
+        }
+        else if (0 == strcmp("-connections", argv[i]))
+        {
+            if (!ParseNumber(argc, argv, &i, UINT16_MAX, &value)) return -1;
+            params.connections = value;
+            single = true;
+        }
+        else if (0 == strcmp("-fanout", argv[i]))
+        {
+            if (!ParseNumber(argc, argv, &i, GENERATOR_MAX_NODES - 1, &value)) return -1;
+            params.fanout = value;
+            single = true;
+        }
+        else if (0 == strcmp("-scripts", argv[i]))
+        {
+            if (!ParseNumber(argc, argv, &i, UINT16_MAX, &value)) return -1;
+            params.scripts = value;
+            single = true;
+        }
+        else if (0 == strcmp("-drivers", argv[i]))
+        {
+            if (!ParseNumber(argc, argv, &i, UINT16_MAX, &value)) return -1;
+            params.drivers = value;
+            single = true;
+        }
+        else if (0 == strcmp("-iterations", argv[i]))
+        {
+            if (!ParseNumber(argc, argv, &i, UINT32_MAX, &value)) return -1;
+            iterations = (0 < value) ? value : 1;
+        }
+        else if (0 == strcmp("-out", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -out parameter needs additional path of the XML file to be written\n");
+                return -1;
+            }
+            outFileName = argv[++i];
+            single = true;
+        }
+        else if (0 == strcmp("--help", argv[i]))
+        {
+            PrintHelp();
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Error: Unknown parameter '%s'\n", argv[i]);
+            return -1;
+        }
+    }
+    if (outFileName)
+        return WriteConfig(&params, outFileName);
+    if (!single)
+        return RunSuite(iterations);
+    printf(CSV_HEADER);
+    fflush(stdout);
+    return RunScenario(&params, iterations);
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  CALLBACK FUNCTION FROM XML PARSER                   */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+void UcsXml_CB_OnError(const char format[], uint16_t vargsCnt, ...)
+{
+    va_list argptr;
+    va_start(argptr, vargsCnt);
+    fprintf(stderr, "XML-Parser error: '");
+    vfprintf(stderr, format, argptr);
+    fprintf(stderr, "'\n");
+    va_end(argptr);
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                        ALLOCATOR WRAPPERS                            */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+void *__wrap_malloc(size_t size)
+{
+    void *ptr = __real_malloc(size);
+    OnAlloc(ptr);
+    return ptr;
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+    void *ptr = __real_calloc(nmemb, size);
+    OnAlloc(ptr);
+    return ptr;
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    void *result;
+    size_t oldSize = ptr ? malloc_usable_size(ptr) : 0;
+    result = __real_realloc(ptr, size);
+    if (NULL == result)
+        return NULL;
+    stats.liveBytes -= oldSize;
+    OnAlloc(result);
+    return result;
+}
+
+void __wrap_free(void *ptr)
+{
+    OnFree(ptr);
+    __real_free(ptr);
+}
+
+char *__wrap_strdup(const char *s)
+{
+    size_t len = strlen(s) + 1;
+    char *copy = __wrap_malloc(len);
+    if (copy)
+        memcpy(copy, s, len);
+    return copy;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static int RunSuite(uint32_t iterations)
+{
+    uint32_t i;
+    int result = 0;
+    printf(CSV_HEADER);
+    fflush(stdout);
+    for (i = 0; i < sizeof(suite) / sizeof(suite[0]); i++)
+    {
+        GeneratorParams_t params = suite[i];
+        if (0 != RunScenario(&params, iterations))
+            result = -1;
+    }
+    return result;
+}
+
+static int RunScenario(GeneratorParams_t *params, uint32_t iterations)
+{
+    int status;
+    /* Every scenario runs in its own process, so the peak RSS is not inherited from the previous one */
+    pid_t pid = fork();
+    if (-1 == pid)
+    {
+        fprintf(stderr, "Error: Could not fork benchmark process\n");
+        return -1;
+    }
+    if (0 == pid)
+    {
+        status = MeasureScenario(params, iterations);
+        fflush(stdout);
+        _exit((0 == status) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    if (-1 == waitpid(pid, &status, 0) || !WIFEXITED(status) || EXIT_SUCCESS != WEXITSTATUS(status))
+    {
+        fprintf(stderr, "Error: Scenario nodes=%u connections=%u fanout=%u scripts=%u drivers=%u failed\n",
+            params->nodes, params->connections, params->fanout, params->scripts, params->drivers);
+        return -1;
+    }
+    return 0;
+}
+
+static int MeasureScenario(GeneratorParams_t *params, uint32_t iterations)
+{
+    uint32_t i, routes = 0;
+    double start, parseUs = 0, freeUs = 0;
+    int64_t baseBytes;
+    struct rusage usage;
+    UcsXmlVal_t *val;
+    char *xml = GenerateConfig(params, &routes);
+    if (NULL == xml)
+    {
+        fprintf(stderr, "Error: Could not generate XML\n");
+        return -1;
+    }
+    /* Warm up, the first run also interns the XML keys */
+    val = UcsXml_Parse(xml);
+    if (NULL == val)
+    {
+        free(xml);
+        return -1;
+    }
+    UcsXml_FreeVal(val);
+    baseBytes = stats.liveBytes;
+    stats.allocs = 0;
+    stats.allocBytes = 0;
+    stats.peakBytes = baseBytes;
+    for (i = 0; i < iterations; i++)
+    {
+        start = GetTimeUs();
+        val = UcsXml_Parse(xml);
+        parseUs += GetTimeUs() - start;
+        if (NULL == val)
+        {
+            free(xml);
+            return -1;
+        }
+        start = GetTimeUs();
+        UcsXml_FreeVal(val);
+        freeUs += GetTimeUs() - start;
+    }
+    getrusage(RUSAGE_SELF, &usage);
+    printf("%u,%u,%u,%u,%u,%zu,%u,%u,%.1f,%.1f,%llu,%llu,%lld,%ld\n",
+        params->nodes, params->connections, params->fanout, params->scripts, params->drivers,
+        strlen(xml), routes, iterations, parseUs / iterations, freeUs / iterations,
+        (unsigned long long)(stats.allocs / iterations), (unsigned long long)(stats.allocBytes / iterations),
+        (long long)(stats.peakBytes - baseBytes), usage.ru_maxrss);
+    free(xml);
+    return 0;
+}
+
+static int WriteConfig(GeneratorParams_t *params, const char *fileName)
+{
+    FILE *fh;
+    bool success;
+    char *xml = GenerateConfig(params, NULL);
+    if (NULL == xml)
+    {
+        fprintf(stderr, "Error: Could not generate XML\n");
+        return -1;
+    }
+    fh = fopen(fileName, "w");
+    success = (NULL != fh) && (1 == fwrite(xml, strlen(xml), 1, fh));
+    if (NULL != fh && 0 != fclose(fh))
+        success = false;
+    if (!success)
+        fprintf(stderr, "Error: Could not write XML file '%s'\n", fileName);
+    free(xml);
+    return success ? 0 : -1;
+}
+
+static bool ParseNumber(int argc, char *argv[], uint16_t *i, long max, long *pValue)
+{
+    char *end;
+    if (argc <= (*i + 1))
+    {
+        fprintf(stderr, "Error: %s parameter needs an additional number\n", argv[*i]);
+        return false;
+    }
+    *pValue = strtol(argv[*i + 1], &end, 0);
+    if ('\0' != *end || 0 > *pValue || max < *pValue)
+    {
+        fprintf(stderr, "Error: %s parameter must be a number between 0 and %ld\n", argv[*i], max);
+        return false;
+    }
+    ++*i;
+    return true;
+}
+
+static void OnAlloc(void *ptr)
+{
+    size_t size;
+    if (NULL == ptr)
+        return;
+    size = malloc_usable_size(ptr);
+    ++stats.allocs;
+    stats.allocBytes += size;
+    stats.liveBytes += size;
+    if (stats.liveBytes > stats.peakBytes)
+        stats.peakBytes = stats.liveBytes;
+}
+
+static void OnFree(void *ptr)
+{
+    if (ptr)
+        stats.liveBytes -= malloc_usable_size(ptr);
+}
+
+static double GetTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000.0) + (ts.tv_nsec / 1000.0);
+}
+
+static void PrintHelp(void)
+{
+    printf("Usage: ucsxml-bench [OPTION]...\n");
+    printf("Measure UcsXml_Parse and UcsXml_FreeVal on generated UNICENS XML configurations and print the results as CSV.\n\n");
+    printf("  -nodes [Count]           Amount of nodes (1 to %d)\n", GENERATOR_MAX_NODES);
+    printf("  -connections [Count]     Amount of routes started by each node\n");
+    printf("  -fanout [Count]          Amount of sinks of each route\n");
+    printf("  -scripts [Count]         Amount of scripts, assigned to the nodes in turn (at most one per node)\n");
+    printf("  -drivers [Count]         Amount of routes with an INIC Linux Driver entry\n");
+    printf("  -iterations [Count]      Amount of measured runs per configuration (default: %d)\n", DEFAULT_ITERATIONS);
+    printf("  -out [File]              Write the generated XML into the given file instead of measuring it\n");
+    printf("  --help                   Prints this help and exit\n\n");
+    printf("Without any configuration option, a suite varying each parameter separately is measured.\n");
+    printf("Parameters not given on the command line keep the defaults of the suite (16 nodes, 4 connections,\n");
+    printf("fanout 2, 4 scripts, 4 drivers). Allocations and times are average values of a single run.\n\n");
+    printf("Examples:\n");
+    printf("  ucsxml-bench > results.csv\n");
+    printf("  ucsxml-bench -nodes 63 -connections 8 -iterations 100\n");
+    printf("  ucsxml-bench -nodes 8 -scripts 2 -out config.xml\n");
+}
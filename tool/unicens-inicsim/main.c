@@ -0,0 +1,410 @@
+/*------------------------------------------------------------------------------------------------*/
+/* INIC Simulator                                                                                 */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "InicSim.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                          USER ADJUSTABLE                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/* Pass these paths to unicensd with -ctx and -crx */
+#define DEFAULT_TX_PATH         "/tmp/inicsim-control-tx"
+#define DEFAULT_RX_PATH         "/tmp/inicsim-control-rx"
+#define DEFAULT_NODES           (3)
+#define DEFAULT_FIRST_ADDRESS   (0x200)
+#define DEFAULT_LATENCY_MS      (1)
+#define DEFAULT_STARTUP_MS      (100)
+#define DEFAULT_I2C_MS          (5)
+#define DEFAULT_GPIO_MS         (2)
+#define DEFAULT_CHIP_ID         (0x18)
+#define DEFAULT_GROUP_ADDRESS   (0x3C8)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void);
+static bool ParseMs(int argc, char *argv[], int *pIndex, uint32_t *pMs);
+static void SetNode(InicSimNode_t *node, uint16_t address, uint8_t chipId, const uint8_t fw[3]);
+static int Listen(const char *path);
+static int Accept(int listenFd, int oldFd);
+static uint32_t GetMs(void);
+static void OnSignal(int sig);
+
+static volatile sig_atomic_t m_stop = 0;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+int main(int argc, char *argv[])
+{
+    static InicSimConfig_t cfg;
+    const char *txPath = DEFAULT_TX_PATH;
+    const char *rxPath = DEFAULT_RX_PATH;
+    uint16_t addresses[INICSIM_MAX_NODES];
+    uint8_t addressCnt = 0;
+    long nodeCnt = DEFAULT_NODES;
+    long chipId = DEFAULT_CHIP_ID;
+    uint8_t fw[3] = { 3, 2, 0 };
+    int txListen, rxListen, txFd = -1, rxFd = -1;
+    InicSimStats_t stats;
+    struct sigaction stop;
+    int i;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.latencyMs = DEFAULT_LATENCY_MS;
+    cfg.startupMs = DEFAULT_STARTUP_MS;
+    cfg.i2cLatencyMs = DEFAULT_I2C_MS;
+    cfg.gpioLatencyMs = DEFAULT_GPIO_MS;
+    for (i = 1; i < argc; i++)
+    {
+        if (0 == strcmp("-tx", argv[i]) || 0 == strcmp("-rx", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: %s parameter needs additional socket path\n", argv[i]);
+                return -1;
+            }
+            if ('t' == argv[i][1])
+                txPath = argv[++i];
+            else
+                rxPath = argv[++i];
+        }
+        else if (0 == strcmp("-nodes", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -nodes parameter needs additional amount of nodes\n");
+                return -1;
+            }
+            nodeCnt = strtol(argv[++i], NULL, 0);
+            if (1 > nodeCnt || INICSIM_MAX_NODES < nodeCnt)
+            {
+                fprintf(stderr, "Error: -nodes must be between 1 and %d\n", INICSIM_MAX_NODES);
+                return -1;
+            }
+        }
+        else if (0 == strcmp("-node", argv[i]))
+        {
+            long address;
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -node parameter needs additional node address\n");
+                return -1;
+            }
+            address = strtol(argv[++i], NULL, 0);
+            if (0x10 > address || 0x2FF < address)
+            {
+                fprintf(stderr, "Error: -node address must be between 0x10 and 0x2FF\n");
+                return -1;
+            }
+            if (INICSIM_MAX_NODES <= addressCnt)
+            {
+                fprintf(stderr, "Error: At most %d nodes can be simulated\n", INICSIM_MAX_NODES);
+                return -1;
+            }
+            addresses[addressCnt++] = (uint16_t)address;
+        }
+        else if (0 == strcmp("-chip", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -chip parameter needs additional chip ID\n");
+                return -1;
+            }
+            chipId = strtol(argv[++i], NULL, 0);
+            if (0 > chipId || 0xFF < chipId)
+            {
+                fprintf(stderr, "Error: -chip ID must be between 0x00 and 0xFF\n");
+                return -1;
+            }
+        }
+        else if (0 == strcmp("-fw", argv[i]))
+        {
+            unsigned int major, minor, release;
+            if (argc <= (i+1) || 3 != sscanf(argv[i + 1], "%u.%u.%u", &major, &minor, &release)
+                || 0xFF < major || 0xFF < minor || 0xFF < release)
+            {
+                fprintf(stderr, "Error: -fw parameter needs additional firmware version like 3.2.0\n");
+                return -1;
+            }
+            fw[0] = major;
+            fw[1] = minor;
+            fw[2] = release;
+            ++i;
+        }
+        else if (0 == strcmp("-latency", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.latencyMs))
+                return -1;
+        }
+        else if (0 == strcmp("-startup", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.startupMs))
+                return -1;
+        }
+        else if (0 == strcmp("-i2c", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.i2cLatencyMs))
+                return -1;
+        }
+        else if (0 == strcmp("-gpio", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.gpioLatencyMs))
+                return -1;
+        }
+        else if (0 == strcmp("-v", argv[i]))
+        {
+            cfg.verbose = true;
+        }
+        else if (0 == strcmp("--help", argv[i]))
+        {
+            PrintHelp();
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Error: Unknown parameter '%s'\n", argv[i]);
+            return -1;
+        }
+    }
+    /* Without explicit addresses, the nodes are numbered from the first address on */
+    cfg.nodeCnt = (0 != addressCnt) ? addressCnt : (uint8_t)nodeCnt;
+    for (i = 0; i < cfg.nodeCnt; i++)
+        SetNode(&cfg.nodes[i], (0 != addressCnt) ? addresses[i] : DEFAULT_FIRST_ADDRESS + i, (uint8_t)chipId, fw);
+    InicSim_Init(&cfg);
+
+    txListen = Listen(txPath);
+    rxListen = Listen(rxPath);
+    if (-1 == txListen || -1 == rxListen)
+        return -1;
+    memset(&stop, 0, sizeof(stop));
+    stop.sa_handler = &OnSignal;
+    sigemptyset(&stop.sa_mask);
+    sigaction(SIGINT, &stop, NULL);
+    sigaction(SIGTERM, &stop, NULL);
+    printf("Simulating %u nodes, local node address=0x%X\n", cfg.nodeCnt, cfg.nodes[0].nodeAddress);
+    printf("Start the daemon with: unicensd -ctx %s -crx %s [FILE]\n", txPath, rxPath);
+    fflush(stdout);
+
+    while (!m_stop)
+    {
+        struct pollfd fds[4];
+        uint8_t buf[INICSIM_MAX_MSG_SIZE * 4];
+        uint32_t len;
+        int timeout = (-1 == rxFd) ? -1 : InicSim_GetTimeout(GetMs());
+        fds[0].fd = txListen;
+        fds[1].fd = rxListen;
+        fds[2].fd = txFd;
+        fds[3].fd = rxFd;
+        for (i = 0; i < 4; i++)
+        {
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
+        if (0 > poll(fds, 4, timeout))
+        {
+            if (EINTR == errno)
+                continue;
+            fprintf(stderr, "Error: poll failed, reason='%s'\n", strerror(errno));
+            break;
+        }
+        if (fds[0].revents & POLLIN)
+        {
+            /* unicensd opens its TX channel with the first message, so it was (re)started */
+            txFd = Accept(txListen, txFd);
+            InicSim_Reset();
+            printf("unicensd connected\n");
+            fflush(stdout);
+        }
+        if (fds[1].revents & POLLIN)
+            rxFd = Accept(rxListen, rxFd);
+        if (-1 != txFd && (fds[2].revents & (POLLIN | POLLHUP | POLLERR)))
+        {
+            ssize_t rx = recv(txFd, buf, sizeof(buf), 0);
+            if (0 < rx)
+            {
+                InicSim_OnTx(GetMs(), buf, (uint32_t)rx);
+            }
+            else
+            {
+                close(txFd);
+                txFd = -1;
+                printf("unicensd disconnected\n");
+                fflush(stdout);
+            }
+        }
+        if (-1 != rxFd && (fds[3].revents & (POLLHUP | POLLERR)))
+        {
+            close(rxFd);
+            rxFd = -1;
+        }
+        while (-1 != rxFd && InicSim_GetRx(GetMs(), buf, &len))
+        {
+            if (0 > send(rxFd, buf, len, MSG_NOSIGNAL))
+            {
+                close(rxFd);
+                rxFd = -1;
+            }
+        }
+        fflush(stdout);
+    }
+    InicSim_GetStats(&stats);
+    printf("%u messages received, %u messages sent, %u messages not simulated, %u resources created, %u nodes welcomed\n",
+        stats.rxMessages, stats.txMessages, stats.unknownMessages, stats.resources, stats.discoveredNodes);
+    close(txListen);
+    close(rxListen);
+    unlink(txPath);
+    unlink(rxPath);
+    return 0;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void)
+{
+    printf("Usage: unicens-inicsim [OPTION]...\n");
+    printf("Simulates the local INIC and the remote nodes of an INICnet, so that unicensd can run without hardware.\n");
+    printf("unicensd connects to the simulator instead of opening the control character devices.\n\n");
+    printf("  -tx [Path]               Socket to pass to unicensd -ctx, default is \"%s\"\n", DEFAULT_TX_PATH);
+    printf("  -rx [Path]               Socket to pass to unicensd -crx, default is \"%s\"\n", DEFAULT_RX_PATH);
+    printf("  -nodes [Count]           Amount of nodes including the local INIC, numbered from 0x%X on (default %d)\n",
+        DEFAULT_FIRST_ADDRESS, DEFAULT_NODES);
+    printf("  -node [Address]          Adds a node with the given address, may be given multiple times.\n");
+    printf("                           The first one is the local INIC, the others follow in ring order\n");
+    printf("  -chip [ID]               Chip ID reported by all nodes (default 0x%02X)\n", DEFAULT_CHIP_ID);
+    printf("  -fw [Version]            Firmware version reported by all nodes (default 3.2.0)\n");
+    printf("  -latency [ms]            Time until an INIC answers (default %d)\n", DEFAULT_LATENCY_MS);
+    printf("  -startup [ms]            Time until the network is available after startup (default %d)\n", DEFAULT_STARTUP_MS);
+    printf("  -i2c [ms]                Time until an I2C read or write is finished (default %d)\n", DEFAULT_I2C_MS);
+    printf("  -gpio [ms]               Time until a GPIO request is answered (default %d)\n", DEFAULT_GPIO_MS);
+    printf("  -v                       Prints every port message\n");
+    printf("  --help                   Prints this help and exit\n\n");
+    printf("Examples:\n");
+    printf("  unicens-inicsim -nodes 8\n");
+    printf("  unicens-inicsim -node 0x200 -node 0x270 -node 0x271 -i2c 20\n");
+}
+
+static bool ParseMs(int argc, char *argv[], int *pIndex, uint32_t *pMs)
+{
+    long ms;
+    if (argc <= (*pIndex + 1))
+    {
+        fprintf(stderr, "Error: %s parameter needs additional time in milliseconds\n", argv[*pIndex]);
+        return false;
+    }
+    ms = strtol(argv[*pIndex + 1], NULL, 0);
+    if (0 > ms || 60000 < ms)
+    {
+        fprintf(stderr, "Error: %s time must be between 0 and 60000 ms\n", argv[*pIndex]);
+        return false;
+    }
+    *pMs = (uint32_t)ms;
+    ++*pIndex;
+    return true;
+}
+
+static void SetNode(InicSimNode_t *node, uint16_t address, uint8_t chipId, const uint8_t fw[3])
+{
+    memset(node, 0, sizeof(InicSimNode_t));
+    node->nodeAddress = address;
+    node->groupAddress = DEFAULT_GROUP_ADDRESS;
+    /* Locally administered MAC address, derived from the node address */
+    node->mac[0] = 0x02;
+    node->mac[4] = address >> 8;
+    node->mac[5] = address & 0xFF;
+    node->numPorts = 2;
+    node->chipId = chipId;
+    node->fwMajor = fw[0];
+    node->fwMinor = fw[1];
+    node->fwRelease = fw[2];
+    node->csMajor = 1;
+}
+
+static int Listen(const char *path)
+{
+    struct sockaddr_un addr;
+    int fd;
+    if (sizeof(addr.sun_path) <= strlen(path))
+    {
+        fprintf(stderr, "Error: Socket path '%s' is too long\n", path);
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+    fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (-1 == fd || 0 != bind(fd, (struct sockaddr *)&addr, sizeof(addr)) || 0 != listen(fd, 1))
+    {
+        fprintf(stderr, "Error: Could not create socket '%s', reason='%s'\n", path, strerror(errno));
+        if (-1 != fd)
+            close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* Only one connection per channel, a new one replaces the old one */
+static int Accept(int listenFd, int oldFd)
+{
+    int fd = accept(listenFd, NULL, NULL);
+    if (-1 == fd)
+        return oldFd;
+    if (-1 != oldFd)
+        close(oldFd);
+    return fd;
+}
+
+static uint32_t GetMs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+static void OnSignal(int sig)
+{
+    sig = sig;
+    m_stop = 1;
+}
@@ -0,0 +1,458 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS LLD Trace Dissector                                                                    */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "LldTrace.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PORT MESSAGE LAYOUT                              */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/* PML (2 bytes, length of the rest), PMHL (1 byte, length of the header), then the header */
+#define PM_PML_POS              (0)
+#define PM_PMHL_POS             (2)
+#define PM_FPH_POS              (3)
+#define PM_SID_POS              (4)
+#define PM_EXT_TYPE_POS         (5)
+#define PM_MIN_SIZE             (6)
+
+/* FIFO protocol header */
+#define FPH_DIR_MASK            (0x01)
+#define FPH_TYPE_POS            (1)
+#define FPH_TYPE_MASK           (0x06)
+#define FPH_FIFO_POS            (3)
+#define FPH_FIFO_MASK           (0x18)
+
+#define MSG_TYPE_CMD            (0)
+#define MSG_TYPE_STATUS         (1)
+#define MSG_TYPE_DATA           (2)
+
+/* Content types of data messages, given by EXT_TYPE */
+#define CONTENT_TGT             (0x80)
+#define CONTENT_TGT_SRC         (0x81)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVATE TYPEDEFS                                 */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+typedef struct
+{
+    uint16_t pml;
+    uint8_t pmhl;
+    uint8_t fifo;
+    uint8_t type;
+    uint8_t sid;
+    uint8_t extType;
+    /** Set for data messages of a known content type, the fields below are valid then */
+    bool hasMsgHeader;
+    bool hasSource;
+    uint16_t targetAddr;
+    uint16_t sourceAddr;
+    uint8_t fblock;
+    uint8_t instance;
+    uint16_t function;
+    uint8_t opType;
+    uint8_t telId;
+    uint16_t telLen;
+    const uint8_t *pPayload;
+    uint32_t payloadLen;
+} PortMessage_t;
+
+typedef struct
+{
+    bool absolute;
+    bool hexDump;
+    int32_t fblockFilter;
+    bool started;
+    uint64_t firstUs;
+    uint32_t txCnt;
+    uint32_t rxCnt;
+    uint32_t droppedCnt;
+} Options_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void);
+static bool DecodeFile(const char *fileName, Options_t *o);
+static uint32_t Swap32(uint32_t val, bool swap);
+static void PrintPacket(Options_t *o, uint64_t timeUs, const uint8_t *pData, uint32_t len, uint32_t origLen);
+static bool ParsePortMessage(const uint8_t *pm, uint32_t len, PortMessage_t *msg);
+static void PrintPortMessage(const PortMessage_t *msg);
+static void PrintHex(const uint8_t *pData, uint32_t len);
+static const char *GetFifoName(uint8_t fifo);
+static const char *GetFBlockName(uint8_t fblock);
+static const char *GetOpTypeName(uint8_t opType);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+int main(int argc, char *argv[])
+{
+    Options_t o;
+    int i, files = 0;
+    memset(&o, 0, sizeof(o));
+    o.fblockFilter = -1;
+    for (i = 1; i < argc; i++)
+    {
+        if (0 == strcmp("-abs", argv[i]))
+        {
+            o.absolute = true;
+        }
+        else if (0 == strcmp("-x", argv[i]))
+        {
+            o.hexDump = true;
+        }
+        else if (0 == strcmp("-fblock", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -fblock parameter needs additional FBlock ID\n");
+                return -1;
+            }
+            o.fblockFilter = (int32_t)strtol(argv[++i], NULL, 0);
+            if (0 > o.fblockFilter || 0xFF < o.fblockFilter)
+            {
+                fprintf(stderr, "Error: -fblock ID must be between 0x00 and 0xFF\n");
+                return -1;
+            }
+        }
+        else if (0 == strcmp("--help", argv[i]))
+        {
+            PrintHelp();
+            return 0;
+        }
+        else if ('-' == argv[i][0])
+        {
+            fprintf(stderr, "Error: Unknown parameter '%s'\n", argv[i]);
+            return -1;
+        }
+    }
+    /* Files are read in the given order, pass the rotated file first */
+    for (i = 1; i < argc; i++)
+    {
+        if (0 == strcmp("-fblock", argv[i]))
+        {
+            ++i;
+            continue;
+        }
+        if ('-' == argv[i][0])
+            continue;
+        ++files;
+        if (!DecodeFile(argv[i], &o))
+            return -1;
+    }
+    if (0 == files)
+    {
+        fprintf(stderr, "Error: No capture file given, see --help\n");
+        return -1;
+    }
+    printf("%u messages sent, %u messages received, %u messages not captured\n", o.txCnt, o.rxCnt, o.droppedCnt);
+    return 0;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void)
+{
+    printf("Usage: unicens-lldtrace [OPTION]... [FILE]...\n");
+    printf("Decodes the port messages captured by unicensd -lldcap.\n\n");
+    printf("  -abs                     Print the wall clock time instead of the time since the first message\n");
+    printf("  -x                       Print the raw bytes of every message additionally\n");
+    printf("  -fblock [ID]             Print only data messages of the given FBlock\n");
+    printf("  --help                   Prints this help and exit\n\n");
+    printf("Examples:\n");
+    printf("  unicens-lldtrace lld.pcap\n");
+    printf("  unicens-lldtrace -x -fblock 0x0A lld.pcap.1 lld.pcap\n");
+}
+
+static bool DecodeFile(const char *fileName, Options_t *o)
+{
+    LldTraceFileHeader_t header;
+    LldTraceRecord_t rec;
+    uint8_t *pData;
+    bool swap, success = true;
+    FILE *fp = fopen(fileName, "rb");
+    if (NULL == fp)
+    {
+        fprintf(stderr, "Error: Could not open file '%s'\n", fileName);
+        return false;
+    }
+    if (1 != fread(&header, sizeof(header), 1, fp)
+        || (LLD_TRACE_PCAP_MAGIC != header.magic && LLD_TRACE_PCAP_MAGIC != Swap32(header.magic, true)))
+    {
+        fprintf(stderr, "Error: '%s' is not a pcap file\n", fileName);
+        fclose(fp);
+        return false;
+    }
+    /* The file may have been captured on a target of different byte order */
+    swap = (LLD_TRACE_PCAP_MAGIC != header.magic);
+    if (LLD_TRACE_LINKTYPE != Swap32(header.linkType, swap))
+    {
+        fprintf(stderr, "Error: '%s' was not captured by unicensd (link type %u)\n", fileName, Swap32(header.linkType, swap));
+        fclose(fp);
+        return false;
+    }
+    pData = malloc(LLD_TRACE_SNAPLEN);
+    if (NULL == pData)
+    {
+        fclose(fp);
+        return false;
+    }
+    while (1 == fread(&rec, sizeof(rec), 1, fp))
+    {
+        uint32_t inclLen = Swap32(rec.inclLen, swap);
+        uint64_t timeUs = (uint64_t)Swap32(rec.tsSec, swap) * 1000000 + Swap32(rec.tsUsec, swap);
+        if (0 == inclLen || LLD_TRACE_SNAPLEN < inclLen || 1 != fread(pData, inclLen, 1, fp))
+        {
+            fprintf(stderr, "Error: '%s' is truncated or corrupted\n", fileName);
+            success = false;
+            break;
+        }
+        PrintPacket(o, timeUs, pData, inclLen, Swap32(rec.origLen, swap));
+    }
+    free(pData);
+    fclose(fp);
+    return success;
+}
+
+static uint32_t Swap32(uint32_t val, bool swap)
+{
+    if (!swap)
+        return val;
+    return ((val & 0xFF) << 24) | ((val & 0xFF00) << 8) | ((val >> 8) & 0xFF00) | (val >> 24);
+}
+
+static void PrintPacket(Options_t *o, uint64_t timeUs, const uint8_t *pData, uint32_t len, uint32_t origLen)
+{
+    PortMessage_t msg;
+    uint8_t dir = pData[0];
+    uint32_t dropped = 0;
+    bool valid = false;
+    if (!o->started)
+    {
+        o->started = true;
+        o->firstUs = timeUs;
+    }
+    if (LldTraceDir_Dropped == dir)
+    {
+        if (1 + sizeof(dropped) <= len)
+            memcpy(&dropped, &pData[1], sizeof(dropped));
+        o->droppedCnt += dropped;
+    }
+    else
+    {
+        if (LldTraceDir_Tx == dir)
+            ++o->txCnt;
+        else
+            ++o->rxCnt;
+        valid = ParsePortMessage(&pData[1], len - 1, &msg);
+        if (-1 != o->fblockFilter && (!valid || !msg.hasMsgHeader || msg.fblock != o->fblockFilter))
+            return;
+    }
+    if (o->absolute)
+    {
+        time_t sec = (time_t)(timeUs / 1000000);
+        struct tm tmVal;
+        char buf[32];
+        localtime_r(&sec, &tmVal);
+        strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tmVal);
+        printf("%s.%06u ", buf, (uint32_t)(timeUs % 1000000));
+    }
+    else
+    {
+        uint64_t rel = timeUs - o->firstUs;
+        printf("%4u.%06u ", (uint32_t)(rel / 1000000), (uint32_t)(rel % 1000000));
+    }
+    if (LldTraceDir_Dropped == dir)
+    {
+        printf("-- %u messages not captured, the writer could not keep up --\n", dropped);
+        return;
+    }
+    printf("%s ", (LldTraceDir_Tx == dir) ? "TX" : "RX");
+    if (valid)
+        PrintPortMessage(&msg);
+    else
+        printf("invalid port message, len=%u", len - 1);
+    if (origLen > len)
+        printf(" (cut, %u bytes)", origLen - 1);
+    printf("\n");
+    if (o->hexDump || !valid)
+    {
+        printf("            ");
+        PrintHex(&pData[1], len - 1);
+        printf("\n");
+    }
+}
+
+static bool ParsePortMessage(const uint8_t *pm, uint32_t len, PortMessage_t *msg)
+{
+    const uint8_t *mh;
+    uint32_t mhLen;
+    memset(msg, 0, sizeof(PortMessage_t));
+    if (PM_MIN_SIZE > len)
+        return false;
+    msg->pml = (uint16_t)((pm[PM_PML_POS] << 8) | pm[PM_PML_POS + 1]);
+    msg->pmhl = pm[PM_PMHL_POS];
+    msg->fifo = (pm[PM_FPH_POS] & FPH_FIFO_MASK) >> FPH_FIFO_POS;
+    msg->type = (pm[PM_FPH_POS] & FPH_TYPE_MASK) >> FPH_TYPE_POS;
+    msg->sid = pm[PM_SID_POS];
+    msg->extType = pm[PM_EXT_TYPE_POS];
+    if (3 > msg->pmhl || (uint32_t)PM_PMHL_POS + 1 + msg->pmhl > len)
+        return false;
+    msg->pPayload = &pm[PM_PMHL_POS + 1 + msg->pmhl];
+    msg->payloadLen = len - (PM_PMHL_POS + 1 + msg->pmhl);
+    if (MSG_TYPE_DATA != msg->type || (CONTENT_TGT != msg->extType && CONTENT_TGT_SRC != msg->extType))
+        return true;
+    /* Target address, optional source address, FBlockID, InstID, FktID (12 bit) and OPType (4 bit),
+     * TelID (4 bit) and TelLen (12 bit) */
+    mh = msg->pPayload;
+    msg->hasSource = (CONTENT_TGT_SRC == msg->extType);
+    mhLen = msg->hasSource ? 10 : 8;
+    if (msg->payloadLen < mhLen)
+        return true;
+    msg->hasMsgHeader = true;
+    msg->targetAddr = (uint16_t)((mh[0] << 8) | mh[1]);
+    if (msg->hasSource)
+    {
+        msg->sourceAddr = (uint16_t)((mh[2] << 8) | mh[3]);
+        mh += 2;
+    }
+    msg->fblock = mh[2];
+    msg->instance = mh[3];
+    msg->function = (uint16_t)((mh[4] << 4) | (mh[5] >> 4));
+    msg->opType = mh[5] & 0xF;
+    msg->telId = mh[6] >> 4;
+    msg->telLen = (uint16_t)(((mh[6] & 0xF) << 8) | mh[7]);
+    msg->pPayload += mhLen;
+    msg->payloadLen -= mhLen;
+    return true;
+}
+
+static void PrintPortMessage(const PortMessage_t *msg)
+{
+    printf("%s ", GetFifoName(msg->fifo));
+    switch (msg->type)
+    {
+    case MSG_TYPE_CMD:
+        printf("command sid=0x%02X type=0x%02X", msg->sid, msg->extType);
+        break;
+    case MSG_TYPE_STATUS:
+        printf("status  sid=0x%02X type=0x%02X", msg->sid, msg->extType);
+        break;
+    case MSG_TYPE_DATA:
+        printf("data    sid=0x%02X content=0x%02X", msg->sid, msg->extType);
+        break;
+    default:
+        printf("type=%u sid=0x%02X ext=0x%02X", msg->type, msg->sid, msg->extType);
+        break;
+    }
+    if (msg->hasMsgHeader)
+    {
+        printf(" tgt=0x%04X", msg->targetAddr);
+        if (msg->hasSource)
+            printf(" src=0x%04X", msg->sourceAddr);
+        printf(" %s(0x%02X).0x%02X.0x%03X.%s(0x%X)", GetFBlockName(msg->fblock), msg->fblock, msg->instance,
+            msg->function, GetOpTypeName(msg->opType), msg->opType);
+        if (0 != msg->telId)
+            printf(" tel=%u", msg->telId);
+        printf(" len=%u", msg->telLen);
+    }
+    if (0 != msg->payloadLen)
+    {
+        printf(" | ");
+        PrintHex(msg->pPayload, msg->payloadLen);
+    }
+}
+
+static void PrintHex(const uint8_t *pData, uint32_t len)
+{
+    uint32_t i;
+    for (i = 0; i < len; i++)
+        printf(i ? " %02X" : "%02X", pData[i]);
+}
+
+static const char *GetFifoName(uint8_t fifo)
+{
+    switch (fifo)
+    {
+    case 0:
+        return "ICM";
+    case 1:
+        return "RCM";
+    case 2:
+        return "MCM";
+    default:
+        return "ALL";
+    }
+}
+
+static const char *GetFBlockName(uint8_t fblock)
+{
+    switch (fblock)
+    {
+    case 0x00:
+        return "INIC";
+    case 0x01:
+        return "NetBlock";
+    case 0x02:
+        return "NetworkMaster";
+    case 0x03:
+        return "ConnectionMaster";
+    case 0x06:
+        return "Diagnosis";
+    case 0x0A:
+        return "EXC";
+    case 0x0F:
+        return "EnhancedTestability";
+    default:
+        return "FBlock";
+    }
+}
+
+/* Properties and methods share the operation types, both meanings are given */
+static const char *GetOpTypeName(uint8_t opType)
+{
+    static const char *names[] =
+    {
+        "Set/Start", "Get/Abort", "SetGet/StartResult", "Increment", "Decrement", "GetInterface",
+        "StartResultAck", "AbortAck", "StartAck", "ErrorAck", "ProcessingAck", "Processing",
+        "Status/Result", "ResultAck", "Interface", "Error"
+    };
+    return names[opType & 0xF];
+}
@@ -0,0 +1,412 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Binary Log Decoder                                                                     */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ConsoleBinary.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     USED ADJUSTABLE DEFINES                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define MAX_SPEC_LEN            (64)
+#define MAX_STAR_ARGS           (2)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVATE TYPEDEFS                                 */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+typedef struct
+{
+    const uint8_t *pData;
+    uint16_t len;
+    uint16_t pos;
+} ArgReader_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void);
+static bool ReadExact(FILE *fp, void *pData, size_t len);
+static bool StoreDefinition(char ***pppDefs, uint32_t *pDefsSize, uint32_t id, char *format);
+static void PrintEvent(const char *format, const uint8_t *pArgs, uint16_t argsLen);
+static bool GetArg(ArgReader_t *ar, uint8_t type, void *pValue, uint16_t *pStrLen);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+int main(int argc, char *argv[])
+{
+    const char *fileName = NULL;
+    bool absolute = false;
+    bool inMessage = false;
+    ConsoleBinHeader_t header;
+    char **ppDefs = NULL;
+    uint32_t defsSize = 0;
+    uint8_t *pArgs = NULL;
+    uint32_t i, events = 0;
+    int result = 0;
+    FILE *fp;
+    for (i = 1; i < (uint32_t)argc; i++)
+    {
+        if (0 == strcmp("-abs", argv[i]))
+        {
+            absolute = true;
+        }
+        else if (0 == strcmp("--help", argv[i]))
+        {
+            PrintHelp();
+            return 0;
+        }
+        else if ('-' != argv[i][0] && NULL == fileName)
+        {
+            fileName = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "Error: Unknown parameter '%s'\n", argv[i]);
+            return -1;
+        }
+    }
+    if (NULL == fileName)
+    {
+        fprintf(stderr, "Error: No binary log file given, see --help\n");
+        return -1;
+    }
+    fp = fopen(fileName, "rb");
+    if (NULL == fp)
+    {
+        fprintf(stderr, "Error: Could not open file '%s'\n", fileName);
+        return -1;
+    }
+    if (!ReadExact(fp, &header, sizeof(header))
+        || 0 != memcmp(header.magic, CONSOLE_BIN_MAGIC, sizeof(CONSOLE_BIN_MAGIC)))
+    {
+        fprintf(stderr, "Error: '%s' is not a binary log file\n", fileName);
+        fclose(fp);
+        return -1;
+    }
+    if (CONSOLE_BIN_BYTE_ORDER != header.byteOrder || CONSOLE_BIN_VERSION != header.version)
+    {
+        fprintf(stderr, "Error: '%s' was written with a different byte order or version (%u)\n",
+            fileName, header.version);
+        fclose(fp);
+        return -1;
+    }
+    pArgs = malloc(0x10000);
+    if (NULL == pArgs)
+    {
+        fclose(fp);
+        return -1;
+    }
+    while (true)
+    {
+        uint8_t type;
+        if (!ReadExact(fp, &type, sizeof(type)))
+            break;
+        if (ConsoleBin_Definition == type)
+        {
+            ConsoleBinDef_t def;
+            char *format;
+            def.type = type;
+            if (!ReadExact(fp, (uint8_t *)&def + 1, sizeof(def) - 1))
+                break;
+            format = malloc(def.len + 1);
+            if (NULL == format || !ReadExact(fp, format, def.len))
+            {
+                free(format);
+                break;
+            }
+            format[def.len] = '\0';
+            if (!StoreDefinition(&ppDefs, &defsSize, def.id, format))
+            {
+                free(format);
+                result = -1;
+                break;
+            }
+        }
+        else if (ConsoleBin_Event == type)
+        {
+            ConsoleBinEvent_t evt;
+            evt.type = type;
+            if (!ReadExact(fp, (uint8_t *)&evt + 1, sizeof(evt) - 1)
+                || !ReadExact(fp, pArgs, evt.argsLen))
+                break;
+            if (!inMessage)
+            {
+                uint64_t t = evt.timeUs - header.monotonicUs;
+                if (absolute)
+                    t += header.realTimeUs;
+                printf("[%llu.%06llu] ", (unsigned long long)(t / 1000000), (unsigned long long)(t % 1000000));
+            }
+            if (evt.id < defsSize && NULL != ppDefs[evt.id])
+                PrintEvent(ppDefs[evt.id], pArgs, evt.argsLen);
+            else
+                printf("<unknown format %u>", evt.id);
+            inMessage = (0 != (evt.flags & CONSOLE_BIN_FLAG_PART));
+            if (!inMessage && (evt.id >= defsSize || NULL == ppDefs[evt.id]
+                || 0 == strlen(ppDefs[evt.id]) || '\n' != ppDefs[evt.id][strlen(ppDefs[evt.id]) - 1]))
+                printf("\n");
+            ++events;
+        }
+        else
+        {
+            fprintf(stderr, "Error: Unknown record type %u after %u messages, file corrupted\n", type, events);
+            result = -1;
+            break;
+        }
+    }
+    if (!feof(fp) && 0 == result)
+    {
+        fprintf(stderr, "Error: File ends within a record after %u messages\n", events);
+        result = -1;
+    }
+    for (i = 0; i < defsSize; i++)
+        free(ppDefs[i]);
+    free(ppDefs);
+    free(pArgs);
+    fclose(fp);
+    return result;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void)
+{
+    printf("Usage: unicens-logdecode [OPTION]... [FILE]\n");
+    printf("Prints the messages of a binary log file written by unicensd -blog as text.\n\n");
+    printf("  -abs                     Print the wall clock time instead of the time since the file was created\n");
+    printf("  --help                   Prints this help and exit\n\n");
+    printf("Examples:\n");
+    printf("  unicens-logdecode unicensd.blog\n");
+    printf("  unicens-logdecode -abs unicensd.blog | less\n");
+}
+
+static bool ReadExact(FILE *fp, void *pData, size_t len)
+{
+    return (0 == len || 1 == fread(pData, len, 1, fp));
+}
+
+static bool StoreDefinition(char ***pppDefs, uint32_t *pDefsSize, uint32_t id, char *format)
+{
+    if (id >= *pDefsSize)
+    {
+        uint32_t newSize = (id + 1) * 2;
+        char **ppDefs = realloc(*pppDefs, newSize * sizeof(char *));
+        if (NULL == ppDefs)
+            return false;
+        memset(&ppDefs[*pDefsSize], 0, (newSize - *pDefsSize) * sizeof(char *));
+        *pppDefs = ppDefs;
+        *pDefsSize = newSize;
+    }
+    free((*pppDefs)[id]);
+    (*pppDefs)[id] = format;
+    return true;
+}
+
+/* Prints the literal text and renders every conversion on its own with the recorded argument */
+static void PrintEvent(const char *format, const uint8_t *pArgs, uint16_t argsLen)
+{
+    ArgReader_t ar;
+    const char *p = format;
+    ar.pData = pArgs;
+    ar.len = argsLen;
+    ar.pos = 0;
+    while ('\0' != *p)
+    {
+        char spec[MAX_SPEC_LEN];
+        int64_t star[MAX_STAR_ARGS];
+        uint8_t starCnt = 0;
+        uint16_t specLen = 0;
+        const char *start;
+        char conv;
+        if ('%' != *p)
+        {
+            putchar(*p++);
+            continue;
+        }
+        if ('%' == p[1])
+        {
+            putchar('%');
+            p += 2;
+            continue;
+        }
+        start = p++;
+        spec[specLen++] = '%';
+        while ('\0' != *p && NULL != strchr("-+ #0'*.0123456789", *p) && specLen < MAX_SPEC_LEN - 8)
+        {
+            if ('*' == *p)
+            {
+                if (MAX_STAR_ARGS <= starCnt || !GetArg(&ar, ConsoleBinArg_Int, &star[starCnt], NULL))
+                    break;
+                ++starCnt;
+            }
+            spec[specLen++] = *p++;
+        }
+        /* Length modifiers are replaced, the arguments were stored with 64 bits */
+        while ('\0' != *p && NULL != strchr("hlqzjtL", *p))
+            ++p;
+        conv = *p;
+        if ('\0' == conv)
+            break;
+        ++p;
+        switch (conv)
+        {
+        case 'd':
+        case 'i':
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'c':
+        {
+            int64_t v;
+            if (!GetArg(&ar, ConsoleBinArg_Int, &v, NULL))
+                break;
+            if ('c' != conv)
+            {
+                spec[specLen++] = 'l';
+                spec[specLen++] = 'l';
+            }
+            spec[specLen++] = conv;
+            spec[specLen] = '\0';
+            if ('c' == conv)
+            {
+                if (0 == starCnt) printf(spec, (int)v);
+                else if (1 == starCnt) printf(spec, (int)star[0], (int)v);
+                else printf(spec, (int)star[0], (int)star[1], (int)v);
+            }
+            else
+            {
+                if (0 == starCnt) printf(spec, (long long)v);
+                else if (1 == starCnt) printf(spec, (int)star[0], (long long)v);
+                else printf(spec, (int)star[0], (int)star[1], (long long)v);
+            }
+            continue;
+        }
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double v;
+            if (!GetArg(&ar, ConsoleBinArg_Double, &v, NULL))
+                break;
+            spec[specLen++] = conv;
+            spec[specLen] = '\0';
+            if (0 == starCnt) printf(spec, v);
+            else if (1 == starCnt) printf(spec, (int)star[0], v);
+            else printf(spec, (int)star[0], (int)star[1], v);
+            continue;
+        }
+        case 's':
+        {
+            const char *v;
+            uint16_t vLen;
+            if (!GetArg(&ar, ConsoleBinArg_String, &v, &vLen))
+                break;
+            /* Strings are not zero terminated in the file, so the length is passed as precision */
+            if (NULL == memchr(spec, '.', specLen))
+            {
+                spec[specLen++] = '.';
+                spec[specLen++] = '*';
+                spec[specLen++] = 's';
+                spec[specLen] = '\0';
+                if (0 == starCnt) printf(spec, (int)vLen, v);
+                else printf(spec, (int)star[0], (int)vLen, v);
+            }
+            else
+            {
+                char *copy = malloc(vLen + 1);
+                if (NULL == copy)
+                    break;
+                memcpy(copy, v, vLen);
+                copy[vLen] = '\0';
+                spec[specLen++] = 's';
+                spec[specLen] = '\0';
+                if (0 == starCnt) printf(spec, copy);
+                else if (1 == starCnt) printf(spec, (int)star[0], copy);
+                else printf(spec, (int)star[0], (int)star[1], copy);
+                free(copy);
+            }
+            continue;
+        }
+        case 'p':
+        {
+            uint64_t v;
+            if (!GetArg(&ar, ConsoleBinArg_Pointer, &v, NULL))
+                break;
+            printf("0x%llx", (unsigned long long)v);
+            continue;
+        }
+        case 'n':
+        case 'm':
+            continue;
+        default:
+            break;
+        }
+        /* Argument missing or of unexpected type, show the conversion as it is */
+        printf("%.*s", (int)(p - start), start);
+    }
+}
+
+static bool GetArg(ArgReader_t *ar, uint8_t type, void *pValue, uint16_t *pStrLen)
+{
+    if (ar->pos >= ar->len || type != ar->pData[ar->pos])
+        return false;
+    if (ConsoleBinArg_String == type)
+    {
+        uint16_t len;
+        if (ar->pos + 1 + sizeof(uint16_t) > ar->len)
+            return false;
+        memcpy(&len, &ar->pData[ar->pos + 1], sizeof(uint16_t));
+        if (ar->pos + 1 + sizeof(uint16_t) + len > ar->len)
+            return false;
+        *(const char **)pValue = (const char *)&ar->pData[ar->pos + 1 + sizeof(uint16_t)];
+        *pStrLen = len;
+        ar->pos += 1 + sizeof(uint16_t) + len;
+        return true;
+    }
+    if (ar->pos + 1 + 8 > ar->len)
+        return false;
+    memcpy(pValue, &ar->pData[ar->pos + 1], 8);
+    ar->pos += 1 + 8;
+    return true;
+}
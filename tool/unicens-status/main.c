@@ -0,0 +1,214 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Status Dump Tool                                                                       */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "StatusShm.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     USED ADJUSTABLE DEFINES                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define DEFAULT_WATCH_INTERVAL  (100)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void);
+static void PrintStatus(StatusShmReader_t *r, const StatusShmData_t *d, uint32_t sequence);
+static const char *GetNodeStateName(uint8_t state);
+static const char *GetResStateName(uint8_t state);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+int main(int argc, char *argv[])
+{
+    const char *name = STATUS_SHM_NAME;
+    bool watch = false;
+    long interval = DEFAULT_WATCH_INTERVAL;
+    uint32_t sequence, lastSequence = 1;
+    StatusShmReader_t reader;
+    static StatusShmData_t data;
+    int i;
+    for (i = 1; i < argc; i++)
+    {
+        if (0 == strcmp("-name", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -name parameter needs additional shared memory name\n");
+                return -1;
+            }
+            name = argv[++i];
+        }
+        else if (0 == strcmp("-watch", argv[i]))
+        {
+            watch = true;
+            if ((i+1) < argc && '-' != argv[i + 1][0])
+            {
+                interval = strtol(argv[++i], NULL, 0);
+                if (0 >= interval)
+                {
+                    fprintf(stderr, "Error: -watch interval must be greater than zero\n");
+                    return -1;
+                }
+            }
+        }
+        else if (0 == strcmp("--help", argv[i]))
+        {
+            PrintHelp();
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Error: Unknown parameter '%s'\n", argv[i]);
+            return -1;
+        }
+    }
+    if (!StatusShm_Open(&reader, name))
+    {
+        fprintf(stderr, "Error: Could not open status shared memory '%s' (version %d), is unicensd running?\n",
+            name, STATUS_SHM_VERSION);
+        return -1;
+    }
+    do
+    {
+        /* Only the sequence number is polled, the copy is taken when it has changed */
+        if (!watch || lastSequence != StatusShm_GetSequence(&reader))
+        {
+            if (!StatusShm_Read(&reader, &data, &sequence))
+            {
+                if (!watch)
+                {
+                    fprintf(stderr, "Error: Could not get a consistent status\n");
+                    StatusShm_Close(&reader);
+                    return -1;
+                }
+            }
+            else if (sequence != lastSequence)
+            {
+                lastSequence = sequence;
+                PrintStatus(&reader, &data, sequence);
+                fflush(stdout);
+            }
+        }
+        if (watch)
+            usleep(interval * 1000);
+    } while (watch);
+    StatusShm_Close(&reader);
+    return 0;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void)
+{
+    printf("Usage: unicens-status [OPTION]...\n");
+    printf("Prints the node, route and resource states published by unicensd into shared memory.\n\n");
+    printf("  -name [Name]             Name of the shared memory (default: %s)\n", STATUS_SHM_NAME);
+    printf("  -watch [Interval]        Keep running and print the status whenever it changed,\n");
+    printf("                           checked every [Interval] milliseconds (default: %d)\n", DEFAULT_WATCH_INTERVAL);
+    printf("  --help                   Prints this help and exit\n\n");
+    printf("Examples:\n");
+    printf("  unicens-status\n");
+    printf("  unicens-status -watch 500\n");
+    printf("  unicens-status -name /unicensd-status-2\n");
+}
+
+static void PrintStatus(StatusShmReader_t *r, const StatusShmData_t *d, uint32_t sequence)
+{
+    uint16_t i;
+    printf("status sequence=%u pid=%u daemon=%s\n", sequence, StatusShm_GetWriterPid(r),
+        d->daemonRunning ? "running" : "stopped");
+    printf("network available=%u nodes=%u\n", d->networkAvailable, d->nodeCount);
+    for (i = 0; i < d->nodesSize; i++)
+    {
+        const StatusShmNode_t *n = &d->nodes[i];
+        const StatusShmSignature_t *s = &n->signature;
+        printf("node address=0x%X state=%s", n->nodeAddress, GetNodeStateName(n->state));
+        if (n->signatureValid)
+        {
+            printf(" pos=0x%X group=0x%X mac=%02X:%02X:%02X:%02X:%02X:%02X chip=0x%X ports=%u fw=%u.%u.%u-%u cs=%u.%u.%u",
+                s->nodePosAddr, s->groupAddress, s->mac[0], s->mac[1], s->mac[2], s->mac[3], s->mac[4], s->mac[5],
+                s->chipId, s->numPorts, s->fwMajor, s->fwMinor, s->fwRelease, s->fwBuild,
+                s->csMajor, s->csMinor, s->csRelease);
+        }
+        printf("\n");
+    }
+    for (i = 0; i < d->routesSize; i++)
+    {
+        const StatusShmRoute_t *rt = &d->routes[i];
+        printf("route id=0x%X shall=%s is=%s label=0x%X source=0x%X sink=0x%X\n", rt->routeId,
+            rt->shallActive ? "active" : "inactive", rt->isBuilt ? "built" : "destroyed",
+            rt->connectionLabel, rt->sourceNode, rt->sinkNode);
+    }
+    for (i = 0; i < d->resourcesSize; i++)
+    {
+        const StatusShmResource_t *res = &d->resources[i];
+        printf("resource route=0x%X node=0x%X endpoint=%s job=%u type=%s state=%s\n", res->routeId,
+            res->nodeAddress, res->isSource ? "source" : "sink", res->jobIndex,
+            StatusShm_GetResTypeName(res->type), GetResStateName(res->state));
+    }
+    printf("\n");
+}
+
+static const char *GetNodeStateName(uint8_t state)
+{
+    switch (state)
+    {
+    case StatusNode_Available:
+        return "available";
+    case StatusNode_Ignored:
+        return "ignored";
+    default:
+        return "not-available";
+    }
+}
+
+static const char *GetResStateName(uint8_t state)
+{
+    switch (state)
+    {
+    case StatusRes_Built:
+        return "built";
+    case StatusRes_Failed:
+        return "failed";
+    default:
+        return "unused";
+    }
+}
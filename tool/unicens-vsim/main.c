@@ -0,0 +1,473 @@
+/*------------------------------------------------------------------------------------------------*/
+/* Virtual Time Simulation                                                                        */
+/* Copyright 2018, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Console.h"
+#include "InicSim.h"
+#include "task-unicens.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                          USER ADJUSTABLE                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define DEFAULT_NODES           (3)
+#define DEFAULT_FIRST_ADDRESS   (0x200)
+#define DEFAULT_LATENCY_MS      (1)
+#define DEFAULT_STARTUP_MS      (100)
+#define DEFAULT_I2C_MS          (5)
+#define DEFAULT_GPIO_MS         (2)
+#define DEFAULT_DURATION_MS     (10000)
+#define DEFAULT_CHIP_ID         (0x18)
+#define DEFAULT_GROUP_ADDRESS   (0x3C8)
+/* Own status shared memory, so a running unicensd is not disturbed */
+#define STATUS_NAME             "/unicens-vsim-status"
+#define MAX_BREAKS              (16)
+/* The task checks its own timers (e.g. cable diagnosis) only when it runs, so time advances at most this far at once */
+#define TIME_STEP_MS            (10)
+/* The task is considered stuck, if it still has work after this many calls without time advancing */
+#define MAX_PROCESS_CALLS       (10000)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                      DEFINES AND LOCAL VARIABLES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+typedef struct
+{
+    uint32_t startMs;
+    uint32_t durationMs;
+} RingBreak_t;
+
+typedef struct
+{
+    uint32_t nowMs;
+    bool timerArmed;
+    uint32_t timerDueMs;
+    bool rxHeld;
+    uint8_t rx[INICSIM_MAX_MSG_SIZE];
+    uint32_t rxLen;
+    uint32_t timeoutCnt;
+    uint32_t stuckCnt;
+} LocalVar_t;
+
+static LocalVar_t m;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void);
+static bool ParseMs(int argc, char *argv[], int *pIndex, uint32_t *pMs);
+static void SetNode(InicSimNode_t *node, uint16_t address, uint8_t chipId);
+static bool Run(uint32_t durationMs, const RingBreak_t *pBreaks, uint8_t breakCnt);
+static void ApplyRingBreaks(const RingBreak_t *pBreaks, uint8_t breakCnt);
+static bool ProcessTask(void);
+static uint32_t GetWallMs(void);
+static uint32_t EnvGetTicks(void *pTag);
+static void EnvSetTimer(void *pTag, uint16_t timeout);
+static bool EnvGetRx(void *pTag, uint8_t **pData, uint32_t *len);
+static bool EnvPopRx(void *pTag);
+static bool EnvWrite(void *pTag, const uint8_t *pData, uint32_t len);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+int main(int argc, char *argv[])
+{
+    static InicSimConfig_t cfg;
+    static TaskUnicens_t taskVars;
+    static const TaskUnicensEnv_t env = { NULL, &EnvGetTicks, &EnvSetTimer, &EnvGetRx, &EnvPopRx, &EnvWrite };
+    RingBreak_t breaks[MAX_BREAKS];
+    uint8_t breakCnt = 0;
+    uint32_t durationMs = DEFAULT_DURATION_MS;
+    long nodeCnt = DEFAULT_NODES;
+    InicSimStats_t stats;
+    uint32_t wallMs;
+    bool finished;
+    int i;
+    memset(&cfg, 0, sizeof(cfg));
+    memset(&taskVars, 0, sizeof(taskVars));
+    cfg.latencyMs = DEFAULT_LATENCY_MS;
+    cfg.startupMs = DEFAULT_STARTUP_MS;
+    cfg.i2cLatencyMs = DEFAULT_I2C_MS;
+    cfg.gpioLatencyMs = DEFAULT_GPIO_MS;
+    cfg.seed = 1;
+    taskVars.statusName = STATUS_NAME;
+    taskVars.env = &env;
+    ConsoleSetPrio(PRIO_HIGH);
+    for (i = 1; i < argc; i++)
+    {
+        if ('-' != argv[i][0])
+        {
+            if (NULL != taskVars.cfgFileName)
+            {
+                fprintf(stderr, "Error: Filename is already set. Wrong parameter='%s'\n", argv[i]);
+                return -1;
+            }
+            taskVars.cfgFileName = argv[i];
+        }
+        else if (0 == strcmp("-variant", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -variant parameter needs additional configuration name or \"auto\"\n");
+                return -1;
+            }
+            taskVars.variantName = argv[++i];
+        }
+        else if (0 == strcmp("-nodes", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -nodes parameter needs additional amount of nodes\n");
+                return -1;
+            }
+            nodeCnt = strtol(argv[++i], NULL, 0);
+            if (1 > nodeCnt || INICSIM_MAX_NODES < nodeCnt)
+            {
+                fprintf(stderr, "Error: -nodes must be between 1 and %d\n", INICSIM_MAX_NODES);
+                return -1;
+            }
+        }
+        else if (0 == strcmp("-seed", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -seed parameter needs additional number\n");
+                return -1;
+            }
+            cfg.seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (0 == strcmp("-jitter", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.jitterMs))
+                return -1;
+        }
+        else if (0 == strcmp("-latency", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.latencyMs))
+                return -1;
+        }
+        else if (0 == strcmp("-startup", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.startupMs))
+                return -1;
+        }
+        else if (0 == strcmp("-i2c", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.i2cLatencyMs))
+                return -1;
+        }
+        else if (0 == strcmp("-gpio", argv[i]))
+        {
+            if (!ParseMs(argc, argv, &i, &cfg.gpioLatencyMs))
+                return -1;
+        }
+        else if (0 == strcmp("-duration", argv[i]))
+        {
+            unsigned long ms;
+            if (argc <= (i+1))
+            {
+                fprintf(stderr, "Error: -duration parameter needs additional time in milliseconds\n");
+                return -1;
+            }
+            ms = strtoul(argv[++i], NULL, 0);
+            if (1 > ms || 86400000UL < ms)
+            {
+                fprintf(stderr, "Error: -duration must be between 1 and 86400000 ms\n");
+                return -1;
+            }
+            durationMs = (uint32_t)ms;
+        }
+        else if (0 == strcmp("-break", argv[i]))
+        {
+            unsigned int startMs, breakMs;
+            if (argc <= (i+1) || 2 != sscanf(argv[i + 1], "%u:%u", &startMs, &breakMs))
+            {
+                fprintf(stderr, "Error: -break parameter needs additional start and duration in milliseconds like 2000:500\n");
+                return -1;
+            }
+            if (MAX_BREAKS <= breakCnt)
+            {
+                fprintf(stderr, "Error: At most %d ring breaks can be simulated\n", MAX_BREAKS);
+                return -1;
+            }
+            breaks[breakCnt].startMs = startMs;
+            breaks[breakCnt].durationMs = breakMs;
+            ++breakCnt;
+            ++i;
+        }
+        else if (0 == strcmp("-v", argv[i]))
+        {
+            ConsoleSetPrio(PRIO_MEDIUM);
+        }
+        else if (0 == strcmp("-vv", argv[i]))
+        {
+            ConsoleSetPrio(PRIO_LOW);
+        }
+        else if (0 == strcmp("-hide", argv[i]))
+        {
+            taskVars.noRouteTable = true;
+        }
+        else if (0 == strcmp("-lld", argv[i]))
+        {
+            taskVars.lldTrace = true;
+        }
+        else if (0 == strcmp("--help", argv[i]))
+        {
+            PrintHelp();
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Error: Unknown parameter '%s'\n", argv[i]);
+            return -1;
+        }
+    }
+    cfg.nodeCnt = (uint8_t)nodeCnt;
+    for (i = 0; i < cfg.nodeCnt; i++)
+        SetNode(&cfg.nodes[i], DEFAULT_FIRST_ADDRESS + i, DEFAULT_CHIP_ID);
+    InicSim_Init(&cfg);
+    memset(&m, 0, sizeof(m));
+
+    ConsolePrintf(PRIO_HIGH, "Simulating %u nodes for %u ms, seed=%u, jitter=%u ms\r\n", cfg.nodeCnt, durationMs, cfg.seed, cfg.jitterMs);
+    wallMs = GetWallMs();
+    if (!TaskUnicens_Init(&taskVars))
+    {
+        ConsolePrintf(PRIO_ERROR, RED "Initialization of UNICENS task failed" RESETCOLOR "\r\n");
+        return -1;
+    }
+    finished = Run(durationMs, breaks, breakCnt);
+    wallMs = GetWallMs() - wallMs;
+
+    InicSim_GetStats(&stats);
+    ConsolePrintfStart(PRIO_HIGH, GREEN "Simulated %u ms in %u ms" RESETCOLOR "\r\n", m.nowMs, wallMs);
+    ConsolePrintfContinue("  Messages    : %u sent to the INIC, %u received from the INIC, %u not simulated\r\n",
+        stats.rxMessages, stats.txMessages, stats.unknownMessages);
+    ConsolePrintfContinue("  Network     : %u startups, last available at %u ms, %u nodes welcomed, %u resources created\r\n",
+        stats.networkStartups, stats.availableMs, stats.discoveredNodes, stats.resources);
+    ConsolePrintfContinue("  Task        : %u service timeouts, %u times stuck\r\n", m.timeoutCnt, m.stuckCnt);
+    ConsolePrintfExit("\r\n");
+    return finished ? 0 : -1;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void PrintHelp(void)
+{
+    printf("Usage: unicens-vsim [OPTION]... [FILE]\n");
+    printf("Runs the UNICENS task of unicensd against a simulated INICnet in virtual time on a single thread.\n");
+    printf("Time only advances when nothing is left to do, so seconds of network startup take milliseconds.\n");
+    printf("All delays are derived from the seed, the same options give the same run.\n");
+    printf("FILE is a XML or binary configuration, without it the compiled default configuration is used.\n\n");
+    printf("  -variant [Name]          Uses the compiled configuration with the given name or \"auto\"\n");
+    printf("  -nodes [Count]           Amount of nodes including the local INIC, numbered from 0x%X on (default %d)\n",
+        DEFAULT_FIRST_ADDRESS, DEFAULT_NODES);
+    printf("  -seed [Value]            Start value of the random generator (default 1)\n");
+    printf("  -jitter [ms]             Every answer is delayed randomly by up to this time (default 0)\n");
+    printf("  -latency [ms]            Time until an INIC answers (default %d)\n", DEFAULT_LATENCY_MS);
+    printf("  -startup [ms]            Time until the network is available after startup (default %d)\n", DEFAULT_STARTUP_MS);
+    printf("  -i2c [ms]                Time until an I2C read or write is finished (default %d)\n", DEFAULT_I2C_MS);
+    printf("  -gpio [ms]               Time until a GPIO request is answered (default %d)\n", DEFAULT_GPIO_MS);
+    printf("  -duration [ms]           Virtual time to simulate (default %d)\n", DEFAULT_DURATION_MS);
+    printf("  -break [Start]:[ms]      Breaks the ring at the given virtual time for the given time, may be given multiple times\n");
+    printf("  -hide                    Disable node and route table printing\n");
+    printf("  -lld                     Prints every port message with its virtual time\n");
+    printf("  -v                       Verbose mode\n");
+    printf("  -vv                      Super verbose mode\n");
+    printf("  --help                   Prints this help and exit\n\n");
+    printf("Examples:\n");
+    printf("  unicens-vsim -nodes 8 -hide config.xml\n");
+    printf("  unicens-vsim -nodes 8 -jitter 20 -seed 42 -break 3000:1500 -duration 20000 config.xml\n");
+}
+
+static bool ParseMs(int argc, char *argv[], int *pIndex, uint32_t *pMs)
+{
+    long ms;
+    if (argc <= (*pIndex + 1))
+    {
+        fprintf(stderr, "Error: %s parameter needs additional time in milliseconds\n", argv[*pIndex]);
+        return false;
+    }
+    ms = strtol(argv[*pIndex + 1], NULL, 0);
+    if (0 > ms || 60000 < ms)
+    {
+        fprintf(stderr, "Error: %s time must be between 0 and 60000 ms\n", argv[*pIndex]);
+        return false;
+    }
+    *pMs = (uint32_t)ms;
+    ++*pIndex;
+    return true;
+}
+
+static void SetNode(InicSimNode_t *node, uint16_t address, uint8_t chipId)
+{
+    memset(node, 0, sizeof(InicSimNode_t));
+    node->nodeAddress = address;
+    node->groupAddress = DEFAULT_GROUP_ADDRESS;
+    /* Locally administered MAC address, derived from the node address */
+    node->mac[0] = 0x02;
+    node->mac[4] = address >> 8;
+    node->mac[5] = address & 0xFF;
+    node->numPorts = 2;
+    node->chipId = chipId;
+    node->fwMajor = 3;
+    node->fwMinor = 2;
+    node->csMajor = 1;
+}
+
+/* Delivers everything due at the current time, then jumps to the next event. Returns false, if the task stopped by itself */
+static bool Run(uint32_t durationMs, const RingBreak_t *pBreaks, uint8_t breakCnt)
+{
+    uint8_t i;
+    ApplyRingBreaks(pBreaks, breakCnt);
+    while (true)
+    {
+        uint32_t nextMs;
+        int32_t rxTimeout;
+        if (!ProcessTask())
+            return false;
+        if (!m.rxHeld && InicSim_GetRx(m.nowMs, m.rx, &m.rxLen))
+        {
+            m.rxHeld = true;
+            TaskUnicens_OnDataAvailable();
+            continue;
+        }
+        if (m.timerArmed && (int32_t)(m.nowMs - m.timerDueMs) >= 0)
+        {
+            m.timerArmed = false;
+            ++m.timeoutCnt;
+            TaskUnicens_OnTimeout();
+            continue;
+        }
+        if (durationMs <= m.nowMs)
+            return true;
+        /* Nothing left to do at this time, jump to the next event */
+        nextMs = m.nowMs + TIME_STEP_MS;
+        if (m.timerArmed && (int32_t)(m.timerDueMs - nextMs) < 0)
+            nextMs = m.timerDueMs;
+        rxTimeout = InicSim_GetTimeout(m.nowMs);
+        if (!m.rxHeld && 0 <= rxTimeout && m.nowMs + (uint32_t)rxTimeout < nextMs)
+            nextMs = m.nowMs + (uint32_t)rxTimeout;
+        for (i = 0; i < breakCnt; i++)
+        {
+            if (m.nowMs < pBreaks[i].startMs && pBreaks[i].startMs < nextMs)
+                nextMs = pBreaks[i].startMs;
+            if (m.nowMs < pBreaks[i].startMs + pBreaks[i].durationMs && pBreaks[i].startMs + pBreaks[i].durationMs < nextMs)
+                nextMs = pBreaks[i].startMs + pBreaks[i].durationMs;
+        }
+        if (durationMs < nextMs)
+            nextMs = durationMs;
+        m.nowMs = nextMs;
+        ApplyRingBreaks(pBreaks, breakCnt);
+    }
+}
+
+static void ApplyRingBreaks(const RingBreak_t *pBreaks, uint8_t breakCnt)
+{
+    uint8_t i;
+    for (i = 0; i < breakCnt; i++)
+    {
+        if (pBreaks[i].startMs == m.nowMs)
+        {
+            ConsolePrintf(PRIO_HIGH, YELLOW "%08u: Ring break for %u ms" RESETCOLOR "\r\n", m.nowMs, pBreaks[i].durationMs);
+            InicSim_SetRingBreak(m.nowMs, true);
+        }
+        if (pBreaks[i].startMs + pBreaks[i].durationMs == m.nowMs)
+        {
+            ConsolePrintf(PRIO_HIGH, YELLOW "%08u: Ring closed" RESETCOLOR "\r\n", m.nowMs);
+            InicSim_SetRingBreak(m.nowMs, false);
+        }
+    }
+}
+
+/* Runs the task until it waits for new events, it also checks its own timers once every call */
+static bool ProcessTask(void)
+{
+    uint32_t calls = 0;
+    do
+    {
+        if (!TaskUnicens_Process())
+            return false;
+        if (MAX_PROCESS_CALLS <= ++calls)
+        {
+            /* e.g. UNICENS can not take the received message, let time pass */
+            ++m.stuckCnt;
+            break;
+        }
+    } while (TaskUnicens_IsPending());
+    return true;
+}
+
+static uint32_t GetWallMs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+static uint32_t EnvGetTicks(void *pTag)
+{
+    return m.nowMs;
+}
+
+static void EnvSetTimer(void *pTag, uint16_t timeout)
+{
+    m.timerArmed = (0 != timeout);
+    m.timerDueMs = m.nowMs + timeout;
+}
+
+static bool EnvGetRx(void *pTag, uint8_t **pData, uint32_t *len)
+{
+    if (!m.rxHeld)
+        return false;
+    *pData = m.rx;
+    *len = m.rxLen;
+    return true;
+}
+
+static bool EnvPopRx(void *pTag)
+{
+    m.rxHeld = false;
+    return true;
+}
+
+static bool EnvWrite(void *pTag, const uint8_t *pData, uint32_t len)
+{
+    InicSim_OnTx(m.nowMs, pData, len);
+    return true;
+}
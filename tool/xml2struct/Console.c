@@ -38,12 +38,31 @@ typedef struct
 {
     /**Minimum priority to be printed. If lower, message will be discarded.*/
     ConsolePrio_t minPrio;
+} LocalData_t;
+
+typedef struct
+{
     /**If is in a critical segmented print, this variable will hold the prio for Start, Continue, Exit.*/
     ConsolePrio_t contPrio;
-} LocalData_t;
+    /**Stream for all non error messages of this thread. If NULL, stdout is used.*/
+    FILE *out;
+} ThreadData_t;
 /*! \endcond */
 
 static LocalData_t data = { 0 };
+static __thread ThreadData_t thread = { 0 };
+
+static FILE *GetStream(ConsolePrio_t prio)
+{
+    if (PRIO_ERROR == prio)
+        return stderr;
+    return (NULL != thread.out) ? thread.out : stdout;
+}
+
+void ConsoleSetOutput( FILE *out )
+{
+    thread.out = out;
+}
 
 void ConsoleSetPrio( ConsolePrio_t prio )
 {
@@ -56,38 +75,38 @@ void ConsolePrintf( ConsolePrio_t prio, const char *statement, ... )
     if( prio < data.minPrio || NULL == statement )
         return;
     va_start( args, statement );
-    vfprintf( (PRIO_ERROR == prio ? stderr : stdout), statement, args );
+    vfprintf( GetStream(prio), statement, args );
     va_end( args );
 }
 
 void ConsolePrintfStart( ConsolePrio_t prio, const char *statement, ... )
 {
     va_list args;
-    data.contPrio = prio;
-    if( data.contPrio < data.minPrio || NULL == statement )
+    thread.contPrio = prio;
+    if( thread.contPrio < data.minPrio || NULL == statement )
         return;
     va_start( args, statement );
-    vfprintf( (PRIO_ERROR == prio ? stderr : stdout), statement, args );
+    vfprintf( GetStream(prio), statement, args );
     va_end( args );
 }
 
 void ConsolePrintfContinue( const char *statement, ... )
 {
     va_list args;
-    if( data.contPrio < data.minPrio || NULL == statement )
+    if( thread.contPrio < data.minPrio || NULL == statement )
         return;
     va_start( args, statement );
-    vfprintf( (PRIO_ERROR == data.contPrio ? stderr : stdout), statement, args );
+    vfprintf( GetStream(thread.contPrio), statement, args );
     va_end( args );
 }
 
 void ConsolePrintfExit( const char *statement, ... )
 {
     va_list args;
-    if( data.contPrio < data.minPrio || NULL == statement )
+    if( thread.contPrio < data.minPrio || NULL == statement )
         return;
     va_start( args, statement );
-    vfprintf( (PRIO_ERROR == data.contPrio ? stderr : stdout), statement, args );
+    vfprintf( GetStream(thread.contPrio), statement, args );
     va_end( args );
 }
 
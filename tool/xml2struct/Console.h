@@ -54,6 +54,7 @@
 #endif
 
 #include <stdbool.h>
+#include <stdio.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -76,6 +77,13 @@ extern "C"
     /*----------------------------------------------------------*/
     void ConsoleSetPrio( ConsolePrio_t prio );
 
+    /*----------------------------------------------------------*/
+    /*! \brief Redirects all non error messages of the calling thread to the given stream
+     *  \param out - The stream to print to, NULL to print to stdout again
+     */
+    /*----------------------------------------------------------*/
+    void ConsoleSetOutput( FILE *out );
+
     /*----------------------------------------------------------*/
     /*! \brief Uses the board specific PRINT mechanism and provides thread and process safety.
      *
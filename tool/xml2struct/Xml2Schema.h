@@ -0,0 +1,123 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Driver Printing module                                                                 */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#ifndef UCSXML2SCHEMA_H_
+#define UCSXML2SCHEMA_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* The tables of this file are generated by xsd2c from cfg/unicens.xsd at build time.
+ * Every element declaration of the schema owns a content model, which is compiled
+ * into a deterministic state machine over the names of its child elements. */
+
+#define SCHEMA_NONE         (0xFFFF)
+#define SCHEMA_MAX_ATTR     (64)
+
+typedef enum
+{
+    SCHEMA_LEX_STRING,      /* Any text */
+    SCHEMA_LEX_INTEGER,     /* xs:integer, optional sign and decimal digits */
+    SCHEMA_LEX_NUMBER,      /* Decimal or 0x prefixed hexadecimal number */
+    SCHEMA_LEX_BOOLEAN,     /* true, false, 1 or 0 */
+    SCHEMA_LEX_HEX_DATA,    /* Space separated hexadecimal bytes, may be empty */
+    SCHEMA_LEX_NOT_BLANK    /* Text with at least one non whitespace character */
+} SchemaLexical_t;
+
+typedef struct
+{
+    const char *name;
+    SchemaLexical_t lexical;
+    /* NULL terminated list of allowed values, NULL if there is no enumeration */
+    const char *const *enumeration;
+    int32_t minLength;      /* -1 if not restricted */
+    int32_t maxLength;      /* -1 if not restricted */
+    bool hasMin;
+    bool hasMax;
+    int64_t minValue;       /* Inclusive */
+    int64_t maxValue;       /* Inclusive */
+} SchemaSimpleType_t;
+
+typedef struct
+{
+    const char *name;
+    uint16_t simpleType;
+    bool required;
+} SchemaAttribute_t;
+
+typedef struct
+{
+    uint16_t element;       /* Index of the child element declaration */
+    uint16_t nextState;
+} SchemaTransition_t;
+
+typedef struct
+{
+    uint16_t firstTransition;
+    uint16_t transitionCount;
+    bool accepting;         /* The element may be closed in this state */
+} SchemaState_t;
+
+typedef struct
+{
+    const char *name;
+    uint16_t firstAttribute;
+    uint16_t attributeCount;
+    uint16_t startState;
+    uint16_t stateCount;
+    uint16_t textType;      /* Simple type of the text content, SCHEMA_NONE for element only content */
+} SchemaElement_t;
+
+typedef struct
+{
+    const SchemaSimpleType_t *simpleTypes;
+    uint16_t simpleTypesSize;
+    const SchemaAttribute_t *attributes;
+    uint16_t attributesSize;
+    const SchemaTransition_t *transitions;
+    uint16_t transitionsSize;
+    const SchemaState_t *states;
+    uint16_t statesSize;
+    const SchemaElement_t *elements;
+    uint16_t elementsSize;
+    /* State machine of the document, its transitions lead to the allowed root elements */
+    uint16_t rootState;
+} Schema_t;
+
+extern const Schema_t unicensSchema;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*UCSXML2SCHEMA_H_*/
@@ -53,31 +53,64 @@ static const char *VERSION_STR = "V5.2.1";
 #define C99(X)
 #endif
 
-struct ObjectList
+/* UNICENS only reads the resource objects and job lists, so they are emitted
+ * as const and end up in .rodata. The casts drop the qualifier again for the
+ * non-const pointers of the UNICENS structures */
+#define RES_CONST               "const "
+#define RES_REF                 "(Ucs_Xrm_ResObject_t *)&%s"
+
+#define ARENA_BLOCK_SIZE        (16 * 1024)
+#define ARENA_ALIGN             (sizeof(void *))
+#define NAME_TABLE_INIT_SIZE    (256)
+/* Limits given by ucs_cfg.h and ucs_xrm_cfg.h */
+#define POOL_MAX_REMOTE_DEVICES (63)
+#define POOL_MAX_JOBS           (254)
+#define REGISTRY_NAME_MAX_LEN   (64)
+
+struct ArenaBlock
 {
-    void *obj;
-    struct ObjectList *next;
+    struct ArenaBlock *next;
+    size_t used;
+    size_t size;
+    void *data[];
 };
 
-struct NameLookupTable
+struct NameEntry
 {
     UCS_NS_CONST Ucs_Xrm_ResObject_t *element;
     char *name;
-    struct NameLookupTable *next;
+};
+
+/* Two open addressing hash sets over the same entries, keyed by element pointer and by name.
+ * Both have the same power of two size and are kept at most half full. */
+struct NameTable
+{
+    struct NameEntry **byElement;
+    struct NameEntry **byName;
+    uint32_t size;
+    uint32_t count;
 };
 
 struct LocalVar
 {
-    struct ObjectList objList;
-    struct NameLookupTable allNames;
+    struct ArenaBlock *arena;
+    struct NameTable allNames;
     uint16_t currentRoute;
     bool isSourceJob;
     const char *prefix;
 };
 
 static void PrintHeader(void);
-static void *Mcalloc(struct ObjectList *list, uint32_t nElem, uint32_t elemSize);
-static void Mfree(struct ObjectList *cur);
+static void PrintConfiguration(uint16_t packetBw, uint16_t proxyBw, Ucs_Rm_Route_t *pRoutes, uint16_t routesSize,
+    Ucs_Rm_Node_t *pNod, uint16_t nodSize, const char *variablePrefix);
+static uint32_t AddMargin(uint32_t value, uint16_t marginPercent);
+static void *ArenaAlloc(uint32_t size);
+static void ArenaFree(void);
+static uint32_t HashPointer(const void *ptr);
+static uint32_t HashString(const char *str);
+static void InsertName(struct NameEntry **table, uint32_t size, struct NameEntry *entry, uint32_t hash);
+static void GrowNameTable(void);
+static void FreeNameTable(void);
 static UCS_NS_CONST Ucs_Xrm_ResObject_t *GetObjectFromTable(const char *name);
 static char *GetNameFromTable(UCS_NS_CONST Ucs_Xrm_ResObject_t *element);
 static void StoreNameInTable(UCS_NS_CONST Ucs_Xrm_ResObject_t *element, char *name);
@@ -120,7 +153,8 @@ static void PrintEndpoint(Ucs_Rm_EndPoint_t *ep, bool isSourceEp, uint8_t routeP
 static const char*GetClockConfigString(Ucs_Stream_PortClockConfig_t clk_config);
 static void PrintRoutes(Ucs_Rm_Route_t *routes, uint8_t len);
 
-static struct LocalVar m;
+/* Thread local, so several files can be printed in parallel */
+static __thread struct LocalVar m;
 
 const char *GetXml2StructVersion(void)
 {
@@ -135,6 +169,58 @@ void PrintUcsStructures(
     Ucs_Rm_Node_t *pNod,
     uint16_t nodSize,
     const char *variablePrefix)
+{
+    PrintHeader();
+    ConsolePrintf(PRIO_HIGH, "#include \"ucs_api.h\"\n\n");
+    PrintConfiguration(packetBw, proxyBw, pRoutes, routesSize, pNod, nodSize, variablePrefix);
+}
+
+void PrintUcsRegistry(const Xml2StructConfig_t *pConfigs, uint16_t configsSize)
+{
+    uint16_t i;
+    char prefix[REGISTRY_NAME_MAX_LEN + 2];
+    CHECK_ASSERT(pConfigs);
+    PrintHeader();
+    ConsolePrintf(PRIO_HIGH, "#include \"ucs_api.h\"\n");
+    ConsolePrintf(PRIO_HIGH, "#include \"default_config.h\"\n\n");
+    for (i = 0; i < configsSize; i++)
+    {
+        const Xml2StructConfig_t *cfg = &pConfigs[i];
+        CHECK_ASSERT(strlen(cfg->name) <= REGISTRY_NAME_MAX_LEN);
+        snprintf(prefix, sizeof(prefix), "%s_", cfg->name);
+        ConsolePrintf(PRIO_HIGH, "/* Configuration '%s' */\n", cfg->name);
+        PrintConfiguration(cfg->packetBw, cfg->proxyBw, cfg->pRoutes, cfg->routesSize, cfg->pNod, cfg->nodSize, prefix);
+        ConsolePrintf(PRIO_HIGH, "\n");
+    }
+    ConsolePrintfStart(PRIO_HIGH, "const DefaultConfig_t DefaultConfigs[] = {\n");
+    for (i = 0; i < configsSize; i++)
+    {
+        const Xml2StructConfig_t *cfg = &pConfigs[i];
+        ConsolePrintfContinue(TAB "{\n");
+        ConsolePrintfContinue(TAB TAB C99(".name = ") "\"%s\",\n", cfg->name);
+        ConsolePrintfContinue(TAB TAB C99(".packetBw = ") "%u,\n", cfg->packetBw);
+        ConsolePrintfContinue(TAB TAB C99(".proxyBw = ") "%u,\n", cfg->proxyBw);
+        /* The empty lists are printed as pointer variables, which are no constant initializers */
+        if (0 != cfg->routesSize)
+            ConsolePrintfContinue(TAB TAB C99(".pRoutes = ") "%s_AllRoutes,\n", cfg->name);
+        else
+            ConsolePrintfContinue(TAB TAB C99(".pRoutes = ") "NULL,\n");
+        ConsolePrintfContinue(TAB TAB C99(".routesSize = ") "%u,\n", cfg->routesSize);
+        ConsolePrintfContinue(TAB TAB C99(".pNodes = ") "%s_AllNodes,\n", cfg->name);
+        ConsolePrintfContinue(TAB TAB C99(".nodesSize = ") "%u }%s\n", cfg->nodSize, (i + 1 < configsSize) ? "," : "");
+    }
+    ConsolePrintfContinue("};\n");
+    ConsolePrintfExit("const uint16_t DefaultConfigsSize = %u;\n", configsSize);
+}
+
+static void PrintConfiguration(
+    uint16_t packetBw,
+    uint16_t proxyBw,
+    Ucs_Rm_Route_t *pRoutes,
+    uint16_t routesSize,
+    Ucs_Rm_Node_t *pNod,
+    uint16_t nodSize,
+    const char *variablePrefix)
 {
     uint16_t i;
     memset(&m, 0, sizeof(struct LocalVar));
@@ -144,8 +230,6 @@ void PrintUcsStructures(
         m.prefix = "";
     else
         m.prefix = variablePrefix;
-    PrintHeader();
-    ConsolePrintf(PRIO_HIGH, "#include \"ucs_api.h\"\n\n");
     ConsolePrintf(PRIO_HIGH, "uint16_t %sPacketBandwidth = %u;\n", m.prefix, packetBw);
     ConsolePrintf(PRIO_HIGH, "uint16_t %sProxyBandwidth = %u;\n", m.prefix, proxyBw);
     ConsolePrintf(PRIO_HIGH, "uint16_t %sRoutesSize = %u;\n", m.prefix, routesSize);
@@ -190,10 +274,11 @@ void PrintUcsStructures(
     }
     PrintNodes(pNod, nodSize);
     PrintRoutes(pRoutes, routesSize);
-    Mfree(&m.objList);
+    FreeNameTable();
+    ArenaFree();
 }
 
-void PrintHeaderFile(const char *variablePrefix)
+void PrintHeaderFile(const char *variablePrefix, bool registry)
 {
     const char *prefix;
     if (NULL == variablePrefix)
@@ -207,18 +292,66 @@ void PrintHeaderFile(const char *variablePrefix)
     ConsolePrintfContinue("extern \"C\" {\n");
     ConsolePrintfContinue("#endif\n\n");
     ConsolePrintfContinue("#include \"ucs_api.h\"\n\n");
-    ConsolePrintfContinue("extern uint16_t %sPacketBandwidth;\n", prefix);
-    ConsolePrintfContinue("extern uint16_t %sProxyBandwidth;\n", prefix);
-    ConsolePrintfContinue("extern uint16_t %sRoutesSize;\n", prefix);
-    ConsolePrintfContinue("extern uint16_t %sNodeSize;\n", prefix);
-    ConsolePrintfContinue("extern Ucs_Rm_Route_t %sAllRoutes[];\n", prefix);
-    ConsolePrintfContinue("extern Ucs_Rm_Node_t %sAllNodes[];\n\n", prefix);
+    if (!registry)
+    {
+        ConsolePrintfContinue("extern uint16_t %sPacketBandwidth;\n", prefix);
+        ConsolePrintfContinue("extern uint16_t %sProxyBandwidth;\n", prefix);
+        ConsolePrintfContinue("extern uint16_t %sRoutesSize;\n", prefix);
+        ConsolePrintfContinue("extern uint16_t %sNodeSize;\n", prefix);
+        ConsolePrintfContinue("extern Ucs_Rm_Route_t %sAllRoutes[];\n", prefix);
+        ConsolePrintfContinue("extern Ucs_Rm_Node_t %sAllNodes[];\n\n", prefix);
+    }
+    /* Headers of several prefixes may be included together, the registry is declared once */
+    ConsolePrintfContinue("#ifndef DEFAULT_CONFIG_REGISTRY_\n");
+    ConsolePrintfContinue("#define DEFAULT_CONFIG_REGISTRY_\n\n");
+    ConsolePrintfContinue("typedef struct\n");
+    ConsolePrintfContinue("{\n");
+    ConsolePrintfContinue(TAB "const char *name;\n");
+    ConsolePrintfContinue(TAB "uint16_t packetBw;\n");
+    ConsolePrintfContinue(TAB "uint16_t proxyBw;\n");
+    ConsolePrintfContinue(TAB "Ucs_Rm_Route_t *pRoutes;\n");
+    ConsolePrintfContinue(TAB "uint16_t routesSize;\n");
+    ConsolePrintfContinue(TAB "Ucs_Rm_Node_t *pNodes;\n");
+    ConsolePrintfContinue(TAB "uint16_t nodesSize;\n");
+    ConsolePrintfContinue("} DefaultConfig_t;\n\n");
+    ConsolePrintfContinue("/* Written by xml2struct -registry */\n");
+    ConsolePrintfContinue("extern const DefaultConfig_t DefaultConfigs[];\n");
+    ConsolePrintfContinue("extern const uint16_t DefaultConfigsSize;\n\n");
+    ConsolePrintfContinue("#endif /* DEFAULT_CONFIG_REGISTRY_ */\n\n");
     ConsolePrintfContinue("#ifdef __cplusplus\n");
     ConsolePrintfContinue("}\n");
     ConsolePrintfContinue("#endif\n\n");
     ConsolePrintfExit("#endif /* %s_DEFAULT_CONFIG_H_ */\n", prefix);
 }
 
+void PrintPoolHeaderFile(const char *sourceName, uint16_t nodes, uint16_t routes,
+    uint16_t endpoints, uint16_t resources, uint16_t marginPercent)
+{
+    /* The local INIC is part of the node list, but is not a remote device */
+    uint32_t remoteDevices = AddMargin((0 < nodes) ? nodes - 1 : 0, marginPercent);
+    uint32_t jobs = AddMargin(endpoints, marginPercent);
+    if (POOL_MAX_REMOTE_DEVICES < remoteDevices)
+        remoteDevices = POOL_MAX_REMOTE_DEVICES;
+    if (POOL_MAX_JOBS < jobs)
+    {
+        if (POOL_MAX_JOBS < endpoints)
+            ConsolePrintfError(sourceName, 0 ,0, "Error", "%u endpoints exceed the UNICENS limit of %u XRM jobs\r\n", endpoints, POOL_MAX_JOBS);
+        jobs = POOL_MAX_JOBS;
+    }
+    PrintHeader();
+    ConsolePrintfStart(PRIO_HIGH, "/* UNICENS pool sizes for '%s'\n", sourceName);
+    ConsolePrintfContinue(" * Needed: nodes=%u routes=%u endpoints=%u resources=%u, margin=%u%%\n",
+        nodes, routes, endpoints, resources, marginPercent);
+    ConsolePrintfContinue(" * Configurations loaded at runtime must fit into these pools as well.\n */\n\n");
+    ConsolePrintfContinue("#ifndef UCS_POOL_CFG_H\n");
+    ConsolePrintfContinue("#define UCS_POOL_CFG_H\n\n");
+    ConsolePrintfContinue("#define UCS_NUM_REMOTE_DEVICES       %u\n", remoteDevices);
+    ConsolePrintfContinue("#define UCS_XRM_NUM_JOBS             %u\n", (0 < jobs) ? jobs : 1);
+    ConsolePrintfContinue("#define UCS_XRM_NUM_RESOURCES        %u\n", AddMargin((0 < resources) ? resources : 1, marginPercent));
+    ConsolePrintfContinue("#define UCS_POOL_NUM_ROUTES          %u\n\n", AddMargin((0 < routes) ? routes : 1, marginPercent));
+    ConsolePrintfExit("#endif /* UCS_POOL_CFG_H */\n");
+}
+
 static void PrintHeader(void) {
     ConsolePrintfStart(PRIO_HIGH, "/*------------------------------------------------------------------------------------------------*/\n");
     ConsolePrintfContinue("/* UNICENS Generated Network Configuration                                                        */\n");
@@ -226,91 +359,142 @@ static void PrintHeader(void) {
     ConsolePrintfExit("/*------------------------------------------------------------------------------------------------*/\n");
 }
 
-void *Mcalloc(struct ObjectList *list, uint32_t nElem, uint32_t elemSize)
+static uint32_t AddMargin(uint32_t value, uint16_t marginPercent)
+{
+    return value + (value * marginPercent + 99) / 100;
+}
+
+static void *ArenaAlloc(uint32_t size)
 {
     void *obj;
-    struct ObjectList *tail = list;
-    if (NULL == list || 0 == nElem || 0 == elemSize) return NULL;
-    
-    obj = calloc(nElem, elemSize);
-    CHECK_ASSERT(obj);
-    if (NULL == list->obj)
+    struct ArenaBlock *block = m.arena;
+    if (0 == size) return NULL;
+    size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if (NULL == block || block->size - block->used < size)
     {
-        list->obj = obj;
-        return obj;
+        /* Oversized objects get a block on their own */
+        size_t blockSize = (size > ARENA_BLOCK_SIZE) ? size : ARENA_BLOCK_SIZE;
+        block = calloc(1, sizeof(struct ArenaBlock) + blockSize);
+        CHECK_ASSERT(block);
+        block->size = blockSize;
+        block->next = m.arena;
+        m.arena = block;
     }
-    while(tail->next) tail = tail->next;
-    tail->next = calloc(1, sizeof(struct ObjectList));
-    CHECK_ASSERT(tail->next);
-    tail->next->obj = obj;
+    obj = (uint8_t *)block->data + block->used;
+    block->used += size;
     return obj;
 }
 
-void Mfree(struct ObjectList *cur)
+static void ArenaFree(void)
+{
+    while(m.arena)
+    {
+        struct ArenaBlock *next = m.arena->next;
+        free(m.arena);
+        m.arena = next;
+    }
+}
+
+static uint32_t HashPointer(const void *ptr)
+{
+    uint64_t h = (uint64_t)(uintptr_t)ptr;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return (uint32_t)h;
+}
+
+static uint32_t HashString(const char *str)
 {
-    struct ObjectList *root = cur;
-    while(cur)
+    uint32_t h = 2166136261U;
+    while(*str)
     {
-        struct ObjectList *next = cur->next;
-        if (cur->obj)
-            free(cur->obj);
-        if (cur != root)
-            free(cur);
-        cur = next;
+        h ^= (uint8_t)*str++;
+        h *= 16777619U;
     }
+    return h;
+}
+
+static void InsertName(struct NameEntry **table, uint32_t size, struct NameEntry *entry, uint32_t hash)
+{
+    uint32_t i = hash & (size - 1);
+    while(table[i])
+        i = (i + 1) & (size - 1);
+    table[i] = entry;
+}
+
+static void GrowNameTable(void)
+{
+    uint32_t i;
+    struct NameTable *t = &m.allNames;
+    uint32_t newSize = t->size ? 2 * t->size : NAME_TABLE_INIT_SIZE;
+    struct NameEntry **byElement = calloc(newSize, sizeof(struct NameEntry *));
+    struct NameEntry **byName = calloc(newSize, sizeof(struct NameEntry *));
+    CHECK_ASSERT(byElement && byName);
+    for (i = 0; i < t->size; i++)
+    {
+        if (t->byElement[i])
+            InsertName(byElement, newSize, t->byElement[i], HashPointer(t->byElement[i]->element));
+        if (t->byName[i])
+            InsertName(byName, newSize, t->byName[i], HashString(t->byName[i]->name));
+    }
+    free(t->byElement);
+    free(t->byName);
+    t->byElement = byElement;
+    t->byName = byName;
+    t->size = newSize;
+}
+
+static void FreeNameTable(void)
+{
+    free(m.allNames.byElement);
+    free(m.allNames.byName);
+    memset(&m.allNames, 0, sizeof(struct NameTable));
 }
 
 static UCS_NS_CONST Ucs_Xrm_ResObject_t *GetObjectFromTable(const char *name)
 {
-    struct NameLookupTable *tail = &m.allNames;
+    uint32_t i;
+    struct NameTable *t = &m.allNames;
     CHECK_ASSERT(name);
-    if (!name) return NULL;
-    while(tail && tail->name && tail->element)
+    if (!name || 0 == t->size) return NULL;
+    for (i = HashString(name) & (t->size - 1); t->byName[i]; i = (i + 1) & (t->size - 1))
     {
-        if (0 == strcmp(name, tail->name))
-            return tail->element;
-        tail = tail->next;
+        if (0 == strcmp(name, t->byName[i]->name))
+            return t->byName[i]->element;
     }
     return NULL;
 }
 
 static char *GetNameFromTable(UCS_NS_CONST Ucs_Xrm_ResObject_t *element)
 {
-    struct NameLookupTable *tail = &m.allNames;
+    uint32_t i;
+    struct NameTable *t = &m.allNames;
     CHECK_ASSERT(element);
-    if (!element) return NULL;
-    while(tail && tail->name && tail->element)
+    if (!element || 0 == t->size) return NULL;
+    for (i = HashPointer(element) & (t->size - 1); t->byElement[i]; i = (i + 1) & (t->size - 1))
     {
-        if (element == tail->element)
-            return tail->name;
-        tail = tail->next;
+        if (element == t->byElement[i]->element)
+            return t->byElement[i]->name;
     }
     return NULL;
 }
 
 static void StoreNameInTable(UCS_NS_CONST Ucs_Xrm_ResObject_t *element, char *name)
 {
-    struct NameLookupTable *tail = &m.allNames;
+    struct NameEntry *entry;
+    struct NameTable *t = &m.allNames;
     CHECK_ASSERT(element);
     CHECK_ASSERT(name);
     CHECK_ASSERT(NULL == GetNameFromTable(element));
-    while(tail)
-    {
-        if (NULL == tail->element)
-            break;
-        if (tail->next)
-        {
-            tail = tail->next;
-        }
-        else {
-            tail->next = Mcalloc(&m.objList, 1, sizeof(struct NameLookupTable));
-            CHECK_ASSERT(tail->next);
-            tail = tail->next;
-            break;
-        }
-    }
-    tail->element = element;
-    tail->name = name;
+    if (2 * (t->count + 1) > t->size)
+        GrowNameTable();
+    entry = ArenaAlloc(sizeof(struct NameEntry));
+    entry->element = element;
+    entry->name = name;
+    InsertName(t->byElement, t->size, entry, HashPointer(element));
+    InsertName(t->byName, t->size, entry, HashString(name));
+    ++t->count;
 }
 
 static char *AllocateString(const char format[], uint16_t vargsCnt, ...)
@@ -323,9 +507,9 @@ static char *AllocateString(const char format[], uint16_t vargsCnt, ...)
     vsprintf(outbuf, format, argptr);
     va_end(argptr);
     len = strlen(outbuf);
-    returnString = Mcalloc(&m.objList, 1 + len, 1);
+    returnString = ArenaAlloc(1 + len);
     CHECK_ASSERT(returnString);
-    memcpy(returnString, outbuf, len);
+    memcpy(returnString, outbuf, 1 + len);
     return returnString;
 }
 
@@ -354,7 +538,7 @@ static char *GetVariableName(UCS_NS_CONST Ucs_Xrm_ResObject_t *element, const ch
 
 static void PrintDcPort(Ucs_Xrm_DefaultCreatedPort_t *port)
 { 
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(port), 
             GetVariableName(port, "DcPort"),
             GetResourceTypeString(&port->resource_type));
@@ -365,7 +549,7 @@ static void PrintDcPort(Ucs_Xrm_DefaultCreatedPort_t *port)
 
 static void PrintNetworkSocket(Ucs_Xrm_NetworkSocket_t *socket)
 {
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(socket), 
             GetVariableName(socket, "NetworkSocket"),
             GetResourceTypeString(&socket->resource_type));
@@ -397,7 +581,7 @@ static const char*GetMlbClkString(Ucs_Mlb_ClockConfig_t clk)
 
 static void PrintMlbPort(Ucs_Xrm_MlbPort_t *port)
 {
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(port), 
             GetVariableName(port, "MlbPort"),
             GetResourceTypeString(&port->resource_type));
@@ -409,11 +593,11 @@ static void PrintMlbPort(Ucs_Xrm_MlbPort_t *port)
 static void PrintMlbSocket(Ucs_Xrm_MlbSocket_t *socket)
 {
     PrintUcsElement(socket->mlb_port_obj_ptr);
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(socket), 
             GetVariableName(socket, "MlbSocket"),
             GetResourceTypeString(&socket->resource_type));
-    ConsolePrintfContinue(C99(".mlb_port_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(socket->mlb_port_obj_ptr));
+    ConsolePrintfContinue(C99(".mlb_port_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(socket->mlb_port_obj_ptr));
     ConsolePrintfContinue(C99(".direction = ")"%s,\n"TAB, GetDirectionString(socket->direction));
     ConsolePrintfContinue(C99(".data_type = ")"%s,\n"TAB, GetMlbDataTypeString(socket->data_type));
     ConsolePrintfContinue(C99(".bandwidth = ")"%u,\n"TAB, socket->bandwidth);
@@ -435,7 +619,7 @@ static const char*GetUsbPhyString(Ucs_Usb_PhysicalLayer_t phy)
 
 static void PrintUsbPort(Ucs_Xrm_UsbPort_t *port)
 {
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(port), 
             GetVariableName(port, "UsbPort"),
             GetResourceTypeString(&port->resource_type));
@@ -450,11 +634,11 @@ static void PrintUsbPort(Ucs_Xrm_UsbPort_t *port)
 static void PrintUsbSocket(Ucs_Xrm_UsbSocket_t *socket)
 {
     PrintUcsElement(socket->usb_port_obj_ptr);
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(socket), 
             GetVariableName(socket, "UsbSocket"),
             GetResourceTypeString(&socket->resource_type));
-    ConsolePrintfContinue(C99(".usb_port_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(socket->usb_port_obj_ptr));
+    ConsolePrintfContinue(C99(".usb_port_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(socket->usb_port_obj_ptr));
     ConsolePrintfContinue(C99(".direction = ")"%s,\n"TAB, GetDirectionString(socket->direction));
     ConsolePrintfContinue(C99(".data_type = ")"%s,\n"TAB, GetUsbDataTypeString(socket->data_type));
     ConsolePrintfContinue(C99(".end_point_addr = ")"0x%02X,\n"TAB, socket->end_point_addr);
@@ -497,7 +681,7 @@ static const char*GetStrmAlignString(Ucs_Stream_PortDataAlign_t align)
 
 static void PrintStrmPort(Ucs_Xrm_StrmPort_t *port)
 {
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(port), 
             GetVariableName(port, "StrmPort"),
             GetResourceTypeString(&port->resource_type));
@@ -509,7 +693,7 @@ static void PrintStrmPort(Ucs_Xrm_StrmPort_t *port)
 
 static void PrintRmckPort(Ucs_Xrm_RmckPort_t *port)
 {
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(port), 
             GetVariableName(port, "RmckPort"),
             GetResourceTypeString(&port->resource_type));
@@ -536,11 +720,11 @@ static const char*GetStrmPinString(Ucs_Stream_PortPinId_t pin)
 static void PrintStrmSocket(Ucs_Xrm_StrmSocket_t *socket)
 {
     PrintUcsElement(socket->stream_port_obj_ptr);
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(socket), 
             GetVariableName(socket, "StrmSocket"),
             GetResourceTypeString(&socket->resource_type));
-    ConsolePrintfContinue(C99(".stream_port_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(socket->stream_port_obj_ptr));
+    ConsolePrintfContinue(C99(".stream_port_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(socket->stream_port_obj_ptr));
     ConsolePrintfContinue(C99(".direction = ")"%s,\n"TAB, GetDirectionString(socket->direction));
     ConsolePrintfContinue(C99(".data_type = ")"%s,\n"TAB, GetStreamDataTypeString(socket->data_type));
     ConsolePrintfContinue(C99(".bandwidth = ")"%u,\n"TAB, socket->bandwidth);
@@ -551,11 +735,11 @@ static void PrintStrmSocket(Ucs_Xrm_StrmSocket_t *socket)
 static void PrintCombiner(Ucs_Xrm_Combiner_t *combiner)
 {
     PrintUcsElement(combiner->port_socket_obj_ptr);
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(combiner), 
             GetVariableName(combiner, "Combiner"),
             GetResourceTypeString(&combiner->resource_type));
-    ConsolePrintfContinue(C99(".port_socket_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(combiner->port_socket_obj_ptr));
+    ConsolePrintfContinue(C99(".port_socket_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(combiner->port_socket_obj_ptr));
     ConsolePrintfContinue(C99(".nw_port_handle = ")"0x%04X,\n"TAB, combiner->nw_port_handle);
     ConsolePrintfContinue(C99(".bytes_per_frame = ")"%u", combiner->bytes_per_frame);
     ConsolePrintfExit(" };\n");
@@ -564,11 +748,11 @@ static void PrintCombiner(Ucs_Xrm_Combiner_t *combiner)
 static void PrintSplitter(Ucs_Xrm_Splitter_t *splitter)
 {
     PrintUcsElement(splitter->socket_in_obj_ptr);
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(splitter),
             GetVariableName(splitter, "Splitter"),
             GetResourceTypeString(&splitter->resource_type));
-    ConsolePrintfContinue(C99(".socket_in_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(splitter->socket_in_obj_ptr));
+    ConsolePrintfContinue(C99(".socket_in_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(splitter->socket_in_obj_ptr));
     ConsolePrintfContinue(C99(".nw_port_handle = ")"0x%04X,\n"TAB, splitter->nw_port_handle);
     ConsolePrintfContinue(C99(".bytes_per_frame = ")"%u", splitter->bytes_per_frame);
     ConsolePrintfExit(" };\n");
@@ -590,12 +774,12 @@ static void PrintSyncCon(Ucs_Xrm_SyncCon_t *con)
 {
     PrintUcsElement(con->socket_in_obj_ptr);
     PrintUcsElement(con->socket_out_obj_ptr);
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(con), 
             GetVariableName(con, "SyncCon"),
             GetResourceTypeString(&con->resource_type));
-    ConsolePrintfContinue(C99(".socket_in_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(con->socket_in_obj_ptr));
-    ConsolePrintfContinue(C99(".socket_out_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(con->socket_out_obj_ptr));
+    ConsolePrintfContinue(C99(".socket_in_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(con->socket_in_obj_ptr));
+    ConsolePrintfContinue(C99(".socket_out_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(con->socket_out_obj_ptr));
     ConsolePrintfContinue(C99(".mute_mode = ")"%s,\n"TAB, GetSyncConMuteString(con->mute_mode));
     ConsolePrintfContinue(C99(".offset = ")"%u", con->offset);
     ConsolePrintfExit(" };\n");
@@ -619,12 +803,12 @@ static void PrintAvpCon(Ucs_Xrm_AvpCon_t *con)
 {
     PrintUcsElement(con->socket_in_obj_ptr);
     PrintUcsElement(con->socket_out_obj_ptr);
-    ConsolePrintfStart(PRIO_HIGH, "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
+    ConsolePrintfStart(PRIO_HIGH, RES_CONST "%s %s = { \n"TAB C99(".resource_type = ")"%s,\n"TAB, 
             GetTypeString(con), 
             GetVariableName(con, "AvpCon"),
             GetResourceTypeString(&con->resource_type));
-    ConsolePrintfContinue(C99(".socket_in_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(con->socket_in_obj_ptr));
-    ConsolePrintfContinue(C99(".socket_out_obj_ptr = ")"&%s,\n"TAB, GetNameFromTable(con->socket_out_obj_ptr));
+    ConsolePrintfContinue(C99(".socket_in_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(con->socket_in_obj_ptr));
+    ConsolePrintfContinue(C99(".socket_out_obj_ptr = ")RES_REF ",\n"TAB, GetNameFromTable(con->socket_out_obj_ptr));
     ConsolePrintfContinue(C99(".isoc_packet_size = ")"%s", GetAvpConIsocString(con->isoc_packet_size));
     ConsolePrintfExit(" };\n");
 }
@@ -829,12 +1013,12 @@ static void PrintJobs(Ucs_Xrm_ResObject_t **jobs_list_ptr)
     }
     if (GetVariableName(jobs_list_ptr, NULL))
         return; /*Already printed */
-    ConsolePrintfStart(PRIO_HIGH, "Ucs_Xrm_ResObject_t *%s[] = {\n"TAB,
+    ConsolePrintfStart(PRIO_HIGH, "Ucs_Xrm_ResObject_t *const %s[] = {\n"TAB,
         GetVariableName(jobs_list_ptr, "JobList"));
     for (i = 0; (job = jobs_list_ptr[i]); i++ )
     {
         if(i) ConsolePrintfContinue(",\n"TAB);
-        ConsolePrintfContinue("&%s", GetVariableName(job, NULL));
+        ConsolePrintfContinue(RES_REF, GetVariableName(job, NULL));
     }
     ConsolePrintfContinue(",\n"TAB"NULL");
     ConsolePrintfExit(" };\n");
@@ -976,7 +1160,7 @@ static void PrintEndpoint(Ucs_Rm_EndPoint_t *ep, bool isSourceEp, uint8_t routeP
     ConsolePrintfStart(PRIO_HIGH, "Ucs_Rm_EndPoint_t %s = {\n"TAB, varName);
     ConsolePrintfContinue(C99(".endpoint_type = ")"%s,\n"TAB, GetEndpointTypeString(ep->endpoint_type));
     if (NULL != ep->jobs_list_ptr) {
-        ConsolePrintfContinue(C99(".jobs_list_ptr = ")"%s,\n"TAB, GetNameFromTable(ep->jobs_list_ptr));
+        ConsolePrintfContinue(C99(".jobs_list_ptr = ")"(Ucs_Xrm_ResObject_t **)%s,\n"TAB, GetNameFromTable(ep->jobs_list_ptr));
     } else {
         ConsolePrintfContinue(C99(".jobs_list_ptr = ")"NULL,\n"TAB);
     }
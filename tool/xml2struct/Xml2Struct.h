@@ -35,6 +35,7 @@ extern "C" {
 #endif
     
 #include <stdint.h>
+#include <stdbool.h>
 #include "ucs_api.h"
     
 #define C99_STRUCTS
@@ -51,7 +52,32 @@ void PrintUcsStructures(
     uint16_t nodSize,
     const char *variablePrefix);
 
-void PrintHeaderFile(const char *variablePrefix);
+typedef struct
+{
+    const char *name;
+    uint16_t packetBw;
+    uint16_t proxyBw;
+    Ucs_Rm_Route_t *pRoutes;
+    uint16_t routesSize;
+    Ucs_Rm_Node_t *pNod;
+    uint16_t nodSize;
+} Xml2StructConfig_t;
+
+/* Prints all configurations prefixed with their name and the DefaultConfigs table referring to them.
+ * The names must be valid C identifiers. */
+void PrintUcsRegistry(const Xml2StructConfig_t *pConfigs, uint16_t configsSize);
+
+/* Prints the header declaring the variables written by -ucs. With registry set, the configurations
+ * are only reachable through the DefaultConfigs table and only the table is declared. */
+void PrintHeaderFile(const char *variablePrefix, bool registry);
+
+void PrintPoolHeaderFile(
+    const char *sourceName,
+    uint16_t nodes,
+    uint16_t routes,
+    uint16_t endpoints,
+    uint16_t resources,
+    uint16_t marginPercent);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,630 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Driver Printing module                                                                 */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <inttypes.h>
+#include <ctype.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "mxml.h"
+#include "Xml2Schema.h"
+#include "Xml2Validate.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     USED ADJUSTABLE DEFINES                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define MAX_DEPTH           (16)
+#define MAX_SIBLING_NAMES   (16)
+#define MAX_PATH_LEN        (512)
+#define MAX_MESSAGE_LEN     (512)
+#define MAX_TEXT_LEN        (4096)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                        PRIVATE DEFINES                               */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+typedef struct
+{
+    const char *name;
+    uint32_t count;
+} Sibling_t;
+
+typedef struct
+{
+    const char *name;
+    uint32_t index;         /* Position among the siblings of the same name, starting with 1 */
+    uint16_t element;       /* SCHEMA_NONE, if the element is not part of the schema */
+    uint16_t state;
+    bool textReported;
+    Sibling_t siblings[MAX_SIBLING_NAMES];
+    uint8_t siblingsSize;
+} Frame_t;
+
+typedef struct
+{
+    /* frames[0] is the document itself */
+    Frame_t frames[MAX_DEPTH + 1];
+    uint32_t depth;
+    uint32_t skippedDepth;  /* Elements nested deeper than MAX_DEPTH */
+    uint32_t violations;
+    bool hasRoot;
+    char text[MAX_TEXT_LEN];
+    size_t textLen;
+    ValidateErrorCb_t onError;
+    void *userPtr;
+} Validator_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void InternNames(void);
+static void OnSaxEvent(mxml_node_t *node, mxml_sax_event_t event, void *data);
+static void OnElementOpen(Validator_t *v, mxml_node_t *node);
+static void OnElementClose(Validator_t *v);
+static void OnText(Validator_t *v, mxml_node_t *node);
+static uint16_t FindChildElement(const Frame_t *parent, const char *name);
+static void CheckAttributes(Validator_t *v, mxml_node_t *node, const SchemaElement_t *element);
+static bool CheckValue(const SchemaSimpleType_t *type, const char *value, char *reason, size_t reasonLen);
+static bool ParseNumber(SchemaLexical_t lexical, const char *value, size_t len, int64_t *pNumber);
+static void DescribeExpected(const Frame_t *frame, char *out, size_t outLen);
+static void Report(Validator_t *v, const char *format, ...) __attribute__ ((format (gnu_printf, 2, 3)));
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                          PRIVTATE Variables                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+/* Interned names of the schema, element and attribute names of mxml nodes are compared by pointer */
+static const char **elementNames;
+static const char **attributeNames;
+static pthread_once_t namesInterned = PTHREAD_ONCE_INIT;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+uint32_t ValidateXml(const char *xml, size_t len, ValidateErrorCb_t onError, void *userPtr)
+{
+    mxml_node_t *top;
+    Validator_t *v;
+    uint32_t violations;
+    pthread_once(&namesInterned, InternNames);
+    v = calloc(1, sizeof(Validator_t));
+    if (NULL == v || NULL == elementNames || NULL == attributeNames)
+    {
+        if (onError)
+            onError(userPtr, "/", "Out of memory");
+        free(v);
+        return 1;
+    }
+    v->onError = onError;
+    v->userPtr = userPtr;
+    v->frames[0].name = "";
+    v->frames[0].state = unicensSchema.rootState;
+    top = mxmlSAXLoadBuffer(NULL, xml, len, MXML_NO_CALLBACK, OnSaxEvent, v);
+    if (NULL == top)
+    {
+        /* Reported violations may be a result of the damage, the parser error is the relevant one */
+        v->depth = 0;
+        Report(v, "XML is not well formed");
+    }
+    else
+    {
+        /* mxml only complains about missing close tags below the root, the
+         * element names still belong to the tree, so check before deleting it */
+        v->skippedDepth = 0;
+        while (0 != v->depth)
+        {
+            Report(v, "Element <%s> is not closed", v->frames[v->depth].name);
+            OnElementClose(v);
+        }
+        mxmlDelete(top);
+        if (!v->hasRoot)
+            Report(v, "Document has no root element");
+    }
+    violations = v->violations;
+    free(v);
+    return violations;
+}
+
+uint32_t ValidateXmlFile(const char *fileName, ValidateErrorCb_t onError, void *userPtr)
+{
+    struct stat st;
+    void *content;
+    uint32_t violations;
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0 || 0 != fstat(fd, &st) || !S_ISREG(st.st_mode) || 0 == st.st_size)
+    {
+        if (0 <= fd)
+            close(fd);
+        if (onError)
+            onError(userPtr, "/", "Could not read file");
+        return 1;
+    }
+    content = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == content)
+    {
+        if (onError)
+            onError(userPtr, "/", "Could not read file");
+        return 1;
+    }
+    posix_madvise(content, st.st_size, POSIX_MADV_SEQUENTIAL);
+    violations = ValidateXml(content, st.st_size, onError, userPtr);
+    munmap(content, st.st_size);
+    return violations;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void InternNames(void)
+{
+    uint32_t i;
+    const char **elems = calloc(unicensSchema.elementsSize, sizeof(const char *));
+    const char **attrs = calloc(unicensSchema.attributesSize + 1, sizeof(const char *));
+    if (NULL == elems || NULL == attrs)
+        goto ERROR;
+    for (i = 0; i < unicensSchema.elementsSize; i++)
+    {
+        elems[i] = mxmlIntern(unicensSchema.elements[i].name);
+        if (NULL == elems[i]) goto ERROR;
+    }
+    for (i = 0; i < unicensSchema.attributesSize; i++)
+    {
+        attrs[i] = mxmlIntern(unicensSchema.attributes[i].name);
+        if (NULL == attrs[i]) goto ERROR;
+    }
+    elementNames = elems;
+    attributeNames = attrs;
+    return;
+ERROR:
+    free(elems);
+    free(attrs);
+}
+
+static void OnSaxEvent(mxml_node_t *node, mxml_sax_event_t event, void *data)
+{
+    Validator_t *v = (Validator_t *)data;
+    switch (event)
+    {
+    case MXML_SAX_ELEMENT_OPEN:
+        /* Only the root element is kept, so mxml returns it. All others are freed when closed. */
+        if (NULL == node->parent)
+            mxmlRetain(node);
+        OnElementOpen(v, node);
+        break;
+    case MXML_SAX_ELEMENT_CLOSE:
+        OnElementClose(v);
+        break;
+    case MXML_SAX_DATA:
+        OnText(v, node);
+        break;
+    case MXML_SAX_CDATA:
+        OnText(v, NULL);
+        break;
+    default:
+        break;
+    }
+}
+
+static void OnElementOpen(Validator_t *v, mxml_node_t *node)
+{
+    char expected[MAX_MESSAGE_LEN];
+    uint32_t i;
+    const char *name = node->value.element.name;
+    Frame_t *parent, *frame;
+    uint16_t element = SCHEMA_NONE;
+    if (MAX_DEPTH <= v->depth || 0 < v->skippedDepth)
+    {
+        if (0 == v->skippedDepth++)
+            Report(v, "Elements are nested deeper than %d levels, <%s> is not checked", MAX_DEPTH, name);
+        return;
+    }
+    parent = &v->frames[v->depth];
+    frame = &v->frames[v->depth + 1];
+    memset(frame, 0, offsetof(Frame_t, siblings));
+    frame->siblingsSize = 0;
+    frame->name = name;
+    /* The index of the element among its siblings of the same name is only needed for the path */
+    for (i = 0; i < parent->siblingsSize && parent->siblings[i].name != name; i++)
+        ;
+    if (i < parent->siblingsSize)
+    {
+        frame->index = ++parent->siblings[i].count;
+    }
+    else if (i < MAX_SIBLING_NAMES)
+    {
+        parent->siblings[i].name = name;
+        parent->siblings[i].count = 1;
+        parent->siblingsSize++;
+        frame->index = 1;
+    }
+    if (0 == v->depth)
+        v->hasRoot = true;
+    if (0 == v->depth || SCHEMA_NONE != parent->element)
+    {
+        const SchemaState_t *state = &unicensSchema.states[parent->state];
+        for (i = state->firstTransition; i < state->firstTransition + state->transitionCount; i++)
+        {
+            const SchemaTransition_t *transition = &unicensSchema.transitions[i];
+            if (elementNames[transition->element] == name)
+            {
+                element = transition->element;
+                parent->state = transition->nextState;
+                break;
+            }
+        }
+        if (SCHEMA_NONE == element)
+        {
+            DescribeExpected(parent, expected, sizeof(expected));
+            /* Element is valid at another position of the parent, so its content is still checked */
+            element = FindChildElement(parent, name);
+            v->depth++;
+            frame->element = element;
+            if (SCHEMA_NONE == element)
+                Report(v, "Element <%s> is not allowed here, expected %s", name, expected);
+            else
+                Report(v, "Element <%s> is not expected at this position, expected %s", name, expected);
+            v->depth--;
+        }
+    }
+    frame->element = element;
+    v->depth++;
+    v->textLen = 0;
+    if (SCHEMA_NONE != element)
+    {
+        frame->state = unicensSchema.elements[element].startState;
+        CheckAttributes(v, node, &unicensSchema.elements[element]);
+    }
+}
+
+static void OnElementClose(Validator_t *v)
+{
+    char expected[MAX_MESSAGE_LEN];
+    char reason[MAX_MESSAGE_LEN];
+    Frame_t *frame;
+    const SchemaElement_t *element;
+    if (0 < v->skippedDepth)
+    {
+        v->skippedDepth--;
+        return;
+    }
+    if (0 == v->depth)
+        return;
+    frame = &v->frames[v->depth];
+    if (SCHEMA_NONE != frame->element)
+    {
+        element = &unicensSchema.elements[frame->element];
+        if (!unicensSchema.states[frame->state].accepting)
+        {
+            DescribeExpected(frame, expected, sizeof(expected));
+            Report(v, "Element <%s> is incomplete, expected %s", frame->name, expected);
+        }
+        if (SCHEMA_NONE != element->textType && !frame->textReported)
+        {
+            v->text[v->textLen] = '\0';
+            if (!CheckValue(&unicensSchema.simpleTypes[element->textType], v->text, reason, sizeof(reason)))
+                Report(v, "Text content '%s' is invalid, %s", v->text, reason);
+        }
+    }
+    v->depth--;
+    v->textLen = 0;
+}
+
+static void OnText(Validator_t *v, mxml_node_t *node)
+{
+    Frame_t *frame = &v->frames[v->depth];
+    const SchemaElement_t *element;
+    const char *text;
+    size_t len;
+    if (0 < v->skippedDepth || 0 == v->depth || SCHEMA_NONE == frame->element || frame->textReported)
+        return;
+    /* Without a load callback mxml delivers words, whitespace only gives an empty string */
+    text = (node && MXML_TEXT == node->type) ? node->value.text.string : NULL;
+    if (NULL != node && (NULL == text || '\0' == text[0]))
+        return;
+    element = &unicensSchema.elements[frame->element];
+    if (SCHEMA_NONE == element->textType)
+    {
+        frame->textReported = true;
+        Report(v, "Text content is not allowed in <%s>", frame->name);
+        return;
+    }
+    if (NULL == text)
+        return;
+    len = strlen(text);
+    if (v->textLen + len + 1 >= MAX_TEXT_LEN)
+    {
+        frame->textReported = true;
+        Report(v, "Text content of <%s> is too long to be checked", frame->name);
+        return;
+    }
+    if (0 < v->textLen && node->value.text.whitespace)
+        v->text[v->textLen++] = ' ';
+    memcpy(&v->text[v->textLen], text, len);
+    v->textLen += len;
+}
+
+/* Searches all states of the parent, not only the current one */
+static uint16_t FindChildElement(const Frame_t *parent, const char *name)
+{
+    uint32_t s, i, firstState, stateCount;
+    if (0 == parent->name[0])
+    {
+        firstState = unicensSchema.rootState;
+        stateCount = 1;
+    }
+    else
+    {
+        firstState = unicensSchema.elements[parent->element].startState;
+        stateCount = unicensSchema.elements[parent->element].stateCount;
+    }
+    for (s = firstState; s < firstState + stateCount; s++)
+    {
+        const SchemaState_t *state = &unicensSchema.states[s];
+        for (i = state->firstTransition; i < state->firstTransition + state->transitionCount; i++)
+        {
+            if (elementNames[unicensSchema.transitions[i].element] == name)
+                return unicensSchema.transitions[i].element;
+        }
+    }
+    return SCHEMA_NONE;
+}
+
+static void CheckAttributes(Validator_t *v, mxml_node_t *node, const SchemaElement_t *element)
+{
+    char reason[MAX_MESSAGE_LEN];
+    uint64_t seen = 0;
+    int i;
+    uint32_t j;
+    for (i = 0; i < node->value.element.num_attrs; i++)
+    {
+        const mxml_attr_t *attr = &node->value.element.attrs[i];
+        for (j = 0; j < element->attributeCount; j++)
+        {
+            if (attributeNames[element->firstAttribute + j] == attr->name)
+                break;
+        }
+        if (j == element->attributeCount)
+        {
+            /* Namespace declarations and attributes like xsi:noNamespaceSchemaLocation are not part of the schema */
+            if (NULL == strchr(attr->name, ':') && 0 != strcmp(attr->name, "xmlns"))
+                Report(v, "Attribute '%s' is not allowed in <%s>", attr->name, node->value.element.name);
+            continue;
+        }
+        seen |= 1ull << j;
+        if (!CheckValue(&unicensSchema.simpleTypes[unicensSchema.attributes[element->firstAttribute + j].simpleType],
+            attr->value ? attr->value : "", reason, sizeof(reason)))
+            Report(v, "Attribute '%s' has invalid value '%s', %s", attr->name, attr->value ? attr->value : "", reason);
+    }
+    for (j = 0; j < element->attributeCount; j++)
+    {
+        const SchemaAttribute_t *attr = &unicensSchema.attributes[element->firstAttribute + j];
+        if (attr->required && 0 == (seen & (1ull << j)))
+            Report(v, "Required attribute '%s' is missing in <%s>", attr->name, node->value.element.name);
+    }
+}
+
+static bool CheckValue(const SchemaSimpleType_t *type, const char *value, char *reason, size_t reasonLen)
+{
+    const char *begin = value;
+    const char *end = value + strlen(value);
+    int64_t number = 0;
+    uint32_t i;
+    size_t len = end - begin;
+    bool numeric = (SCHEMA_LEX_INTEGER == type->lexical || SCHEMA_LEX_NUMBER == type->lexical);
+    /* All types except strings collapse the surrounding whitespace */
+    if (SCHEMA_LEX_STRING != type->lexical && SCHEMA_LEX_NOT_BLANK != type->lexical)
+    {
+        while (begin < end && strchr(" \t\r\n", *begin))
+            begin++;
+        while (end > begin && strchr(" \t\r\n", end[-1]))
+            end--;
+    }
+    switch (type->lexical)
+    {
+    case SCHEMA_LEX_INTEGER:
+    case SCHEMA_LEX_NUMBER:
+        if (!ParseNumber(type->lexical, begin, end - begin, &number))
+        {
+            snprintf(reason, reasonLen, "expected %s", SCHEMA_LEX_NUMBER == type->lexical
+                ? "a decimal or 0x prefixed hexadecimal number" : "an integer");
+            return false;
+        }
+        break;
+    case SCHEMA_LEX_BOOLEAN:
+        if (!((4 == end - begin && 0 == strncmp(begin, "true", 4)) || (5 == end - begin && 0 == strncmp(begin, "false", 5))
+            || (1 == end - begin && ('0' == *begin || '1' == *begin))))
+        {
+            snprintf(reason, reasonLen, "expected true or false");
+            return false;
+        }
+        break;
+    case SCHEMA_LEX_HEX_DATA:
+        for (i = 0; begin + i < end; )
+        {
+            if (end - (begin + i) < 2 || !isxdigit((unsigned char)begin[i]) || !isxdigit((unsigned char)begin[i + 1]))
+                break;
+            i += 2;
+            if (begin + i == end)
+                break;
+            if (!strchr(" \t\r\n", begin[i]))
+                break;
+            while (begin + i < end && strchr(" \t\r\n", begin[i]))
+                i++;
+        }
+        if (begin + i != end)
+        {
+            snprintf(reason, reasonLen, "expected space separated bytes with two hexadecimal digits");
+            return false;
+        }
+        break;
+    case SCHEMA_LEX_NOT_BLANK:
+        for (; begin < end && strchr(" \t\r\n", *begin); begin++)
+            ;
+        if (begin == end)
+        {
+            snprintf(reason, reasonLen, "expected a non empty value");
+            return false;
+        }
+        begin = value;
+        break;
+    default:
+        break;
+    }
+    if (type->enumeration)
+    {
+        for (i = 0; NULL != type->enumeration[i]; i++)
+        {
+            int64_t allowed;
+            if (numeric && ParseNumber(type->lexical, type->enumeration[i], strlen(type->enumeration[i]), &allowed))
+            {
+                if (allowed == number)
+                    break;
+            }
+            else if (strlen(type->enumeration[i]) == (size_t)(end - begin) && 0 == strncmp(type->enumeration[i], begin, end - begin))
+            {
+                break;
+            }
+        }
+        if (NULL == type->enumeration[i])
+        {
+            size_t used = snprintf(reason, reasonLen, "expected one of");
+            for (i = 0; NULL != type->enumeration[i] && used < reasonLen; i++)
+                used += snprintf(reason + used, reasonLen - used, "%s '%s'", (0 == i) ? "" : ",", type->enumeration[i]);
+            return false;
+        }
+    }
+    if ((0 <= type->minLength && len < (size_t)type->minLength) || (0 <= type->maxLength && len > (size_t)type->maxLength))
+    {
+        snprintf(reason, reasonLen, "length must be between %d and %d", type->minLength, type->maxLength);
+        return false;
+    }
+    if (numeric && ((type->hasMin && number < type->minValue) || (type->hasMax && number > type->maxValue)))
+    {
+        if (type->hasMin && type->hasMax)
+            snprintf(reason, reasonLen, "expected a value between %" PRId64 " and %" PRId64, type->minValue, type->maxValue);
+        else if (type->hasMin)
+            snprintf(reason, reasonLen, "expected a value of at least %" PRId64, type->minValue);
+        else
+            snprintf(reason, reasonLen, "expected a value of at most %" PRId64, type->maxValue);
+        return false;
+    }
+    return true;
+}
+
+static bool ParseNumber(SchemaLexical_t lexical, const char *value, size_t len, int64_t *pNumber)
+{
+    size_t i = 0;
+    bool negative = false;
+    uint64_t number = 0, limit;
+    uint32_t base = 10;
+    if (SCHEMA_LEX_NUMBER == lexical && 2 < len && '0' == value[0] && 'x' == value[1])
+    {
+        base = 16;
+        i = 2;
+    }
+    else if (SCHEMA_LEX_INTEGER == lexical && 0 < len && ('+' == value[0] || '-' == value[0]))
+    {
+        negative = ('-' == value[0]);
+        i = 1;
+    }
+    if (i == len)
+        return false;
+    limit = negative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+    for (; i < len; i++)
+    {
+        uint32_t digit;
+        if ('0' <= value[i] && '9' >= value[i])
+            digit = value[i] - '0';
+        else if (16 == base && 'a' <= value[i] && 'f' >= value[i])
+            digit = value[i] - 'a' + 10;
+        else if (16 == base && 'A' <= value[i] && 'F' >= value[i])
+            digit = value[i] - 'A' + 10;
+        else
+            return false;
+        /* Values beyond 64 bit are well formed, they are clipped for the range check */
+        number = (number > (limit - digit) / base) ? limit : number * base + digit;
+    }
+    *pNumber = negative ? (int64_t)(0 - number) : (int64_t)number;
+    return true;
+}
+
+static void DescribeExpected(const Frame_t *frame, char *out, size_t outLen)
+{
+    uint32_t i, count;
+    size_t used = 0;
+    const SchemaState_t *state = &unicensSchema.states[frame->state];
+    count = state->transitionCount + (state->accepting ? 1 : 0);
+    out[0] = '\0';
+    for (i = 0; i < state->transitionCount && used < outLen; i++)
+    {
+        used += snprintf(out + used, outLen - used, "%s<%s>", (0 == i) ? "" : (i + 1 == count) ? " or " : ", ",
+            unicensSchema.elements[unicensSchema.transitions[state->firstTransition + i].element].name);
+    }
+    if (state->accepting && used < outLen)
+    {
+        if (0 == frame->name[0])
+            snprintf(out + used, outLen - used, "%send of document", (0 == i) ? "" : " or ");
+        else
+            snprintf(out + used, outLen - used, "%s</%s>", (0 == i) ? "" : " or ", frame->name);
+    }
+}
+
+static void Report(Validator_t *v, const char *format, ...)
+{
+    char path[MAX_PATH_LEN];
+    char message[MAX_MESSAGE_LEN];
+    size_t used = 0;
+    uint32_t i;
+    va_list args;
+    v->violations++;
+    if (NULL == v->onError)
+        return;
+    path[0] = '\0';
+    for (i = 1; i <= v->depth && used < sizeof(path); i++)
+        used += snprintf(path + used, sizeof(path) - used, "/%s[%u]", v->frames[i].name, v->frames[i].index);
+    if (0 == v->depth)
+        snprintf(path, sizeof(path), "/");
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    v->onError(v->userPtr, path, message);
+}
@@ -0,0 +1,72 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Driver Printing module                                                                 */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+#ifndef UCSXML2VALIDATE_H_
+#define UCSXML2VALIDATE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Callback for every violation found by the validator
+ * \param userPtr - The pointer given to ValidateXml or ValidateXmlFile
+ * \param path - Location of the violating element, for example "/Unicens/Node[2]/SyncConnection[1]"
+ * \param message - Description of the violation
+ */
+typedef void (*ValidateErrorCb_t)(void *userPtr, const char *path, const char *message);
+
+/**
+ * \brief Checks the given XML against the UNICENS XML schema (cfg/unicens.xsd) in a single pass.
+ *        Unlike UcsXml_Parse, the check does not stop at the first error, all violations are reported.
+ * \param xml - The XML content, needs not to be zero terminated
+ * \param len - Length of xml in bytes
+ * \param onError - Called for every violation
+ * \param userPtr - Passed to onError
+ * \return Amount of violations, 0 if the XML is valid
+ */
+uint32_t ValidateXml(const char *xml, size_t len, ValidateErrorCb_t onError, void *userPtr);
+
+/**
+ * \brief Same as ValidateXml, but the content is read from the given file.
+ * \param fileName - Path to the XML file
+ * \param onError - Called for every violation, also if the file can not be read
+ * \param userPtr - Passed to onError
+ * \return Amount of violations, 0 if the XML is valid
+ */
+uint32_t ValidateXmlFile(const char *fileName, ValidateErrorCb_t onError, void *userPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*UCSXML2VALIDATE_H_*/
@@ -35,10 +35,13 @@
 #include <string.h>
 #include <unistd.h>
 #include <assert.h>
+#include <time.h>
+#include <pthread.h>
 #include "Console.h"
 #include "UcsXml.h"
 #include "Xml2Struct.h"
 #include "Xml2Driver.h"
+#include "Xml2Validate.h"
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                     USED ADJUSTABLE DEFINES                          */
@@ -46,6 +49,9 @@
 
 #define NODE_START  "<<<<< FILE START 0x%03x >>>>>\n"
 #define NODE_END    "<<<<< FILE END >>>>>\n"
+#define PATH_MAX_LEN    (1024)
+#define POOL_MARGIN_PERCENT (25)
+#define REGISTRY_NAME_LEN   (64)
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                        PRIVATE DEFINES                               */
@@ -55,16 +61,48 @@ typedef enum
 {
     JOB_PRINT_UCS_STRUCTURE,
     JOB_PRINT_UCS_HEADER,
+    JOB_PRINT_POOL_HEADER,
     JOB_PRINT_SINGLE_DRIVER,
-    JOB_PRINT_ALL_DRIVERS
+    JOB_PRINT_ALL_DRIVERS,
+    JOB_WRITE_BINARY,
+    JOB_BATCH,
+    JOB_VALIDATE,
+    JOB_BANDWIDTH,
+    JOB_REGISTRY
 } Job_t;
 
+typedef struct
+{
+    const char *fileName;
+    bool success;
+    double durationMs;
+} BatchFile_t;
+
+typedef struct
+{
+    BatchFile_t *files;
+    uint32_t filesSize;
+    uint32_t nextFile;
+    const char *outDir;
+    pthread_mutex_t mutex;
+} Batch_t;
+
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                     PRIVTATE FUNCTION PROTOTYPES                     */
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
 static void PrintHelp(void);
-static char *ReadFileToString(const char *fileName);
+static int RunBatch(const char *outDir, const char *fileNames[], uint32_t filesSize, uint32_t threadCount);
+static void *BatchWorker(void *arg);
+static void CompileBatchFile(BatchFile_t *file, const char *outDir);
+static void OnBatchError(void *userPtr, const char *message);
+static int RunValidation(const char *fileNames[], uint32_t filesSize);
+static void OnValidateError(void *userPtr, const char *path, const char *message);
+static int RunBandwidth(const char *fileNames[], uint32_t filesSize);
+static bool PrintBandwidth(const char *fileName, const UcsXmlVal_t *cfg);
+static int RunRegistry(const char *args[], uint32_t argsSize);
+static bool GetRegistryName(const char *arg, char *name, uint32_t nameSize, const char **pFileName);
+static double GetTimeMs(clockid_t clock);
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                          PRIVTATE Variables                          */
@@ -72,6 +110,8 @@ static char *ReadFileToString(const char *fileName);
 
 static const char* globalFileName = NULL;
 static char *variablePrefix = NULL;
+static bool registry = false;
+static Batch_t batch;
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 /*                         PUBLIC FUNCTIONS                             */
@@ -82,25 +122,34 @@ int main(int argc, char *argv[])
     bool found;
     Job_t job = JOB_PRINT_UCS_STRUCTURE;
     const char *fileName = NULL;
+    const char *binFileName = NULL;
+    const char *batchDir = NULL;
+    const char **fileNames;
+    uint32_t filesSize = 0;
+    long threadCount = sysconf(_SC_NPROCESSORS_ONLN);
     uint16_t printNodeAddress = 0;
+    uint16_t marginPercent = POOL_MARGIN_PERCENT;
+    UcsXmlPoolUsage_t usage;
     uint16_t i;
-    char *xmlContent;
     UcsXmlVal_t *cfg;
     if (1 == argc)
     {
         PrintHelp();
         return 0;
     }
+    fileNames = calloc(argc, sizeof(const char *));
+    if (NULL == fileNames)
+    {
+        ConsolePrintfError("NoFile", 0 ,0, "Error", "Out of memory\r\n");
+        return -1;
+    }
     for (i = 1; i < argc; i++)
     {
         if ('-' != argv[i][0])
         {
-            if (fileName)
-            {
-                ConsolePrintfError(fileName, 0 ,0, "Error", "Filename is already set. Wrong parameter='%s'\r\n", argv[i]);
-                return -1;
-            }
-            fileName = argv[i];
+            if (!fileName)
+                fileName = argv[i];
+            fileNames[filesSize++] = argv[i];
         }
         else if (0 == strcmp("-ucs", argv[i]))
         {
@@ -110,11 +159,27 @@ int main(int argc, char *argv[])
         {
             job = JOB_PRINT_UCS_HEADER;
         }
+        else if (0 == strcmp("-pool", argv[i]))
+        {
+            job = JOB_PRINT_POOL_HEADER;
+        }
+        else if (0 == strcmp("-margin", argv[i]))
+        {
+            if (argc <= (i+1) || 0 > strtol( argv[i + 1], NULL, 10 ) || 1000 < strtol( argv[i + 1], NULL, 10 ))
+            {
+                ConsolePrintfError(fileName ? fileName : "NoFile", 0 ,0, "Error", "-margin parameter needs additional percentage (0..1000)\r\n");
+                free(fileNames);
+                return -1;
+            }
+            marginPercent = (uint16_t)strtol( argv[i + 1], NULL, 10 );
+            ++i;
+        }
         else if (0 == strcmp("-prefix", argv[i]))
         {
             if (argc <= (i+1))
             {
                 ConsolePrintfError(fileName ? fileName : "NoFile", 0 ,0, "Error", "-prefix parameter needs additional name to be concated at the begin of each variable\r\n");
+                free(fileNames);
                 return -1;
             }
             variablePrefix = argv[i + 1];
@@ -125,6 +190,7 @@ int main(int argc, char *argv[])
             if (argc <= (i+1))
             {
                 ConsolePrintfError(fileName ? fileName : "NoFile", 0 ,0, "Error", "-drv parameter needs additional node address of the device to be configured\r\n");
+                free(fileNames);
                 return -1;
             }
             job = JOB_PRINT_SINGLE_DRIVER;
@@ -135,42 +201,122 @@ int main(int argc, char *argv[])
         {
             job = JOB_PRINT_ALL_DRIVERS;
         }
+        else if (0 == strcmp("-bin", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintfError(fileName ? fileName : "NoFile", 0 ,0, "Error", "-bin parameter needs additional path of the binary file to be written\r\n");
+                free(fileNames);
+                return -1;
+            }
+            job = JOB_WRITE_BINARY;
+            binFileName = argv[i + 1];
+            ++i;
+        }
+        else if (0 == strcmp("-batch", argv[i]))
+        {
+            if (argc <= (i+1))
+            {
+                ConsolePrintfError(fileName ? fileName : "NoFile", 0 ,0, "Error", "-batch parameter needs additional path of the output directory\r\n");
+                free(fileNames);
+                return -1;
+            }
+            job = JOB_BATCH;
+            batchDir = argv[i + 1];
+            ++i;
+        }
+        else if (0 == strcmp("-validate", argv[i]))
+        {
+            job = JOB_VALIDATE;
+        }
+        else if (0 == strcmp("-bandwidth", argv[i]))
+        {
+            job = JOB_BANDWIDTH;
+        }
+        else if (0 == strcmp("-registry", argv[i]))
+        {
+            registry = true;
+            /* Combined with -header, the header for the registry is printed */
+            if (JOB_PRINT_UCS_HEADER != job)
+                job = JOB_REGISTRY;
+        }
+        else if (0 == strcmp("-jobs", argv[i]))
+        {
+            if (argc <= (i+1) || 0 >= strtol( argv[i + 1], NULL, 10 ))
+            {
+                ConsolePrintfError(fileName ? fileName : "NoFile", 0 ,0, "Error", "-jobs parameter needs additional amount of worker threads\r\n");
+                free(fileNames);
+                return -1;
+            }
+            threadCount = strtol( argv[i + 1], NULL, 10 );
+            ++i;
+        }
         else if (0 == strcmp("--version", argv[i]))
         {
             ConsolePrintf(PRIO_HIGH, "%s\r\n", GetXml2StructVersion());
+            free(fileNames);
             return 0;
         }
         else if (0 == strcmp("--help", argv[i]))
         {
             PrintHelp();
+            free(fileNames);
             return 0;
         }
         else
         {
             ConsolePrintfError(fileName ? fileName : "NoFile", 0 ,0, "Error", "Unknown parameter '%s'\r\n", argv[i]);
+            free(fileNames);
             return -1;
         }
     }
     if (JOB_PRINT_UCS_HEADER == job)
     {
         /* Special handling for header file. It does not need a XML file as input */
-        PrintHeaderFile(variablePrefix);
+        PrintHeaderFile(variablePrefix, registry);
+        free(fileNames);
         return 0;
     }
     if (!fileName)
     {
         ConsolePrintfError("NoFile", 0 ,0, "Error", "Can not start, please provide path to XML\r\n");
+        free(fileNames);
         return -1;
     }
-    globalFileName = fileName;
-    xmlContent = ReadFileToString(fileName);
-    if (NULL == xmlContent)
+    if (JOB_BATCH == job)
     {
-        ConsolePrintfError(fileName, 0 ,0, "Error", "File could not be opened: '%s'\r\n", argv[1]);
+        int result = RunBatch(batchDir, fileNames, filesSize, (0 < threadCount) ? threadCount : 1);
+        free(fileNames);
+        return result;
+    }
+    if (JOB_VALIDATE == job)
+    {
+        int result = RunValidation(fileNames, filesSize);
+        free(fileNames);
+        return result;
+    }
+    if (JOB_BANDWIDTH == job)
+    {
+        int result = RunBandwidth(fileNames, filesSize);
+        free(fileNames);
+        return result;
+    }
+    if (JOB_REGISTRY == job)
+    {
+        int result = RunRegistry(fileNames, filesSize);
+        free(fileNames);
+        return result;
+    }
+    if (1 < filesSize)
+    {
+        ConsolePrintfError(fileName, 0 ,0, "Error", "Filename is already set. Wrong parameter='%s'\r\n", fileNames[1]);
+        free(fileNames);
         return -1;
     }
-    cfg = UcsXml_Parse(xmlContent);
-    free(xmlContent);
+    free(fileNames);
+    globalFileName = fileName;
+    /* The file is mapped and parsed in place, no copy of the content is made */
+    cfg = UcsXml_ParseFile(fileName);
     if (NULL == cfg)
     {
         ConsolePrintfError(fileName, 0 ,0, "Error", "Could not parse UNICENS XML\r\n");
@@ -201,6 +347,23 @@ int main(int argc, char *argv[])
             ConsolePrintf(PRIO_HIGH, NODE_END);
         }
         break;
+    case JOB_PRINT_POOL_HEADER:
+        if (!UcsXml_GetPoolUsage(cfg, &usage))
+        {
+            ConsolePrintfError(fileName, 0 ,0, "Error", "Could not count the needed UNICENS objects\r\n");
+            UcsXml_FreeVal(cfg);
+            return -1;
+        }
+        PrintPoolHeaderFile(fileName, usage.nodes, usage.routes, usage.endpoints, usage.resources, marginPercent);
+        break;
+    case JOB_WRITE_BINARY:
+        if (!UcsXml_WriteBinary(cfg, binFileName))
+        {
+            ConsolePrintfError(fileName, 0 ,0, "Error", "Could not write binary configuration '%s'\r\n", binFileName);
+            UcsXml_FreeVal(cfg);
+            return -1;
+        }
+        break;
     default:
         assert(false);
     }
@@ -227,43 +390,344 @@ void UcsXml_CB_OnError(const char format[], uint16_t vargsCnt, ...)
 /*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
+static int RunBatch(const char *outDir, const char *fileNames[], uint32_t filesSize, uint32_t threadCount)
+{
+    pthread_t *threads;
+    double startMs, wallMs, sumMs = 0;
+    uint32_t i, created, failed = 0;
+    if (threadCount > filesSize)
+        threadCount = filesSize;
+    memset(&batch, 0, sizeof(Batch_t));
+    batch.files = calloc(filesSize, sizeof(BatchFile_t));
+    threads = calloc(threadCount, sizeof(pthread_t));
+    if (NULL == batch.files || NULL == threads)
+    {
+        ConsolePrintfError(outDir, 0 ,0, "Error", "Out of memory\r\n");
+        free(threads);
+        free(batch.files);
+        return -1;
+    }
+    for (i = 0; i < filesSize; i++)
+        batch.files[i].fileName = fileNames[i];
+    batch.filesSize = filesSize;
+    batch.outDir = outDir;
+    pthread_mutex_init(&batch.mutex, NULL);
+    startMs = GetTimeMs(CLOCK_MONOTONIC);
+    for (created = 0; created < threadCount; created++)
+    {
+        if (0 != pthread_create(&threads[created], NULL, BatchWorker, NULL))
+            break;
+    }
+    if (0 == created)
+        BatchWorker(NULL); /* No thread could be started, compile in the main thread */
+    for (i = 0; i < created; i++)
+        pthread_join(threads[i], NULL);
+    wallMs = GetTimeMs(CLOCK_MONOTONIC) - startMs;
+    pthread_mutex_destroy(&batch.mutex);
+    for (i = 0; i < filesSize; i++)
+    {
+        sumMs += batch.files[i].durationMs;
+        if (!batch.files[i].success)
+            ++failed;
+    }
+    /* The speedup compares the wall time with the summed CPU time of the single files,
+     * which is roughly the time a sequential run would have needed */
+    ConsolePrintf(PRIO_HIGH, "Compiled %u of %u files with %u threads on %ld cores in %.1f ms (CPU time of single files %.1f ms, speedup %.2fx)\r\n",
+        filesSize - failed, filesSize, (created ? created : 1), sysconf(_SC_NPROCESSORS_ONLN),
+        wallMs, sumMs, (0 < wallMs) ? (sumMs / wallMs) : 1.0);
+    free(threads);
+    free(batch.files);
+    return (0 == failed) ? 0 : -1;
+}
+
+static void *BatchWorker(void *arg)
+{
+    uint32_t index;
+    (void)arg;
+    while (true)
+    {
+        pthread_mutex_lock(&batch.mutex);
+        index = batch.nextFile++;
+        pthread_mutex_unlock(&batch.mutex);
+        if (index >= batch.filesSize)
+            break;
+        CompileBatchFile(&batch.files[index], batch.outDir);
+    }
+    return NULL;
+}
+
+static void CompileBatchFile(BatchFile_t *file, const char *outDir)
+{
+    char outPath[PATH_MAX_LEN];
+    const char *baseName = strrchr(file->fileName, '/');
+    const char *ext;
+    int baseLen;
+    FILE *out;
+    UcsXmlVal_t *cfg;
+    UcsXmlCtx_t ctx;
+    double startMs = GetTimeMs(CLOCK_THREAD_CPUTIME_ID);
+    ctx.onError = OnBatchError;
+    ctx.userPtr = (void *)file->fileName;
+    baseName = baseName ? baseName + 1 : file->fileName;
+    ext = strrchr(baseName, '.');
+    baseLen = ext ? (int)(ext - baseName) : (int)strlen(baseName);
+    snprintf(outPath, sizeof(outPath), "%s/%.*s.c", outDir, baseLen, baseName);
+    cfg = UcsXml_ParseFileCtx(&ctx, file->fileName);
+    if (NULL == cfg)
+    {
+        ConsolePrintfError(file->fileName, 0 ,0, "Error", "Could not parse UNICENS XML\r\n");
+    }
+    else if (NULL == (out = fopen(outPath, "w")))
+    {
+        ConsolePrintfError(file->fileName, 0 ,0, "Error", "Could not create output file '%s'\r\n", outPath);
+    }
+    else
+    {
+        ConsoleSetOutput(out);
+        PrintUcsStructures(cfg->packetBw, cfg->proxyBw, cfg->pRoutes, cfg->routesSize, cfg->pNod, cfg->nodSize, variablePrefix);
+        ConsoleSetOutput(NULL);
+        file->success = (0 == fclose(out));
+        if (!file->success)
+            ConsolePrintfError(file->fileName, 0 ,0, "Error", "Could not write output file '%s'\r\n", outPath);
+    }
+    UcsXml_FreeVal(cfg);
+    file->durationMs = GetTimeMs(CLOCK_THREAD_CPUTIME_ID) - startMs;
+}
+
+static void OnBatchError(void *userPtr, const char *message)
+{
+    ConsolePrintfError((const char *)userPtr, 0 ,0, "Error", "XML-Parser error: '%s'\r\n", message);
+}
+
+static int RunValidation(const char *fileNames[], uint32_t filesSize)
+{
+    uint32_t i, violations, invalid = 0;
+    double startMs = GetTimeMs(CLOCK_MONOTONIC);
+    for (i = 0; i < filesSize; i++)
+    {
+        violations = ValidateXmlFile(fileNames[i], OnValidateError, (void *)fileNames[i]);
+        if (0 != violations)
+        {
+            ConsolePrintfError(fileNames[i], 0 ,0, "Error", "%u schema violations found\r\n", violations);
+            ++invalid;
+        }
+    }
+    ConsolePrintf(PRIO_HIGH, "Validated %u files in %.1f ms, %u valid, %u invalid\r\n",
+        filesSize, GetTimeMs(CLOCK_MONOTONIC) - startMs, filesSize - invalid, invalid);
+    return (0 == invalid) ? 0 : -1;
+}
+
+static void OnValidateError(void *userPtr, const char *path, const char *message)
+{
+    ConsolePrintfError((const char *)userPtr, 0 ,0, "Error", "%s: %s\r\n", path, message);
+}
+
+static int RunBandwidth(const char *fileNames[], uint32_t filesSize)
+{
+    uint32_t i, failed = 0;
+    UcsXmlCtx_t ctx;
+    UcsXmlVal_t *cfg;
+    ctx.onError = OnBatchError;
+    for (i = 0; i < filesSize; i++)
+    {
+        ctx.userPtr = (void *)fileNames[i];
+        cfg = UcsXml_ParseFileCtx(&ctx, fileNames[i]);
+        if (NULL == cfg)
+        {
+            ConsolePrintfError(fileNames[i], 0 ,0, "Error", "Could not parse UNICENS XML\r\n");
+            ++failed;
+            continue;
+        }
+        if (!PrintBandwidth(fileNames[i], cfg))
+            ++failed;
+        UcsXml_FreeVal(cfg);
+    }
+    return (0 == failed) ? 0 : -1;
+}
+
+static bool PrintBandwidth(const char *fileName, const UcsXmlVal_t *cfg)
+{
+    uint16_t i, nodesUsed;
+    UcsXmlBandwidth_t bw;
+    UcsXmlNodeBw_t *nodes = calloc(cfg->nodSize, sizeof(UcsXmlNodeBw_t));
+    if (!nodes && 0 != cfg->nodSize)
+    {
+        ConsolePrintfError(fileName, 0 ,0, "Error", "Out of memory\r\n");
+        return false;
+    }
+    if (!UcsXml_AnalyzeBandwidth(cfg, &bw, nodes, cfg->nodSize, &nodesUsed))
+    {
+        ConsolePrintfError(fileName, 0 ,0, "Error", "Could not analyze the bandwidth\r\n");
+        free(nodes);
+        return false;
+    }
+    ConsolePrintfStart(PRIO_HIGH, "%s:\r\n", fileName);
+    ConsolePrintfContinue("  Network:          %3u bytes%s\r\n", bw.networkBw, bw.networkAssumed ? " (Network attribute missing, assuming 150 MBit/s)" : "");
+    ConsolePrintfContinue("  AsyncBandwidth:   %3u bytes\r\n", bw.packetBw);
+    ConsolePrintfContinue("  ProxyBandwidth:   %3u bytes\r\n", bw.proxyBw);
+    ConsolePrintfContinue("  Streaming:        %3d bytes\r\n", bw.streamingBw);
+    ConsolePrintfContinue("  Startup routes:   %3u bytes\r\n", bw.activeBw);
+    ConsolePrintfContinue("  Peak routes:      %3u bytes (%s)\r\n", bw.peakBw, bw.peakScene ? bw.peakScene->name : "startup");
+    ConsolePrintfContinue("  All routes:       %3u bytes\r\n", bw.maximumBw);
+    ConsolePrintfContinue("  Headroom:         %3d bytes\r\n", bw.headroom);
+    for (i = 0; i < nodesUsed; i++)
+        ConsolePrintfContinue("  Node 0x%03X:       %3u bytes at startup, %3u bytes with all routes\r\n",
+            nodes[i].nodeAddress, nodes[i].activeBw, nodes[i].maximumBw);
+    ConsolePrintfExit("  Proposed AsyncBandwidth: %u\r\n", bw.proposedPacketBw);
+    if (bw.maximumBw > bw.streamingBw && !bw.oversubscribed)
+        ConsolePrintf(PRIO_HIGH, YELLOW "%s: Not all routes fit at the same time, keep them in separate scenes" RESETCOLOR "\r\n", fileName);
+    if (bw.oversubscribed)
+        ConsolePrintfError(fileName, 0 ,0, "Error", "Network oversubscribed by %d bytes, set AsyncBandwidth to %u or less\r\n",
+            -bw.headroom, bw.proposedPacketBw);
+    free(nodes);
+    return !bw.oversubscribed;
+}
+
+static int RunRegistry(const char *args[], uint32_t argsSize)
+{
+    uint32_t i, j, parsed;
+    int result = 0;
+    UcsXmlCtx_t ctx;
+    const char *fileName;
+    char (*names)[REGISTRY_NAME_LEN + 1] = calloc(argsSize, sizeof(*names));
+    UcsXmlVal_t **cfgs = calloc(argsSize, sizeof(UcsXmlVal_t *));
+    Xml2StructConfig_t *configs = calloc(argsSize, sizeof(Xml2StructConfig_t));
+    if (NULL == names || NULL == cfgs || NULL == configs)
+    {
+        ConsolePrintfError(args[0], 0 ,0, "Error", "Out of memory\r\n");
+        free(configs);
+        free(cfgs);
+        free(names);
+        return -1;
+    }
+    ctx.onError = OnBatchError;
+    for (parsed = 0; parsed < argsSize; parsed++)
+    {
+        if (!GetRegistryName(args[parsed], names[parsed], sizeof(names[parsed]), &fileName))
+        {
+            ConsolePrintfError(args[parsed], 0 ,0, "Error", "Configuration name must be a C identifier with up to %u characters, use [Name]=[File]\r\n", REGISTRY_NAME_LEN);
+            result = -1;
+            break;
+        }
+        for (j = 0; j < parsed; j++)
+        {
+            if (0 == strcmp(names[j], names[parsed]))
+                break;
+        }
+        if (j != parsed)
+        {
+            ConsolePrintfError(fileName, 0 ,0, "Error", "Configuration name '%s' is used twice, use [Name]=[File]\r\n", names[parsed]);
+            result = -1;
+            break;
+        }
+        ctx.userPtr = (void *)fileName;
+        cfgs[parsed] = UcsXml_ParseFileCtx(&ctx, fileName);
+        if (NULL == cfgs[parsed])
+        {
+            ConsolePrintfError(fileName, 0 ,0, "Error", "Could not parse UNICENS XML\r\n");
+            result = -1;
+            break;
+        }
+        configs[parsed].name = names[parsed];
+        configs[parsed].packetBw = cfgs[parsed]->packetBw;
+        configs[parsed].proxyBw = cfgs[parsed]->proxyBw;
+        configs[parsed].pRoutes = cfgs[parsed]->pRoutes;
+        configs[parsed].routesSize = cfgs[parsed]->routesSize;
+        configs[parsed].pNod = cfgs[parsed]->pNod;
+        configs[parsed].nodSize = cfgs[parsed]->nodSize;
+    }
+    /* Nothing is printed, unless all configurations could be parsed */
+    if (0 == result)
+        PrintUcsRegistry(configs, argsSize);
+    for (i = 0; i < parsed; i++)
+        UcsXml_FreeVal(cfgs[i]);
+    free(configs);
+    free(cfgs);
+    free(names);
+    return result;
+}
+
+static bool GetRegistryName(const char *arg, char *name, uint32_t nameSize, const char **pFileName)
+{
+    const char *separator = strchr(arg, '=');
+    const char *baseName, *ext;
+    uint32_t i, len;
+    if (NULL != separator)
+    {
+        /* Explicit name given as [Name]=[File] */
+        baseName = arg;
+        len = separator - arg;
+        *pFileName = separator + 1;
+    }
+    else
+    {
+        /* Derive the name from the file name without directory and extension */
+        baseName = strrchr(arg, '/');
+        baseName = baseName ? baseName + 1 : arg;
+        ext = strrchr(baseName, '.');
+        len = ext ? (uint32_t)(ext - baseName) : (uint32_t)strlen(baseName);
+        *pFileName = arg;
+    }
+    if (0 == len || nameSize <= len)
+        return false;
+    for (i = 0; i < len; i++)
+    {
+        char c = baseName[i];
+        if (('a' <= c && 'z' >= c) || ('A' <= c && 'Z' >= c) || ('0' <= c && '9' >= c && 0 != i))
+            name[i] = c;
+        else if ('_' == c || (NULL == separator && ('-' == c || '.' == c)))
+            name[i] = '_';
+        else
+            return false;
+    }
+    name[len] = '\0';
+    return true;
+}
+
+static double GetTimeMs(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
 static void PrintHelp(void)
 {
-    ConsolePrintfStart(PRIO_HIGH, "Usage: xml2struct [OPTION]... [FILE]\r\n");
+    ConsolePrintfStart(PRIO_HIGH, "Usage: xml2struct [OPTION]... [FILE]...\r\n");
     ConsolePrintfContinue("Translate a UNICENS XML file into structures for the UNICENS library or structures for the INIC Linux Driver.\r\n\r\n");
     ConsolePrintfContinue("  -ucs                     Print UNICENS C structures\r\n");
-    ConsolePrintfContinue("  -header                  Print UNICENS H file\r\n");
+    ConsolePrintfContinue("  -header                  Print UNICENS H file (with -registry: for the registry)\r\n");
     ConsolePrintfContinue("  -prefix [Name]           Adds the given name before any variable or structure (-ucs and -header mode only)\r\n");
+    ConsolePrintfContinue("  -pool                    Print the UNICENS pool sizes needed by the configuration as ucs_pool_cfg.h (see POOL_CONFIG build option)\r\n");
+    ConsolePrintfContinue("  -margin [Percent]        Safety margin added to the pool sizes (-pool mode only, default: %u)\r\n", POOL_MARGIN_PERCENT);
     ConsolePrintfContinue("  -drv [Address]           Print INIC Linux Driver structure for the given node address (value will be interpreted as hex)\r\n");
     ConsolePrintfContinue("  -all                     Print all possible INIC Linux Driver structures for all nodes.\r\n");
     ConsolePrintfContinue("                           There is a file seperator inserted after each configuration\r\n");
+    ConsolePrintfContinue("  -bin [File]              Write a precompiled binary configuration, which can be passed to unicensd instead of the XML file.\r\n");
+    ConsolePrintfContinue("                           The binary file is only valid for the UNICENS version and CPU architecture of this build\r\n");
+    ConsolePrintfContinue("  -batch [Dir]             Print UNICENS C structures for all given XML files into [Dir]/<file name>.c\r\n");
+    ConsolePrintfContinue("                           The files are compiled in parallel and a speedup report is printed at the end\r\n");
+    ConsolePrintfContinue("  -jobs [Count]            Amount of worker threads for -batch (default: amount of online CPU cores)\r\n");
+    ConsolePrintfContinue("  -validate                Check all given XML files against the UNICENS XML schema and report all violations\r\n");
+    ConsolePrintfContinue("  -bandwidth               Print the network bandwidth used by the routes and scenes of all given XML files.\r\n");
+    ConsolePrintfContinue("                           Fails if a file is oversubscribed and proposes the largest fitting AsyncBandwidth\r\n");
+    ConsolePrintfContinue("  -registry                Print UNICENS C structures for all given XML files and the DefaultConfigs table,\r\n");
+    ConsolePrintfContinue("                           from which unicensd selects by name or by the found nodes (unicensd -variant).\r\n");
+    ConsolePrintfContinue("                           The variables of each file are prefixed with its name, which is the file name without\r\n");
+    ConsolePrintfContinue("                           extension. Use [Name]=[File] to give another name\r\n");
     ConsolePrintfContinue("  --version                Prints the version string of this program and exit\r\n\r\n");
     ConsolePrintfContinue("  --help                   Prints this help and exit\r\n\r\n");
     ConsolePrintfContinue("With no OPTION, UNICENS C structures are printed\r\n\r\n");
     ConsolePrintfContinue("Examples:\r\n");
     ConsolePrintfContinue("  xml2struct -drv 200 config.xml\r\n");
     ConsolePrintfContinue("  xml2struct -all config.xml\r\n");
+    ConsolePrintfContinue("  xml2struct -bin config.bin config.xml\r\n");
+    ConsolePrintfContinue("  xml2struct -pool -margin 50 config.xml > libraries/unicens/cfg-daemon/ucs_pool_cfg.h\r\n");
+    ConsolePrintfContinue("  xml2struct -batch out -jobs 4 variant1.xml variant2.xml variant3.xml\r\n");
+    ConsolePrintfContinue("  xml2struct -validate variant1.xml variant2.xml\r\n");
+    ConsolePrintfContinue("  xml2struct -bandwidth variant1.xml variant2.xml\r\n");
+    ConsolePrintfContinue("  xml2struct -registry sedan=variant1.xml suv=variant2.xml > src/default_config.c\r\n");
+    ConsolePrintfContinue("  xml2struct -header -registry > src/default_config.h\r\n");
     ConsolePrintfExit("  xml2stuct config.xml\r\n");
 }
 
-static char *ReadFileToString(const char *fileName)
-{
-    char *buffer;
-    int stringSize, readSize;
-    FILE *fh = fopen(fileName, "r");
-    if (!fh) return NULL;
-    fseek(fh, 0, SEEK_END);
-    stringSize = ftell(fh);
-    rewind(fh);
-    buffer = (char *)malloc(stringSize + 1);
-    readSize = fread(buffer, sizeof(char), stringSize, fh);
-    buffer[stringSize] = '\0'; /*In any case, terminate it.*/
-    if (stringSize != readSize)
-    {
-        free(buffer);
-        buffer = NULL;
-    }
-    fclose(fh);
-    return buffer;
-}
-
@@ -0,0 +1,1137 @@
+/*------------------------------------------------------------------------------------------------*/
+/* UNICENS Driver Printing module                                                                 */
+/* Copyright 2017, Microchip Technology Inc. and its subsidiaries.                                */
+/*                                                                                                */
+/* Redistribution and use in source and binary forms, with or without                             */
+/* modification, are permitted provided that the following conditions are met:                    */
+/*                                                                                                */
+/* 1. Redistributions of source code must retain the above copyright notice, this                 */
+/*    list of conditions and the following disclaimer.                                            */
+/*                                                                                                */
+/* 2. Redistributions in binary form must reproduce the above copyright notice,                   */
+/*    this list of conditions and the following disclaimer in the documentation                   */
+/*    and/or other materials provided with the distribution.                                      */
+/*                                                                                                */
+/* 3. Neither the name of the copyright holder nor the names of its                               */
+/*    contributors may be used to endorse or promote products derived from                        */
+/*    this software without specific prior written permission.                                    */
+/*                                                                                                */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"                    */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE                      */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE                 */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE                   */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL                     */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR                     */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER                     */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,                  */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE                  */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                           */
+/*------------------------------------------------------------------------------------------------*/
+/* xsd2c translates the UNICENS XML schema into the tables of Xml2Schema.h.
+ * Only the subset of XML schema used by cfg/unicens.xsd is supported:
+ * element, sequence, choice and all particles with occurrence bounds,
+ * complex types with extension, attributes, attribute references and
+ * simple types restricted by enumerations, lengths, ranges and a known
+ * set of patterns. Anything else stops the build, so schema changes are
+ * never silently ignored. */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <limits.h>
+#include "mxml.h"
+#include "Xml2Schema.h"
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     USED ADJUSTABLE DEFINES                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define SCHEMA_VARIABLE     "unicensSchema"
+#define MAX_ALL_PARTICLES   (8)
+#define MAX_OCCURS_EXPANDED (64)
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                        PRIVATE DEFINES                               */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+#define UNBOUNDED           (-1)
+#define EPSILON             (SCHEMA_NONE)
+
+typedef struct
+{
+    mxml_node_t *xsd;
+    char *name;
+    SchemaLexical_t lexical;
+    char **enumeration;
+    uint32_t enumerationSize;
+    int32_t minLength;
+    int32_t maxLength;
+    bool hasMin;
+    bool hasMax;
+    int64_t minValue;
+    int64_t maxValue;
+} SimpleType_t;
+
+typedef struct
+{
+    mxml_node_t *xsd;
+    const char *name;
+    uint16_t firstAttribute;
+    uint16_t attributeCount;
+    uint16_t startState;
+    uint16_t stateCount;
+    uint16_t textType;
+} Element_t;
+
+typedef struct
+{
+    uint32_t from;
+    uint32_t to;
+    uint16_t label;         /* Element index or EPSILON */
+} NfaEdge_t;
+
+typedef struct
+{
+    uint64_t *set;          /* Set of NFA states */
+    bool accepting;
+    uint32_t firstEdge;
+    uint32_t edgeCount;
+} DfaState_t;
+
+/* Collects the parts of a complex type while walking its derivation chain */
+typedef struct
+{
+    mxml_node_t *particles[16];
+    uint32_t particlesSize;
+    uint16_t textType;
+    const char *owner;
+    uint32_t firstAttribute;
+} TypeBody_t;
+
+/* A growable array */
+typedef struct
+{
+    void *data;
+    uint32_t size;
+    uint32_t capacity;
+} Array_t;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                     PRIVTATE FUNCTION PROTOTYPES                     */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void Fail(mxml_node_t *node, const char *format, ...) __attribute__ ((format (gnu_printf, 2, 3), noreturn));
+static void *Push(Array_t *array, size_t elemSize);
+static bool IsXsd(mxml_node_t *node, const char *localName);
+static mxml_node_t *FirstChild(mxml_node_t *node);
+static mxml_node_t *NextSibling(mxml_node_t *node);
+static mxml_node_t *FindGlobal(const char *localName, const char *name);
+static const char *StripPrefix(const char *qname);
+static uint16_t GetElement(mxml_node_t *xsd);
+static void ResolveElement(uint16_t index);
+static void ResolveComplexType(mxml_node_t *ct, TypeBody_t *body);
+static void ResolveTypeBody(mxml_node_t *node, TypeBody_t *body);
+static void AddAttribute(mxml_node_t *attr, TypeBody_t *body);
+static uint16_t GetSimpleTypeByName(mxml_node_t *ref, const char *qname);
+static uint16_t GetBuiltinType(mxml_node_t *ref, const char *localName);
+static uint16_t ResolveSimpleType(mxml_node_t *st, const char *name);
+static void ApplyFacet(mxml_node_t *facet, SimpleType_t *type);
+static uint16_t NewSimpleType(void);
+static void GetOccurs(mxml_node_t *particle, int32_t *pMin, int32_t *pMax);
+static uint32_t NewNfaState(void);
+static void AddNfaEdge(uint32_t from, uint32_t to, uint16_t label);
+static uint32_t BuildParticle(mxml_node_t *particle, uint32_t start);
+static uint32_t BuildParticleOnce(mxml_node_t *particle, uint32_t start);
+static uint32_t BuildAll(mxml_node_t *all, uint32_t start);
+static void BuildDfa(Element_t *element, uint32_t nfaStart, uint32_t nfaAccept);
+static bool IsEquivalent(Array_t *dfa, Array_t *edges, uint32_t *classes, uint32_t a, uint32_t b);
+static void CloseOverEpsilon(uint64_t *set);
+static uint32_t FindOrAddDfaState(Array_t *dfa, uint64_t *set, uint32_t nfaAccept);
+static void WriteTables(FILE *out, const char *xsdFileName);
+static void WriteString(FILE *out, const char *text);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                          PRIVTATE Variables                          */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static mxml_node_t *schema;
+static char prefix[32];
+static Array_t elements;        /* Element_t */
+static Array_t simpleTypes;     /* SimpleType_t */
+static Array_t attributes;      /* SchemaAttribute_t */
+static Array_t states;          /* SchemaState_t */
+static Array_t transitions;     /* SchemaTransition_t */
+static Array_t nfaEdges;        /* NfaEdge_t, rebuilt for every element */
+static uint32_t nfaStates;
+static uint32_t setWords;
+static uint16_t rootState;
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                         PUBLIC FUNCTIONS                             */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+int main(int argc, char *argv[])
+{
+    FILE *fh;
+    mxml_node_t *doc, *child;
+    uint32_t i, rootCount = 0;
+    uint16_t root[16];
+    SchemaState_t *state;
+    SchemaTransition_t *transition;
+    const char *colon;
+    if (3 != argc)
+    {
+        fprintf(stderr, "Usage: xsd2c [XSD file] [Output C file]\n");
+        fprintf(stderr, "Generate the validation tables of xml2struct from a UNICENS XML schema.\n");
+        return -1;
+    }
+    fh = fopen(argv[1], "r");
+    if (NULL == fh)
+    {
+        fprintf(stderr, "xsd2c: Could not open '%s'\n", argv[1]);
+        return -1;
+    }
+    doc = mxmlLoadFile(NULL, fh, MXML_NO_CALLBACK);
+    fclose(fh);
+    if (NULL == doc)
+    {
+        fprintf(stderr, "xsd2c: '%s' is not well formed\n", argv[1]);
+        return -1;
+    }
+    for (schema = doc; NULL != schema; schema = mxmlWalkNext(schema, doc, MXML_DESCEND))
+    {
+        if (MXML_ELEMENT == schema->type && '?' != schema->value.element.name[0]
+            && '!' != schema->value.element.name[0])
+            break;
+    }
+    if (NULL == schema)
+        Fail(NULL, "No schema element found");
+    colon = strchr(schema->value.element.name, ':');
+    if (colon)
+        snprintf(prefix, sizeof(prefix), "%.*s", (int)(colon - schema->value.element.name + 1), schema->value.element.name);
+    if (!IsXsd(schema, "schema"))
+        Fail(schema, "Root element is not a schema");
+    /* Every global element may be the root of a document */
+    for (child = FirstChild(schema); NULL != child; child = NextSibling(child))
+    {
+        if (IsXsd(child, "element"))
+        {
+            if (rootCount >= sizeof(root) / sizeof(root[0]))
+                Fail(child, "Too many global elements");
+            root[rootCount++] = GetElement(child);
+        }
+    }
+    if (0 == rootCount)
+        Fail(schema, "Schema does not declare any element");
+    /* Resolving an element adds the elements of its content model to the end of the list */
+    for (i = 0; i < elements.size; i++)
+        ResolveElement(i);
+    rootState = states.size;
+    state = Push(&states, sizeof(SchemaState_t));
+    state->firstTransition = transitions.size;
+    state->transitionCount = rootCount;
+    state->accepting = false;
+    state = Push(&states, sizeof(SchemaState_t));
+    state->firstTransition = transitions.size;
+    state->transitionCount = 0;
+    state->accepting = true;
+    for (i = 0; i < rootCount; i++)
+    {
+        transition = Push(&transitions, sizeof(SchemaTransition_t));
+        transition->element = root[i];
+        transition->nextState = rootState + 1;
+    }
+    if (SCHEMA_NONE <= states.size || SCHEMA_NONE <= transitions.size || SCHEMA_NONE <= attributes.size
+        || SCHEMA_NONE <= elements.size || SCHEMA_NONE <= simpleTypes.size)
+        Fail(NULL, "Schema is too large for the table format");
+    fh = fopen(argv[2], "w");
+    if (NULL == fh)
+    {
+        fprintf(stderr, "xsd2c: Could not create '%s'\n", argv[2]);
+        return -1;
+    }
+    WriteTables(fh, argv[1]);
+    if (0 != fclose(fh))
+    {
+        fprintf(stderr, "xsd2c: Could not write '%s'\n", argv[2]);
+        remove(argv[2]);
+        return -1;
+    }
+    mxmlDelete(doc);
+    return 0;
+}
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*                  PRIVATE FUNCTION IMPLEMENTATIONS                    */
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+static void Fail(mxml_node_t *node, const char *format, ...)
+{
+    va_list args;
+    const char *name;
+    fprintf(stderr, "xsd2c: ");
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    for (; NULL != node && MXML_ELEMENT == node->type; node = node->parent)
+    {
+        name = mxmlElementGetAttr(node, "name");
+        if (NULL == name)
+            name = mxmlElementGetAttr(node, "ref");
+        if (name)
+        {
+            fprintf(stderr, " (in <%s name=\"%s\">)", node->value.element.name, name);
+            break;
+        }
+    }
+    fprintf(stderr, "\n");
+    exit(EXIT_FAILURE);
+}
+
+static void *Push(Array_t *array, size_t elemSize)
+{
+    void *elem;
+    if (array->size == array->capacity)
+    {
+        uint32_t capacity = array->capacity ? 2 * array->capacity : 64;
+        void *data = realloc(array->data, capacity * elemSize);
+        if (NULL == data)
+            Fail(NULL, "Out of memory");
+        array->data = data;
+        array->capacity = capacity;
+    }
+    elem = (char *)array->data + (array->size++ * elemSize);
+    memset(elem, 0, elemSize);
+    return elem;
+}
+
+static bool IsXsd(mxml_node_t *node, const char *localName)
+{
+    size_t len = strlen(prefix);
+    const char *name;
+    if (NULL == node || MXML_ELEMENT != node->type)
+        return false;
+    name = node->value.element.name;
+    return (0 == strncmp(name, prefix, len) && 0 == strcmp(name + len, localName));
+}
+
+static mxml_node_t *FirstChild(mxml_node_t *node)
+{
+    node = node->child;
+    while (NULL != node && MXML_ELEMENT != node->type)
+        node = node->next;
+    return node;
+}
+
+static mxml_node_t *NextSibling(mxml_node_t *node)
+{
+    do
+        node = node->next;
+    while (NULL != node && MXML_ELEMENT != node->type);
+    return node;
+}
+
+static mxml_node_t *FindGlobal(const char *localName, const char *name)
+{
+    mxml_node_t *child;
+    const char *childName;
+    for (child = FirstChild(schema); NULL != child; child = NextSibling(child))
+    {
+        childName = mxmlElementGetAttr(child, "name");
+        if (IsXsd(child, localName) && NULL != childName && 0 == strcmp(childName, name))
+            return child;
+    }
+    return NULL;
+}
+
+static const char *StripPrefix(const char *qname)
+{
+    const char *colon = strchr(qname, ':');
+    return colon ? colon + 1 : qname;
+}
+
+static uint16_t GetElement(mxml_node_t *xsd)
+{
+    uint32_t i;
+    Element_t *element;
+    const char *ref = mxmlElementGetAttr(xsd, "ref");
+    if (ref)
+    {
+        mxml_node_t *global = FindGlobal("element", StripPrefix(ref));
+        if (NULL == global)
+            Fail(xsd, "Referenced element '%s' does not exist", ref);
+        xsd = global;
+    }
+    for (i = 0; i < elements.size; i++)
+    {
+        if (((Element_t *)elements.data)[i].xsd == xsd)
+            return i;
+    }
+    element = Push(&elements, sizeof(Element_t));
+    element->xsd = xsd;
+    element->name = mxmlElementGetAttr(xsd, "name");
+    element->textType = SCHEMA_NONE;
+    if (NULL == element->name)
+        Fail(xsd, "Element without name");
+    return elements.size - 1;
+}
+
+static void ResolveElement(uint16_t index)
+{
+    TypeBody_t body;
+    uint32_t i, start, cur;
+    mxml_node_t *xsd = ((Element_t *)elements.data)[index].xsd;
+    mxml_node_t *child;
+    const char *typeName = mxmlElementGetAttr(xsd, "type");
+    memset(&body, 0, sizeof(TypeBody_t));
+    body.textType = SCHEMA_NONE;
+    body.owner = ((Element_t *)elements.data)[index].name;
+    body.firstAttribute = attributes.size;
+    ((Element_t *)elements.data)[index].firstAttribute = attributes.size;
+    if (typeName)
+    {
+        mxml_node_t *ct = FindGlobal("complexType", StripPrefix(typeName));
+        if (ct)
+            ResolveComplexType(ct, &body);
+        else
+            body.textType = GetSimpleTypeByName(xsd, typeName);
+    }
+    else
+    {
+        for (child = FirstChild(xsd); NULL != child; child = NextSibling(child))
+        {
+            if (IsXsd(child, "complexType"))
+                ResolveComplexType(child, &body);
+            else if (IsXsd(child, "simpleType"))
+                body.textType = ResolveSimpleType(child, body.owner);
+            else if (!IsXsd(child, "annotation"))
+                Fail(child, "Unsupported <%s> in element", child->value.element.name);
+        }
+    }
+    /* Attributes of an element are stored in one block */
+    if (SCHEMA_MAX_ATTR < attributes.size - ((Element_t *)elements.data)[index].firstAttribute)
+        Fail(xsd, "More than %d attributes", SCHEMA_MAX_ATTR);
+    ((Element_t *)elements.data)[index].attributeCount = attributes.size - ((Element_t *)elements.data)[index].firstAttribute;
+    ((Element_t *)elements.data)[index].textType = body.textType;
+    /* The content model is the sequence of the particles of the derivation chain */
+    nfaEdges.size = 0;
+    nfaStates = 0;
+    start = NewNfaState();
+    cur = start;
+    for (i = 0; i < body.particlesSize; i++)
+        cur = BuildParticle(body.particles[i], cur);
+    BuildDfa(&((Element_t *)elements.data)[index], start, cur);
+}
+
+static void ResolveComplexType(mxml_node_t *ct, TypeBody_t *body)
+{
+    mxml_node_t *child, *derivation;
+    const char *mixed = mxmlElementGetAttr(ct, "mixed");
+    const char *base;
+    if (mixed && 0 == strcmp(mixed, "true"))
+        body->textType = GetBuiltinType(ct, "string");
+    for (child = FirstChild(ct); NULL != child; child = NextSibling(child))
+    {
+        if (!IsXsd(child, "complexContent") && !IsXsd(child, "simpleContent"))
+            continue;
+        mixed = mxmlElementGetAttr(child, "mixed");
+        if (mixed && 0 == strcmp(mixed, "true"))
+            body->textType = GetBuiltinType(child, "string");
+        for (derivation = FirstChild(child); NULL != derivation; derivation = NextSibling(derivation))
+        {
+            if (IsXsd(derivation, "annotation"))
+                continue;
+            if (!IsXsd(derivation, "extension"))
+                Fail(derivation, "Only derivation by extension is supported");
+            base = mxmlElementGetAttr(derivation, "base");
+            if (NULL == base)
+                Fail(derivation, "Extension without base");
+            if (IsXsd(child, "complexContent"))
+            {
+                mxml_node_t *baseType = FindGlobal("complexType", StripPrefix(base));
+                if (NULL == baseType)
+                    Fail(derivation, "Base type '%s' does not exist", base);
+                ResolveComplexType(baseType, body);
+            }
+            else
+            {
+                body->textType = GetSimpleTypeByName(derivation, base);
+            }
+            ResolveTypeBody(derivation, body);
+        }
+        return;
+    }
+    ResolveTypeBody(ct, body);
+}
+
+static void ResolveTypeBody(mxml_node_t *node, TypeBody_t *body)
+{
+    mxml_node_t *child;
+    for (child = FirstChild(node); NULL != child; child = NextSibling(child))
+    {
+        if (IsXsd(child, "sequence") || IsXsd(child, "choice") || IsXsd(child, "all"))
+        {
+            if (body->particlesSize >= sizeof(body->particles) / sizeof(body->particles[0]))
+                Fail(child, "Derivation chain is too deep");
+            body->particles[body->particlesSize++] = child;
+        }
+        else if (IsXsd(child, "attribute"))
+        {
+            AddAttribute(child, body);
+        }
+        else if (!IsXsd(child, "annotation"))
+        {
+            Fail(child, "Unsupported <%s> in complex type", child->value.element.name);
+        }
+    }
+}
+
+static void AddAttribute(mxml_node_t *attr, TypeBody_t *body)
+{
+    char name[256];
+    uint32_t i;
+    mxml_node_t *decl = attr, *child;
+    SchemaAttribute_t *entry;
+    const char *use = mxmlElementGetAttr(attr, "use");
+    const char *ref = mxmlElementGetAttr(attr, "ref");
+    const char *typeName;
+    uint16_t type = SCHEMA_NONE;
+    if (use && 0 == strcmp(use, "prohibited"))
+        return;
+    if (ref)
+    {
+        decl = FindGlobal("attribute", StripPrefix(ref));
+        if (NULL == decl)
+            Fail(attr, "Referenced attribute '%s' does not exist", ref);
+    }
+    if (NULL == mxmlElementGetAttr(decl, "name"))
+        Fail(attr, "Attribute without name");
+    for (i = body->firstAttribute; i < attributes.size; i++)
+    {
+        if (0 == strcmp(((SchemaAttribute_t *)attributes.data)[i].name, mxmlElementGetAttr(decl, "name")))
+            Fail(attr, "Attribute is declared twice");
+    }
+    typeName = mxmlElementGetAttr(decl, "type");
+    snprintf(name, sizeof(name), "%s@%s", body->owner, mxmlElementGetAttr(decl, "name"));
+    if (typeName)
+        type = GetSimpleTypeByName(decl, typeName);
+    for (child = FirstChild(decl); NULL != child; child = NextSibling(child))
+    {
+        if (IsXsd(child, "simpleType"))
+            type = ResolveSimpleType(child, name);
+        else if (!IsXsd(child, "annotation"))
+            Fail(child, "Unsupported <%s> in attribute", child->value.element.name);
+    }
+    if (SCHEMA_NONE == type)
+        type = GetBuiltinType(decl, "string");
+    entry = Push(&attributes, sizeof(SchemaAttribute_t));
+    entry->name = mxmlElementGetAttr(decl, "name");
+    entry->simpleType = type;
+    entry->required = (use && 0 == strcmp(use, "required"));
+}
+
+static uint16_t GetSimpleTypeByName(mxml_node_t *ref, const char *qname)
+{
+    size_t len = strlen(prefix);
+    mxml_node_t *st;
+    if (0 < len && 0 == strncmp(qname, prefix, len))
+        return GetBuiltinType(ref, qname + len);
+    st = FindGlobal("simpleType", StripPrefix(qname));
+    if (NULL == st)
+        Fail(ref, "Simple type '%s' does not exist", qname);
+    return ResolveSimpleType(st, mxmlElementGetAttr(st, "name"));
+}
+
+static uint16_t GetBuiltinType(mxml_node_t *ref, const char *localName)
+{
+    static const struct
+    {
+        const char *name;
+        SchemaLexical_t lexical;
+        bool hasMin;
+        bool hasMax;
+        int64_t minValue;
+        int64_t maxValue;
+    } builtins[] =
+    {
+        { "string", SCHEMA_LEX_STRING, false, false, 0, 0 },
+        { "normalizedString", SCHEMA_LEX_STRING, false, false, 0, 0 },
+        { "token", SCHEMA_LEX_STRING, false, false, 0, 0 },
+        { "boolean", SCHEMA_LEX_BOOLEAN, false, false, 0, 0 },
+        { "integer", SCHEMA_LEX_INTEGER, false, false, 0, 0 },
+        { "long", SCHEMA_LEX_INTEGER, true, true, INT64_MIN, INT64_MAX },
+        { "int", SCHEMA_LEX_INTEGER, true, true, INT32_MIN, INT32_MAX },
+        { "short", SCHEMA_LEX_INTEGER, true, true, INT16_MIN, INT16_MAX },
+        { "byte", SCHEMA_LEX_INTEGER, true, true, INT8_MIN, INT8_MAX },
+        { "nonNegativeInteger", SCHEMA_LEX_INTEGER, true, false, 0, 0 },
+        { "positiveInteger", SCHEMA_LEX_INTEGER, true, false, 1, 0 },
+        { "unsignedInt", SCHEMA_LEX_INTEGER, true, true, 0, UINT32_MAX },
+        { "unsignedShort", SCHEMA_LEX_INTEGER, true, true, 0, UINT16_MAX },
+        { "unsignedByte", SCHEMA_LEX_INTEGER, true, true, 0, UINT8_MAX },
+    };
+    char name[64];
+    uint32_t i;
+    SimpleType_t *type;
+    snprintf(name, sizeof(name), "%s%s", prefix, localName);
+    for (i = 0; i < simpleTypes.size; i++)
+    {
+        type = &((SimpleType_t *)simpleTypes.data)[i];
+        if (NULL == type->xsd && 0 == strcmp(type->name, name))
+            return i;
+    }
+    for (i = 0; i < sizeof(builtins) / sizeof(builtins[0]); i++)
+    {
+        if (0 == strcmp(builtins[i].name, localName))
+        {
+            uint16_t index = NewSimpleType();
+            type = &((SimpleType_t *)simpleTypes.data)[index];
+            type->name = strdup(name);
+            type->lexical = builtins[i].lexical;
+            type->hasMin = builtins[i].hasMin;
+            type->hasMax = builtins[i].hasMax;
+            type->minValue = builtins[i].minValue;
+            type->maxValue = builtins[i].maxValue;
+            return index;
+        }
+    }
+    Fail(ref, "Built-in type '%s' is not supported", name);
+}
+
+static uint16_t ResolveSimpleType(mxml_node_t *st, const char *name)
+{
+    uint32_t i;
+    uint16_t index, baseIndex = SCHEMA_NONE;
+    mxml_node_t *restriction, *child;
+    SimpleType_t *type;
+    const char *base;
+    for (i = 0; i < simpleTypes.size; i++)
+    {
+        if (((SimpleType_t *)simpleTypes.data)[i].xsd == st)
+            return i;
+    }
+    for (restriction = FirstChild(st); NULL != restriction; restriction = NextSibling(restriction))
+    {
+        if (!IsXsd(restriction, "annotation"))
+            break;
+    }
+    if (!IsXsd(restriction, "restriction"))
+        Fail(st, "Only simple types derived by restriction are supported");
+    base = mxmlElementGetAttr(restriction, "base");
+    if (base)
+        baseIndex = GetSimpleTypeByName(restriction, base);
+    for (child = FirstChild(restriction); NULL != child && SCHEMA_NONE == baseIndex; child = NextSibling(child))
+    {
+        if (IsXsd(child, "simpleType"))
+            baseIndex = ResolveSimpleType(child, name);
+    }
+    if (SCHEMA_NONE == baseIndex)
+        Fail(restriction, "Restriction without base type");
+    index = NewSimpleType();
+    type = &((SimpleType_t *)simpleTypes.data)[index];
+    *type = ((SimpleType_t *)simpleTypes.data)[baseIndex];
+    type->xsd = st;
+    type->name = strdup(name ? name : "");
+    /* An enumeration of the restriction replaces the one of the base type */
+    type->enumeration = NULL;
+    type->enumerationSize = 0;
+    for (child = FirstChild(restriction); NULL != child; child = NextSibling(child))
+    {
+        if (!IsXsd(child, "simpleType") && !IsXsd(child, "annotation"))
+            ApplyFacet(child, type);
+    }
+    if (NULL == type->enumeration && NULL != ((SimpleType_t *)simpleTypes.data)[baseIndex].enumeration)
+    {
+        type->enumeration = ((SimpleType_t *)simpleTypes.data)[baseIndex].enumeration;
+        type->enumerationSize = ((SimpleType_t *)simpleTypes.data)[baseIndex].enumerationSize;
+    }
+    return index;
+}
+
+static void ApplyFacet(mxml_node_t *facet, SimpleType_t *type)
+{
+    /* Patterns are not compiled, the known ones are mapped to hand written lexical checks */
+    static const struct
+    {
+        const char *pattern;
+        SchemaLexical_t lexical;
+    } patterns[] =
+    {
+        { "([0-9]+)|(0x[0-9a-fA-F]+)", SCHEMA_LEX_NUMBER },
+        { "([0-9a-fA-F]{2}(\\s+[0-9a-fA-F]{2})*)?", SCHEMA_LEX_HEX_DATA },
+        { ".*[^\\s].*", SCHEMA_LEX_NOT_BLANK },
+    };
+    const char *value = mxmlElementGetAttr(facet, "value");
+    char *end;
+    long long number;
+    uint32_t i;
+    if (NULL == value)
+        Fail(facet, "Facet <%s> without value", facet->value.element.name);
+    number = strtoll(value, &end, 10);
+    if (IsXsd(facet, "enumeration"))
+    {
+        char **enumeration = realloc(type->enumeration, (type->enumerationSize + 1) * sizeof(char *));
+        if (NULL == enumeration)
+            Fail(facet, "Out of memory");
+        enumeration[type->enumerationSize++] = strdup(value);
+        type->enumeration = enumeration;
+    }
+    else if (IsXsd(facet, "pattern"))
+    {
+        for (i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++)
+        {
+            if (0 == strcmp(patterns[i].pattern, value))
+                break;
+        }
+        if (i == sizeof(patterns) / sizeof(patterns[0]))
+            Fail(facet, "Pattern '%s' is unknown, add a lexical check for it to xsd2c", value);
+        if (SCHEMA_LEX_STRING != type->lexical && patterns[i].lexical != type->lexical)
+            Fail(facet, "Pattern '%s' can not be combined with the base type", value);
+        type->lexical = patterns[i].lexical;
+    }
+    else if ('\0' != *end || end == value)
+    {
+        Fail(facet, "Value '%s' of facet <%s> is not an integer", value, facet->value.element.name);
+    }
+    else if (IsXsd(facet, "length"))
+    {
+        type->minLength = number;
+        type->maxLength = number;
+    }
+    else if (IsXsd(facet, "minLength"))
+    {
+        type->minLength = number;
+    }
+    else if (IsXsd(facet, "maxLength"))
+    {
+        type->maxLength = number;
+    }
+    else if (IsXsd(facet, "minInclusive") || IsXsd(facet, "minExclusive"))
+    {
+        type->hasMin = true;
+        type->minValue = IsXsd(facet, "minExclusive") ? number + 1 : number;
+    }
+    else if (IsXsd(facet, "maxInclusive") || IsXsd(facet, "maxExclusive"))
+    {
+        type->hasMax = true;
+        type->maxValue = IsXsd(facet, "maxExclusive") ? number - 1 : number;
+    }
+    else
+    {
+        Fail(facet, "Facet <%s> is not supported", facet->value.element.name);
+    }
+}
+
+static uint16_t NewSimpleType(void)
+{
+    SimpleType_t *type = Push(&simpleTypes, sizeof(SimpleType_t));
+    type->minLength = -1;
+    type->maxLength = -1;
+    return simpleTypes.size - 1;
+}
+
+static void GetOccurs(mxml_node_t *particle, int32_t *pMin, int32_t *pMax)
+{
+    const char *min = mxmlElementGetAttr(particle, "minOccurs");
+    const char *max = mxmlElementGetAttr(particle, "maxOccurs");
+    *pMin = min ? atoi(min) : 1;
+    if (NULL == max)
+        *pMax = 1;
+    else if (0 == strcmp(max, "unbounded"))
+        *pMax = UNBOUNDED;
+    else
+        *pMax = atoi(max);
+    if (0 > *pMin || MAX_OCCURS_EXPANDED < *pMin || MAX_OCCURS_EXPANDED < *pMax
+        || (UNBOUNDED != *pMax && *pMax < *pMin))
+        Fail(particle, "Unsupported occurrence bounds");
+}
+
+static uint32_t NewNfaState(void)
+{
+    return nfaStates++;
+}
+
+static void AddNfaEdge(uint32_t from, uint32_t to, uint16_t label)
+{
+    NfaEdge_t *edge = Push(&nfaEdges, sizeof(NfaEdge_t));
+    edge->from = from;
+    edge->to = to;
+    edge->label = label;
+}
+
+/* Thompson construction, returns the NFA state reached after the particle */
+static uint32_t BuildParticle(mxml_node_t *particle, uint32_t start)
+{
+    int32_t i, min, max;
+    uint32_t cur = start, end, loop;
+    GetOccurs(particle, &min, &max);
+    for (i = 0; i < min; i++)
+        cur = BuildParticleOnce(particle, cur);
+    if (UNBOUNDED == max)
+    {
+        loop = NewNfaState();
+        AddNfaEdge(cur, loop, EPSILON);
+        end = BuildParticleOnce(particle, loop);
+        AddNfaEdge(end, loop, EPSILON);
+        return loop;
+    }
+    for (i = min; i < max; i++)
+    {
+        end = NewNfaState();
+        AddNfaEdge(cur, end, EPSILON);
+        AddNfaEdge(BuildParticleOnce(particle, cur), end, EPSILON);
+        cur = end;
+    }
+    return cur;
+}
+
+static uint32_t BuildParticleOnce(mxml_node_t *particle, uint32_t start)
+{
+    mxml_node_t *child;
+    uint32_t cur, end;
+    if (IsXsd(particle, "element"))
+    {
+        end = NewNfaState();
+        AddNfaEdge(start, end, GetElement(particle));
+        return end;
+    }
+    if (IsXsd(particle, "sequence"))
+    {
+        cur = start;
+        for (child = FirstChild(particle); NULL != child; child = NextSibling(child))
+        {
+            if (!IsXsd(child, "annotation"))
+                cur = BuildParticle(child, cur);
+        }
+        return cur;
+    }
+    if (IsXsd(particle, "choice"))
+    {
+        end = NewNfaState();
+        for (child = FirstChild(particle); NULL != child; child = NextSibling(child))
+        {
+            if (!IsXsd(child, "annotation"))
+                AddNfaEdge(BuildParticle(child, start), end, EPSILON);
+        }
+        return end;
+    }
+    if (IsXsd(particle, "all"))
+        return BuildAll(particle, start);
+    Fail(particle, "Unsupported particle <%s>", particle->value.element.name);
+}
+
+/* Every subset of the already seen elements of an all group is a state of its own */
+static uint32_t BuildAll(mxml_node_t *all, uint32_t start)
+{
+    mxml_node_t *child, *members[MAX_ALL_PARTICLES];
+    uint32_t hubs[1 << MAX_ALL_PARTICLES];
+    uint32_t i, set, count = 0, required = 0, end;
+    int32_t min, max;
+    for (child = FirstChild(all); NULL != child; child = NextSibling(child))
+    {
+        if (IsXsd(child, "annotation"))
+            continue;
+        if (!IsXsd(child, "element") || MAX_ALL_PARTICLES <= count)
+            Fail(child, "All groups support up to %d elements", MAX_ALL_PARTICLES);
+        GetOccurs(child, &min, &max);
+        if (1 < max || UNBOUNDED == max)
+            Fail(child, "Elements of an all group may occur only once");
+        if (1 == min)
+            required |= 1u << count;
+        members[count++] = child;
+    }
+    hubs[0] = start;
+    for (set = 1; set < (1u << count); set++)
+        hubs[set] = NewNfaState();
+    end = NewNfaState();
+    for (set = 0; set < (1u << count); set++)
+    {
+        for (i = 0; i < count; i++)
+        {
+            if (0 == (set & (1u << i)))
+                AddNfaEdge(hubs[set], hubs[set | (1u << i)], GetElement(members[i]));
+        }
+        if (required == (set & required))
+            AddNfaEdge(hubs[set], end, EPSILON);
+    }
+    return end;
+}
+
+/* Subset construction followed by a minimization, the result is appended to the state table */
+static void BuildDfa(Element_t *element, uint32_t nfaStart, uint32_t nfaAccept)
+{
+    Array_t dfa = { 0 };        /* DfaState_t */
+    Array_t edges = { 0 };      /* SchemaTransition_t between DFA states, grouped by state */
+    uint32_t *classes, *next, *representative;
+    uint32_t i, j, k, current, classCount;
+    uint16_t label;
+    uint64_t *target;
+    bool changed;
+    SchemaState_t *state;
+    SchemaTransition_t *transition;
+    setWords = (nfaStates + 63) / 64;
+    target = calloc(setWords, sizeof(uint64_t));
+    if (NULL == target)
+        Fail(element->xsd, "Out of memory");
+    target[nfaStart / 64] |= 1ull << (nfaStart % 64);
+    CloseOverEpsilon(target);
+    FindOrAddDfaState(&dfa, target, nfaAccept);
+    for (current = 0; current < dfa.size; current++)
+    {
+        ((DfaState_t *)dfa.data)[current].firstEdge = edges.size;
+        /* Every element label leaving the set of NFA states gets one transition */
+        for (i = 0; i < nfaEdges.size; i++)
+        {
+            NfaEdge_t *edge = &((NfaEdge_t *)nfaEdges.data)[i];
+            uint64_t *set = ((DfaState_t *)dfa.data)[current].set;
+            if (EPSILON == edge->label || 0 == (set[edge->from / 64] & (1ull << (edge->from % 64))))
+                continue;
+            label = edge->label;
+            for (k = ((DfaState_t *)dfa.data)[current].firstEdge; k < edges.size; k++)
+            {
+                uint16_t other = ((SchemaTransition_t *)edges.data)[k].element;
+                if (other == label)
+                    break;
+                if (0 == strcmp(((Element_t *)elements.data)[other].name, ((Element_t *)elements.data)[label].name))
+                    Fail(element->xsd, "Content model of <%s> is ambiguous for <%s>", element->name,
+                        ((Element_t *)elements.data)[label].name);
+            }
+            if (k < edges.size)
+                continue;
+            memset(target, 0, setWords * sizeof(uint64_t));
+            for (j = 0; j < nfaEdges.size; j++)
+            {
+                NfaEdge_t *other = &((NfaEdge_t *)nfaEdges.data)[j];
+                if (label == other->label && 0 != (set[other->from / 64] & (1ull << (other->from % 64))))
+                    target[other->to / 64] |= 1ull << (other->to % 64);
+            }
+            CloseOverEpsilon(target);
+            j = FindOrAddDfaState(&dfa, target, nfaAccept);
+            transition = Push(&edges, sizeof(SchemaTransition_t));
+            transition->element = label;
+            transition->nextState = j;
+        }
+        ((DfaState_t *)dfa.data)[current].edgeCount = edges.size - ((DfaState_t *)dfa.data)[current].firstEdge;
+    }
+    /* Moore's partition refinement, states with equal transitions into the same classes are merged.
+     * The start state always ends up in class 0. */
+    classes = calloc(dfa.size, sizeof(uint32_t));
+    next = calloc(dfa.size, sizeof(uint32_t));
+    representative = calloc(dfa.size, sizeof(uint32_t));
+    if (NULL == classes || NULL == next || NULL == representative)
+        Fail(element->xsd, "Out of memory");
+    for (i = 0; i < dfa.size; i++)
+        classes[i] = ((DfaState_t *)dfa.data)[i].accepting == ((DfaState_t *)dfa.data)[0].accepting ? 0 : 1;
+    do
+    {
+        classCount = 0;
+        for (i = 0; i < dfa.size; i++)
+        {
+            for (j = 0; j < classCount; j++)
+            {
+                if (IsEquivalent(&dfa, &edges, classes, i, representative[j]))
+                    break;
+            }
+            if (j == classCount)
+                representative[classCount++] = i;
+            next[i] = j;
+        }
+        changed = (0 != memcmp(classes, next, dfa.size * sizeof(uint32_t)));
+        memcpy(classes, next, dfa.size * sizeof(uint32_t));
+    }
+    while (changed);
+    element->startState = states.size;
+    element->stateCount = classCount;
+    for (i = 0; i < classCount; i++)
+    {
+        DfaState_t *dfaState = &((DfaState_t *)dfa.data)[representative[i]];
+        state = Push(&states, sizeof(SchemaState_t));
+        state->firstTransition = transitions.size;
+        state->transitionCount = dfaState->edgeCount;
+        state->accepting = dfaState->accepting;
+        for (k = dfaState->firstEdge; k < dfaState->firstEdge + dfaState->edgeCount; k++)
+        {
+            SchemaTransition_t *edge = &((SchemaTransition_t *)edges.data)[k];
+            transition = Push(&transitions, sizeof(SchemaTransition_t));
+            transition->element = edge->element;
+            transition->nextState = element->startState + classes[edge->nextState];
+        }
+    }
+    for (i = 0; i < dfa.size; i++)
+        free(((DfaState_t *)dfa.data)[i].set);
+    free(dfa.data);
+    free(edges.data);
+    free(representative);
+    free(next);
+    free(classes);
+    free(target);
+}
+
+static bool IsEquivalent(Array_t *dfa, Array_t *edges, uint32_t *classes, uint32_t a, uint32_t b)
+{
+    uint32_t i, j;
+    DfaState_t *stateA = &((DfaState_t *)dfa->data)[a];
+    DfaState_t *stateB = &((DfaState_t *)dfa->data)[b];
+    if (classes[a] != classes[b] || stateA->edgeCount != stateB->edgeCount)
+        return false;
+    for (i = 0; i < stateA->edgeCount; i++)
+    {
+        SchemaTransition_t *edgeA = &((SchemaTransition_t *)edges->data)[stateA->firstEdge + i];
+        for (j = 0; j < stateB->edgeCount; j++)
+        {
+            SchemaTransition_t *edgeB = &((SchemaTransition_t *)edges->data)[stateB->firstEdge + j];
+            if (edgeA->element == edgeB->element)
+                break;
+        }
+        if (j == stateB->edgeCount)
+            return false;
+        if (classes[edgeA->nextState] != classes[((SchemaTransition_t *)edges->data)[stateB->firstEdge + j].nextState])
+            return false;
+    }
+    return true;
+}
+
+static void CloseOverEpsilon(uint64_t *set)
+{
+    uint32_t i;
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (i = 0; i < nfaEdges.size; i++)
+        {
+            NfaEdge_t *edge = &((NfaEdge_t *)nfaEdges.data)[i];
+            if (EPSILON == edge->label && 0 != (set[edge->from / 64] & (1ull << (edge->from % 64)))
+                && 0 == (set[edge->to / 64] & (1ull << (edge->to % 64))))
+            {
+                set[edge->to / 64] |= 1ull << (edge->to % 64);
+                changed = true;
+            }
+        }
+    }
+}
+
+static uint32_t FindOrAddDfaState(Array_t *dfa, uint64_t *set, uint32_t nfaAccept)
+{
+    uint32_t i;
+    DfaState_t *state;
+    for (i = 0; i < dfa->size; i++)
+    {
+        if (0 == memcmp(((DfaState_t *)dfa->data)[i].set, set, setWords * sizeof(uint64_t)))
+            return i;
+    }
+    state = Push(dfa, sizeof(DfaState_t));
+    state->set = malloc(setWords * sizeof(uint64_t));
+    if (NULL == state->set)
+        Fail(NULL, "Out of memory");
+    memcpy(state->set, set, setWords * sizeof(uint64_t));
+    state->accepting = (0 != (set[nfaAccept / 64] & (1ull << (nfaAccept % 64))));
+    return dfa->size - 1;
+}
+
+static void WriteTables(FILE *out, const char *xsdFileName)
+{
+    static const char *lexicals[] =
+    {
+        "SCHEMA_LEX_STRING", "SCHEMA_LEX_INTEGER", "SCHEMA_LEX_NUMBER",
+        "SCHEMA_LEX_BOOLEAN", "SCHEMA_LEX_HEX_DATA", "SCHEMA_LEX_NOT_BLANK"
+    };
+    uint32_t i, j;
+    const char *baseName = strrchr(xsdFileName, '/');
+    baseName = baseName ? baseName + 1 : xsdFileName;
+    fprintf(out, "/* Generated by xsd2c from %s, do not edit */\n\n", baseName);
+    fprintf(out, "#include <stddef.h>\n#include \"Xml2Schema.h\"\n\n");
+    for (i = 0; i < simpleTypes.size; i++)
+    {
+        SimpleType_t *type = &((SimpleType_t *)simpleTypes.data)[i];
+        if (NULL == type->enumeration)
+            continue;
+        fprintf(out, "static const char *const enumeration%u[] = { ", i);
+        for (j = 0; j < type->enumerationSize; j++)
+        {
+            WriteString(out, type->enumeration[j]);
+            fprintf(out, ", ");
+        }
+        fprintf(out, "NULL };\n");
+    }
+    fprintf(out, "\nstatic const SchemaSimpleType_t simpleTypes[] =\n{\n");
+    for (i = 0; i < simpleTypes.size; i++)
+    {
+        SimpleType_t *type = &((SimpleType_t *)simpleTypes.data)[i];
+        fprintf(out, "    { ");
+        WriteString(out, type->name);
+        fprintf(out, ", %s, ", lexicals[type->lexical]);
+        if (type->enumeration)
+            fprintf(out, "enumeration%u, ", i);
+        else
+            fprintf(out, "NULL, ");
+        fprintf(out, "%d, %d, %s, %s, ", type->minLength, type->maxLength,
+            type->hasMin ? "true" : "false", type->hasMax ? "true" : "false");
+        /* INT64_MIN can not be written as a literal */
+        if (INT64_MIN == type->minValue)
+            fprintf(out, "INT64_MIN, ");
+        else
+            fprintf(out, "INT64_C(%lld), ", (long long)type->minValue);
+        fprintf(out, "INT64_C(%lld) },\n", (long long)type->maxValue);
+    }
+    fprintf(out, "};\n\nstatic const SchemaAttribute_t attributes[] =\n{\n");
+    for (i = 0; i < attributes.size; i++)
+    {
+        SchemaAttribute_t *attr = &((SchemaAttribute_t *)attributes.data)[i];
+        fprintf(out, "    { ");
+        WriteString(out, attr->name);
+        fprintf(out, ", %u, %s },\n", attr->simpleType, attr->required ? "true" : "false");
+    }
+    if (0 == attributes.size)
+        fprintf(out, "    { NULL, 0, false },\n");
+    fprintf(out, "};\n\nstatic const SchemaTransition_t transitions[] =\n{\n");
+    for (i = 0; i < transitions.size; i++)
+    {
+        SchemaTransition_t *transition = &((SchemaTransition_t *)transitions.data)[i];
+        fprintf(out, "    { %u, %u },\n", transition->element, transition->nextState);
+    }
+    fprintf(out, "};\n\nstatic const SchemaState_t states[] =\n{\n");
+    for (i = 0; i < states.size; i++)
+    {
+        SchemaState_t *state = &((SchemaState_t *)states.data)[i];
+        fprintf(out, "    { %u, %u, %s },\n", state->firstTransition, state->transitionCount,
+            state->accepting ? "true" : "false");
+    }
+    fprintf(out, "};\n\nstatic const SchemaElement_t elements[] =\n{\n");
+    for (i = 0; i < elements.size; i++)
+    {
+        Element_t *element = &((Element_t *)elements.data)[i];
+        fprintf(out, "    { ");
+        WriteString(out, element->name);
+        fprintf(out, ", %u, %u, %u, %u, ", element->firstAttribute, element->attributeCount,
+            element->startState, element->stateCount);
+        if (SCHEMA_NONE == element->textType)
+            fprintf(out, "SCHEMA_NONE },\n");
+        else
+            fprintf(out, "%u },\n", element->textType);
+    }
+    fprintf(out, "};\n\nconst Schema_t %s =\n{\n", SCHEMA_VARIABLE);
+    fprintf(out, "    simpleTypes, %u,\n", simpleTypes.size);
+    fprintf(out, "    attributes, %u,\n", attributes.size);
+    fprintf(out, "    transitions, %u,\n", transitions.size);
+    fprintf(out, "    states, %u,\n", states.size);
+    fprintf(out, "    elements, %u,\n", elements.size);
+    fprintf(out, "    %u\n};\n", rootState);
+}
+
+static void WriteString(FILE *out, const char *text)
+{
+    fputc('"', out);
+    for (; '\0' != *text; text++)
+    {
+        if ('"' == *text || '\\' == *text)
+            fprintf(out, "\\%c", *text);
+        else if ((unsigned char)*text < 0x20)
+            fprintf(out, "\\%03o", (unsigned char)*text);
+        else
+            fputc(*text, out);
+    }
+    fputc('"', out);
+}